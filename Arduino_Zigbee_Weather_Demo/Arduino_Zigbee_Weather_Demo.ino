@@ -6,8 +6,10 @@
  * 1. Read indoor (SHT40)
  * 2. Report to Zigbee (triggers HA automation)
  * 3. Wait for HA to send OUT + Forecast
- * 4. Draw display once
- * 5. Deep sleep 5 min; wake also on touch panel INT (GPIO 4) for immediate update
+ * 4. Draw the page once (full, fast, partial or no refresh depending on what changed and the wake cause);
+ *    touch advances to the next page, a timer wake returns to the conditions page
+ * 5. When the readings changed, re-rasterize the pages they changed into the page cache (SPIFFS)
+ * 6. Deep sleep 5 min; wake also on touch panel INT (GPIO 4) for immediate update
  */
 
 #ifndef ZIGBEE_MODE_ED
@@ -17,7 +19,10 @@
 #include <Wire.h>
 #include <SPI.h>
 #include <esp_sleep.h>
+#include <time.h>
 #include <Preferences.h>
+#include <SPIFFS.h>
+#include <esp_app_desc.h>
 #include <Adafruit_SHT4x.h>
 #include "Zigbee.h"
 #include "Display_EPD_W21_spi.h"
@@ -34,8 +39,8 @@
 #define ZIGBEE_CONNECT_TIMEOUT_MS 10000u  /* If Zigbee fails to connect within 10s, continue without it */
 
 /* Sentinel values: HA did not send data; UI shows "---" for these. */
-#define OUT_TEMP_NO_DATA  999.0f   /* format shows --- when |temp| > 99.9 */
-#define OUT_HUM_NO_DATA   -1.0f    /* format shows --- when hum < 0 or > 100 */
+#define OUT_TEMP_NO_DATA  9990     /* tenths of °C; format shows --- when |temp| > 99.9 */
+#define OUT_HUM_NO_DATA   -1       /* format shows --- when hum < 0 or > 100 */
 #define OUT_WMO_NO_DATA   -1       /* no valid icon; fallback used */
 #define FC_TEMP_NO_DATA   100      /* format shows --- when |temp| > 99 */
 
@@ -57,11 +62,12 @@
 static Adafruit_SHT4x sht4 = Adafruit_SHT4x();
 static bool sht4_ready = false;
 
-static float current_in_temp_c = 21.5f;
-static float current_in_humidity = 45.0f;
+/* Temperatures in tenths of a degree C, humidity in whole percent (fixed point, see epd_ui.h). */
+static int16_t current_in_temp_dc = 215;
+static int current_in_humidity = 45;
 /* OUT/Forecast: "no data" until HA sends; UI shows "---" for these. */
-static float current_out_temp_c = OUT_TEMP_NO_DATA;
-static float current_out_humidity = OUT_HUM_NO_DATA;
+static int16_t current_out_temp_dc = OUT_TEMP_NO_DATA;
+static int current_out_humidity = OUT_HUM_NO_DATA;
 static int current_out_wmo = OUT_WMO_NO_DATA;
 static int current_last_update_hour = -1;   /* -1 = not received; else 0-23 */
 static int current_last_update_minute = -1; /* 0-59 */
@@ -73,6 +79,27 @@ static epd_ui_forecast_day_t current_forecast[3] = {
   { current_fc_date[2], OUT_WMO_NO_DATA, FC_TEMP_NO_DATA, FC_TEMP_NO_DATA },
 };
 
+/* Tile signature of the frame on the panel; survives deep sleep so unchanged wakes skip the refresh. */
+RTC_DATA_ATTR static epd_ui_frame_sig_t epd_frame_sig;
+
+/* Renderer state and the band buffer it draws into; rebuilt on every wake. */
+static unsigned char epd_band_buf[EPD_UI_BAND_BUFFER_SIZE];
+static epd_ui_ctx_t epd_ui;
+
+/* Page on the panel (epd_ui_page_t): touch advances it, a timer wake returns to the conditions page. */
+RTC_DATA_ATTR static uint8_t ui_page;
+/* For the diagnostics page; zero after power on. */
+RTC_DATA_ATTR static uint32_t diag_wakes;
+RTC_DATA_ATTR static uint32_t diag_last_wake_ms;
+RTC_DATA_ATTR static uint8_t diag_last_refresh;
+static epd_ui_diag_t ui_diag;
+/* Indoor readings of the last 24 h for the history page. Timestamps are time(NULL), which is never
+ * set: seconds of uptime, counted through deep sleep. Power loss clears both the clock and this
+ * ring; should only the clock restart, epd_ui_history_add() starts the ring over. */
+RTC_DATA_ATTR static epd_ui_history_t indoor_history;
+/* ui_data_hash() when the page cache was last brought up to date; zero after power on. */
+RTC_DATA_ATTR static uint32_t ui_data_sig;
+
 static ZigbeeTempSensor zbTempIn = ZigbeeTempSensor(ZIGBEE_IN_ENDPOINT);
 static ZigbeeAnalog zbTempOut = ZigbeeAnalog(ZIGBEE_OUT_ENDPOINT);
 static ZigbeeAnalog zbForecast1 = ZigbeeAnalog(ZIGBEE_FORECAST1_ENDPOINT);
@@ -83,11 +110,29 @@ static ZigbeeAnalog zbLastUpdateTime = ZigbeeAnalog(ZIGBEE_LAST_UPDATE_TIME_ENDP
 
 static Preferences prefs;
 
+/* Firmware before fixed-point readings saved OUT as floats ("out_temp" in °C, "out_hum" in %).
+ * Convert them to the deci-degree keys once, so OUT survives the update, and drop them. */
+static void prefs_migrate_out(void) {
+  if (!prefs.begin(PREFS_NS, false)) return;  /* read-write: the conversion writes */
+  if (prefs.isKey("out_temp")) {
+    if (!prefs.isKey("out_tdc")) {
+      const float t = prefs.getFloat("out_temp", OUT_TEMP_NO_DATA / 10.0f);
+      const float h = prefs.getFloat("out_hum", (float)OUT_HUM_NO_DATA);
+      prefs.putShort("out_tdc", (t > -100.0f && t < 100.0f) ? (int16_t)lroundf(t * 10.0f) : (int16_t)OUT_TEMP_NO_DATA);
+      prefs.putChar("out_rh", (h >= 0.0f && h <= 100.0f) ? (int8_t)lroundf(h) : (int8_t)OUT_HUM_NO_DATA);
+    }
+    prefs.remove("out_temp");
+    if (prefs.isKey("out_hum")) prefs.remove("out_hum");
+  }
+  prefs.end();
+}
+
 /* Load saved OUT and forecast from NVS; used when HA does not send data this wake. */
 static void prefs_load_weather(void) {
+  prefs_migrate_out();
   if (!prefs.begin(PREFS_NS, true)) return;  /* read-only for load */
-  current_out_temp_c = prefs.getFloat("out_temp", OUT_TEMP_NO_DATA);
-  current_out_humidity = prefs.getFloat("out_hum", OUT_HUM_NO_DATA);
+  current_out_temp_dc = prefs.getShort("out_tdc", OUT_TEMP_NO_DATA);
+  current_out_humidity = prefs.getChar("out_rh", OUT_HUM_NO_DATA);
   current_out_wmo = prefs.getInt("out_wmo", OUT_WMO_NO_DATA);
   current_last_update_hour = prefs.getInt("upd_hr", -1);
   current_last_update_minute = prefs.getInt("upd_min", -1);
@@ -119,8 +164,8 @@ static void prefs_load_weather(void) {
 
 static void prefs_save_out(void) {
   if (!prefs.begin(PREFS_NS, false)) return;
-  prefs.putFloat("out_temp", current_out_temp_c);
-  prefs.putFloat("out_hum", current_out_humidity);
+  prefs.putShort("out_tdc", current_out_temp_dc);
+  prefs.putChar("out_rh", (int8_t)current_out_humidity);
   prefs.putInt("out_wmo", current_out_wmo);
   prefs.putInt("upd_hr", current_last_update_hour);
   prefs.putInt("upd_min", current_last_update_minute);
@@ -159,11 +204,12 @@ static void prefs_save_forecast(int idx, int month, int day) {
   prefs.end();
 }
 
-/* HA packing: (temp*10+500)<<14 | Hum<<7 | Code. Temp -50.0..+50.0°C, 1 decimal. */
-static void decode_current_packed(uint32_t packed, float *out_temp_c, float *out_hum, int *out_wmo) {
+/* HA packing: (temp*10+500)<<14 | Hum<<7 | Code. Temp -50.0..+50.0°C, 1 decimal: the field is
+ * already tenths of a degree. */
+static void decode_current_packed(uint32_t packed, int16_t *out_temp_dc, int *out_hum, int *out_wmo) {
   if (out_wmo) *out_wmo = (int)(packed & 0x7Fu);
-  if (out_hum) *out_hum = (float)((packed >> 7u) & 0x7Fu);
-  if (out_temp_c) *out_temp_c = (float)(((int)((packed >> 14u) & 0x3FFu) - 500) / 10.0f);
+  if (out_hum) *out_hum = (int)((packed >> 7u) & 0x7Fu);
+  if (out_temp_dc) *out_temp_dc = (int16_t)((int)((packed >> 14u) & 0x3FFu) - 500);
 }
 
 /* FC packing (fits in float): WMO | (Tmin+35)<<7 | (Tmax+35)<<14. Temps -35..50 C. */
@@ -183,9 +229,9 @@ static void decode_forecast_date_packed(uint32_t packed, int *idx, int *month, i
 }
 
 static void onInOutPackedCurrent(uint32_t packed) {
-  decode_current_packed(packed, &current_out_temp_c, &current_out_humidity, &current_out_wmo);
+  decode_current_packed(packed, &current_out_temp_dc, &current_out_humidity, &current_out_wmo);
   prefs_save_out();
-  Serial.printf("OUT_TEMP received: %.1fC %.0f%% wmo=%d\n", current_out_temp_c, current_out_humidity, current_out_wmo);
+  Serial.printf("OUT_TEMP received: %d dC %d%% wmo=%d\n", current_out_temp_dc, current_out_humidity, current_out_wmo);
 }
 
 static void onForecastPackedData(int idx, uint32_t packed) {
@@ -216,7 +262,8 @@ static void onLastUpdateTimeReceived(uint32_t value) {
   Serial.printf("Last update time received: %s\n", current_last_update_str);
 }
 
-/* ZigbeeAnalog callbacks (float present value) */
+/* ZigbeeAnalog callbacks (float present value): the packed integers HA sends fit the float
+ * mantissa exactly, so the float ends here. */
 static void onTempOutPacked(float analog) {
   if (analog < 0.0f) return;
   onInOutPackedCurrent((uint32_t)lroundf(analog));
@@ -243,12 +290,13 @@ static void onLastUpdateTimePacked(float analog) {
   onLastUpdateTimeReceived((uint32_t)lroundf(analog));
 }
 
-static bool read_indoor_sensor(float *temp_c, float *hum_percent) {
+/* SHT40 through the Adafruit driver (float); rounded to tenths of a degree and whole percent here. */
+static bool read_indoor_sensor(int16_t *temp_dc, int *hum_percent) {
   if (!sht4_ready) return false;
   sensors_event_t humidity, temp;
   if (!sht4.getEvent(&humidity, &temp)) return false;
-  *temp_c = temp.temperature;
-  *hum_percent = humidity.relative_humidity;
+  *temp_dc = (int16_t)lroundf(temp.temperature * 10.0f);
+  *hum_percent = (int)lroundf(humidity.relative_humidity);
   return true;
 }
 
@@ -261,6 +309,110 @@ static const char *ui_time_or_blank(const char *time_str) {
 #endif
 }
 
+/* Page cache (epd_ui.h) on the SPIFFS partition: /page<N>.0 holds a page's index, /page<N>.1 its
+ * packed pixels. Parts are read in order and written front to back, so one file stays open between
+ * calls and is only reopened when the page, the part or the direction changes. */
+static File page_file;
+static int page_file_id = -1;  /* page * 2 + part of page_file, -1 = none */
+static bool page_file_writing = false;
+
+static void page_file_close(void) {
+  if (page_file) page_file.close();
+  page_file_id = -1;
+}
+
+static File *page_file_at(unsigned int page, unsigned int part, bool write, uint32_t offset) {
+  const int id = (int)(page * 2u + part);
+  if (write && offset == 0u) page_file_close();  /* the part starts anew */
+  if (id != page_file_id || write != page_file_writing) {
+    page_file_close();
+    char path[16];
+    snprintf(path, sizeof(path), "/page%u.%u", page, part);
+    if (!write && !SPIFFS.exists(path)) return NULL;
+    page_file = SPIFFS.open(path, write ? ((offset == 0u) ? FILE_WRITE : FILE_APPEND) : FILE_READ);
+    if (!page_file) return NULL;
+    page_file_id = id;
+    page_file_writing = write;
+  }
+  if (page_file.position() != offset && !page_file.seek(offset)) return NULL;
+  return &page_file;
+}
+
+static size_t page_store_read(void *, unsigned int page, unsigned int part, uint32_t offset, void *buf, size_t len) {
+  File *f = page_file_at(page, part, false, offset);
+  return f ? f->read((uint8_t *)buf, len) : 0u;
+}
+
+static size_t page_store_write(void *, unsigned int page, unsigned int part, uint32_t offset, const void *buf,
+                               size_t len) {
+  File *f = page_file_at(page, part, true, offset);
+  return f ? f->write((const uint8_t *)buf, len) : 0u;
+}
+
+static epd_ui_page_store_t page_store = { NULL, 0u, page_store_read, page_store_write };
+
+/* The page store once SPIFFS is mounted (formatted on first use), else NULL: no page cache. */
+static const epd_ui_page_store_t *page_store_begin(void) {
+  if (!SPIFFS.begin(true)) {
+    Serial.println("SPIFFS mount failed; pages are not cached.");
+    return NULL;
+  }
+  const uint8_t *sha = esp_app_get_description()->app_elf_sha256;
+  page_store.build_id = (uint32_t)sha[0] | ((uint32_t)sha[1] << 8) | ((uint32_t)sha[2] << 16) | ((uint32_t)sha[3] << 24);
+  return &page_store;
+}
+
+/* Hash of everything the cached pages show but the history: the readings, HA's data, the Zigbee
+ * warning and the firmware build (FNV-1a). */
+static uint32_t ui_data_hash(bool zigbee_ok, uint32_t build_id) {
+  uint32_t h = 2166136261u;
+  auto mix = [&h](const void *p, size_t n) {
+    for (size_t i = 0; i < n; i++) h = (h ^ ((const uint8_t *)p)[i]) * 16777619u;
+  };
+  const int32_t v[] = { current_in_temp_dc, current_in_humidity, current_out_temp_dc, current_out_humidity,
+                        current_out_wmo, zigbee_ok, (int32_t)build_id };
+  mix(v, sizeof(v));
+  mix(current_last_update_str, strlen(current_last_update_str));
+  for (unsigned int i = 0; i < 3u; i++) {
+    const int32_t f[] = { current_forecast[i].wmo_code, current_forecast[i].temp_min_c, current_forecast[i].temp_max_c };
+    mix(f, sizeof(f));
+    mix(current_forecast[i].date, strlen(current_forecast[i].date) + 1u);
+  }
+  return h;
+}
+
+/* Pages the page cache keeps: not the diagnostics page, whose wake counters change every wake. */
+static bool ui_page_cached(unsigned int p) {
+  return p != EPD_UI_PAGE_DIAGNOSTICS;
+}
+
+/* Build page p of the UI from the current readings into epd_ui's frame. The history page shows the
+ * newest sample and ends there, so it only changes when a sample is kept. */
+static void ui_build_page(unsigned int p, bool zigbee_ok) {
+  switch (p) {
+    case EPD_UI_PAGE_HISTORY: {
+      const epd_ui_sample_t *s = epd_ui_history_newest(&indoor_history);
+      if (s)
+        epd_ui_build_history_page(&epd_ui, s->temp_dc, s->humidity, &indoor_history, s->t);
+      else
+        epd_ui_build_history_page(&epd_ui, current_in_temp_dc, current_in_humidity, NULL, 0u);
+      break;
+    }
+    case EPD_UI_PAGE_FORECAST:
+      epd_ui_build_forecast_page(&epd_ui, current_forecast, current_last_update_str);
+      break;
+    case EPD_UI_PAGE_DIAGNOSTICS:
+      epd_ui_build_diagnostics_page(&epd_ui, &ui_diag);
+      break;
+    default:
+      epd_ui_build_demo_4g(&epd_ui,
+        current_in_temp_dc, current_in_humidity,
+        current_out_temp_dc, current_out_humidity, current_out_wmo, current_last_update_str,
+        ui_time_or_blank(""), current_forecast, !zigbee_ok);
+      break;
+  }
+}
+
 /** Returns true if Zigbee started and connected; false otherwise (continue with display using last known data). */
 static bool zigbee_init_receiver(void) {
   zbTempIn.setManufacturerAndModel("Espressif", "ZigbeeWeatherStationDemo");
@@ -329,6 +481,10 @@ static bool zigbee_init_receiver(void) {
 
 void setup() {
   Serial.begin(115200);
+  const esp_sleep_wakeup_cause_t wake_cause = esp_sleep_get_wakeup_cause();
+  const bool touch_wake = (wake_cause == ESP_SLEEP_WAKEUP_EXT1);
+  ui_page = touch_wake ? (uint8_t)((ui_page + 1u) % EPD_UI_PAGE_COUNT) : (uint8_t)EPD_UI_PAGE_CONDITIONS;
+  diag_wakes++;
 
   pinMode(EPD_BUSY_PIN, INPUT);
   pinMode(EPD_RST_PIN, OUTPUT);
@@ -350,36 +506,72 @@ void setup() {
   bool zigbee_ok = zigbee_init_receiver();
 
   /* 1. Read indoor */
-  float in_temp = current_in_temp_c;
-  float in_hum = current_in_humidity;
-  if (read_indoor_sensor(&in_temp, &in_hum)) {
-    current_in_temp_c = in_temp;
+  int16_t in_temp = current_in_temp_dc;
+  int in_hum = current_in_humidity;
+  const bool sensor_ok = read_indoor_sensor(&in_temp, &in_hum);
+  bool history_kept = false;
+  if (sensor_ok) {
+    current_in_temp_dc = in_temp;
     current_in_humidity = in_hum;
+    history_kept = epd_ui_history_add(&indoor_history, (uint32_t)time(NULL), in_temp, in_hum);
   }
 
   if (zigbee_ok) {
-    zbTempIn.setTemperature(current_in_temp_c);
+    zbTempIn.setTemperature(current_in_temp_dc / 10.0f);  /* Zigbee API takes °C as float */
     zbTempIn.setHumidity(current_in_humidity);
     zbTempIn.report();
     /* 2. Wait for HA to send OUT + Forecast (Zigbee callbacks update current_*) */
     delay(WAIT_FOR_HA_MS);
   }
 
-  /* 3. Draw display once */
+  /* 3. Draw the page once: from the page cache if it holds this content, else rasterized */
+  const epd_ui_page_store_t *store = page_store_begin();
+  ui_diag.wake_cause = touch_wake ? "touch" : (wake_cause == ESP_SLEEP_WAKEUP_TIMER) ? "timer" : "power on";
+  ui_diag.wakes = diag_wakes;
+  ui_diag.last_wake_ms = diag_last_wake_ms;
+  ui_diag.zigbee_ok = zigbee_ok;
+  ui_diag.sensor_ok = sensor_ok;
+  ui_diag.last_update = current_last_update_str;
+  ui_diag.last_refresh = diag_last_refresh;
+  ui_diag.partials = epd_frame_sig.partials;
+  ui_diag.cache_used_kb = store ? (uint16_t)(SPIFFS.usedBytes() / 1024u) : 0u;
+  ui_diag.cache_total_kb = store ? (uint16_t)(SPIFFS.totalBytes() / 1024u) : 0u;
+
   SPI.end();
   SPI.begin(EPD_SCK_PIN, EPD_MISO_PIN, EPD_MOSI_PIN);
   SPI.beginTransaction(SPISettings(10000000, MSBFIRST, SPI_MODE0));
-  EPD_HW_Init_4G();
-  const unsigned char *img = epd_ui_build_demo_4g(
-    current_in_temp_c, current_in_humidity,
-    current_out_temp_c, current_out_humidity, current_out_wmo, current_last_update_str,
-    ui_time_or_blank(""), 0.0f, current_forecast, !zigbee_ok);
-  EPD_WhiteScreen_ALL_4G(img);
+  epd_ui_ctx_init(&epd_ui, epd_band_buf);
+  ui_build_page(ui_page, zigbee_ok);
+  const bool cached = ui_page_cached(ui_page) && epd_ui_page_cache_open(&epd_ui, store, ui_page);
+  /* Touch wakes want an answer now: a fast 1-bit refresh (grays dithered) is fine for them. */
+  epd_ui_refresh_plan_t refresh;
+  epd_ui_plan_refresh(&epd_ui, &epd_frame_sig, touch_wake ? EPD_UI_PLAN_FAST_OK : 0u, &refresh);
+  Serial.printf("Display page %u%s refresh: %s (%s, %u tiles, %u windows)\n", ui_page, cached ? " (cached)" : "",
+                epd_ui_refresh_mode_name(refresh.mode), refresh.reason, refresh.changed_tiles, refresh.window_count);
+  epd_ui_apply_refresh(&epd_ui, &epd_frame_sig, &refresh);
+  diag_last_refresh = (uint8_t)refresh.mode;
+
+  /* 4. Keep the pages ready for the next touch, without wearing the flash: the history page once per
+   *    kept sample, the others when the readings or HA's data changed (the page on the panel first,
+   *    its frame is still built). */
+  if (store) {
+    const uint32_t data_sig = ui_data_hash(zigbee_ok, store->build_id);
+    for (unsigned int i = 0; i < EPD_UI_PAGE_COUNT; i++) {
+      const unsigned int p = (ui_page + i) % EPD_UI_PAGE_COUNT;
+      if (!ui_page_cached(p) || ((p == EPD_UI_PAGE_HISTORY) ? !history_kept : (data_sig == ui_data_sig))) continue;
+      if (p != ui_page) ui_build_page(p, zigbee_ok);
+      if (epd_ui_page_cache_update(&epd_ui, store, p)) Serial.printf("Page %u cached\n", p);
+    }
+    page_file_close();
+    ui_data_sig = data_sig;
+  }
 
   /* Small delay to allow display to update and print debug information */
   delay(100);
+  diag_last_wake_ms = millis();
+  Serial.printf("Boot to sleep: %lu ms\n", (unsigned long)diag_last_wake_ms);
 
-  /* 4. Deep sleep: wake on 5 min timer OR touch (INT on GPIO 4). On wake, setup() runs again. */
+  /* 5. Deep sleep: wake on 5 min timer OR touch (INT on GPIO 4). On wake, setup() runs again. */
   pinMode(TOUCH_INT_PIN, INPUT_PULLUP);   /* Idle high; touch pulls INT low -> wake */
   esp_sleep_enable_timer_wakeup((uint64_t)SLEEP_SECONDS * 1000000u);
   esp_sleep_enable_ext1_wakeup_io((1ULL << TOUCH_INT_PIN), ESP_EXT1_WAKEUP_ANY_LOW);
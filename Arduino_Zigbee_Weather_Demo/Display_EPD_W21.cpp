@@ -128,13 +128,15 @@ void EPD_HW_Init_4G(void)
     EPD_W21_WriteDATA((EPD_WIDTH - 1) % 256);
     EPD_W21_WriteDATA((EPD_WIDTH - 1) / 256);
     EPD_W21_WriteDATA(0x02);
+    // X and Y increment, same scan as EPD_Dis_Part: the 4G buffer (epd_ui.cpp) is stored
+    // top row first, so the Y flip is done here instead of in software.
     EPD_W21_WriteCMD(0x11);
-    EPD_W21_WriteDATA(0x02);
+    EPD_W21_WriteDATA(0x03);
     EPD_W21_WriteCMD(0x44);
-    EPD_W21_WriteDATA((EPD_HEIGHT - 1) % 256);
-    EPD_W21_WriteDATA((EPD_HEIGHT - 1) / 256);
     EPD_W21_WriteDATA(0x00);
     EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteDATA((EPD_HEIGHT - 1) % 256);
+    EPD_W21_WriteDATA((EPD_HEIGHT - 1) / 256);
     EPD_W21_WriteCMD(0x45);
     EPD_W21_WriteDATA(0x00);
     EPD_W21_WriteDATA(0x00);
@@ -242,7 +244,15 @@ void EPD_DeepSleep(void)
 void EPD_Dis_Part(unsigned int x_start, unsigned int y_start, const unsigned char *datas, unsigned int PART_COLUMN,
                   unsigned int PART_LINE)
 {
-    unsigned int i, x_end, y_end;
+    EPD_Dis_Part_Begin(x_start, y_start, PART_COLUMN, PART_LINE);
+    EPD_Dis_Part_Data(datas, PART_COLUMN * PART_LINE / 8);
+    EPD_Part_Update();
+}
+// EPD_Dis_Part in steps: Begin sets up the window and opens RAM 0x24, Data streams any number of
+// chunks (PART_COLUMN * PART_LINE / 8 bytes in total), EPD_Part_Update refreshes.
+void EPD_Dis_Part_Begin(unsigned int x_start, unsigned int y_start, unsigned int PART_COLUMN, unsigned int PART_LINE)
+{
+    unsigned int x_end, y_end;
     x_start = x_start - x_start % 8;
     x_end   = x_start + PART_LINE - 1;
     y_end   = y_start + PART_COLUMN - 1;
@@ -287,75 +297,66 @@ void EPD_Dis_Part(unsigned int x_start, unsigned int y_start, const unsigned cha
     EPD_W21_WriteDATA(y_start % 256);
     EPD_W21_WriteDATA(y_start / 256);
     EPD_W21_WriteCMD(0x24);
-    for (i = 0; i < PART_COLUMN * PART_LINE / 8; i++) {
-        EPD_W21_WriteDATA(datas[i]);
-    }
-    EPD_Part_Update();
 }
-
-unsigned char In2bytes_Out1byte_RAM1(unsigned char data1, unsigned char data2)
+void EPD_Dis_Part_Data(const unsigned char *datas, unsigned int len)
 {
     unsigned int i;
-    unsigned char TempData1, TempData2;
-    unsigned char outdata = 0x00;
-    TempData1             = data1;
-    TempData2             = data2;
-    for (i = 0; i < 4; i++) {
-        outdata = outdata << 1;
-        if (((TempData1 & 0xC0) == 0xC0) || ((TempData1 & 0xC0) == 0x40))
-            outdata = outdata | 0x01;
-        else
-            outdata = outdata | 0x00;
-        TempData1 = TempData1 << 2;
-    }
-    for (i = 0; i < 4; i++) {
-        outdata = outdata << 1;
-        if ((TempData2 & 0xC0) == 0xC0 || (TempData2 & 0xC0) == 0x40)
-            outdata = outdata | 0x01;
-        else
-            outdata = outdata | 0x00;
-        TempData2 = TempData2 << 2;
+    for (i = 0; i < len; i++) {
+        EPD_W21_WriteDATA(datas[i]);
     }
-    return outdata;
 }
-unsigned char In2bytes_Out1byte_RAM2(unsigned char data1, unsigned char data2)
+
+// Write panel rows y_start .. y_start + rows - 1 of both 4G planes (after EPD_HW_Init_4G; call
+// EPD_Update_4G once all rows are written). ram24, ram26: rows * EPD_HEIGHT / 8 bytes each.
+void EPD_Write_4G_Band(unsigned int y_start, unsigned int rows, const unsigned char *ram24,
+                       const unsigned char *ram26)
 {
-    unsigned int i;
-    unsigned char TempData1, TempData2;
-    unsigned char outdata = 0x00;
-    TempData1             = data1;
-    TempData2             = data2;
-    for (i = 0; i < 4; i++) {
-        outdata = outdata << 1;
-        if (((TempData1 & 0xC0) == 0xC0) || ((TempData1 & 0xC0) == 0x80))
-            outdata = outdata | 0x01;
-        else
-            outdata = outdata | 0x00;
-        TempData1 = TempData1 << 2;
+    unsigned int i, len = rows * (EPD_HEIGHT / 8);
+    EPD_W21_WriteCMD(0x4E);
+    EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteCMD(0x4F);
+    EPD_W21_WriteDATA(y_start % 256);
+    EPD_W21_WriteDATA(y_start / 256);
+    EPD_W21_WriteCMD(0x24);
+    for (i = 0; i < len; i++) {
+        EPD_W21_WriteDATA(ram24[i]);
     }
-    for (i = 0; i < 4; i++) {
-        outdata = outdata << 1;
-        if ((TempData2 & 0xC0) == 0xC0 || (TempData2 & 0xC0) == 0x80)
-            outdata = outdata | 0x01;
-        else
-            outdata = outdata | 0x00;
-        TempData2 = TempData2 << 2;
+    EPD_W21_WriteCMD(0x4E);
+    EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteCMD(0x4F);
+    EPD_W21_WriteDATA(y_start % 256);
+    EPD_W21_WriteDATA(y_start / 256);
+    EPD_W21_WriteCMD(0x26);
+    for (i = 0; i < len; i++) {
+        EPD_W21_WriteDATA(ram26[i]);
     }
-    return outdata;
 }
-void EPD_WhiteScreen_ALL_4G(const unsigned char *datas)
+// Write panel rows y_start .. y_start + rows - 1 of a 1-bit image (after EPD_HW_Init_Fast; call
+// EPD_Update_Fast once all rows are written), RAM 0x26 white as in EPD_WhiteScreen_ALL_Fast.
+// ram24: rows * EPD_HEIGHT / 8 bytes, 1 = white.
+void EPD_Write_Fast_Band(unsigned int y_start, unsigned int rows, const unsigned char *ram24)
 {
-    unsigned int i;
-    unsigned char tempOriginal;
+    unsigned int i, len = rows * (EPD_HEIGHT / 8);
+    EPD_W21_WriteCMD(0x4E);
+    EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteCMD(0x4F);
+    EPD_W21_WriteDATA(y_start % 256);
+    EPD_W21_WriteDATA(y_start / 256);
     EPD_W21_WriteCMD(0x24);
-    for (i = 0; i < EPD_ARRAY * 2; i += 2) {
-        tempOriginal = In2bytes_Out1byte_RAM1(*(datas + i), *(datas + i + 1));
-        EPD_W21_WriteDATA(~tempOriginal);
+    for (i = 0; i < len; i++) {
+        EPD_W21_WriteDATA(ram24[i]);
     }
+    EPD_W21_WriteCMD(0x4E);
+    EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteDATA(0x00);
+    EPD_W21_WriteCMD(0x4F);
+    EPD_W21_WriteDATA(y_start % 256);
+    EPD_W21_WriteDATA(y_start / 256);
     EPD_W21_WriteCMD(0x26);
-    for (i = 0; i < EPD_ARRAY * 2; i += 2) {
-        tempOriginal = In2bytes_Out1byte_RAM2(*(datas + i), *(datas + i + 1));
-        EPD_W21_WriteDATA(~tempOriginal);
+    for (i = 0; i < len; i++) {
+        EPD_W21_WriteDATA(0xff);
     }
-    EPD_Update_4G();
 }
@@ -15,6 +15,9 @@ void EPD_SetRAMValue_BaseMap(const unsigned char *datas);
 void EPD_Dis_PartAll(const unsigned char *datas);
 void EPD_Dis_Part(unsigned int x_start, unsigned int y_start, const unsigned char *datas, unsigned int PART_COLUMN,
                   unsigned int PART_LINE);
+void EPD_Dis_Part_Begin(unsigned int x_start, unsigned int y_start, unsigned int PART_COLUMN, unsigned int PART_LINE);
+void EPD_Dis_Part_Data(const unsigned char *datas, unsigned int len);
+void EPD_Part_Update(void);
 void EPD_Dis_Part_Time(unsigned int x_startA, unsigned int y_startA, const unsigned char *datasA, unsigned int x_startB,
                        unsigned int y_startB, const unsigned char *datasB, unsigned int x_startC, unsigned int y_startC,
                        const unsigned char *datasC, unsigned int x_startD, unsigned int y_startD,
@@ -22,7 +25,11 @@ void EPD_Dis_Part_Time(unsigned int x_startA, unsigned int y_startA, const unsig
                        const unsigned char *datasE, unsigned int PART_COLUMN, unsigned int PART_LINE);
 void EPD_HW_Init_Fast(void);
 void EPD_WhiteScreen_ALL_Fast(const unsigned char *datas);
+void EPD_Write_Fast_Band(unsigned int y_start, unsigned int rows, const unsigned char *ram24);
+void EPD_Update_Fast(void);
 void EPD_HW_Init_4G(void);
-void EPD_WhiteScreen_ALL_4G(const unsigned char *datas);
+void EPD_Write_4G_Band(unsigned int y_start, unsigned int rows, const unsigned char *ram24,
+                       const unsigned char *ram26);
+void EPD_Update_4G(void);
 
 #endif
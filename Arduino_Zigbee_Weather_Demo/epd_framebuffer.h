@@ -0,0 +1,249 @@
+/**
+ * Compile-time specialized framebuffer for E-ink panel RAM images.
+ * Framebuffer<W, H, Bpp, Layout, Orientation> wraps a W x H logical canvas of Bpp-bit pixels
+ * (panel RAM polarity, 0 = white). Layout and orientation are template constants, so byte
+ * index and bit shift fold to shifts and masks and the pixel/span loops carry no layout branches.
+ *
+ *   EPD_FB_COLUMN_MAJOR: one logical column (x) after another, rows y run along the bytes;
+ *                        this is panel X in data-entry mode 0x03 (see EPD_HW_Init_4G()).
+ *   EPD_FB_ROW_MAJOR:    one logical row after another, columns x run along the bytes.
+ *   EPD_FB_FLIP_Y:       rows stored bottom to top, for controllers that cannot scan the other way.
+ *
+ * PlanarFramebuffer<W, H, Planes, Layout, Orientation> keeps the same canvas as Planes 1-bit
+ * Framebuffers back to back, plane k holding bit k of every pixel: the layout of the controller's
+ * RAM planes (0x24 = bit 0, 0x26 = bit 1), so a frame is streamed without conversion.
+ * The 4G screen in epd_ui.cpp is PlanarFramebuffer<480, 800, 2, EPD_FB_COLUMN_MAJOR, EPD_FB_NATIVE>;
+ * one of its planes is the 1-bit EPD_WhiteScreen_ALL() image. Drawing may also leave the planes
+ * below `first` untouched: first = Planes - 1 renders the top bit alone, e.g. the ink a 1-bit
+ * partial update shows, at half the stores.
+ */
+#ifndef EPD_FRAMEBUFFER_H
+#define EPD_FRAMEBUFFER_H
+
+#include <stdint.h>
+#include <string.h>
+
+typedef enum {
+  EPD_FB_COLUMN_MAJOR = 0,
+  EPD_FB_ROW_MAJOR
+} epd_fb_layout_t;
+
+typedef enum {
+  EPD_FB_NATIVE = 0,
+  EPD_FB_FLIP_Y
+} epd_fb_orientation_t;
+
+template <unsigned int W, unsigned int H, unsigned int Bpp, epd_fb_layout_t Layout, epd_fb_orientation_t Orientation>
+struct Framebuffer {
+  static_assert(Bpp == 1u || Bpp == 2u || Bpp == 4u || Bpp == 8u, "Bpp must divide a byte");
+
+  static constexpr unsigned int kWidth = W;
+  static constexpr unsigned int kHeight = H;
+  static constexpr unsigned int kBpp = Bpp;
+  static constexpr unsigned int kPixelsPerByte = 8u / Bpp;
+  static constexpr unsigned int kPixelMask = (1u << Bpp) - 1u;
+  static constexpr unsigned int kLine = (Layout == EPD_FB_COLUMN_MAJOR) ? H : W;   /* pixels per stored line */
+  static constexpr unsigned int kLines = (Layout == EPD_FB_COLUMN_MAJOR) ? W : H;
+  static constexpr unsigned int kStride = kLine / kPixelsPerByte;                   /* bytes per stored line */
+  static constexpr unsigned int kSize = kStride * kLines;
+  static_assert(kLine % kPixelsPerByte == 0u, "stored lines must be whole bytes");
+
+  uint8_t *bits;
+
+  /* Physical row of logical row y. */
+  static constexpr unsigned int row(unsigned int y) {
+    return (Orientation == EPD_FB_FLIP_Y) ? (H - 1u) - y : y;
+  }
+  /* Stored line of (x, y) and position of the pixel along it. */
+  static constexpr unsigned int line(unsigned int x, unsigned int y) {
+    return (Layout == EPD_FB_COLUMN_MAJOR) ? x : row(y);
+  }
+  static constexpr unsigned int pos(unsigned int x, unsigned int y) {
+    return (Layout == EPD_FB_COLUMN_MAJOR) ? row(y) : x;
+  }
+  static constexpr unsigned int byte_index(unsigned int x, unsigned int y) {
+    return line(x, y) * kStride + pos(x, y) / kPixelsPerByte;
+  }
+  /* Shift of the pixel within its byte; the first pixel of a byte is the MSBs. */
+  static constexpr unsigned int shift(unsigned int x, unsigned int y) {
+    return 8u - Bpp - (pos(x, y) % kPixelsPerByte) * Bpp;
+  }
+  /* value repeated over a whole byte */
+  static constexpr uint8_t pattern(unsigned int value) {
+    return (uint8_t)(value * (0xFFu / kPixelMask));
+  }
+
+  void clear(unsigned int value) {
+    memset(bits, pattern(value), kSize);
+  }
+
+  void set(unsigned int x, unsigned int y, unsigned int value) {
+    if (x >= W || y >= H) return;
+    uint8_t *p = &bits[byte_index(x, y)];
+    const unsigned int s = shift(x, y);
+    *p = (uint8_t)((*p & ~(kPixelMask << s)) | (value << s));
+  }
+
+  /* OR value in (cheaper than set() when drawing ink over white). */
+  void merge(unsigned int x, unsigned int y, unsigned int value) {
+    if (x >= W || y >= H) return;
+    bits[byte_index(x, y)] |= (uint8_t)(value << shift(x, y));
+  }
+
+  /* set() for a pixel the caller has already clipped: no bounds check. */
+  void put(unsigned int x, unsigned int y, unsigned int value) {
+    uint8_t *p = &bits[byte_index(x, y)];
+    const unsigned int s = shift(x, y);
+    *p = (uint8_t)((*p & ~(kPixelMask << s)) | (value << s));
+  }
+
+  unsigned int get(unsigned int x, unsigned int y) const {
+    if (x >= W || y >= H) return 0u;
+    return (bits[byte_index(x, y)] >> shift(x, y)) & kPixelMask;
+  }
+
+  /* Fill logical pixels a..b (inclusive, in range) of stored line ln: masked head and tail
+   * bytes, whole bytes in between. a and b are positions along the line. */
+  void fill_line(unsigned int ln, unsigned int a, unsigned int b, unsigned int value) {
+    if (a > b) {
+      unsigned int t = a;
+      a = b;
+      b = t;
+    }
+    uint8_t *p = &bits[ln * kStride];
+    const uint8_t pat = pattern(value);
+    const unsigned int ha = a / kPixelsPerByte, hb = b / kPixelsPerByte;
+    const uint8_t head_mask = (uint8_t)(0xFFu >> ((a % kPixelsPerByte) * Bpp));        /* a .. end of byte */
+    const uint8_t tail_mask = (uint8_t)(0xFFu << (8u - Bpp - (b % kPixelsPerByte) * Bpp));  /* start .. b */
+    if (ha == hb) {
+      const uint8_t m = (uint8_t)(head_mask & tail_mask);
+      p[ha] = (uint8_t)((p[ha] & ~m) | (pat & m));
+      return;
+    }
+    p[ha] = (uint8_t)((p[ha] & ~head_mask) | (pat & head_mask));
+    if (hb > ha + 1u) memset(p + ha + 1u, pat, hb - ha - 1u);
+    p[hb] = (uint8_t)((p[hb] & ~tail_mask) | (pat & tail_mask));
+  }
+
+  /* Vertical span: logical rows y0..y1 (inclusive, in range) of column x. */
+  void fill_vspan(unsigned int x, unsigned int y0, unsigned int y1, unsigned int value) {
+    if (Layout == EPD_FB_COLUMN_MAJOR) {
+      fill_line(x, row(y0), row(y1), value);
+    } else {
+      const unsigned int s = shift(x, 0u);
+      const uint8_t m = (uint8_t)(kPixelMask << s), v = (uint8_t)(value << s);
+      for (unsigned int y = y0; y <= y1; y++) {
+        uint8_t *p = &bits[byte_index(x, y)];
+        *p = (uint8_t)((*p & ~m) | v);
+      }
+    }
+  }
+
+  /* Horizontal span: logical columns x0..x1 (inclusive, in range) of row y. */
+  void fill_hspan(unsigned int x0, unsigned int x1, unsigned int y, unsigned int value) {
+    if (Layout == EPD_FB_ROW_MAJOR) {
+      fill_line(row(y), x0, x1, value);
+    } else {
+      const unsigned int s = shift(0u, y);
+      const uint8_t m = (uint8_t)(kPixelMask << s), v = (uint8_t)(value << s);
+      uint8_t *p = &bits[byte_index(x0, y)];
+      for (unsigned int x = x0; x <= x1; x++, p += kStride)
+        *p = (uint8_t)((*p & ~m) | v);
+    }
+  }
+};
+
+template <unsigned int W, unsigned int H, unsigned int Planes, epd_fb_layout_t Layout, epd_fb_orientation_t Orientation>
+struct PlanarFramebuffer {
+  typedef Framebuffer<W, H, 1u, Layout, Orientation> plane_t;
+
+  static constexpr unsigned int kPlanes = Planes;
+  static constexpr unsigned int kPlaneSize = plane_t::kSize;
+  static constexpr unsigned int kSize = kPlaneSize * Planes;
+  static constexpr unsigned int kPixelMask = (1u << Planes) - 1u;
+
+  uint8_t *bits;
+  unsigned int first;  /* lowest plane drawn (0: all); planes below it are left as they are */
+
+  uint8_t *plane_bits(unsigned int k) const {
+    return bits + k * kPlaneSize;
+  }
+  plane_t plane(unsigned int k) const {
+    plane_t p = { plane_bits(k) };
+    return p;
+  }
+  /* The loops below run over all planes (a constant count, so they unroll) and skip the rest. */
+  bool drawn(unsigned int k) const {
+    return k >= first;
+  }
+
+  void clear(unsigned int value) {
+    for (unsigned int k = 0; k < Planes; k++)
+      if (drawn(k))
+        memset(plane_bits(k), ((value >> k) & 1u) ? 0xFF : 0x00, kPlaneSize);
+  }
+
+  void set(unsigned int x, unsigned int y, unsigned int value) {
+    if (x >= W || y >= H) return;
+    const unsigned int i = plane_t::byte_index(x, y);
+    const uint8_t m = (uint8_t)(1u << plane_t::shift(x, y));
+    for (unsigned int k = 0; k < Planes; k++) {
+      if (!drawn(k)) continue;
+      uint8_t *p = plane_bits(k) + i;
+      *p = ((value >> k) & 1u) ? (uint8_t)(*p | m) : (uint8_t)(*p & ~m);
+    }
+  }
+
+  /* OR value in (cheaper than set() when drawing ink over white). */
+  void merge(unsigned int x, unsigned int y, unsigned int value) {
+    if (x >= W || y >= H) return;
+    const unsigned int i = plane_t::byte_index(x, y);
+    const uint8_t m = (uint8_t)(1u << plane_t::shift(x, y));
+    for (unsigned int k = 0; k < Planes; k++)
+      if (drawn(k) && ((value >> k) & 1u)) plane_bits(k)[i] |= m;
+  }
+
+  /* set() for a pixel the caller has already clipped: no bounds check. */
+  void put(unsigned int x, unsigned int y, unsigned int value) {
+    const unsigned int i = plane_t::byte_index(x, y);
+    const uint8_t m = (uint8_t)(1u << plane_t::shift(x, y));
+    for (unsigned int k = 0; k < Planes; k++) {
+      if (!drawn(k)) continue;
+      uint8_t *p = plane_bits(k) + i;
+      *p = ((value >> k) & 1u) ? (uint8_t)(*p | m) : (uint8_t)(*p & ~m);
+    }
+  }
+
+  unsigned int get(unsigned int x, unsigned int y) const {
+    if (x >= W || y >= H) return 0u;
+    const unsigned int i = plane_t::byte_index(x, y), s = plane_t::shift(x, y);
+    unsigned int v = 0u;
+    for (unsigned int k = 0; k < Planes; k++)
+      if (drawn(k))
+        v |= ((plane_bits(k)[i] >> s) & 1u) << k;
+    return v;
+  }
+
+  /* Merge a 1-bit mask byte at byte index i of every plane: mask bits take value. */
+  void merge_mask(unsigned int i, uint8_t m, unsigned int value) {
+    for (unsigned int k = 0; k < Planes; k++) {
+      if (!drawn(k)) continue;
+      uint8_t *p = plane_bits(k) + i;
+      *p = ((value >> k) & 1u) ? (uint8_t)(*p | m) : (uint8_t)(*p & ~m);
+    }
+  }
+
+  void fill_vspan(unsigned int x, unsigned int y0, unsigned int y1, unsigned int value) {
+    for (unsigned int k = 0; k < Planes; k++)
+      if (drawn(k))
+        plane(k).fill_vspan(x, y0, y1, (value >> k) & 1u);
+  }
+
+  void fill_hspan(unsigned int x0, unsigned int x1, unsigned int y, unsigned int value) {
+    for (unsigned int k = 0; k < Planes; k++)
+      if (drawn(k))
+        plane(k).fill_hspan(x0, x1, y, (value >> k) & 1u);
+  }
+};
+
+#endif /* EPD_FRAMEBUFFER_H */
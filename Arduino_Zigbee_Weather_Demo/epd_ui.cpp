@@ -5,23 +5,35 @@
 
 #include "epd_ui.h"
 #include "Display_EPD_W21.h"
+#include "epd_framebuffer.h"
 #include "weather_icons/weather_icons_4g.h"
 #include "weather_icons/no_signal_4g.h"
 #include "fonts/gfxfont.h"
+#if EPD_UI_STATIC_LAYER
+#include "epd_ui_static_layer.h"
+#endif
 #if defined(ESP32) || defined(ARDUINO_ARCH_ESP32)
 #include <pgmspace.h>  /* ESP32: pgm_read_ptr reads 32-bit pointers from flash */
 #endif
-#include "fonts/InterBold72.h"
-#include "fonts/InterBold48.h"
+#include "fonts/InterBold72_rle.h"
+#include "fonts/InterBold48_rle.h"
 #include "fonts/InterRegular32.h"
 #include "fonts/SourceSans22.h"
 #include "fonts/Aktinson24.h"
 #include "fonts/InterRegular28.h"
 #include "fonts/InterBold14.h"
 #include "fonts/InterLabel14.h"
+#include "fonts/InterBold72_4g.h"
+#include "fonts/InterBold48_4g.h"
+#include "fonts/InterBold72_metrics.h"
+#include "fonts/InterBold48_metrics.h"
+#include "fonts/InterRegular32_metrics.h"
+#include "fonts/Aktinson24_metrics.h"
+#include "fonts/InterRegular28_metrics.h"
+#include "fonts/InterBold14_metrics.h"
+#include "fonts/InterLabel14_metrics.h"
 #include <stdio.h>
 #include <string.h>
-#include <math.h>
 #include <stdint.h>
 
 /* Read byte/word/dword from PROGMEM when not provided by Arduino. */
@@ -166,142 +178,329 @@ static void draw_string(unsigned char *buf, unsigned int buf_w, unsigned int buf
 #define BATTERY_BUF_SIZE  ((EPD_UI_BATTERY_REGION_W * EPD_UI_BATTERY_REGION_H) / 8)
 #define STATUS_BUF_SIZE   ((EPD_UI_STATUS_REGION_W * EPD_UI_STATUS_REGION_H) / 8)
 
-/* Full-screen 4G buffer: 96000 bytes. Panel may expect column-major (X=height, Y=width). */
-#define EPD_4G_BYTES_PER_COL  (200u)  /* 800/8*2 */
-static unsigned char epd_4g_buffer[EPD_UI_4G_BUFFER_SIZE];
+/* 4G band buffer (ctx->band): logical columns ctx->band_x .. + EPD_UI_BAND_COLS - 1 of the screen as
+ * the controller's two RAM planes: bit 0 of every pixel (RAM 0x24) then bit 1 (RAM 0x26). Each plane is
+ * column-major (each logical column x is one panel RAM row, 800 px of y top to bottom = panel X in
+ * EPD_HW_Init_4G()'s entry mode). Pixel values are in panel RAM polarity (0 = white .. 3 = black),
+ * so memset 0 is white and EPD_Write_4G_Band streams the planes as is. With EPD_UI_BAND_COLS = 480
+ * the band is the whole 96000-byte frame. An ink band (ctx->band_ink, for 1-bit partial updates)
+ * draws plane 1 alone and leaves plane 0 stale: dark gray and black are ink, light gray is white,
+ * and each column is already the panel row a partial update streams. */
+typedef PlanarFramebuffer<EPD_UI_BAND_COLS, EPD_HEIGHT, 2u, EPD_FB_COLUMN_MAJOR, EPD_FB_NATIVE> epd_fb_4g_t;
+typedef epd_fb_4g_t::plane_t epd_fb_plane_t;
+#define EPD_4G_BYTES_PER_COL  (epd_fb_plane_t::kStride)  /* per plane: 800/8 */
+static_assert(epd_fb_4g_t::kSize == EPD_UI_BAND_BUFFER_SIZE, "4G band buffer size");
+static_assert(EPD_WIDTH % EPD_UI_BAND_COLS == 0u && EPD_UI_BAND_COLS % EPD_UI_TILE_W == 0u,
+              "EPD_UI_BAND_COLS must divide the width and hold whole tiles");
+
+/* The band of ctx; ctx->band_x is its left column. Primitives draw in screen coordinates and clip
+ * to the active clip (below), which never leaves the band. band_render_4g() below fills the band
+ * from a display list. */
+static inline epd_fb_4g_t band_fb(const epd_ui_ctx_t *ctx) {
+  epd_fb_4g_t fb = { ctx->band, ctx->band_ink };
+  return fb;
+}
+
+/* ctx->dirty: boxes (logical coordinates) of display-list items (dl_dirty_4g) or changed tiles.
+ * Input to plan_part_windows(). */
+static void dirty_reset_4g(epd_ui_ctx_t *ctx) {
+  ctx->dirty_count = 0;
+}
+
+static epd_ui_rect_t rect_union(const epd_ui_rect_t *a, const epd_ui_rect_t *b) {
+  unsigned int x0 = (a->x < b->x) ? a->x : b->x;
+  unsigned int y0 = (a->y < b->y) ? a->y : b->y;
+  unsigned int x1 = (a->x + a->w > b->x + b->w) ? a->x + a->w : b->x + b->w;
+  unsigned int y1 = (a->y + a->h > b->y + b->h) ? a->y + a->h : b->y + b->h;
+  epd_ui_rect_t r = { (uint16_t)x0, (uint16_t)y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0) };
+  return r;
+}
+
+/* Overlap of a and b; w = 0 when they do not meet. */
+static epd_ui_rect_t rect_intersect(const epd_ui_rect_t *a, const epd_ui_rect_t *b) {
+  unsigned int x0 = (a->x > b->x) ? a->x : b->x;
+  unsigned int y0 = (a->y > b->y) ? a->y : b->y;
+  unsigned int x1 = (a->x + a->w < b->x + b->w) ? a->x + a->w : b->x + b->w;
+  unsigned int y1 = (a->y + a->h < b->y + b->h) ? a->y + a->h : b->y + b->h;
+  epd_ui_rect_t r = { 0u, 0u, 0u, 0u };
+  if (x0 >= x1 || y0 >= y1) return r;
+  r.x = (uint16_t)x0;
+  r.y = (uint16_t)y0;
+  r.w = (uint16_t)(x1 - x0);
+  r.h = (uint16_t)(y1 - y0);
+  return r;
+}
+
+/* True if b lies inside a. */
+static int rect_contains(const epd_ui_rect_t *a, const epd_ui_rect_t *b) {
+  return b->x >= a->x && b->y >= a->y && b->x + b->w <= a->x + a->w && b->y + b->h <= a->y + a->h;
+}
+
+/* Box (x, y, w, h) clipped to the screen; w = 0 when nothing is left. */
+static epd_ui_rect_t rect_clip_screen(int x, int y, int w, int h) {
+  epd_ui_rect_t r = { 0u, 0u, 0u, 0u };
+  if (w <= 0 || h <= 0) return r;
+  int x1 = x + w, y1 = y + h;
+  if (x < 0) x = 0;
+  if (y < 0) y = 0;
+  if (x1 > (int)EPD_WIDTH) x1 = (int)EPD_WIDTH;
+  if (y1 > (int)EPD_HEIGHT) y1 = (int)EPD_HEIGHT;
+  if (x >= x1 || y >= y1) return r;
+  r.x = (uint16_t)x;
+  r.y = (uint16_t)y;
+  r.w = (uint16_t)(x1 - x);
+  r.h = (uint16_t)(y1 - y);
+  return r;
+}
+
+/* Record a drawn box, clipped to the screen. When the list is full the box is merged into
+ * the entry whose area grows least, so the list stays a cover of everything drawn. */
+static void dirty_add_4g(epd_ui_ctx_t *ctx, int x, int y, int w, int h) {
+  epd_ui_rect_t r = rect_clip_screen(x, y, w, h);
+  if (r.w == 0u) return;
+  for (unsigned int i = 0; i < ctx->dirty_count; i++) {
+    const epd_ui_rect_t *d = &ctx->dirty[i];
+    if (r.x >= d->x && r.y >= d->y && r.x + r.w <= d->x + d->w && r.y + r.h <= d->y + d->h) return;
+  }
+  if (ctx->dirty_count < EPD_UI_DIRTY_MAX) {
+    ctx->dirty[ctx->dirty_count++] = r;
+    return;
+  }
+  unsigned int best = 0;
+  unsigned long best_growth = 0xFFFFFFFFul;
+  for (unsigned int i = 0; i < EPD_UI_DIRTY_MAX; i++) {
+    epd_ui_rect_t u = rect_union(&ctx->dirty[i], &r);
+    unsigned long growth = (unsigned long)u.w * u.h - (unsigned long)ctx->dirty[i].w * ctx->dirty[i].h;
+    if (growth < best_growth) {
+      best_growth = growth;
+      best = i;
+    }
+  }
+  ctx->dirty[best] = rect_union(&ctx->dirty[best], &r);
+}
+
+/* ctx->clip: clip rectangle of the 4G primitives. The active clip is the part of the band being
+ * rendered, narrowed by clip_push_4g(); a primitive intersects its extent with it once and then
+ * writes without per-pixel bounds checks. */
+
+/* Empty the stack; r (inside the band) becomes the active clip. */
+static void clip_reset_4g(epd_ui_ctx_t *ctx, const epd_ui_rect_t *r) {
+  ctx->clip.x0 = r->x;
+  ctx->clip.y0 = r->y;
+  ctx->clip.x1 = r->x + r->w;
+  ctx->clip.y1 = r->y + r->h;
+  ctx->clip_depth = 0;
+}
+
+/* Narrow the active clip to r until the matching clip_pop_4g(). Pushes past EPD_UI_CLIP_DEPTH
+ * leave the clip as it is. */
+static void clip_push_4g(epd_ui_ctx_t *ctx, const epd_ui_rect_t *r) {
+  if (ctx->clip_depth < EPD_UI_CLIP_DEPTH) {
+    epd_ui_clip_t *c = &ctx->clip;
+    ctx->clip_stack[ctx->clip_depth] = *c;
+    if (c->x0 < (int)r->x) c->x0 = r->x;
+    if (c->y0 < (int)r->y) c->y0 = r->y;
+    if (c->x1 > (int)(r->x + r->w)) c->x1 = r->x + r->w;
+    if (c->y1 > (int)(r->y + r->h)) c->y1 = r->y + r->h;
+  }
+  ctx->clip_depth++;
+}
+
+static void clip_pop_4g(epd_ui_ctx_t *ctx) {
+  if (ctx->clip_depth == 0u) return;
+  if (--ctx->clip_depth < EPD_UI_CLIP_DEPTH) ctx->clip = ctx->clip_stack[ctx->clip_depth];
+}
 
-/* Invert buffer so panel shows white background, black content. */
-#define EPD_UI_4G_INVERT     1
+/* Box (x, y, w, h) intersected with the active clip into *c; false when nothing is left. */
+static bool clip_box_4g(const epd_ui_ctx_t *ctx, int x, int y, int w, int h, epd_ui_clip_t *c) {
+  c->x0 = (x > ctx->clip.x0) ? x : ctx->clip.x0;
+  c->y0 = (y > ctx->clip.y0) ? y : ctx->clip.y0;
+  c->x1 = (x + w < ctx->clip.x1) ? x + w : ctx->clip.x1;
+  c->y1 = (y + h < ctx->clip.y1) ? y + h : ctx->clip.y1;
+  return c->x0 < c->x1 && c->y0 < c->y1;
+}
 
-/* 1 = column-major (each column 800px then next column); 0 = row-major. Fixes 5x repeat. */
-#define EPD_UI_4G_COLUMN_MAJOR  1
+/* Fill rectangle with 4-gray value (0=white .. 3=black), clipped once. */
+static void fill_rect_4g_value(epd_ui_ctx_t *ctx, unsigned int bx, unsigned int by, unsigned int w, unsigned int h,
+                               unsigned int value) {
+  epd_ui_clip_t c;
+  if (value > 3u || !clip_box_4g(ctx, (int)bx, (int)by, (int)w, (int)h, &c)) return;
+  epd_fb_4g_t fb = band_fb(ctx);
+  for (int x = c.x0; x < c.x1; x++)
+    fb.fill_vspan((unsigned int)x - ctx->band_x, (unsigned int)c.y0, (unsigned int)c.y1 - 1u, value);
+}
 
-/* When set (only during build_demo_4g), flip Y only so orientation matches HELLO but text reads L→R (not mirrored). */
-static uint8_t epd_ui_4g_flip_y = 0;
+/* Horizontal line from x0 to x1 inclusive at y: one byte per column. */
+static void draw_hline_4g_value(epd_ui_ctx_t *ctx, unsigned int x0, unsigned int x1, unsigned int y, unsigned int value) {
+  epd_ui_clip_t c;
+  if (value > 3u || x0 > x1 || !clip_box_4g(ctx, (int)x0, (int)y, (int)(x1 - x0 + 1u), 1, &c)) return;
+  band_fb(ctx).fill_hspan((unsigned int)c.x0 - ctx->band_x, (unsigned int)c.x1 - 1u - ctx->band_x, y, value);
+}
 
-static void set_pixel_4g(unsigned int x, unsigned int y) {
-  if (epd_ui_4g_flip_y) {
-    y = (EPD_HEIGHT - 1u) - y;
+/* Polyline through (xs[i], ys[i]), i < n, xs ascending, as one span of rows per column of a w
+ * column strip: top in spans[2c], bottom in spans[2c + 1]; columns it misses keep top > bottom.
+ * Instead of Bresenham's pixel steps each segment is walked a column at a time, and a column
+ * covers its own row through the row the segment reaches in the next one, so the line stays
+ * connected however steep it is. */
+static void polyline_spans(const uint16_t *xs, const uint8_t *ys, unsigned int n, uint8_t *spans, unsigned int w) {
+  for (unsigned int c = 0; c < w; c++) {
+    spans[2u * c] = 0xFFu;
+    spans[2u * c + 1u] = 0u;
+  }
+  for (unsigned int i = 0; i < n; i++) {
+    const int x0 = xs[i], y0 = ys[i];
+    const int x1 = (i + 1u < n) ? xs[i + 1u] : x0, y1 = (i + 1u < n) ? ys[i + 1u] : y0;
+    const int dx = x1 - x0, dy = y1 - y0;
+    for (int x = x0; x <= x1 && x < (int)w; x++) {
+      /* Rows at x and x + 1, rounded; the segment's last column only covers its end row. */
+      int ya = (dx > 0) ? y0 + (2 * dy * (x - x0) + (dy >= 0 ? dx : -dx)) / (2 * dx) : y0;
+      int yb = (dx > 0 && x < x1) ? y0 + (2 * dy * (x + 1 - x0) + (dy >= 0 ? dx : -dx)) / (2 * dx) : y1;
+      if (ya > yb) { const int t = ya; ya = yb; yb = t; }
+      uint8_t *sp = spans + 2u * (unsigned int)x;
+      if (ya < sp[0]) sp[0] = (uint8_t)ya;
+      if (yb > sp[1]) sp[1] = (uint8_t)yb;
+    }
   }
-  if (x >= EPD_WIDTH || y >= EPD_HEIGHT) return;
-  unsigned int byte_ix;
-  unsigned int nibble_shift;
-#if EPD_UI_4G_COLUMN_MAJOR
-  /* Column x, row y. 2 bytes per 8 pixels = 4 pixels (4 nibbles) per byte. */
-  unsigned int col_byte = (y / 8u) * 2u + ((y % 8u) / 4u);
-  byte_ix = x * EPD_4G_BYTES_PER_COL + col_byte;
-  /* Each byte has 4 nibbles (pixels): y%4 = 0,1,2,3 -> nibbles 0..3. */
-  nibble_shift = (y % 4u);
-#else
-  unsigned int group = y * 60u + (x / 8u);
-  byte_ix = group * 2u + ((x % 8u) / 4u);
-  nibble_shift = (x % 4u);
-#endif
-  epd_4g_buffer[byte_ix] |= (unsigned char)(3 << (6 - nibble_shift * 2));
-}
-
-/* Set one pixel in 4G buffer to 2-bit value (0=white .. 3=black). */
-static void set_pixel_4g_value(unsigned int x, unsigned int y, unsigned int value) {
-  if (value > 3u) return;
-  if (epd_ui_4g_flip_y) {
-    y = (EPD_HEIGHT - 1u) - y;
-  }
-  if (x >= EPD_WIDTH || y >= EPD_HEIGHT) return;
-  unsigned int byte_ix;
-  unsigned int nibble_shift;
-#if EPD_UI_4G_COLUMN_MAJOR
-  unsigned int col_byte = (y / 8u) * 2u + ((y % 8u) / 4u);
-  byte_ix = x * EPD_4G_BYTES_PER_COL + col_byte;
-  nibble_shift = (y % 4u);
-#endif
-  epd_4g_buffer[byte_ix] &= (unsigned char)(~(3u << (6 - nibble_shift * 2)));
-  epd_4g_buffer[byte_ix] |= (unsigned char)((value & 3u) << (6 - nibble_shift * 2));
 }
 
-/* Fill rectangle (all pixels black). */
-static void fill_rect_4g(unsigned int bx, unsigned int by, unsigned int w, unsigned int h) {
-  for (unsigned int dy = 0; dy < h; dy++)
-    for (unsigned int dx = 0; dx < w; dx++)
-      set_pixel_4g(bx + dx, by + dy);
+/* Column spans of a chart strip at (x, y), w x h: per column c the rows y + spans[2c] ..
+ * y + spans[2c + 1] (line), or those below it down to y + h - 1 (fill). Clipped per column, then
+ * one vspan each. */
+static void draw_spans_4g(epd_ui_ctx_t *ctx, int x, int y, unsigned int w, unsigned int h, const uint8_t *spans,
+                          bool fill, unsigned int value) {
+  epd_ui_clip_t c;
+  if (value > 3u || !clip_box_4g(ctx, x, y, (int)w, (int)h, &c)) return;
+  epd_fb_4g_t fb = band_fb(ctx);
+  for (int cx = c.x0; cx < c.x1; cx++) {
+    const uint8_t *sp = spans + 2u * (unsigned int)(cx - x);
+    if (sp[0] > sp[1]) continue;
+    int y0 = y + (fill ? sp[1] + 1 : sp[0]);
+    int y1 = fill ? y + (int)h : y + sp[1] + 1;
+    if (y0 < c.y0) y0 = c.y0;
+    if (y1 > c.y1) y1 = c.y1;
+    if (y0 < y1) fb.fill_vspan((unsigned int)cx - ctx->band_x, (unsigned int)y0, (unsigned int)y1 - 1u, value);
+  }
 }
 
-/* Fill rectangle with 4-gray value (0=white .. 3=black). */
-static void fill_rect_4g_value(unsigned int bx, unsigned int by, unsigned int w, unsigned int h, unsigned int value) {
-  if (value > 3u) return;
-  for (unsigned int dy = 0; dy < h; dy++)
-    for (unsigned int dx = 0; dx < w; dx++)
-      set_pixel_4g_value(bx + dx, by + dy, value);
+/* Pre-transposed 2bpp companions for the fonts whose digits dominate render time. */
+static const GFXfont4g *const gfxfont_4g_companions[] = {
+  &InterTempSemiBold72pt7b4g,
+  &InterTempSemiBold48pt7b4g,
+};
+
+static const GFXfont4g *gfxfont_4g_for(const GFXfont *font) {
+  for (unsigned int i = 0; i < sizeof(gfxfont_4g_companions) / sizeof(gfxfont_4g_companions[0]); i++) {
+    const GFXfont4g *f4 = gfxfont_4g_companions[i];
+    if ((const GFXfont *)pgm_read_ptr(&f4->base) == font) return f4;
+  }
+  return NULL;
+}
+
+/* Merge a pre-transposed glyph (w x h at logical x0, y0; rows inside the clip, columns clipped here).
+ * Each stored column is a 1-bit coverage mask from the glyph's top row; it is shifted by the
+ * destination pixel phase and merged into both planes a whole byte at a time. */
+static void blit_glyph_4g(epd_ui_ctx_t *ctx, const uint8_t *cols, unsigned int bytes_per_col, unsigned int w,
+                          unsigned int h, int x0, unsigned int y0, unsigned int gray_value) {
+  const unsigned int top = epd_fb_plane_t::byte_index(0u, y0);
+  const unsigned int r = 7u - epd_fb_plane_t::shift(0u, y0);  /* bit offset of the glyph's first pixel */
+  const unsigned int out_bytes = (r + h + 7u) / 8u;
+  epd_ui_clip_t c;
+  if (!clip_box_4g(ctx, x0, (int)y0, (int)w, (int)h, &c)) return;
+  epd_fb_4g_t fb = band_fb(ctx);
+  const unsigned int gx0 = (unsigned int)(c.x0 - x0), gx1 = (unsigned int)(c.x1 - x0);
+  for (unsigned int gx = gx0; gx < gx1; gx++) {
+    const uint8_t *src = cols + gx * bytes_per_col;
+    unsigned int dst = ((unsigned int)(x0 + (int)gx) - ctx->band_x) * EPD_4G_BYTES_PER_COL + top;
+    unsigned int carry = 0u;
+    for (unsigned int j = 0; j < out_bytes; j++) {
+      unsigned int b = (j < bytes_per_col) ? (unsigned int)pgm_read_byte(src + j) : 0u;
+      unsigned char m = (unsigned char)((b >> r) | carry);
+      carry = (b << (8u - r)) & 0xFFu;
+      if (m) fb.merge_mask(dst + j, m, gray_value);
+    }
+  }
 }
 
-/* 1-pixel rectangle outline. */
-static void draw_rect_outline_4g(unsigned int bx, unsigned int by, unsigned int w, unsigned int h) {
-  for (unsigned int dx = 0; dx < w; dx++) {
-    set_pixel_4g(bx + dx, by);
-    set_pixel_4g(bx + dx, by + h - 1u);
+/* Decode a GFXFONT_ENC_RLE_COL glyph (w columns at logical x0, y0): one vertical span per ink run,
+ * cut to the clip rows. Columns left of the clip are skipped over, decoding stops at its right edge. */
+static void draw_rle_glyph_4g(epd_ui_ctx_t *ctx, const uint8_t *src, unsigned int w, int x0, int y0,
+                              unsigned int gray_value) {
+  const int cx0 = ctx->clip.x0, cx1 = ctx->clip.x1, cy0 = ctx->clip.y0, cy1 = ctx->clip.y1;
+  epd_fb_4g_t fb = band_fb(ctx);
+  for (unsigned int gx = 0; gx < w; gx++) {
+    unsigned int runs = pgm_read_byte(src++);
+    int px = x0 + (int)gx;
+    if (px >= cx1) break;
+    if (px < cx0) {
+      src += runs * 2u;
+      continue;
+    }
+    int y = y0;
+    while (runs--) {
+      y += pgm_read_byte(src++);
+      int y1 = y + (int)pgm_read_byte(src++);  /* exclusive */
+      int ys = (y < cy0) ? cy0 : y;
+      int ye = (y1 > cy1) ? cy1 : y1;
+      if (ys < ye) fb.fill_vspan((unsigned int)px - ctx->band_x, (unsigned int)ys, (unsigned int)ye - 1u, gray_value);
+      y = y1;
+    }
+  }
+}
+
+/* Next codepoint of a UTF-8 string; ASCII takes one compare. */
+static inline uint32_t utf8_next(const char **s) {
+  const unsigned char c = (unsigned char)**s;
+  if (c < 0x80u) {
+    (*s)++;
+    return c;
   }
-  for (unsigned int dy = 0; dy < h; dy++) {
-    set_pixel_4g(bx, by + dy);
-    set_pixel_4g(bx + w - 1u, by + dy);
+  unsigned int n = 1u;
+  const uint32_t cp = gfx_utf8_decode(*s, &n);
+  *s += n;
+  return cp;
+}
+
+/* Glyph of a codepoint outside first..last from the font's cmap (binary search); NULL if the font
+ * has none. */
+static const GFXglyph *gfxfont_cmap_glyph(const GFXfont *font, const GFXglyph *glyph_base, uint32_t cp) {
+  const GFXcmap *cmap = (const GFXcmap *)pgm_read_ptr(&font->cmap);
+  unsigned int lo = 0u, hi = cmap ? pgm_read_word(&font->cmap_count) : 0u;
+  while (lo < hi) {
+    const unsigned int mid = (lo + hi) / 2u;
+    const uint32_t c = pgm_read_word(&cmap[mid].codepoint);
+    if (c == cp) return glyph_base + pgm_read_word(&cmap[mid].glyph);
+    if (c < cp) lo = mid + 1u;
+    else hi = mid;
   }
+  return NULL;
 }
 
-/* Horizontal line from x0 to x1 inclusive at y. */
-static void draw_hline_4g(unsigned int x0, unsigned int x1, unsigned int y) {
-  for (; x0 <= x1; x0++)
-    set_pixel_4g(x0, y);
-}
-
-/* Line from (x0,y0) to (x1,y1), 4-gray value (0=white .. 3=black). */
-static void draw_line_4g_value(int x0, int y0, int x1, int y1, unsigned int value) {
-  if (value > 3u) return;
-  int dx = (x1 >= x0) ? (x1 - x0) : (x0 - x1);
-  int dy = (y1 >= y0) ? (y1 - y0) : (y0 - y1);
-  int sx = (x0 < x1) ? 1 : -1;
-  int sy = (y0 < y1) ? 1 : -1;
-  int err = dx - dy;
-  for (;;) {
-    if ((unsigned int)x0 < EPD_WIDTH && (unsigned int)y0 < EPD_HEIGHT)
-      set_pixel_4g_value((unsigned int)x0, (unsigned int)y0, value);
-    if (x0 == x1 && y0 == y1) break;
-    int e2 = 2 * err;
-    if (e2 > -dy) { err -= dy; x0 += sx; }
-    if (e2 < dx)  { err += dx; y0 += sy; }
-  }
-}
-
-/* No-signal icon: 3 vertical bars (signal strength) with diagonal backslash through them. 2x size (40x48). */
-static void draw_no_signal_icon_4g(unsigned int bx, unsigned int by, unsigned int value) {
-  if (value > 3u) return;
-  /* 2x size: bars 12/24/36 tall, each 8px wide, 4px gap; bottom-aligned at by+40 */
-  const unsigned int bar_h1 = 12u, bar_h2 = 24u, bar_h3 = 36u;
-  const unsigned int bar_w = 8u, gap = 4u;
-  const unsigned int base_y = by + 40u;
-  const unsigned int icon_w = 40u, icon_h = 48u;
-  fill_rect_4g_value(bx,                  base_y - bar_h1, bar_w, bar_h1, value);
-  fill_rect_4g_value(bx + bar_w + gap,    base_y - bar_h2, bar_w, bar_h2, value);
-  fill_rect_4g_value(bx + 2u * (bar_w + gap), base_y - bar_h3, bar_w, bar_h3, value);
-  /* Thick backslash (3 lines) */
-  draw_line_4g_value((int)bx, (int)by, (int)(bx + icon_w), (int)(by + icon_h), value);
-  draw_line_4g_value((int)(bx + 1u), (int)by, (int)(bx + icon_w + 1u), (int)(by + icon_h), value);
-  draw_line_4g_value((int)(bx + 2u), (int)by, (int)(bx + icon_w + 2u), (int)(by + icon_h), value);
-}
-
-/* Degree symbol in InterRegular32 is at 0x2A (reused from *). */
-static const char degree_c[] = "\x2A";
-
-/* Draw a GFX font string into 4G buffer at baseline (x, y). gray_value 0=white, 3=black, 1/2=gray. */
-static void draw_gfxfont_string_4g(int x_baseline, int y_baseline, const char *str,
+/* Draw a UTF-8 GFX font string into 4G buffer at baseline (x, y). gray_value 0=white, 3=black, 1/2=gray.
+ * Glyphs baked into a 2bpp companion take the byte path, RLE fonts fill one span per run,
+ * plain Adafruit bitmaps are decoded bit by bit. */
+static void draw_gfxfont_string_4g(epd_ui_ctx_t *ctx, int x_baseline, int y_baseline, const char *str,
                                    const GFXfont *font, unsigned int gray_value) {
   if (!str || !font || gray_value > 3u) return;
   const uint8_t *bitmap = (const uint8_t *)pgm_read_ptr(&font->bitmap);
   const GFXglyph *glyph_base = (const GFXglyph *)pgm_read_ptr(&font->glyph);
   uint8_t first = pgm_read_byte(&font->first);
   uint8_t last = pgm_read_byte(&font->last);
+  uint8_t encoding = pgm_read_byte(&font->encoding);
+  const GFXfont4g *font4g = gfxfont_4g_for(font);
+  const uint8_t *bitmap4g = NULL;
+  const GFXglyph4g *glyph4g_base = NULL;
+  uint8_t first4g = 1u, last4g = 0u;
+  if (font4g) {
+    bitmap4g = (const uint8_t *)pgm_read_ptr(&font4g->bitmap);
+    glyph4g_base = (const GFXglyph4g *)pgm_read_ptr(&font4g->glyph);
+    first4g = pgm_read_byte(&font4g->first);
+    last4g = pgm_read_byte(&font4g->last);
+  }
   int x = x_baseline;
   while (*str) {
-    unsigned char c = (unsigned char)*str++;
-    if (c < first || c > last) continue;
-    const GFXglyph *glyph = glyph_base + (c - first);
+    const uint32_t c = utf8_next(&str);
+    const GFXglyph *glyph = (c >= first && c <= last) ? glyph_base + (c - first) : gfxfont_cmap_glyph(font, glyph_base, c);
+    if (!glyph) continue;
     uint16_t bitmapOffset = pgm_read_word(&glyph->bitmapOffset);
     uint8_t w = pgm_read_byte(&glyph->width);
     uint8_t h = pgm_read_byte(&glyph->height);
@@ -312,268 +511,240 @@ static void draw_gfxfont_string_4g(int x_baseline, int y_baseline, const char *s
       x += (int)xAdv;
       continue;
     }
-    /* Adafruit GFX format: row-major bits, 8 pixels per byte, MSB = left. bitIndex = x + width*y */
-    unsigned int bytes_per_row = (unsigned int)((w + 7) / 8);
     int base_x = x + (int)xOff;
     int base_y = y_baseline + (int)yOff;
-    for (unsigned int gy = 0; gy < (unsigned int)h; gy++) {
-      for (unsigned int gx = 0; gx < (unsigned int)w; gx++) {
-        unsigned int bit_index = gx + (unsigned int)w * gy;
-        unsigned int byte_ix = bitmapOffset + (bit_index >> 3u);
-        unsigned char byte_val = pgm_read_byte(bitmap + byte_ix);
-        if (byte_val & (0x80u >> (bit_index & 7u))) {
-          int px = base_x + (int)gx;
-          int py = base_y + (int)gy;
-          if (px >= 0 && py >= 0 && (unsigned int)px < EPD_WIDTH && (unsigned int)py < EPD_HEIGHT)
-            set_pixel_4g_value((unsigned int)px, (unsigned int)py, gray_value);
-        }
+    epd_ui_clip_t gc;  /* glyph box inside the clip */
+    if (!clip_box_4g(ctx, base_x, base_y, (int)w, (int)h, &gc)) {
+      x += (int)xAdv;
+      continue;
+    }
+    if (c >= first4g && c <= last4g && gc.y0 == base_y && gc.y1 == base_y + (int)h) {
+      const GFXglyph4g *g4 = glyph4g_base + (c - first4g);
+      unsigned int bpc = pgm_read_byte(&g4->bytes_per_col);
+      if (bpc) {
+        blit_glyph_4g(ctx, bitmap4g + pgm_read_word(&g4->offset), bpc, w, h, base_x, (unsigned int)base_y, gray_value);
+        x += (int)xAdv;
+        continue;
+      }
+    }
+    if (encoding == GFXFONT_ENC_RLE_COL) {
+      draw_rle_glyph_4g(ctx, bitmap + bitmapOffset, w, base_x, base_y, gray_value);
+      x += (int)xAdv;
+      continue;
+    }
+    /* Adafruit GFX format: row-major bits, 8 pixels per byte, MSB = left. bitIndex = x + width*y.
+     * Only the part of the glyph inside the clip is walked. */
+    for (int py = gc.y0; py < gc.y1; py++) {
+      for (int px = gc.x0; px < gc.x1; px++) {
+        unsigned int bit_index = (unsigned int)(px - base_x) + (unsigned int)w * (unsigned int)(py - base_y);
+        unsigned char byte_val = pgm_read_byte(bitmap + bitmapOffset + (bit_index >> 3u));
+        if (byte_val & (0x80u >> (bit_index & 7u)))
+          band_fb(ctx).put((unsigned int)px - ctx->band_x, (unsigned int)py, gray_value);
       }
     }
     x += (int)xAdv;
   }
 }
 
-/* Return total xAdvance of string in pixels for a GFX font (for right-align). */
-static unsigned int gfxfont_string_width(const char *str, const GFXfont *font) {
-  if (!str || !font) return 0u;
-  const GFXglyph *glyph_base = (const GFXglyph *)pgm_read_ptr(&font->glyph);
-  uint8_t first = pgm_read_byte(&font->first);
-  uint8_t last = pgm_read_byte(&font->last);
+/* Total xAdvance of a runtime UTF-8 string (for right-align / centering): digits from the font's
+ * digit table, anything else from its advance table or cmap. Literals use gfxmetrics_width() at
+ * compile time. */
+static unsigned int text_width(const char *str, const GFXmetrics &m) {
   unsigned int w = 0u;
   while (*str) {
-    unsigned char c = (unsigned char)*str++;
-    if (c >= first && c <= last)
-      w += (unsigned int)pgm_read_byte(&glyph_base[c - first].xAdvance);
+    const uint32_t c = utf8_next(&str);
+    w += (c - '0' < 10u) ? m.digit[c - '0'] : gfxmetrics_advance(m, c);
   }
   return w;
 }
 
-/* Draw string vertically (one character per line, stacked). Uses 8x scale. */
-static void draw_string_4g_vertical_8x(unsigned int base_x, unsigned int base_y, const char *str) {
-  if (!str) return;
-  unsigned int py = base_y;
+/* Ink extent of a UTF-8 GFX font string drawn at baseline (x, y), clipped to the screen (w = 0: no ink). */
+static epd_ui_rect_t gfxfont_string_ink(int x_baseline, int y_baseline, const char *str, const GFXfont *font) {
+  const GFXglyph *glyph_base = (const GFXglyph *)pgm_read_ptr(&font->glyph);
+  uint8_t first = pgm_read_byte(&font->first);
+  uint8_t last = pgm_read_byte(&font->last);
+  int x = x_baseline;
+  int ink_x0 = 0x7FFF, ink_y0 = 0x7FFF, ink_x1 = -0x7FFF, ink_y1 = -0x7FFF;
   while (*str) {
-    int idx = char_to_index(*str++);
-    const unsigned char *col = font_6x8[idx];
-    for (unsigned int cx = 0; cx < FONT_W; cx++) {
-      for (unsigned int ry = 0; ry < FONT_H; ry++) {
-        if ((col[cx] >> ry) & 1) {
-          unsigned int bx = base_x + cx * 8u, by = py + ry * 8u;
-          for (unsigned int dy = 0; dy < 8u; dy++)
-            for (unsigned int dx = 0; dx < 8u; dx++)
-              set_pixel_4g(bx + dx, by + dy);
-        }
-      }
+    const uint32_t c = utf8_next(&str);
+    const GFXglyph *glyph = (c >= first && c <= last) ? glyph_base + (c - first) : gfxfont_cmap_glyph(font, glyph_base, c);
+    if (!glyph) continue;
+    uint8_t w = pgm_read_byte(&glyph->width);
+    uint8_t h = pgm_read_byte(&glyph->height);
+    if (w != 0 && h != 0) {
+      int base_x = x + (int)(int8_t)pgm_read_byte(&glyph->xOffset);
+      int base_y = y_baseline + (int)(int8_t)pgm_read_byte(&glyph->yOffset);
+      if (base_x < ink_x0) ink_x0 = base_x;
+      if (base_y < ink_y0) ink_y0 = base_y;
+      if (base_x + (int)w > ink_x1) ink_x1 = base_x + (int)w;
+      if (base_y + (int)h > ink_y1) ink_y1 = base_y + (int)h;
     }
-    py += (unsigned int)(FONT_H * 8u) + 8u;
+    x += (int)pgm_read_byte(&glyph->xAdvance);
   }
-}
-
-/* Battery: 54x32, 2px outline, nub, number centered. Left side. 4-gray value 2 (dark gray). */
-#define EPD_UI_BATTERY_GRAY  2u   /* 0=white, 1=light gray, 2=dark gray, 3=black */
-static void draw_battery_icon_4g(unsigned int bx, unsigned int by, float percent) {
-  const unsigned int w = EPD_UI_BATTERY_ICON_W;
-  const unsigned int h = EPD_UI_BATTERY_ICON_H;
-  const unsigned int t = 2u;  /* outline thickness */
-  const unsigned int v = EPD_UI_BATTERY_GRAY;
-  /* 2px outline: top, bottom, left, right */
-  fill_rect_4g_value(bx, by, w, t, v);
-  fill_rect_4g_value(bx, by + h - t, w, t, v);
-  fill_rect_4g_value(bx, by, t, h, v);
-  fill_rect_4g_value(bx + w - t, by, t, h, v);
-  /* Nub on right, 2px wide */
-  for (unsigned int dx = 0; dx < 2u; dx++)
-    for (unsigned int dy = 6u; dy < h - 6u; dy++)
-      set_pixel_4g_value(bx + w + dx, by + dy, v);
-  /* Number centered in inner area */
-  char str[8];
-  int p = (percent <= 0) ? 0 : (percent >= 100) ? 100 : (int)(percent + 0.5f);
-  (void)snprintf(str, sizeof(str), "%d", p);
-  unsigned int str_w = gfxfont_string_width(str, &InterTempSemiBold14pt7b);
-  unsigned int inner_w = w - 2u * t;
-  int tx = (int)bx + (int)t + (int)((inner_w > str_w) ? (inner_w - str_w) / 2u : 0u);
-  int ty = (int)by + 26;
-  draw_gfxfont_string_4g(tx, ty, str, &InterTempSemiBold14pt7b, v);
-}
-
-static void draw_string_4g(unsigned int base_x, unsigned int base_y, const char *str) {
-  if (!str) return;
-  unsigned int px = base_x, py = base_y;
-  while (*str) {
-    int idx = char_to_index(*str++);
-    const unsigned char *col = font_6x8[idx];
-    for (unsigned int cx = 0; cx < FONT_W; cx++) {
-      for (unsigned int ry = 0; ry < FONT_H; ry++) {
-        if ((col[cx] >> ry) & 1)
-          set_pixel_4g(px + cx, py + ry);
+  return rect_clip_screen(ink_x0, ink_y0, ink_x1 - ink_x0, ink_y1 - ink_y0);
+}
+
+/* Even bits of a 16-bit word (bit 2j -> bit j): one RAM plane of 8 packed 2bpp pixels. */
+static inline uint8_t icon_plane_bits(unsigned int v) {
+  v &= 0x5555u;
+  v = (v | (v >> 1)) & 0x3333u;
+  v = (v | (v >> 2)) & 0x0F0Fu;
+  return (uint8_t)((v | (v >> 4)) & 0x00FFu);
+}
+
+static inline void store_masked(uint8_t *p, uint8_t m, uint8_t v) {
+  *p = (uint8_t)((*p & ~m) | (v & m));
+}
+
+static_assert(epd_fb_plane_t::row(0u) == 0u && epd_fb_plane_t::byte_index(1u, 0u) == EPD_4G_BYTES_PER_COL,
+              "icon blitter expects native, column-major planes");
+
+/* Rows row0..rows-1 of one 4G icon column (bytes_per_col bytes) into screen column x of the band,
+ * icon row 0 at base_y, white pixels included. Icon columns and RAM plane rows run the same way,
+ * so each pair of icon bytes (8 rows) is split into one byte per plane and stored whole when
+ * base_y is 8-aligned, else shifted across two bytes and stored under a mask; rows clipped off
+ * the top are masked out of their first byte. */
+static void blit_4g_icon_column(epd_ui_ctx_t *ctx, const unsigned char *src, unsigned int bytes_per_col,
+                                unsigned int row0, unsigned int rows, unsigned int x, unsigned int base_y) {
+  const unsigned int r = 7u - epd_fb_plane_t::shift(0u, base_y);  /* bit offset of the icon's first row */
+  const unsigned int dst = (x - ctx->band_x) * EPD_4G_BYTES_PER_COL + epd_fb_plane_t::byte_index(0u, base_y);
+  const epd_fb_4g_t fb = band_fb(ctx);
+  uint8_t *plane0 = fb.drawn(0u) ? fb.plane_bits(0u) + dst : NULL, *plane1 = fb.plane_bits(1u) + dst;
+  for (unsigned int y = row0 & ~7u, j = row0 / 8u; y < rows; y += 8u, j++) {
+    const unsigned int n = (rows - y < 8u) ? rows - y : 8u;
+    unsigned int v = (unsigned int)src[2u * j] << 8;
+    if (2u * j + 1u < bytes_per_col) v |= src[2u * j + 1u];
+    const uint8_t b0 = icon_plane_bits(v), b1 = icon_plane_bits(v >> 1);
+    uint8_t m = (uint8_t)(0xFF00u >> n);
+    if (y < row0) m &= (uint8_t)(0xFFu >> (row0 - y));
+    if (r == 0u) {
+      if (m == 0xFFu) {
+        if (plane0) plane0[j] = b0;
+        plane1[j] = b1;
+      } else {
+        if (plane0) store_masked(plane0 + j, m, b0);
+        store_masked(plane1 + j, m, b1);
       }
+      continue;
     }
-    px += FONT_W + 1;
-  }
-}
-
-/* Draw string at 2x scale (black on white). */
-static void draw_string_4g_scaled(unsigned int base_x, unsigned int base_y, const char *str) {
-  if (!str) return;
-  unsigned int px = base_x, py = base_y;
-  while (*str) {
-    int idx = char_to_index(*str++);
-    const unsigned char *col = font_6x8[idx];
-    for (unsigned int cx = 0; cx < FONT_W; cx++) {
-      for (unsigned int ry = 0; ry < FONT_H; ry++) {
-        if ((col[cx] >> ry) & 1) {
-          set_pixel_4g(px + cx * 2u,     py + ry * 2u);
-          set_pixel_4g(px + cx * 2u + 1u, py + ry * 2u);
-          set_pixel_4g(px + cx * 2u,     py + ry * 2u + 1u);
-          set_pixel_4g(px + cx * 2u + 1u, py + ry * 2u + 1u);
-        }
-      }
+    if (plane0) store_masked(plane0 + j, (uint8_t)(m >> r), (uint8_t)(b0 >> r));
+    store_masked(plane1 + j, (uint8_t)(m >> r), (uint8_t)(b1 >> r));
+    const uint8_t m2 = (uint8_t)(m << (8u - r));
+    if (m2) {
+      if (plane0) store_masked(plane0 + j + 1u, m2, (uint8_t)(b0 << (8u - r)));
+      store_masked(plane1 + j + 1u, m2, (uint8_t)(b1 << (8u - r)));
     }
-    px += (FONT_W + 1) * 2u;
   }
 }
 
-/* Draw string at 4x scale: each font pixel -> 4x4 block (height 32px to match battery). */
-static void draw_string_4g_scaled_4x(unsigned int base_x, unsigned int base_y, const char *str) {
-  if (!str) return;
-  unsigned int px = base_x, py = base_y;
-  while (*str) {
-    int idx = char_to_index(*str++);
-    const unsigned char *col = font_6x8[idx];
-    for (unsigned int cx = 0; cx < FONT_W; cx++) {
-      for (unsigned int ry = 0; ry < FONT_H; ry++) {
-        if ((col[cx] >> ry) & 1) {
-          unsigned int bx = px + cx * 4u, by = py + ry * 4u;
-          for (unsigned int dy = 0; dy < 4u; dy++)
-            for (unsigned int dx = 0; dx < 4u; dx++)
-              set_pixel_4g(bx + dx, by + dy);
-        }
-      }
+/* 4G icon: column-major, (icon_w x icon_h). Blit the part inside the clip into the 4G buffer at
+ * (base_x, base_y), a column at a time. */
+static void blit_4g_icon_to_4g(epd_ui_ctx_t *ctx, const unsigned char *icon_4g, unsigned int base_x,
+                               unsigned int base_y, unsigned int icon_w, unsigned int icon_h) {
+  unsigned int bytes_per_col = ((icon_h - 1u) / 8u) * 2u + ((icon_h - 1u) % 8u) / 4u + 1u;
+  epd_ui_clip_t c;
+  if (!clip_box_4g(ctx, (int)base_x, (int)base_y, (int)icon_w, (int)icon_h, &c)) return;
+  for (int x = c.x0; x < c.x1; x++)
+    blit_4g_icon_column(ctx, icon_4g + ((unsigned int)x - base_x) * bytes_per_col, bytes_per_col,
+                        (unsigned int)c.y0 - base_y, (unsigned int)c.y1 - base_y, (unsigned int)x, base_y);
+}
+
+/* -------- Icon atlas -------- */
+
+/* PackBits reader over one image of weather_icon_atlas (tools/png_to_epd_header.py): control
+ * byte n < 128 = n + 1 literal bytes, n >= 128 = next byte repeated n - 126 times. */
+typedef struct {
+  const uint8_t *p;
+  unsigned int run;  /* bytes left in the current run */
+  bool literal;
+  uint8_t value;
+} atlas_stream_t;
+
+static void atlas_stream_open(atlas_stream_t *s, const weather_icon_image_t *img) {
+  s->p = weather_icon_atlas + img->offset;
+  s->run = 0u;
+  s->literal = false;
+  s->value = 0u;
+}
+
+/* Next n bytes of the image into out (NULL: skip them). */
+static void atlas_stream_read(atlas_stream_t *s, uint8_t *out, unsigned int n) {
+  while (n) {
+    if (s->run == 0u) {
+      unsigned int c = *s->p++;
+      s->literal = (c < 128u);
+      s->run = s->literal ? c + 1u : c - 126u;
+      if (!s->literal) s->value = *s->p++;
     }
-    px += (FONT_W + 1u) * 4u;
-  }
-}
-
-/* Draw string at 3x scale: each font pixel -> 3x3 block (bigger, solid). */
-#define UI_3X_CHAR_W  ((FONT_W + 1u) * 3u)   /* 21 px per character */
-static void draw_string_4g_scaled_3x(unsigned int base_x, unsigned int base_y, const char *str) {
-  if (!str) return;
-  unsigned int px = base_x, py = base_y;
-  while (*str) {
-    int idx = char_to_index(*str++);
-    const unsigned char *col = font_6x8[idx];
-    for (unsigned int cx = 0; cx < FONT_W; cx++) {
-      for (unsigned int ry = 0; ry < FONT_H; ry++) {
-        if ((col[cx] >> ry) & 1) {
-          unsigned int bx = px + cx * 3u, by = py + ry * 3u;
-          for (unsigned int dy = 0; dy < 3u; dy++)
-            for (unsigned int dx = 0; dx < 3u; dx++)
-              set_pixel_4g(bx + dx, by + dy);
-        }
-      }
+    unsigned int k = (s->run < n) ? s->run : n;
+    if (s->literal) {
+      if (out) memcpy(out, s->p, k);
+      s->p += k;
+    } else if (out) {
+      memset(out, s->value, k);
     }
-    px += UI_3X_CHAR_W;
+    if (out) out += k;
+    n -= k;
+    s->run -= k;
   }
 }
 
-/* Draw string at 6x scale, tight: for big numbers (temp/hum/wind), slightly smaller than 8x. */
-#define UI_6X_CHAR_W_TIGHT (FONT_W * 6u)     /* 36px per char */
-static void draw_string_4g_scaled_6x_tight(unsigned int base_x, unsigned int base_y, const char *str) {
-  if (!str) return;
-  unsigned int px = base_x, py = base_y;
-  while (*str) {
-    int idx = char_to_index(*str++);
-    const unsigned char *col = font_6x8[idx];
-    for (unsigned int cx = 0; cx < FONT_W; cx++) {
-      for (unsigned int ry = 0; ry < FONT_H; ry++) {
-        if ((col[cx] >> ry) & 1) {
-          unsigned int bx = px + cx * 6u, by = py + ry * 6u;
-          for (unsigned int dy = 0; dy < 6u; dy++)
-            for (unsigned int dx = 0; dx < 6u; dx++)
-              set_pixel_4g(bx + dx, by + dy);
-        }
+/* One 4G byte (4 pixels) of a layer onto the icon being composed: the mask covers the layer's
+ * non-white pixels, which replace the icon's (OVER) or turn black (INK). */
+static inline void compose_byte(uint8_t *p, uint8_t v, uint8_t op) {
+  uint8_t m = (uint8_t)((v | (v >> 1)) & 0x55u);
+  m = (uint8_t)(m | (m << 1));
+  *p = (op == WEATHER_ICON_OP_INK) ? (uint8_t)(*p | m) : (uint8_t)((*p & ~m) | v);
+}
+
+static_assert(EPD_UI_ICON_SCRATCH_SIZE == WEATHER_ICON_4G_BYTES, "ctx->icon holds one composed icon");
+
+/* Recipe composed into ctx->icon, a 4G image of its box (column-major, like the atlas images),
+ * kept while the same recipe is asked for. Each layer is streamed a column at a time and merged
+ * a byte at a time, shifted down by its row offset within the byte. */
+static const unsigned char *icon_compose(epd_ui_ctx_t *ctx, const weather_icon_recipe_t *r) {
+  unsigned char *scratch = ctx->icon;
+  if (ctx->icon_recipe == r) return scratch;
+  const unsigned int bytes_per_col = (r->h + 3u) / 4u;
+  memset(scratch, 0, (size_t)r->w * bytes_per_col);
+  for (unsigned int i = 0; i < r->count; i++) {
+    const weather_icon_step_t *step = &weather_icon_steps[r->first + i];
+    const weather_icon_image_t *img = &weather_icon_images[step->layer];
+    const unsigned int layer_bpc = (img->h + 3u) / 4u;
+    const unsigned int dy = step->y - r->y, sh = (dy % 4u) * 2u;
+    unsigned char *dst = scratch + (step->x - r->x) * bytes_per_col + dy / 4u;
+    uint8_t col[WEATHER_ICON_4G_COL_BYTES];
+    atlas_stream_t st;
+    atlas_stream_open(&st, img);
+    for (unsigned int x = 0; x < img->w; x++, dst += bytes_per_col) {
+      atlas_stream_read(&st, col, layer_bpc);
+      /* One byte past the layer column catches the pixels shifted out of its last byte. */
+      for (unsigned int j = 0, prev = 0; j <= layer_bpc; j++) {
+        const unsigned int b = (j < layer_bpc) ? col[j] : 0u;
+        const uint8_t v = (uint8_t)(((prev << 8) | b) >> sh);
+        prev = b;
+        if (v) compose_byte(dst + j, v, step->op);
       }
     }
-    px += UI_6X_CHAR_W_TIGHT;
   }
-}
-
-/* Draw string at 8x scale: each font pixel -> 8x8 block (same style as HELLO, solid). */
-#define UI_8X_CHAR_W   ((FONT_W + 1u) * 8u)   /* 56px per char (with gap) */
-#define UI_8X_CHAR_W_TIGHT (FONT_W * 8u)     /* 48px per char, no gap */
-#define UI_8X_CHAR_H   (FONT_H * 8u)
-static void draw_string_4g_scaled_8x(unsigned int base_x, unsigned int base_y, const char *str) {
-  if (!str) return;
-  unsigned int px = base_x, py = base_y;
-  while (*str) {
-    int idx = char_to_index(*str++);
-    const unsigned char *col = font_6x8[idx];
-    for (unsigned int cx = 0; cx < FONT_W; cx++) {
-      for (unsigned int ry = 0; ry < FONT_H; ry++) {
-        if ((col[cx] >> ry) & 1) {
-          unsigned int bx = px + cx * 8u, by = py + ry * 8u;
-          for (unsigned int dy = 0; dy < 8u; dy++)
-            for (unsigned int dx = 0; dx < 8u; dx++)
-              set_pixel_4g(bx + dx, by + dy);
-        }
-      }
-    }
-    px += UI_8X_CHAR_W;
-  }
-}
-/* Same as above but 48px per character (tighter, for numbers). */
-static void draw_string_4g_scaled_8x_tight(unsigned int base_x, unsigned int base_y, const char *str) {
-  if (!str) return;
-  unsigned int px = base_x, py = base_y;
-  while (*str) {
-    int idx = char_to_index(*str++);
-    const unsigned char *col = font_6x8[idx];
-    for (unsigned int cx = 0; cx < FONT_W; cx++) {
-      for (unsigned int ry = 0; ry < FONT_H; ry++) {
-        if ((col[cx] >> ry) & 1) {
-          unsigned int bx = px + cx * 8u, by = py + ry * 8u;
-          for (unsigned int dy = 0; dy < 8u; dy++)
-            for (unsigned int dx = 0; dx < 8u; dx++)
-              set_pixel_4g(bx + dx, by + dy);
-        }
-      }
-    }
-    px += UI_8X_CHAR_W_TIGHT;
-  }
-}
-
-/* Blit 1-bit image (w x h) into 4G buffer at (base_x, base_y). Row stride = (w+7)/8 bytes. */
-static void blit_1bit_to_4g(const unsigned char *bitmap, unsigned int w, unsigned int h,
-                            unsigned int base_x, unsigned int base_y) {
-  const unsigned int row_stride = (w + 7u) / 8u;
-  for (unsigned int y = 0; y < h; y++) {
-    for (unsigned int x = 0; x < w; x++) {
-      unsigned int byte_ix = y * row_stride + (x / 8u);
-      unsigned int bit_ix  = 7 - (x % 8u);
-      if ((bitmap[byte_ix] >> bit_ix) & 1)
-        set_pixel_4g(base_x + x, base_y + y);
-    }
-  }
-}
-
-/* 4G icon: column-major, (icon_w x icon_h). Blit into 4G buffer at (base_x, base_y). */
-static void blit_4g_icon_to_4g(const unsigned char *icon_4g, unsigned int base_x, unsigned int base_y,
-                               unsigned int icon_w, unsigned int icon_h) {
-  unsigned int bytes_per_col = ((icon_h - 1u) / 8u) * 2u + ((icon_h - 1u) % 8u) / 4u + 1u;
-  for (unsigned int ix = 0; ix < icon_w; ix++) {
-    for (unsigned int col_byte = 0; col_byte < bytes_per_col; col_byte++) {
-#ifdef __AVR__
-      unsigned char b = (unsigned char)pgm_read_byte(icon_4g + ix * bytes_per_col + col_byte);
-#else
-      unsigned char b = icon_4g[ix * bytes_per_col + col_byte];
-#endif
-      for (unsigned int k = 0; k < 4u; k++) {
-        unsigned int iy = col_byte * 4u + k;
-        if (iy >= icon_h) break;
-        unsigned int value = (b >> (6 - k * 2)) & 3u;
-        set_pixel_4g_value(base_x + ix, base_y + iy, value);
-      }
-    }
+  ctx->icon_recipe = r;
+  return scratch;
+}
+
+/* 4G atlas image at (base_x, base_y): columns left of the clip are skipped in the stream, the
+ * rest up to its right edge are decompressed one column at a time straight into the blitter. */
+static void blit_atlas_4g(epd_ui_ctx_t *ctx, const weather_icon_image_t *img, unsigned int base_x, unsigned int base_y) {
+  const unsigned int bytes_per_col = (img->h + 3u) / 4u;
+  epd_ui_clip_t c;
+  if (!clip_box_4g(ctx, (int)base_x, (int)base_y, (int)img->w, (int)img->h, &c)) return;
+  uint8_t col[WEATHER_ICON_4G_COL_BYTES];
+  atlas_stream_t st;
+  atlas_stream_open(&st, img);
+  atlas_stream_read(&st, NULL, ((unsigned int)c.x0 - base_x) * bytes_per_col);
+  for (int x = c.x0; x < c.x1; x++) {
+    atlas_stream_read(&st, col, bytes_per_col);
+    blit_4g_icon_column(ctx, col, bytes_per_col, (unsigned int)c.y0 - base_y, (unsigned int)c.y1 - base_y,
+                        (unsigned int)x, base_y);
   }
 }
 
@@ -592,813 +763,1946 @@ static unsigned int get_4g_icon_pixel(const unsigned char *icon_4g, unsigned int
   return (unsigned int)(b >> shift) & 3u;
 }
 
-/* Blit 4G icon at half size (nearest-neighbor downscale) into 4G buffer. */
-static void blit_4g_icon_to_4g_half(const unsigned char *icon_4g, unsigned int base_x, unsigned int base_y,
-                                   unsigned int icon_w, unsigned int icon_h) {
-  unsigned int dw = icon_w / 2u, dh = icon_h / 2u;
-  for (unsigned int dy = 0; dy < dh; dy++) {
-    for (unsigned int dx = 0; dx < dw; dx++) {
-      unsigned int v = get_4g_icon_pixel(icon_4g, icon_w, icon_h, dx * 2u, dy * 2u);
-      set_pixel_4g_value(base_x + dx, base_y + dy, v);
-    }
-  }
-}
-
 /* Blit 4G icon to fit inside box_size x box_size preserving aspect ratio, centered. */
-static void blit_4g_icon_to_4g_fit(const unsigned char *icon_4g, unsigned int base_x, unsigned int base_y,
-                                   unsigned int icon_w, unsigned int icon_h, unsigned int box_size) {
+static void blit_4g_icon_to_4g_fit(epd_ui_ctx_t *ctx, const unsigned char *icon_4g, unsigned int base_x,
+                                   unsigned int base_y, unsigned int icon_w, unsigned int icon_h, unsigned int box_size) {
   unsigned int max_dim = (icon_w >= icon_h) ? icon_w : icon_h;
   if (max_dim == 0u) return;
   unsigned int dest_w = (icon_w * box_size) / max_dim;
   unsigned int dest_h = (icon_h * box_size) / max_dim;
   if (dest_w == 0u || dest_h == 0u) return;
-  unsigned int ox = (box_size - dest_w) / 2u;
-  unsigned int oy = (box_size - dest_h) / 2u;
-  for (unsigned int dy = 0; dy < dest_h; dy++) {
-    for (unsigned int dx = 0; dx < dest_w; dx++) {
-      unsigned int sx = (dx * icon_w) / dest_w;
-      unsigned int sy = (dy * icon_h) / dest_h;
+  unsigned int ox = base_x + (box_size - dest_w) / 2u;
+  unsigned int oy = base_y + (box_size - dest_h) / 2u;
+  epd_ui_clip_t c;
+  if (!clip_box_4g(ctx, (int)ox, (int)oy, (int)dest_w, (int)dest_h, &c)) return;
+  epd_fb_4g_t fb = band_fb(ctx);
+  for (int x = c.x0; x < c.x1; x++) {
+    unsigned int sx = (((unsigned int)x - ox) * icon_w) / dest_w;
+    for (int y = c.y0; y < c.y1; y++) {
+      unsigned int sy = (((unsigned int)y - oy) * icon_h) / dest_h;
       unsigned int v = get_4g_icon_pixel(icon_4g, icon_w, icon_h, sx, sy);
-      set_pixel_4g_value(base_x + ox + dx, base_y + oy + dy, v);
-    }
-  }
-}
-
-/* Blit 1-bit image at half size (nearest-neighbor) into 4G buffer. */
-static void blit_1bit_to_4g_half(const unsigned char *bitmap, unsigned int w, unsigned int h,
-                                 unsigned int base_x, unsigned int base_y) {
-  unsigned int dw = w / 2u, dh = h / 2u;
-  const unsigned int row_stride = (w + 7u) / 8u;
-  for (unsigned int dy = 0; dy < dh; dy++) {
-    for (unsigned int dx = 0; dx < dw; dx++) {
-      unsigned int sx = dx * 2u, sy = dy * 2u;
-      unsigned int byte_ix = sy * row_stride + (sx / 8u);
-      unsigned int bit_ix  = 7 - (sx % 8u);
-      if ((bitmap[byte_ix] >> bit_ix) & 1)
-        set_pixel_4g(base_x + dx, base_y + dy);
+      fb.put((unsigned int)x - ctx->band_x, (unsigned int)y, v);
     }
   }
 }
 
-/* Blit 1-bit image to fit inside box_size x box_size preserving aspect ratio, centered. */
-static void blit_1bit_to_4g_fit(const unsigned char *bitmap, unsigned int w, unsigned int h,
-                                unsigned int base_x, unsigned int base_y, unsigned int box_size) {
-  unsigned int max_dim = (w >= h) ? w : h;
-  if (max_dim == 0u) return;
-  unsigned int dest_w = (w * box_size) / max_dim;
-  unsigned int dest_h = (h * box_size) / max_dim;
-  if (dest_w == 0u || dest_h == 0u) return;
-  unsigned int ox = (box_size - dest_w) / 2u;
-  unsigned int oy = (box_size - dest_h) / 2u;
-  const unsigned int row_stride = (w + 7u) / 8u;
-  for (unsigned int dy = 0; dy < dest_h; dy++) {
-    for (unsigned int dx = 0; dx < dest_w; dx++) {
-      unsigned int sx = (dx * w) / dest_w;
-      unsigned int sy = (dy * h) / dest_h;
-      unsigned int byte_ix = sy * row_stride + (sx / 8u);
-      unsigned int bit_ix  = 7 - (sx % 8u);
-      if ((bitmap[byte_ix] >> bit_ix) & 1)
-        set_pixel_4g(base_x + ox + dx, base_y + oy + dy);
-    }
-  }
-}
-
-/* Copy 1-bit image (src_w x src_h) into buffer (dst_w x dst_h) at offset (ox, oy). */
-static void copy_1bit_into_buf(unsigned char *dst, unsigned int dst_w, unsigned int dst_h,
-                              const unsigned char *src, unsigned int src_w, unsigned int src_h,
-                              unsigned int ox, unsigned int oy) {
-  unsigned int src_stride = (src_w + 7u) / 8u;
+/* Copy the black pixels of a 4G icon (src_w x src_h, column-major) into a 1-bit buffer
+ * (dst_w x dst_h) at offset (ox, oy), each one as a scale x scale block. Returns false at the
+ * first gray pixel: the icon needs 4G. */
+static bool copy_4g_black_into_buf(unsigned char *dst, unsigned int dst_w, unsigned int dst_h,
+                                   const unsigned char *src, unsigned int src_w, unsigned int src_h,
+                                   unsigned int ox, unsigned int oy, unsigned int scale) {
   unsigned int dst_stride = (dst_w + 7u) / 8u;
-  for (unsigned int y = 0; y < src_h; y++) {
-    for (unsigned int x = 0; x < src_w; x++) {
-      unsigned int src_byte_ix = y * src_stride + (x / 8u);
-      unsigned int src_bit = 7 - (x % 8u);
-      unsigned char byte_val;
-#ifdef __AVR__
-      byte_val = (unsigned char)pgm_read_byte(src + src_byte_ix);
-#else
-      byte_val = src[src_byte_ix];
-#endif
-      int on = (byte_val >> src_bit) & 1;
-      if (!on) continue;
-      unsigned int dx = ox + x, dy = oy + y;
-      if (dx >= dst_w || dy >= dst_h) continue;
-      unsigned int dst_byte_ix = dy * dst_stride + (dx / 8u);
-      unsigned int dst_bit = 7 - (dx % 8u);
-      dst[dst_byte_ix] |= (unsigned char)(1 << dst_bit);
+  for (unsigned int x = 0; x < src_w; x++) {
+    for (unsigned int y = 0; y < src_h; y++) {
+      unsigned int v = get_4g_icon_pixel(src, src_w, src_h, x, y);
+      if (v == 0u) continue;
+      if (v != 3u) return false;
+      for (unsigned int sy = 0; sy < scale; sy++) {
+        for (unsigned int sx = 0; sx < scale; sx++) {
+          unsigned int dx = (ox + x) * scale + sx, dy = (oy + y) * scale + sy;
+          if (dx >= dst_w || dy >= dst_h) continue;
+          unsigned int dst_byte_ix = dy * dst_stride + (dx / 8u);
+          unsigned int dst_bit = 7 - (dx % 8u);
+          dst[dst_byte_ix] |= (unsigned char)(1 << dst_bit);
+        }
+      }
     }
   }
+  return true;
 }
 
-static void format_temp(char *out, size_t out_size, float temp_c) {
-  if (temp_c < -99.9f || temp_c > 99.9f)
-    snprintf(out, out_size, "---");
-  else
-    snprintf(out, out_size, "%.1f%cC", (double)temp_c, (char)0xB0);  /* °C */
+/* Fixed-point value as text, integer arithmetic only: value / 10^frac_digits with frac_digits
+ * decimals ("-12.3" for -123 with 1, "45" for 45 with 0), or "---" if |value| > max_abs. Returns
+ * the length written; out_size must hold "---" or the longest value plus the NUL. */
+static size_t format_fixed(char *out, size_t out_size, int value, unsigned int frac_digits, int max_abs) {
+  if (value < -max_abs || value > max_abs) {
+    memcpy(out, "---", 4);
+    return 3u;
+  }
+  char tmp[12];
+  unsigned int n = 0u;
+  unsigned int v = (value < 0) ? 0u - (unsigned int)value : (unsigned int)value;
+  do {
+    tmp[n++] = (char)('0' + v % 10u);
+    v /= 10u;
+    if (n == frac_digits) tmp[n++] = '.';
+  } while (v != 0u || n <= frac_digits + (frac_digits ? 1u : 0u));
+  size_t len = 0u;
+  if (value < 0 && len + 1u < out_size) out[len++] = '-';
+  while (n && len + 1u < out_size) out[len++] = tmp[--n];
+  out[len] = '\0';
+  return len;
+}
+
+/* Legacy 1-bit text: "21.5°C" (0xB0 is the degree sign of font_6x8). */
+static void format_temp(char *out, size_t out_size, int16_t temp_dc) {
+  size_t len = format_fixed(out, out_size, temp_dc, 1u, EPD_UI_TEMP_DC_MAX);
+  if (temp_dc >= -EPD_UI_TEMP_DC_MAX && temp_dc <= EPD_UI_TEMP_DC_MAX && len + 3u <= out_size)
+    memcpy(out + len, "\xB0" "C", 3);
 }
 
 /* Number only for temp (draw °C separately in smaller font). */
-static void format_temp_number(char *out, size_t out_size, float temp_c) {
-  if (temp_c < -99.9f || temp_c > 99.9f)
-    snprintf(out, out_size, "---");
-  else
-    snprintf(out, out_size, "%.1f", (double)temp_c);
+static void format_temp_number(char *out, size_t out_size, int16_t temp_dc) {
+  format_fixed(out, out_size, temp_dc, 1u, EPD_UI_TEMP_DC_MAX);
 }
 
-static void format_humidity(char *out, size_t out_size, float humidity_percent) {
-  if (humidity_percent < 0 || humidity_percent > 100)
-    snprintf(out, out_size, "--%%");
-  else
-    snprintf(out, out_size, "%.0f%%", (double)humidity_percent);
+static void format_humidity(char *out, size_t out_size, int humidity_percent) {
+  if (humidity_percent < 0 || humidity_percent > 100) {
+    memcpy(out, "--%", 4);
+    return;
+  }
+  size_t len = format_fixed(out, out_size, humidity_percent, 0u, 100);
+  if (len + 2u <= out_size) memcpy(out + len, "%", 2);
 }
 
 /* Number only for humidity (draw % separately in smaller font). */
-static void format_humidity_number(char *out, size_t out_size, float humidity_percent) {
-  if (humidity_percent < 0 || humidity_percent > 100)
-    snprintf(out, out_size, "---");
-  else
-    snprintf(out, out_size, "%.0f", (double)humidity_percent);
-}
-
-static void format_temp_range(char *out, size_t out_size, float tmin_c, float tmax_c) {
-  char a[16], b[16];
-  format_temp(a, sizeof(a), tmin_c);
-  format_temp(b, sizeof(b), tmax_c);
-  snprintf(out, out_size, "%s-%s", a, b);
-}
-
-/* Forecast temps as integers: "min°C-max°C" (e.g. "-2°C-3°C"). */
-static void format_temp_range_int(char *out, size_t out_size, int tmin_c, int tmax_c) {
-  if (tmin_c < -99 || tmin_c > 99 || tmax_c < -99 || tmax_c > 99)
-    snprintf(out, out_size, "---");
-  else
-    snprintf(out, out_size, "%d%cC/%d%cC", tmin_c, (char)0xB0, tmax_c, (char)0xB0);
+static void format_humidity_number(char *out, size_t out_size, int humidity_percent) {
+  format_fixed(out, out_size, (humidity_percent < 0) ? 101 : humidity_percent, 0u, 100);
 }
 
-/* Single temp for forecast: "−2°" or "3°" (degree only, no C). */
-/* Forecast min/max: number only (no ° symbol). */
+/* Forecast min/max: whole degrees, number only (no ° symbol). */
 static void format_temp_int_degree(char *out, size_t out_size, int temp_c) {
-  if (temp_c < -99 || temp_c > 99)
-    snprintf(out, out_size, "---");
-  else
-    snprintf(out, out_size, "%d", temp_c);
+  format_fixed(out, out_size, temp_c, 0u, 99);
 }
 
-/* Draw a circle outline (midpoint). cx,cy center; r radius. */
-static void draw_circle(unsigned char *buf, unsigned int w, unsigned int h,
-                        int cx, int cy, int r) {
-  int x = r, y = 0, err = 1 - r;
-  while (x >= y) {
-    set_pixel(buf, w, h, (unsigned int)(cx + x), (unsigned int)(cy + y));
-    set_pixel(buf, w, h, (unsigned int)(cx - x), (unsigned int)(cy + y));
-    set_pixel(buf, w, h, (unsigned int)(cx + x), (unsigned int)(cy - y));
-    set_pixel(buf, w, h, (unsigned int)(cx - x), (unsigned int)(cy - y));
-    set_pixel(buf, w, h, (unsigned int)(cx + y), (unsigned int)(cy + x));
-    set_pixel(buf, w, h, (unsigned int)(cx - y), (unsigned int)(cy + x));
-    set_pixel(buf, w, h, (unsigned int)(cx + y), (unsigned int)(cy - x));
-    set_pixel(buf, w, h, (unsigned int)(cx - y), (unsigned int)(cy - x));
-    y++;
-    if (err <= 0) { err += 2 * y + 1; }
-    else { x--; err += 2 * (y - x) + 1; }
-  }
-}
+/* -------- Vector icons -------- */
 
-/* Draw filled circle. */
-static void fill_circle(unsigned char *buf, unsigned int w, unsigned int h,
-                        int cx, int cy, int r) {
-  for (int dy = -r; dy <= r; dy++) {
-    int q = r * r - dy * dy;
-    int dx = (q <= 0) ? 0 : (int)(sqrtf((float)q) + 0.5f);
-    for (int x = cx - dx; x <= cx + dx; x++)
-      set_pixel(buf, w, h, (unsigned int)x, (unsigned int)(cy + dy));
+/* Floor of the square root of v. */
+static uint32_t isqrt_u32(uint32_t v) {
+  uint32_t r = 0, bit = 1ul << 30;
+  while (bit > v) bit >>= 2;
+  for (; bit; bit >>= 2) {
+    if (v >= r + bit) {
+      v -= r + bit;
+      r = (r >> 1) + bit;
+    } else {
+      r >>= 1;
+    }
   }
+  return r;
 }
 
-/* Horizontal line. */
-static void hline(unsigned char *buf, unsigned int w, unsigned int h,
-                  unsigned int x0, unsigned int x1, unsigned int y) {
-  for (; x0 <= x1; x0++) set_pixel(buf, w, h, x0, y);
-}
+/* Takes the spans of a vector icon: rows r0..r1-1 of icon column c, at gray. */
+typedef void (*vec_span_fn)(void *ctx, unsigned int c, unsigned int r0, unsigned int r1, unsigned int gray);
 
-/* Vertical line. */
-static void vline(unsigned char *buf, unsigned int w, unsigned int h,
-                  unsigned int x, unsigned int y0, unsigned int y1) {
-  for (; y0 <= y1; y0++) set_pixel(buf, w, h, x, y0);
-}
+typedef struct {
+  vec_span_fn span;
+  void *ctx;
+  int size;    /* icon square, px */
+  int c0, c1;  /* icon columns drawn: c0..c1-1 */
+  unsigned int gray;
+} vec_raster_t;
+
+#define VEC_ONE   (1 << WEATHER_VEC_FRAC_BITS)
+#define VEC_HALF  (VEC_ONE / 2)
 
-static void draw_icon_simple_rays(unsigned char *buf, unsigned int w, unsigned int h) {
-  int cx = (int)w / 2, cy = (int)h / 2, r = (int)h / 4;
-  draw_circle(buf, w, h, cx, cy, r);
-  hline(buf, w, h, 0, (unsigned int)(w - 1), (unsigned int)cy);
-  vline(buf, w, h, (unsigned int)cx, 0, (unsigned int)(h - 1));
-  hline(buf, w, h, (unsigned int)(cx - r), (unsigned int)(cx + r), (unsigned int)(cy - r / 2));
-  hline(buf, w, h, (unsigned int)(cx - r), (unsigned int)(cx + r), (unsigned int)(cy + r / 2));
-  vline(buf, w, h, (unsigned int)(cx - r / 2), (unsigned int)(cy - r), (unsigned int)(cy + r));
-  vline(buf, w, h, (unsigned int)(cx + r / 2), (unsigned int)(cy - r), (unsigned int)(cy + r));
+/* First pixel whose center is at or past v (1/16 px). */
+static inline int vec_px(int v) {
+  return (v + VEC_HALF - 1) >> WEATHER_VEC_FRAC_BITS;
 }
 
-static void draw_icon_cloud(unsigned char *buf, unsigned int w, unsigned int h) {
-  fill_circle(buf, w, h, (int)w/2 - 8, (int)h/2 + 4, 12);
-  fill_circle(buf, w, h, (int)w/2 + 8, (int)h/2 + 4, 12);
-  fill_circle(buf, w, h, (int)w/2, (int)h/2 - 4, 14);
-  hline(buf, w, h, 4, (unsigned int)(w - 5), (unsigned int)(h/2 + 14));
+/* Pixels of column c whose centers lie in [ya, yb). */
+static void vec_span(const vec_raster_t *vr, int c, int ya, int yb) {
+  int r0 = vec_px(ya), r1 = vec_px(yb);
+  if (r0 < 0) r0 = 0;
+  if (r1 > vr->size) r1 = vr->size;
+  if (r0 < r1) vr->span(vr->ctx, (unsigned int)c, (unsigned int)r0, (unsigned int)r1, vr->gray);
 }
 
-static void draw_icon_rain(unsigned char *buf, unsigned int w, unsigned int h) {
-  draw_icon_cloud(buf, w, h);
-  for (int i = 0; i < 5; i++) {
-    unsigned int x = 12 + (unsigned int)i * 14;
-    vline(buf, w, h, x, (unsigned int)(h/2 + 18), (unsigned int)(h - 4));
-    vline(buf, w, h, x + 1, (unsigned int)(h/2 + 18), (unsigned int)(h - 4));
-  }
+/* Columns whose centers lie in [xa, xb), clipped to the drawn ones. */
+static void vec_columns(const vec_raster_t *vr, int xa, int xb, int *c0, int *c1) {
+  *c0 = vec_px(xa);
+  *c1 = vec_px(xb);
+  if (*c0 < vr->c0) *c0 = vr->c0;
+  if (*c1 > vr->c1) *c1 = vr->c1;
 }
 
-static void draw_icon_snow(unsigned char *buf, unsigned int w, unsigned int h) {
-  draw_icon_cloud(buf, w, h);
-  int cx = (int)w / 2, cy = (int)h / 2 + 20;
-  for (int i = 0; i < 3; i++) {
-    int dx = 8 * (i - 1);
-    vline(buf, w, h, (unsigned int)(cx + dx), (unsigned int)(cy - 8), (unsigned int)(cy + 8));
-    hline(buf, w, h, (unsigned int)(cx + dx - 4), (unsigned int)(cx + dx + 4), (unsigned int)cy);
-    int x = cx + dx, y = cy;
-    set_pixel(buf, w, h, (unsigned int)(x - 3), (unsigned int)(y - 3));
-    set_pixel(buf, w, h, (unsigned int)(x + 3), (unsigned int)(y - 3));
-    set_pixel(buf, w, h, (unsigned int)(x - 3), (unsigned int)(y + 3));
-    set_pixel(buf, w, h, (unsigned int)(x + 3), (unsigned int)(y + 3));
+static void vec_fill_circle(const vec_raster_t *vr, int cx, int cy, int r) {
+  int c0, c1;
+  vec_columns(vr, cx - r, cx + r, &c0, &c1);
+  for (int c = c0; c < c1; c++) {
+    int d = c * VEC_ONE + VEC_HALF - cx;
+    if (d < 0) d = -d;
+    if (d >= r) continue;
+    int h = (int)isqrt_u32((uint32_t)(r * r - d * d));
+    vec_span(vr, c, cy - h, cy + h);
   }
 }
 
-static void draw_icon_fog(unsigned char *buf, unsigned int w, unsigned int h) {
-  draw_icon_cloud(buf, w, h);
-  for (int i = 0; i < 4; i++) {
-    unsigned int y = (unsigned int)(h/2 + 20 + i * 10);
-    hline(buf, w, h, 8, (unsigned int)(w - 9), y);
+/* Polygon (xs[i], ys[i]), i < n, even-odd: per column, the edge crossings at the pixel center
+ * sorted top to bottom and filled in pairs. */
+static void vec_fill_poly(const vec_raster_t *vr, const int *xs, const int *ys, unsigned int n) {
+  int xmin = xs[0], xmax = xs[0];
+  for (unsigned int i = 1; i < n; i++) {
+    if (xs[i] < xmin) xmin = xs[i];
+    if (xs[i] > xmax) xmax = xs[i];
+  }
+  int c0, c1;
+  vec_columns(vr, xmin, xmax, &c0, &c1);
+  int cross[WEATHER_VEC_POLY_MAX + 1u];
+  for (int c = c0; c < c1; c++) {
+    const int x = c * VEC_ONE + VEC_HALF;
+    unsigned int k = 0;
+    for (unsigned int i = 0; i < n; i++) {
+      const unsigned int j = (i + 1u == n) ? 0u : i + 1u;
+      const int xa = xs[i], xb = xs[j];
+      if (!((xa <= x && x < xb) || (xb <= x && x < xa))) continue;
+      int y = ys[i] + (x - xa) * (ys[j] - ys[i]) / (xb - xa);
+      unsigned int m = k++;
+      for (; m > 0u && cross[m - 1u] > y; m--) cross[m] = cross[m - 1u];
+      cross[m] = y;
+    }
+    for (unsigned int i = 0; i + 1u < k; i += 2u) vec_span(vr, c, cross[i], cross[i + 1u]);
   }
 }
 
-static void draw_icon_thunder(unsigned char *buf, unsigned int w, unsigned int h) {
-  draw_icon_cloud(buf, w, h);
-  int cx = (int)w / 2;
-  /* zigzag lightning */
-  vline(buf, w, h, (unsigned int)(cx + 4), (unsigned int)(h/2 + 10), (unsigned int)(h/2 + 28));
-  for (int y = h/2 + 28; y <= h/2 + 36; y++) set_pixel(buf, w, h, (unsigned int)(cx + 4 - (y - (h/2+28))), (unsigned int)y);
-  vline(buf, w, h, (unsigned int)(cx - 4), (unsigned int)(h/2 + 36), (unsigned int)(h - 8));
+/* Vector icon data (WEATHER_VEC_* stream) as a size x size px square; only icon columns
+ * c0..c1-1 are rasterized, each one a few spans handed to span(ctx, ...). Design units map to
+ * 1/16 px as v * size / 16, so the same stream draws the 106 px OUT icon and the 70 px cards. */
+static void vector_icon_draw(const uint8_t *data, unsigned int size, unsigned int c0, unsigned int c1,
+                             vec_span_fn span, void *ctx) {
+  vec_raster_t vr = { span, ctx, (int)size, (int)c0, (int)((c1 < size) ? c1 : size), 0u };
+  const int s = (int)size;
+#define VEC_FX(v) (((int)(v) * s) >> (8 - WEATHER_VEC_FRAC_BITS))
+  for (;;) {
+    const uint8_t op = *data++;
+    if (op == WEATHER_VEC_END) break;
+    if ((op & 0xF0u) == WEATHER_VEC_GRAY) {
+      vr.gray = op & 3u;
+    } else if (op == WEATHER_VEC_CIRCLE) {
+      vec_fill_circle(&vr, VEC_FX(data[0]), VEC_FX(data[1]), VEC_FX(data[2]));
+      data += 3;
+    } else if (op == WEATHER_VEC_BAR) {
+      /* Quad r to each side of the segment, normal in design units << 4, then the round caps. */
+      const int ax = VEC_FX(data[0]), ay = VEC_FX(data[1]), bx = VEC_FX(data[2]), by = VEC_FX(data[3]);
+      const int dx = (int)data[2] - (int)data[0], dy = (int)data[3] - (int)data[1], r = data[4];
+      const int n = (int)isqrt_u32((uint32_t)(dx * dx + dy * dy));
+      if (n) {
+        const int nx = ((-dy * r * 16 / n) * s) >> (12 - WEATHER_VEC_FRAC_BITS);
+        const int ny = ((dx * r * 16 / n) * s) >> (12 - WEATHER_VEC_FRAC_BITS);
+        const int xs[4] = { ax + nx, bx + nx, bx - nx, ax - nx };
+        const int ys[4] = { ay + ny, by + ny, by - ny, ay - ny };
+        vec_fill_poly(&vr, xs, ys, 4u);
+      }
+      vec_fill_circle(&vr, ax, ay, VEC_FX(r));
+      vec_fill_circle(&vr, bx, by, VEC_FX(r));
+      data += 5;
+    } else {
+      const unsigned int n = op & WEATHER_VEC_POLY_MAX;
+      int xs[WEATHER_VEC_POLY_MAX], ys[WEATHER_VEC_POLY_MAX];
+      for (unsigned int i = 0; i < n; i++) {
+        xs[i] = VEC_FX(data[2u * i]);
+        ys[i] = VEC_FX(data[2u * i + 1u]);
+      }
+      if (n >= 3u) vec_fill_poly(&vr, xs, ys, n);
+      data += 2u * n;
+    }
+  }
+#undef VEC_FX
+}
+
+/* Renderer and screen position of a vector icon drawn into its 4G band. */
+typedef struct {
+  epd_ui_ctx_t *ui;
+  unsigned int x, y;
+} vec_4g_target_t;
+
+static void vec_span_4g(void *ctx, unsigned int c, unsigned int r0, unsigned int r1, unsigned int gray) {
+  const vec_4g_target_t *t = (const vec_4g_target_t *)ctx;
+  const epd_ui_clip_t *clip = &t->ui->clip;
+  const int y0 = (int)(t->y + r0), y1 = (int)(t->y + r1);
+  const int ys = (y0 > clip->y0) ? y0 : clip->y0, ye = (y1 < clip->y1) ? y1 : clip->y1;
+  if (ys < ye) band_fb(t->ui).fill_vspan(t->x + c - t->ui->band_x, (unsigned int)ys, (unsigned int)ye - 1u, gray);
+}
+
+/* Vector icon of kind as a size px square at (x, y), columns outside the clip skipped. */
+static void vector_icon_draw_4g(epd_ui_ctx_t *ctx, epd_ui_weather_icon_t kind, unsigned int x, unsigned int y,
+                                unsigned int size) {
+  epd_ui_clip_t c;
+  if ((unsigned int)kind >= EPD_UI_ICON_COUNT || !clip_box_4g(ctx, (int)x, (int)y, (int)size, (int)size, &c)) return;
+  vec_4g_target_t t = { ctx, x, y };
+  vector_icon_draw(weather_icon_vectors[kind], size, (unsigned int)c.x0 - x, (unsigned int)c.x1 - x, vec_span_4g, &t);
+}
+
+/* Row-major 1-bit buffer (1 = black) of the legacy partial-update API. */
+typedef struct {
+  unsigned char *buf;
+  unsigned int w, h;
+} vec_1bit_target_t;
+
+static void vec_span_1bit(void *ctx, unsigned int c, unsigned int r0, unsigned int r1, unsigned int gray) {
+  const vec_1bit_target_t *t = (const vec_1bit_target_t *)ctx;
+  if (c >= t->w) return;
+  const unsigned int stride = (t->w + 7u) / 8u;
+  const unsigned char bit = (unsigned char)(0x80u >> (c % 8u));
+  unsigned char *p = t->buf + r0 * stride + c / 8u;
+  for (unsigned int r = r0; r < r1 && r < t->h; r++, p += stride) {
+    /* Grays as 2x2 ordered dither: light gray one pixel in four, dark gray every other one. */
+    const bool on = (gray == 3u) || (gray == 2u && ((r ^ c) & 1u) == 0u) ||
+                    (gray == 1u && (r & 1u) == 0u && (c & 1u) == 0u);
+    *p = on ? (unsigned char)(*p | bit) : (unsigned char)(*p & ~bit);
+  }
 }
 
-static void draw_weather_icon(unsigned char *buf, unsigned int w, unsigned int h,
+/* Vector icon of kind as a size px square into a cleared w x h 1-bit buffer. */
+static void draw_weather_icon(unsigned char *buf, unsigned int w, unsigned int h, unsigned int size,
                               epd_ui_weather_icon_t icon) {
-  memset(buf, 0, (w * h) / 8);
-  switch (icon) {
-    case EPD_UI_ICON_CLEAR:
-      draw_icon_simple_rays(buf, w, h);
-      break;
-    case EPD_UI_ICON_PARTLY_CLOUDY:
-      draw_icon_simple_rays(buf, w, h);
-      draw_icon_cloud(buf, w, h);
-      break;
-    case EPD_UI_ICON_CLOUDY:
-      draw_icon_cloud(buf, w, h);
-      break;
-    case EPD_UI_ICON_FOG:
-      draw_icon_fog(buf, w, h);
-      break;
-    case EPD_UI_ICON_RAIN:
-      draw_icon_rain(buf, w, h);
-      break;
-    case EPD_UI_ICON_SNOW:
-      draw_icon_snow(buf, w, h);
-      break;
-    case EPD_UI_ICON_THUNDERSTORM:
-      draw_icon_thunder(buf, w, h);
-      break;
-    default:
-      draw_icon_cloud(buf, w, h);
-      break;
-  }
+  if ((unsigned int)icon >= EPD_UI_ICON_COUNT) icon = EPD_UI_ICON_CLOUDY;
+  vec_1bit_target_t t = { buf, w, h };
+  vector_icon_draw(weather_icon_vectors[icon], size, 0u, size, vec_span_1bit, &t);
 }
 
 epd_ui_weather_icon_t epd_ui_weather_code_to_icon(int wmo_code) {
-  if (wmo_code == 0 || wmo_code == 1) return EPD_UI_ICON_CLEAR;       /* Clear, Mainly clear */
-  if (wmo_code == 2) return EPD_UI_ICON_PARTLY_CLOUDY;                  /* Partly cloudy */
-  if (wmo_code == 3) return EPD_UI_ICON_CLOUDY;                        /* Cloudy */
-  if (wmo_code == 45 || wmo_code == 48) return EPD_UI_ICON_FOG;        /* Fog, Rime fog */
-  if (wmo_code >= 51 && wmo_code <= 67) return EPD_UI_ICON_RAIN;       /* Drizzle, rain, freezing rain */
-  if (wmo_code >= 71 && wmo_code <= 77) return EPD_UI_ICON_SNOW;       /* Snow, snow grains */
-  if (wmo_code >= 95 && wmo_code <= 99) return EPD_UI_ICON_THUNDERSTORM; /* Thunderstorm */
-  if (wmo_code >= 85 && wmo_code <= 86) return EPD_UI_ICON_SNOW;       /* Snow showers */
-  if (wmo_code >= 80 && wmo_code <= 82) return EPD_UI_ICON_RAIN;      /* Showers */
-  return EPD_UI_ICON_CLOUDY;
-}
-
-void epd_ui_draw_indoor_temp(float temp_c) {
-  static unsigned char buf[TEMP_BUF_SIZE];
-  memset(buf, 0, sizeof(buf));
+  return (epd_ui_weather_icon_t)weather_icon_desc_by_wmo(wmo_code)->kind;
+}
+
+/* Cleared 1-bit image of size bytes for the legacy partial updates: the front of ctx's band
+ * buffer, whose band is then no longer cached. */
+static unsigned char *legacy_buf_1bit(epd_ui_ctx_t *ctx, size_t size) {
+  ctx->band_dl = NULL;
+  memset(ctx->band, 0, size);
+  return ctx->band;
+}
+static_assert(LARGE_ICON_BUF_SIZE <= EPD_UI_BAND_BUFFER_SIZE, "legacy 1-bit images are drawn in the band buffer");
+
+void epd_ui_draw_indoor_temp(epd_ui_ctx_t *ctx, int16_t temp_dc) {
+  unsigned char *buf = legacy_buf_1bit(ctx, TEMP_BUF_SIZE);
   char str[16];
-  format_temp(str, sizeof(str), temp_c);
+  format_temp(str, sizeof(str), temp_dc);
   draw_string(buf, EPD_UI_TEMP_REGION_W, EPD_UI_TEMP_REGION_H, 0, 8, str);
   EPD_Dis_Part(EPD_UI_INDOOR_TEMP_X, EPD_UI_INDOOR_TEMP_Y, buf, EPD_UI_TEMP_REGION_H, EPD_UI_TEMP_REGION_W);
 }
 
-void epd_ui_draw_outdoor_temp(float temp_c) {
-  static unsigned char buf[TEMP_BUF_SIZE];
-  memset(buf, 0, sizeof(buf));
+void epd_ui_draw_outdoor_temp(epd_ui_ctx_t *ctx, int16_t temp_dc) {
+  unsigned char *buf = legacy_buf_1bit(ctx, TEMP_BUF_SIZE);
   char str[16];
-  format_temp(str, sizeof(str), temp_c);
+  format_temp(str, sizeof(str), temp_dc);
   draw_string(buf, EPD_UI_TEMP_REGION_W, EPD_UI_TEMP_REGION_H, 0, 8, str);
   EPD_Dis_Part(EPD_UI_OUTDOOR_TEMP_X, EPD_UI_OUTDOOR_TEMP_Y, buf, EPD_UI_TEMP_REGION_H, EPD_UI_TEMP_REGION_W);
 }
 
-void epd_ui_draw_indoor_humidity(float humidity_percent) {
-  static unsigned char buf[HUMID_BUF_SIZE];
-  memset(buf, 0, sizeof(buf));
+void epd_ui_draw_indoor_humidity(epd_ui_ctx_t *ctx, int humidity_percent) {
+  unsigned char *buf = legacy_buf_1bit(ctx, HUMID_BUF_SIZE);
   char str[8];
   format_humidity(str, sizeof(str), humidity_percent);
   draw_string(buf, EPD_UI_HUMID_REGION_W, EPD_UI_HUMID_REGION_H, 0, 8, str);
   EPD_Dis_Part(EPD_UI_INDOOR_HUMID_X, EPD_UI_INDOOR_HUMID_Y, buf, EPD_UI_HUMID_REGION_H, EPD_UI_HUMID_REGION_W);
 }
 
-void epd_ui_draw_outdoor_humidity(float humidity_percent) {
-  static unsigned char buf[HUMID_BUF_SIZE];
-  memset(buf, 0, sizeof(buf));
+void epd_ui_draw_outdoor_humidity(epd_ui_ctx_t *ctx, int humidity_percent) {
+  unsigned char *buf = legacy_buf_1bit(ctx, HUMID_BUF_SIZE);
   char str[8];
   format_humidity(str, sizeof(str), humidity_percent);
   draw_string(buf, EPD_UI_HUMID_REGION_W, EPD_UI_HUMID_REGION_H, 0, 8, str);
   EPD_Dis_Part(EPD_UI_OUTDOOR_HUMID_X, EPD_UI_OUTDOOR_HUMID_Y, buf, EPD_UI_HUMID_REGION_H, EPD_UI_HUMID_REGION_W);
 }
 
-/* Representative WMO code per icon type (each has a bitmap). */
+/* Representative WMO code per icon type (weather_icon_kind_wmo in the atlas). */
 static int icon_to_wmo(epd_ui_weather_icon_t icon) {
-  switch (icon) {
-    case EPD_UI_ICON_CLEAR:         return 0;
-    case EPD_UI_ICON_PARTLY_CLOUDY: return 2;
-    case EPD_UI_ICON_CLOUDY:       return 3;
-    case EPD_UI_ICON_FOG:          return 45;
-    case EPD_UI_ICON_RAIN:         return 61;
-    case EPD_UI_ICON_SNOW:         return 71;
-    case EPD_UI_ICON_THUNDERSTORM: return 95;
-    default:                       return 3;
-  }
-}
-
-/* Fill frame-sized 1-bit buffer: center icon (by WMO) or fallback to drawn icon. */
-static void fill_icon_buf_64x64(unsigned char *buf, int wmo_code, epd_ui_weather_icon_t fallback_icon) {
-  const unsigned char *bitmap = weather_icon_bitmap_by_wmo(wmo_code);
-  if (bitmap) {
-    unsigned int icon_w = weather_icon_1bit_width_by_wmo(wmo_code);
-    unsigned int icon_h = weather_icon_1bit_height_by_wmo(wmo_code);
-    unsigned int ox = (EPD_UI_ICON_REGION_W - icon_w) / 2u;
-    unsigned int oy = (EPD_UI_ICON_REGION_H - icon_h) / 2u;
-    memset(buf, 0, (size_t)ICON_BUF_SIZE);
-    copy_1bit_into_buf(buf, EPD_UI_ICON_REGION_W, EPD_UI_ICON_REGION_H,
-                      bitmap, icon_w, icon_h, ox, oy);
-  } else {
-    draw_weather_icon(buf, EPD_UI_ICON_REGION_W, EPD_UI_ICON_REGION_H, fallback_icon);
-  }
-}
-
-void epd_ui_draw_outdoor_icon(epd_ui_weather_icon_t icon) {
-  static unsigned char buf[ICON_BUF_SIZE];
-  int wmo = icon_to_wmo(icon);
-  fill_icon_buf_64x64(buf, wmo, icon);
+  return ((unsigned int)icon < EPD_UI_ICON_COUNT) ? weather_icon_kind_wmo[icon] : 3;
+}
+
+/* Fill a cleared 1-bit buffer of the icon frame, or of a multiple w x h of it, with the WMO code's
+ * composed icon scaled to fit if it is black and white only (sun, fog bands); false, with buf
+ * cleared, if the code needs its vector icon instead. */
+static bool fill_icon_buf_recipe(epd_ui_ctx_t *ctx, unsigned char *buf, unsigned int w, unsigned int h,
+                                 int wmo_code) {
+  const weather_icon_recipe_t *r = weather_icon_recipe(weather_icon_desc_by_wmo(wmo_code)->recipe);
+  if (!EPD_UI_VECTOR_ICONS && r &&
+      copy_4g_black_into_buf(buf, w, h, icon_compose(ctx, r), r->w, r->h, r->x, r->y, w / EPD_UI_ICON_REGION_W))
+    return true;
+  memset(buf, 0, (size_t)((w + 7u) / 8u) * h);
+  return false;
+}
+
+void epd_ui_draw_outdoor_icon(epd_ui_ctx_t *ctx, epd_ui_weather_icon_t icon) {
+  unsigned char *buf = legacy_buf_1bit(ctx, ICON_BUF_SIZE);
+  if (!fill_icon_buf_recipe(ctx, buf, EPD_UI_ICON_REGION_W, EPD_UI_ICON_REGION_H, icon_to_wmo(icon)))
+    draw_weather_icon(buf, EPD_UI_ICON_REGION_W, EPD_UI_ICON_REGION_H, EPD_UI_ICON_REGION_W, icon);
   EPD_Dis_Part(EPD_UI_OUTDOOR_ICON_X, EPD_UI_OUTDOOR_ICON_Y, buf, EPD_UI_ICON_REGION_H, EPD_UI_ICON_PART_LINE);
 }
 
-/* Scale icon 2x (e.g. 106x106 -> 212x212); source/dest use row-stride layout. */
-static void scale_icon_2x(const unsigned char *src, unsigned char *dst) {
-  const unsigned int sw = EPD_UI_ICON_REGION_W, sh = EPD_UI_ICON_REGION_H;
-  const unsigned int dw = EPD_UI_LARGE_ICON_W, dh = EPD_UI_LARGE_ICON_H;
-  const unsigned int src_stride = ICON_ROW_STRIDE, dst_stride = LARGE_ICON_ROW_STRIDE;
-  memset(dst, 0, (size_t)LARGE_ICON_BUF_SIZE);
-  for (unsigned int sy = 0; sy < sh; sy++) {
-    for (unsigned int sx = 0; sx < sw; sx++) {
-      unsigned int byte_ix = sy * src_stride + (sx / 8u);
-      unsigned int bit_ix  = 7 - (sx % 8u);
-      int on = (src[byte_ix] >> bit_ix) & 1;
-      if (!on) continue;
-      unsigned int dx = sx * 2u, dy = sy * 2u;
-      for (unsigned int oy = 0; oy < 2u; oy++) {
-        for (unsigned int ox = 0; ox < 2u; ox++) {
-          unsigned int byte_o = (dy + oy) * dst_stride + ((dx + ox) / 8u);
-          unsigned int bit_o  = 7 - ((dx + ox) % 8u);
-          dst[byte_o] |= (unsigned char)(1 << bit_o);
-        }
-      }
-    }
-  }
-}
-
-void epd_ui_draw_large_weather_icon(epd_ui_weather_icon_t icon) {
-  static unsigned char small_buf[ICON_BUF_SIZE];
-  static unsigned char large_buf[LARGE_ICON_BUF_SIZE];
-  int wmo = icon_to_wmo(icon);
-  fill_icon_buf_64x64(small_buf, wmo, icon);
-  scale_icon_2x(small_buf, large_buf);
-  EPD_Dis_Part(EPD_UI_LARGE_ICON_X, EPD_UI_LARGE_ICON_Y, large_buf, EPD_UI_LARGE_ICON_H, EPD_UI_LARGE_ICON_PART_LINE);
+/* Composed icons are doubled pixel by pixel; vector icons are drawn at the large size. */
+void epd_ui_draw_large_weather_icon(epd_ui_ctx_t *ctx, epd_ui_weather_icon_t icon) {
+  static_assert(EPD_UI_LARGE_ICON_W == 2u * EPD_UI_ICON_REGION_W && EPD_UI_LARGE_ICON_H == 2u * EPD_UI_ICON_REGION_H,
+                "large icon is the frame doubled");
+  unsigned char *buf = legacy_buf_1bit(ctx, LARGE_ICON_BUF_SIZE);
+  if (!fill_icon_buf_recipe(ctx, buf, EPD_UI_LARGE_ICON_W, EPD_UI_LARGE_ICON_H, icon_to_wmo(icon)))
+    draw_weather_icon(buf, EPD_UI_LARGE_ICON_W, EPD_UI_LARGE_ICON_H, EPD_UI_LARGE_ICON_W, icon);
+  EPD_Dis_Part(EPD_UI_LARGE_ICON_X, EPD_UI_LARGE_ICON_Y, buf, EPD_UI_LARGE_ICON_H, EPD_UI_LARGE_ICON_PART_LINE);
 }
 
-void epd_ui_draw_battery(float percent) {
-  static unsigned char buf[BATTERY_BUF_SIZE];
-  memset(buf, 0, sizeof(buf));
+void epd_ui_draw_battery(epd_ui_ctx_t *ctx, int percent) {
+  unsigned char *buf = legacy_buf_1bit(ctx, BATTERY_BUF_SIZE);
   char str[8];
-  if (percent < 0 || percent > 100)
-    snprintf(str, sizeof(str), "--%%");
-  else
-    snprintf(str, sizeof(str), "%.0f%%", (double)percent);
+  format_humidity(str, sizeof(str), percent);
   draw_string(buf, EPD_UI_BATTERY_REGION_W, EPD_UI_BATTERY_REGION_H, 0, 8, str);
   EPD_Dis_Part(EPD_UI_BATTERY_X, EPD_UI_BATTERY_Y, buf, EPD_UI_BATTERY_REGION_H, EPD_UI_BATTERY_REGION_W);
 }
 
-void epd_ui_draw_status(const char *str) {
-  static unsigned char buf[STATUS_BUF_SIZE];
-  memset(buf, 0, sizeof(buf));
+void epd_ui_draw_status(epd_ui_ctx_t *ctx, const char *str) {
+  unsigned char *buf = legacy_buf_1bit(ctx, STATUS_BUF_SIZE);
   if (str) draw_string(buf, EPD_UI_STATUS_REGION_W, EPD_UI_STATUS_REGION_H, 0, 8, str);
   EPD_Dis_Part(EPD_UI_STATUS_X, EPD_UI_STATUS_Y, buf, EPD_UI_STATUS_REGION_H, EPD_UI_STATUS_REGION_W);
 }
 
-void epd_ui_draw_status2(const char *str) {
-  static unsigned char buf[STATUS_BUF_SIZE];
-  memset(buf, 0, sizeof(buf));
+void epd_ui_draw_status2(epd_ui_ctx_t *ctx, const char *str) {
+  unsigned char *buf = legacy_buf_1bit(ctx, STATUS_BUF_SIZE);
   if (str) draw_string(buf, EPD_UI_STATUS_REGION_W, EPD_UI_STATUS_REGION_H, 0, 8, str);
   EPD_Dis_Part(EPD_UI_STATUS2_X, EPD_UI_STATUS2_Y, buf, EPD_UI_STATUS_REGION_H, EPD_UI_STATUS_REGION_W);
 }
 
-/* -------- New layout-aligned partial redraw helpers -------- */
+/* -------- Display list -------- */
+
+/* What a frame or a block draws, recorded by the layout_*_4g functions and rasterized later,
+ * one band at a time, by band_render_4g(). Items stay in drawing order (icons overwrite, text and
+ * rects merge) and each has a box covering every pixel it writes, so an item is skipped for bands
+ * it misses and its box is its dirty box. Text is copied into the list. Items recorded between
+ * dl_clip_push() and dl_clip_pop() are clipped to that rectangle: their boxes are cut to it when
+ * recorded and it is the active clip while they are rasterized. */
+typedef enum {
+  EPD_UI_DL_TEXT = 0,      /* src: GFXfont, (x, y): baseline, arg: offset in text[] */
+  EPD_UI_DL_RECT,          /* filled w x h at (x, y) */
+  EPD_UI_DL_ICON_4G,       /* src: 2bpp column-major icon, w x h at (x, y) */
+  EPD_UI_DL_ICON_ATLAS,    /* src: 4G weather_icon_image_t, w x h at (x, y) */
+  EPD_UI_DL_ICON_RECIPE,   /* src: weather_icon_recipe_t, composed, its w x h box at (x, y) */
+  EPD_UI_DL_ICON_RECIPE_FIT, /* same, fitted into an arg x arg box at (x, y) */
+  EPD_UI_DL_ICON_VECTOR,   /* src: vector icon of kind arg, rasterized as a w x w square at (x, y) */
+  EPD_UI_DL_SPANS,         /* w x h chart strip at (x, y), arg: offset of its column spans in spans[] */
+  EPD_UI_DL_SPANS_FILL     /* same, the area below the spans */
+} epd_ui_dl_kind_t;
+
+/* Items and lists are epd_ui_dl_item_t / epd_ui_dl_t (epd_ui.h); a context holds the frame's
+ * list and the blocks' list. */
+
+/* Empty dl on a white background; ctx no longer caches a band of it, nor a cached page for it. */
+static void dl_reset(epd_ui_ctx_t *ctx, epd_ui_dl_t *dl) {
+  dl->count = 0;
+  dl->text_len = 0;
+  dl->span_len = 0;
+  dl->clips[0] = rect_clip_screen(0, 0, (int)EPD_WIDTH, (int)EPD_HEIGHT);
+  dl->clip_count = 1;
+  dl->clip_depth = 0;
+  dl->clip = 0;
+  dl->background = 0;
+  if (ctx->band_dl == dl) ctx->band_dl = NULL;
+  if (dl == &ctx->frame_dl) ctx->cache_hit = 0;
+}
+
+/* Clip the items recorded until the matching dl_clip_pop() to (x, y, w, h), inside the current
+ * clip. Past EPD_UI_DL_CLIPS rectangles or EPD_UI_CLIP_DEPTH levels the clip stays as it is. */
+static void dl_clip_push(epd_ui_dl_t *dl, int x, int y, int w, int h) {
+  if (dl->clip_depth < EPD_UI_CLIP_DEPTH) {
+    dl->clip_stack[dl->clip_depth] = dl->clip;
+    if (dl->clip_count < EPD_UI_DL_CLIPS) {
+      epd_ui_rect_t r = rect_clip_screen(x, y, w, h);
+      dl->clips[dl->clip_count] = rect_intersect(&dl->clips[dl->clip], &r);
+      dl->clip = (uint8_t)dl->clip_count++;
+    }
+  }
+  dl->clip_depth++;
+}
+
+static void dl_clip_pop(epd_ui_dl_t *dl) {
+  if (dl->clip_depth == 0u) return;
+  if (--dl->clip_depth < EPD_UI_CLIP_DEPTH) dl->clip = dl->clip_stack[dl->clip_depth];
+}
+
+/* Append an item, its box cut to the current clip; items with nothing left inside it and items
+ * past EPD_UI_DL_MAX are dropped. */
+static epd_ui_dl_item_t *dl_add(epd_ui_dl_t *dl, epd_ui_dl_kind_t kind, const epd_ui_rect_t *box) {
+  epd_ui_rect_t b = rect_intersect(box, &dl->clips[dl->clip]);
+  if (b.w == 0u || dl->count >= EPD_UI_DL_MAX) return NULL;
+  epd_ui_dl_item_t *it = &dl->items[dl->count++];
+  memset(it, 0, sizeof(*it));
+  it->kind = (uint8_t)kind;
+  it->box = b;
+  it->clip = dl->clip;
+  return it;
+}
+
+static void dl_text(epd_ui_dl_t *dl, int x, int y, const char *str, const GFXfont *font, unsigned int gray) {
+  if (!str || !font || gray > 3u) return;
+  size_t len = strlen(str) + 1u;
+  if (dl->text_len + len > sizeof(dl->text)) return;
+  epd_ui_rect_t box = gfxfont_string_ink(x, y, str, font);
+  epd_ui_dl_item_t *it = dl_add(dl, EPD_UI_DL_TEXT, &box);
+  if (!it) return;
+  memcpy(dl->text + dl->text_len, str, len);
+  it->src = font;
+  it->arg = (int)dl->text_len;
+  it->x = (int16_t)x;
+  it->y = (int16_t)y;
+  it->gray = (uint8_t)gray;
+  dl->text_len += (unsigned int)len;
+}
+
+static void dl_rect(epd_ui_dl_t *dl, unsigned int x, unsigned int y, unsigned int w, unsigned int h,
+                    unsigned int gray) {
+  if (gray > 3u || x >= EPD_WIDTH || y >= EPD_HEIGHT) return;
+  epd_ui_rect_t box = rect_clip_screen((int)x, (int)y, (int)w, (int)h);
+  epd_ui_dl_item_t *it = dl_add(dl, EPD_UI_DL_RECT, &box);
+  if (!it) return;
+  it->x = (int16_t)box.x;
+  it->y = (int16_t)box.y;
+  it->w = box.w;
+  it->h = box.h;
+  it->gray = (uint8_t)gray;
+}
 
-/* Convert one 4G pixel to 2-bit grayscale value (0..3). */
-static unsigned int get_pixel_4g_value(unsigned int x, unsigned int y) {
-  if (epd_ui_4g_flip_y) {
-    y = (EPD_HEIGHT - 1u) - y;
-  }
-  if (x >= EPD_WIDTH || y >= EPD_HEIGHT) return 0u;
-  unsigned int byte_ix;
-  unsigned int nibble_shift;
-#if EPD_UI_4G_COLUMN_MAJOR
-  unsigned int col_byte = (y / 8u) * 2u + ((y % 8u) / 4u);
-  byte_ix = x * EPD_4G_BYTES_PER_COL + col_byte;
-  nibble_shift = (y % 4u);
-#else
-  unsigned int group = y * 60u + (x / 8u);
-  byte_ix = group * 2u + ((x % 8u) / 4u);
-  nibble_shift = (x % 4u);
+/* Horizontal line from x0 to x1 inclusive at y. */
+static void dl_hline(epd_ui_dl_t *dl, unsigned int x0, unsigned int x1, unsigned int y, unsigned int gray) {
+  if (x0 <= x1) dl_rect(dl, x0, y, x1 - x0 + 1u, 1u, gray);
+}
+
+/* 1-pixel rectangle outline, black. */
+static void dl_rect_outline(epd_ui_dl_t *dl, unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+  if (w == 0u || h == 0u) return;
+  dl_hline(dl, x, x + w - 1u, y, 3u);
+  dl_hline(dl, x, x + w - 1u, y + h - 1u, 3u);
+  dl_rect(dl, x, y, 1u, h, 3u);
+  dl_rect(dl, x + w - 1u, y, 1u, h, 3u);
+}
+
+static void dl_icon_4g(epd_ui_dl_t *dl, const unsigned char *icon_4g, unsigned int x, unsigned int y,
+                       unsigned int w, unsigned int h) {
+  epd_ui_rect_t box = rect_clip_screen((int)x, (int)y, (int)w, (int)h);
+  epd_ui_dl_item_t *it = dl_add(dl, EPD_UI_DL_ICON_4G, &box);
+  if (!it) return;
+  it->src = icon_4g;
+  it->x = (int16_t)x;
+  it->y = (int16_t)y;
+  it->w = (uint16_t)w;
+  it->h = (uint16_t)h;
+}
+
+/* Box of an w x h image fitted into a box_size square at (x, y), as blit_*_fit draw it. */
+static epd_ui_rect_t fit_box(unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned int box_size) {
+  unsigned int max_dim = (w >= h) ? w : h;
+  unsigned int dest_w = max_dim ? (w * box_size) / max_dim : 0u;
+  unsigned int dest_h = max_dim ? (h * box_size) / max_dim : 0u;
+  if (dest_w == 0u || dest_h == 0u) return rect_clip_screen(0, 0, 0, 0);
+  return rect_clip_screen((int)(x + (box_size - dest_w) / 2u), (int)(y + (box_size - dest_h) / 2u),
+                          (int)dest_w, (int)dest_h);
+}
+
+static void dl_icon_atlas(epd_ui_dl_t *dl, const weather_icon_image_t *img, unsigned int x, unsigned int y) {
+  epd_ui_rect_t box = rect_clip_screen((int)x, (int)y, (int)img->w, (int)img->h);
+  epd_ui_dl_item_t *it = dl_add(dl, EPD_UI_DL_ICON_ATLAS, &box);
+  if (!it) return;
+  it->src = img;
+  it->x = (int16_t)x;
+  it->y = (int16_t)y;
+  it->w = img->w;
+  it->h = img->h;
+}
+
+/* Recipe r composed at draw time; (frame_x, frame_y) is the icon frame, the item covers r's box. */
+static void dl_icon_recipe(epd_ui_dl_t *dl, const weather_icon_recipe_t *r, unsigned int frame_x, unsigned int frame_y) {
+  unsigned int x = frame_x + r->x, y = frame_y + r->y;
+  epd_ui_rect_t box = rect_clip_screen((int)x, (int)y, (int)r->w, (int)r->h);
+  epd_ui_dl_item_t *it = dl_add(dl, EPD_UI_DL_ICON_RECIPE, &box);
+  if (!it) return;
+  it->src = r;
+  it->x = (int16_t)x;
+  it->y = (int16_t)y;
+  it->w = r->w;
+  it->h = r->h;
+}
+
+static void dl_icon_recipe_fit(epd_ui_dl_t *dl, const weather_icon_recipe_t *r, unsigned int x, unsigned int y,
+                               unsigned int box_size) {
+  epd_ui_rect_t box = fit_box(x, y, r->w, r->h, box_size);
+  epd_ui_dl_item_t *it = dl_add(dl, EPD_UI_DL_ICON_RECIPE_FIT, &box);
+  if (!it) return;
+  it->src = r;
+  it->arg = (int)box_size;
+  it->x = (int16_t)x;
+  it->y = (int16_t)y;
+  it->w = r->w;
+  it->h = r->h;
+}
+
+/* Vector icon of kind drawn as a size px square at (x, y). */
+static void dl_icon_vector(epd_ui_dl_t *dl, epd_ui_weather_icon_t kind, unsigned int x, unsigned int y,
+                           unsigned int size) {
+  if ((unsigned int)kind >= EPD_UI_ICON_COUNT) kind = EPD_UI_ICON_CLOUDY;
+  epd_ui_rect_t box = rect_clip_screen((int)x, (int)y, (int)size, (int)size);
+  epd_ui_dl_item_t *it = dl_add(dl, EPD_UI_DL_ICON_VECTOR, &box);
+  if (!it) return;
+  it->src = weather_icon_vectors[kind];
+  it->arg = (int)kind;
+  it->x = (int16_t)x;
+  it->y = (int16_t)y;
+  it->w = (uint16_t)size;
+  it->h = (uint16_t)size;
+}
+
+/* Chart line through (xs[i], ys[i]), i < n, in the w x h strip at (x, y) (xs < w, ys < h, xs
+ * ascending), 2 px thick in line_gray, the area below it in fill_gray (0 = none). Its column
+ * spans are copied into the list; past EPD_UI_DL_SPAN_COLS the chart is dropped. */
+static void dl_chart(epd_ui_dl_t *dl, unsigned int x, unsigned int y, unsigned int w, unsigned int h,
+                     const uint16_t *xs, const uint8_t *ys, unsigned int n, unsigned int line_gray,
+                     unsigned int fill_gray) {
+  if (n == 0u || line_gray > 3u || fill_gray > 3u || dl->span_len + 2u * w > sizeof(dl->spans)) return;
+  uint8_t *spans = dl->spans + dl->span_len;
+  polyline_spans(xs, ys, n, spans, w);
+  unsigned int c0 = w, c1 = 0, top = 0xFFu, bottom = 0;
+  for (unsigned int c = 0; c < w; c++) {
+    uint8_t *sp = spans + 2u * c;
+    if (sp[0] > sp[1]) continue;
+    if (sp[0] > 0u) sp[0]--;  /* second pixel row */
+    if (c < c0) c0 = c;
+    c1 = c;
+    if (sp[0] < top) top = sp[0];
+    if (sp[1] > bottom) bottom = sp[1];
+  }
+  if (c0 > c1) return;
+  const unsigned int kinds = fill_gray ? 2u : 1u;
+  for (unsigned int k = 0; k < kinds; k++) {
+    const bool fill = (k == 0u && fill_gray);
+    epd_ui_rect_t box = rect_clip_screen((int)(x + c0), (int)(y + top), (int)(c1 - c0 + 1u),
+                                         (int)((fill ? h : bottom + 1u) - top));
+    epd_ui_dl_item_t *it = dl_add(dl, fill ? EPD_UI_DL_SPANS_FILL : EPD_UI_DL_SPANS, &box);
+    if (!it) return;
+    it->arg = (int)dl->span_len;
+    it->x = (int16_t)x;
+    it->y = (int16_t)y;
+    it->w = (uint16_t)w;
+    it->h = (uint16_t)h;
+    it->gray = (uint8_t)(fill ? fill_gray : line_gray);
+  }
+  dl->span_len += 2u * w;
+}
+
+static void dl_raster_item(epd_ui_ctx_t *ctx, const epd_ui_dl_t *dl, const epd_ui_dl_item_t *it) {
+  switch (it->kind) {
+    case EPD_UI_DL_TEXT:
+      draw_gfxfont_string_4g(ctx, it->x, it->y, dl->text + it->arg, (const GFXfont *)it->src, it->gray);
+      break;
+    case EPD_UI_DL_RECT:
+      if (it->h == 1u)
+        draw_hline_4g_value(ctx, (unsigned int)it->x, (unsigned int)it->x + it->w - 1u, (unsigned int)it->y, it->gray);
+      else
+        fill_rect_4g_value(ctx, (unsigned int)it->x, (unsigned int)it->y, it->w, it->h, it->gray);
+      break;
+    case EPD_UI_DL_SPANS:
+    case EPD_UI_DL_SPANS_FILL:
+      draw_spans_4g(ctx, it->x, it->y, it->w, it->h, dl->spans + it->arg, it->kind == EPD_UI_DL_SPANS_FILL, it->gray);
+      break;
+    case EPD_UI_DL_ICON_4G:
+      blit_4g_icon_to_4g(ctx, (const unsigned char *)it->src, (unsigned int)it->x, (unsigned int)it->y, it->w, it->h);
+      break;
+    case EPD_UI_DL_ICON_ATLAS:
+      blit_atlas_4g(ctx, (const weather_icon_image_t *)it->src, (unsigned int)it->x, (unsigned int)it->y);
+      break;
+    case EPD_UI_DL_ICON_RECIPE:
+      blit_4g_icon_to_4g(ctx, icon_compose(ctx, (const weather_icon_recipe_t *)it->src), (unsigned int)it->x,
+                         (unsigned int)it->y, it->w, it->h);
+      break;
+    case EPD_UI_DL_ICON_RECIPE_FIT:
+      blit_4g_icon_to_4g_fit(ctx, icon_compose(ctx, (const weather_icon_recipe_t *)it->src), (unsigned int)it->x,
+                             (unsigned int)it->y, it->w, it->h, (unsigned int)it->arg);
+      break;
+    case EPD_UI_DL_ICON_VECTOR:
+      vector_icon_draw_4g(ctx, (epd_ui_weather_icon_t)it->arg, (unsigned int)it->x, (unsigned int)it->y, it->w);
+      break;
+    default:
+      break;
+  }
+}
+
+/* -------- Packed columns: the static layer and the page cache -------- */
+
+/* A packed column is one PackBits stream per plane, plane 0 first, each of EPD_4G_BYTES_PER_COL
+ * bytes: control byte c < 128 is followed by c + 1 literal bytes, c >= 128 by one byte repeated
+ * c - 126 times. */
+
+/* Decode the packed column at p..end onto band byte i of the white band (an ink band only steps
+ * over the plane 0 stream). White runs are only skipped, so a column holding one line costs a few
+ * control bytes. Returns the end of the column, NULL if a run overflows the plane or end. */
+static const uint8_t *packed_column_fill_4g(const epd_fb_4g_t &fb, unsigned int i, const uint8_t *p,
+                                            const uint8_t *end) {
+  for (unsigned int k = 0; k < epd_fb_4g_t::kPlanes; k++) {
+    uint8_t *dst = fb.drawn(k) ? fb.plane_bits(k) + i : NULL;
+    for (unsigned int n = EPD_4G_BYTES_PER_COL; n;) {
+      if (p >= end) return NULL;
+      const unsigned int c = *p++;
+      const unsigned int run = (c < 128u) ? c + 1u : c - 126u;
+      if (run > n || (size_t)(end - p) < ((c < 128u) ? run : 1u)) return NULL;
+      if (c < 128u) {
+        if (dst) memcpy(dst, p, run);
+        p += run;
+      } else {
+        if (dst && *p) memset(dst, *p, run);
+        p++;
+      }
+      if (dst) dst += run;
+      n -= run;
+    }
+  }
+  return p;
+}
+
+/* n bytes as a PackBits stream into out (room for 2 * n bytes), the encoding of
+ * tools/static_layer_bake.cpp. Returns its length. */
+static unsigned int packbits_encode(const uint8_t *src, unsigned int n, uint8_t *out) {
+  unsigned int len = 0, i = 0;
+  while (i < n) {
+    unsigned int j = i;
+    while (j < n && src[j] == src[i] && j - i < 129u) j++;
+    if (j - i >= 2u) {
+      out[len++] = (uint8_t)(126u + (j - i));
+      out[len++] = src[i];
+      i = j;
+      continue;
+    }
+    const unsigned int start = i;
+    while (i < n && i - start < 128u && !(i + 1u < n && src[i + 1u] == src[i])) i++;
+    out[len++] = (uint8_t)(i - start - 1u);
+    memcpy(out + len, src + start, i - start);
+    len += i - start;
+  }
+  return len;
+}
+
+#define EPD_UI_PACKED_COLUMN_MAX  (2u * 2u * EPD_4G_BYTES_PER_COL)  /* worst case, both planes */
+static_assert(EPD_UI_PACKED_COLUMN_MAX <= EPD_UI_PAGE_CACHE_CHUNK, "a packed column fits a cache chunk");
+
+#if EPD_UI_STATIC_LAYER
+/* Columns x0..x1-1 of the static layer onto the white band. */
+static void static_layer_fill_4g(epd_ui_ctx_t *ctx, unsigned int x0, unsigned int x1) {
+  const epd_fb_4g_t fb = band_fb(ctx);
+  for (unsigned int x = x0; x < x1; x++)
+    packed_column_fill_4g(fb, epd_fb_plane_t::byte_index(x - ctx->band_x, 0u),
+                          epd_ui_static_layer + epd_ui_static_layer_cols[x],
+                          epd_ui_static_layer + sizeof(epd_ui_static_layer));
+}
+#endif
+
+/* Columns x0..x1-1 of the cached page onto the white band, read from the store a chunk of whole
+ * columns at a time. False if the store fails or the data does not decode. */
+static bool page_cache_fill_4g(epd_ui_ctx_t *ctx, unsigned int x0, unsigned int x1) {
+  const epd_ui_page_store_t *store = ctx->cache_store;
+  const uint32_t *cols = ctx->cache_cols;
+  const epd_fb_4g_t fb = band_fb(ctx);
+  for (unsigned int x = x0; x < x1;) {
+    unsigned int x_end = x + 1u;
+    while (x_end < x1 && cols[x_end + 1u] >= cols[x] && cols[x_end + 1u] - cols[x] <= EPD_UI_PAGE_CACHE_CHUNK)
+      x_end++;
+    if (cols[x_end] < cols[x] || cols[x_end] - cols[x] > EPD_UI_PAGE_CACHE_CHUNK) return false;
+    const size_t n = cols[x_end] - cols[x];
+    if (store->read(store->user, ctx->cache_page, 1u, cols[x], ctx->cache_buf, n) != n) return false;
+    const uint8_t *p = ctx->cache_buf;
+    for (; x < x_end; x++) {
+      p = packed_column_fill_4g(fb, epd_fb_plane_t::byte_index(x - ctx->band_x, 0u), p, ctx->cache_buf + n);
+      if (!p) return false;
+    }
+  }
+  return true;
+}
+
+/* Rasterize the items of dl that touch the band starting at column band_x into ctx's band buffer,
+ * as a 4G band or an ink band (ink), only inside region (the whole band if NULL): that part of
+ * the band is the clip, and each item is drawn under its own clip inside it. The buffer is kept
+ * while the same list, band and kind are asked for again with a region it already covers. The
+ * background is the static layer (dl->background) or white. A frame found in the page cache is
+ * decoded from it instead; if that fails, it is rasterized after all. */
+static void band_render(epd_ui_ctx_t *ctx, const epd_ui_dl_t *dl, unsigned int band_x, const epd_ui_rect_t *region,
+                        bool ink) {
+  const epd_ui_rect_t band = { (uint16_t)band_x, 0u, (uint16_t)EPD_UI_BAND_COLS, (uint16_t)EPD_HEIGHT };
+  const epd_ui_rect_t r = region ? rect_intersect(&band, region) : band;
+  if (dl == ctx->band_dl && band_x == ctx->band_x && ink == (ctx->band_ink != 0u) &&
+      rect_contains(&ctx->band_region, &r))
+    return;
+  ctx->band_x = band_x;
+  ctx->band_dl = dl;
+  ctx->band_region = r;
+  ctx->band_ink = ink ? 1u : 0u;
+  clip_reset_4g(ctx, &r);
+  if (r.w == EPD_UI_BAND_COLS && r.h == EPD_HEIGHT)
+    band_fb(ctx).clear(0u);  /* white background */
+  else
+    fill_rect_4g_value(ctx, r.x, r.y, r.w, r.h, 0u);
+  if (dl == &ctx->frame_dl && ctx->cache_hit) {
+    if (page_cache_fill_4g(ctx, r.x, r.x + r.w)) return;  /* whole columns, as the static layer */
+    ctx->cache_hit = 0;
+    fill_rect_4g_value(ctx, r.x, r.y, r.w, r.h, 0u);
+  }
+#if EPD_UI_STATIC_LAYER
+  if (dl->background) static_layer_fill_4g(ctx, r.x, r.x + r.w);  /* whole columns: rows outside r are not read */
 #endif
-  return (unsigned int)((epd_4g_buffer[byte_ix] >> (6u - nibble_shift * 2u)) & 0x3u);
+  for (unsigned int i = 0; i < dl->count; i++) {
+    const epd_ui_dl_item_t *it = &dl->items[i];
+    const epd_ui_rect_t hit = rect_intersect(&it->box, &r);
+    if (hit.w == 0u) continue;
+    clip_push_4g(ctx, &dl->clips[it->clip]);
+    dl_raster_item(ctx, dl, it);
+    clip_pop_4g(ctx);
+  }
+}
+
+static void band_render_4g(epd_ui_ctx_t *ctx, const epd_ui_dl_t *dl, unsigned int band_x,
+                           const epd_ui_rect_t *region) {
+  band_render(ctx, dl, band_x, region, false);
+}
+
+/* Dirty list = the item boxes of dl. */
+static void dl_dirty_4g(epd_ui_ctx_t *ctx, const epd_ui_dl_t *dl) {
+  dirty_reset_4g(ctx);
+  for (unsigned int i = 0; i < dl->count; i++)
+    dirty_add_4g(ctx, dl->items[i].box.x, dl->items[i].box.y, dl->items[i].box.w, dl->items[i].box.h);
+}
+
+/* Hash of what an item draws (FNV-1a over its parameters and text). Equal hashes at the same
+ * list position mean equal pixels, so the frame diff only rasterizes tiles where they differ. */
+static uint32_t dl_item_hash(const epd_ui_dl_t *dl, const epd_ui_dl_item_t *it) {
+  const epd_ui_rect_t *c = &dl->clips[it->clip];
+  const uint32_t v[] = { it->kind, it->gray, (uint16_t)it->x, (uint16_t)it->y, it->w, it->h,
+                         (uint32_t)it->arg, (uint32_t)(uintptr_t)it->src, c->x, c->y, c->w, c->h };
+  uint32_t h = 2166136261ul;
+  for (unsigned int i = 0; i < sizeof(v) / sizeof(v[0]); i++)
+    h = (h ^ v[i]) * 16777619ul;
+  if (it->kind == EPD_UI_DL_TEXT)
+    for (const char *c = dl->text + it->arg; *c; c++) h = (h ^ (unsigned char)*c) * 16777619ul;
+  if (it->kind == EPD_UI_DL_SPANS || it->kind == EPD_UI_DL_SPANS_FILL)
+    for (unsigned int i = 0; i < 2u * it->w; i++) h = (h ^ dl->spans[it->arg + (int)i]) * 16777619ul;
+  return h;
+}
+
+/* -------- 1-bit output: plain or ordered dither -------- */
+
+/* 4x4 Bayer matrix, [y & 3][x & 3]. */
+static constexpr uint8_t bayer4[4][4] = { { 0u, 8u, 2u, 10u }, { 12u, 4u, 14u, 6u }, { 3u, 11u, 1u, 9u }, { 15u, 7u, 13u, 5u } };
+
+/* Ink of gray level g (1 light, 2 dark) in column x for 8 rows of a plane byte (MSB = top row,
+ * rows repeat every 4): pixels whose threshold is below g / 3 of the 16 levels. */
+static constexpr uint8_t dither_byte(unsigned int g, unsigned int x) {
+  unsigned int b = 0;
+  for (unsigned int r = 0; r < 8u; r++)
+    b = (b << 1) | (bayer4[r & 3u][x & 3u] < (g * 16u + 1u) / 3u ? 1u : 0u);
+  return (uint8_t)b;
+}
+static constexpr uint8_t dither_light[4] = { dither_byte(1u, 0u), dither_byte(1u, 1u), dither_byte(1u, 2u), dither_byte(1u, 3u) };
+static constexpr uint8_t dither_dark[4] = { dither_byte(2u, 0u), dither_byte(2u, 1u), dither_byte(2u, 2u), dither_byte(2u, 3u) };
+
+/* Black pixels (bit set) of 8 rows of column x from their two 4G plane bytes: black stays black,
+ * dark and light gray become 11/16 and 5/16 of a Bayer pattern with dither, else dark gray and
+ * black are black and light gray is white. */
+static inline uint8_t ink_1bit(uint8_t lo, uint8_t hi, unsigned int x, bool dither) {
+  if (!dither) return hi;
+  return (uint8_t)((lo & hi) | (hi & ~lo & dither_dark[x & 3u]) | (lo & ~hi & dither_light[x & 3u]));
+}
+
+/* The band of ctx as a 1-bit image (1 = white), written over plane 0: EPD_UI_BAND_COLS * 100
+ * bytes, 48000 for the whole frame, in the order EPD_Write_Fast_Band streams. The band no longer
+ * holds a 4G rendering afterwards. */
+static void band_to_1bit(epd_ui_ctx_t *ctx) {
+  const epd_fb_4g_t fb = band_fb(ctx);
+  uint8_t *lo = fb.plane_bits(0);
+  const uint8_t *hi = fb.plane_bits(1);
+  for (unsigned int x = 0; x < EPD_UI_BAND_COLS; x++) {
+    for (unsigned int k = 0, i = epd_fb_plane_t::byte_index(x, 0u); k < EPD_4G_BYTES_PER_COL; k++, i++)
+      lo[i] = (uint8_t)~ink_1bit(lo[i], hi[i], ctx->band_x + x, true);
+  }
+  ctx->band_dl = NULL;
 }
 
-/* Pack rectangular region from 4G buffer into 1-bit buffer and push with EPD_Dis_Part.
+/* -------- New layout-aligned partial redraw helpers -------- */
+
+/* Push a rectangular region of dl as a 1-bit partial update, rasterized band by band.
  * NOTE: In this panel driver, partial-update addressing uses swapped axes:
  *   - PART_LINE   maps to panel X (0..799)  -> logical Y
  *   - PART_COLUMN maps to panel Y (0..479)  -> logical X
- * So we transpose logical coordinates before issuing EPD_Dis_Part.
+ * So each panel row is one logical column. Without dither the region is rendered as an ink band,
+ * whose column segments are the rows as they are sent (inverted for the partial polarity and
+ * masked to the region); with dither (as a fast refresh draws the grays) it is rendered in 4G
+ * and the rows are ink_1bit() of both planes.
  */
-static void push_4g_region_as_1bit(unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
-  static unsigned char part_buf[EPD_ARRAY];  /* max full-screen 1-bit buffer */
-  static unsigned char clear_buf[EPD_ARRAY]; /* same shape, forced white */
+static void push_4g_region_as_1bit(epd_ui_ctx_t *ctx, const epd_ui_dl_t *dl, unsigned int x, unsigned int y,
+                                   unsigned int w, unsigned int h, bool dither) {
+  unsigned char row_buf[EPD_4G_BYTES_PER_COL];
   /* Driver aligns panel-X to 8px; panel-X corresponds to logical Y. */
   unsigned int y_aligned = y - (y % 8u);
   unsigned int y_pad = y - y_aligned;            /* top blank pixels in logical region */
   unsigned int line_aligned = ((h + y_pad + 7u) / 8u) * 8u;  /* panel-X span */
   unsigned int row_stride = line_aligned / 8u;                /* bytes per panel row */
-  unsigned int total_bytes = row_stride * w;                  /* rows == logical width */
-  if (total_bytes > EPD_ARRAY) return;
-  /* Partial 1-bit polarity: 1 = white, 0 = black. */
-  memset(clear_buf, 0xFF, total_bytes);
-  memset(part_buf, 0xFF, total_bytes);
-
-  /* Row-major in panel space: row=panel-Y(logical X), col=panel-X(logical Y). */
+  if (w == 0u || h == 0u || x + w > EPD_WIDTH || y_aligned + line_aligned > EPD_HEIGHT) return;
+  const unsigned char head_mask = (unsigned char)(0xFFu >> y_pad);
+  const unsigned char tail_mask = (unsigned char)(0xFFu << (7u - (y_pad + h - 1u) % 8u));
+  const epd_ui_rect_t region = { (uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h };
+
+  /* panel_x_start=logical_y, panel_y_start=logical_x. Partial 1-bit polarity: 1 = white, 0 = black. */
+  memset(row_buf, 0xFF, row_stride);
+  EPD_Dis_Part_Begin(y_aligned, x, w, line_aligned); /* clear region first */
+  for (unsigned int row = 0; row < w; row++)
+    EPD_Dis_Part_Data(row_buf, row_stride);
+  EPD_Part_Update();
+
+  EPD_Dis_Part_Begin(y_aligned, x, w, line_aligned);
   for (unsigned int row = 0; row < w; row++) {
-    for (unsigned int col = 0; col < line_aligned; col++) {
-      int on = 0;
-      if (col >= y_pad && col < y_pad + h) {
-        /* Threshold gray: dark gray/black -> black in 1-bit partial update. */
-        unsigned int logical_x = x + row;
-        unsigned int logical_y = y + (col - y_pad);
-        unsigned int v = get_pixel_4g_value(logical_x, logical_y);
-        on = (v >= 2u);
-      }
-      if (on) {
-        unsigned int byte_ix = row * row_stride + (col / 8u);
-        unsigned int bit_ix = 7u - (col % 8u);
-        part_buf[byte_ix] &= (unsigned char)(~(1u << bit_ix));
+    unsigned int logical_x = x + row;
+    band_render(ctx, dl, logical_x - logical_x % EPD_UI_BAND_COLS, &region, !dither);
+    const unsigned int i = epd_fb_plane_t::byte_index(logical_x - ctx->band_x, y_aligned);
+    const unsigned char *hi = band_fb(ctx).plane_bits(1) + i, *lo = dither ? band_fb(ctx).plane_bits(0) + i : hi;
+    for (unsigned int k = 0; k < row_stride; k++) {
+      unsigned char m = 0xFFu;
+      if (k == 0u) m &= head_mask;
+      if (k == row_stride - 1u) m &= tail_mask;
+      row_buf[k] = (unsigned char)~(ink_1bit(lo[k], hi[k], logical_x, dither) & m);
+    }
+    EPD_Dis_Part_Data(row_buf, row_stride);
+  }
+  EPD_Part_Update();
+}
+
+/* Partial-update planner. Each window costs two EPD_Dis_Part calls (clear + content), and each call
+ * resets the panel, waits on BUSY and runs the waveform, so a window has a large fixed cost next to
+ * the bytes it sends. Costs are in microseconds; tune for another driver or SPI clock. */
+#define EPD_UI_PART_WINDOW_COST_US  (2ul * 1000000ul)  /* reset 20 ms + 3 busy tails of 200 ms + ~0.4 s waveform */
+#define EPD_UI_PART_BYTE_COST_US    (2ul * 4ul)        /* each byte sent twice, ~4 us with CS per byte */
+/* Full 4G refresh: EPD_HW_Init_4G delays, both RAM planes, ~3 s 4-gray waveform plus busy tail. */
+#define EPD_UI_FULL_REFRESH_COST_US (1000000ul + (unsigned long)EPD_ARRAY * 2ul * 4ul + 3200000ul)
+/* Fast 1-bit refresh: EPD_HW_Init_Fast delays (reset, 2 busy tails), RAM 0x24 plus the white
+ * 0x26, ~1.5 s fast waveform plus busy tail. */
+#define EPD_UI_FAST_REFRESH_COST_US (600000ul + (unsigned long)EPD_ARRAY * 2ul * 4ul + 1700000ul)
+
+/* Window extended to the 8 px panel-X (logical Y) alignment of EPD_Dis_Part, kept inside band. */
+static epd_ui_rect_t part_window_align(const epd_ui_rect_t *r, const epd_ui_rect_t *band) {
+  unsigned int y0 = r->y - (r->y % 8u);
+  unsigned int y1 = ((r->y + r->h + 7u) / 8u) * 8u;
+  if (y0 < band->y) y0 = band->y;
+  if (y1 > band->y + band->h) y1 = band->y + band->h;
+  epd_ui_rect_t a = { r->x, (uint16_t)y0, r->w, (uint16_t)(y1 - y0) };
+  return a;
+}
+
+static unsigned long part_window_cost(const epd_ui_rect_t *r) {
+  unsigned int line_aligned = ((r->h + r->y % 8u + 7u) / 8u) * 8u;  /* as push_4g_region_as_1bit */
+  return EPD_UI_PART_WINDOW_COST_US + (unsigned long)r->w * (line_aligned / 8u) * EPD_UI_PART_BYTE_COST_US;
+}
+
+/* True if r overlaps any tile set in mask (one bit per EPD_UI_TILE_W x EPD_UI_TILE_H tile). */
+static int rect_hits_tiles(const epd_ui_rect_t *r, const uint8_t *mask) {
+  if (!mask || r->w == 0u || r->h == 0u) return 0;
+  for (unsigned int ty = r->y / EPD_UI_TILE_H; ty <= (r->y + r->h - 1u) / EPD_UI_TILE_H; ty++) {
+    for (unsigned int tx = r->x / EPD_UI_TILE_W; tx <= (r->x + r->w - 1u) / EPD_UI_TILE_W; tx++) {
+      unsigned int t = ty * EPD_UI_TILES_X + tx;
+      if (mask[t >> 3] & (1u << (t & 7u))) return 1;
+    }
+  }
+  return 0;
+}
+
+/* Merge the dirty boxes of ctx inside band into at most EPD_UI_PART_MAX_WINDOWS aligned windows:
+ * repeatedly merge the pair whose union costs least relative to pushing both, and stop once
+ * no merge pays off and the window limit is met. Merges that would spread over a keep_out tile
+ * are only taken to meet the limit. Returns the window count. */
+static unsigned int plan_part_windows(const epd_ui_ctx_t *ctx, const epd_ui_rect_t *band, epd_ui_rect_t *win,
+                                      const uint8_t *keep_out) {
+  unsigned int n = 0;
+  for (unsigned int i = 0; i < ctx->dirty_count; i++) {
+    const epd_ui_rect_t *d = &ctx->dirty[i];
+    unsigned int x0 = (d->x > band->x) ? d->x : band->x;
+    unsigned int y0 = (d->y > band->y) ? d->y : band->y;
+    unsigned int x1 = (d->x + d->w < band->x + band->w) ? d->x + d->w : band->x + band->w;
+    unsigned int y1 = (d->y + d->h < band->y + band->h) ? d->y + d->h : band->y + band->h;
+    if (x0 >= x1 || y0 >= y1) continue;
+    epd_ui_rect_t r = { (uint16_t)x0, (uint16_t)y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0) };
+    win[n++] = part_window_align(&r, band);
+  }
+  while (n > 1u) {
+    unsigned int bi = 0, bj = 1;
+    long best_gain = -0x7FFFFFFFl;
+    for (unsigned int i = 0; i < n; i++) {
+      for (unsigned int j = i + 1u; j < n; j++) {
+        epd_ui_rect_t u = rect_union(&win[i], &win[j]);
+        long gain = (long)(part_window_cost(&win[i]) + part_window_cost(&win[j])) - (long)part_window_cost(&u);
+        if (keep_out && rect_hits_tiles(&u, keep_out) &&
+            !rect_hits_tiles(&win[i], keep_out) && !rect_hits_tiles(&win[j], keep_out))
+          gain = -0x7FFFFFFEl;  /* last resort */
+        if (gain > best_gain) {
+          best_gain = gain;
+          bi = i;
+          bj = j;
+        }
       }
     }
+    if (best_gain < 0 && n <= EPD_UI_PART_MAX_WINDOWS) break;
+    win[bi] = rect_union(&win[bi], &win[bj]);
+    win[bj] = win[--n];
   }
-
-  /* panel_x_start=logical_y, panel_y_start=logical_x */
-  EPD_Dis_Part(y_aligned, x, clear_buf, w, line_aligned); /* clear region first */
-  EPD_Dis_Part(y_aligned, x, part_buf, w, line_aligned);
+  return n;
+}
+
+/* ctx->part_history: per-block boxes drawn by the previous partial push, so the next one also
+ * clears stale ink. Not retained across deep sleep or a full refresh; the first push then covers
+ * the whole band. */
+typedef enum {
+  EPD_UI_PART_TIME = 0,
+  EPD_UI_PART_BATTERY,
+  EPD_UI_PART_INDOOR,
+  EPD_UI_PART_OUTDOOR,
+  EPD_UI_PART_FORECAST,
+  EPD_UI_PART_COUNT
+} epd_ui_part_block_t;
+static_assert(EPD_UI_PART_COUNT == EPD_UI_PART_BLOCKS, "EPD_UI_PART_BLOCKS in epd_ui.h");
+
+/* Push what dl draws (plus what the block drew last time) inside the block's layout band. */
+static void push_4g_block(epd_ui_ctx_t *ctx, epd_ui_part_block_t block, const epd_ui_dl_t *dl,
+                          unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+  epd_ui_part_history_t *hist = &ctx->part_history[block];
+  dl_dirty_4g(ctx, dl);
+  const epd_ui_rect_t band = { (uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h };
+  epd_ui_rect_t drawn[EPD_UI_DIRTY_MAX];
+  unsigned int drawn_count = ctx->dirty_count;
+  memcpy(drawn, ctx->dirty, drawn_count * sizeof(drawn[0]));
+
+  if (!hist->valid) {
+    push_4g_region_as_1bit(ctx, dl, x, y, w, h, false);
+  } else {
+    epd_ui_rect_t win[EPD_UI_DIRTY_MAX];
+    for (unsigned int i = 0; i < hist->count; i++)
+      dirty_add_4g(ctx, hist->rects[i].x, hist->rects[i].y, hist->rects[i].w, hist->rects[i].h);
+    unsigned int n = plan_part_windows(ctx, &band, win, NULL);
+    for (unsigned int i = 0; i < n; i++)
+      push_4g_region_as_1bit(ctx, dl, win[i].x, win[i].y, win[i].w, win[i].h, false);
+  }
+  memcpy(hist->rects, drawn, drawn_count * sizeof(drawn[0]));
+  hist->count = (uint8_t)drawn_count;
+  hist->valid = 1u;
 }
 
-/* Draw only time in full-screen 4G buffer, then push header region. */
-void epd_ui_draw_time_header(const char *time_str) {
-  memset(epd_4g_buffer, 0, sizeof(epd_4g_buffer));
-  epd_ui_4g_flip_y = 1;
+/* -------- Layout: one recorder per screen section, shared by the full frame and the blocks -------- */
+
+/* Header: time, Inter Regular 32px dark gray. */
+static void layout_time_4g(epd_ui_dl_t *dl, const char *time_str) {
   if (time_str && time_str[0])
-    draw_gfxfont_string_4g((int)EPD_UI_TIME_X, (int)EPD_UI_TIME_Y + 46, time_str,
-                           &InterTempRegular32pt7b, 2u);
-  push_4g_region_as_1bit(0u, 0u, EPD_WIDTH, EPD_UI_IN_TEMP_Y);
+    dl_text(dl, (int)EPD_UI_TIME_X, (int)EPD_UI_TIME_Y + 46, time_str, &InterTempRegular32pt7b, 2u);
 }
 
-/* Draw only battery icon in full-screen 4G buffer, then push battery region. */
-void epd_ui_draw_battery_header(float percent) {
-  memset(epd_4g_buffer, 0, sizeof(epd_4g_buffer));
-  epd_ui_4g_flip_y = 1;
-  draw_battery_icon_4g(EPD_UI_BATTERY_ICON_X, EPD_UI_BATTERY_ICON_Y, percent);
-  push_4g_region_as_1bit(EPD_UI_BATTERY_ICON_X, EPD_UI_BATTERY_ICON_Y,
-                         EPD_UI_BATTERY_ICON_W + 2u, EPD_UI_BATTERY_ICON_H);
+/* Battery: 54x32, 2px outline, nub, number centered. Left side. 4-gray value 2 (dark gray). */
+#define EPD_UI_BATTERY_GRAY  2u   /* 0=white, 1=light gray, 2=dark gray, 3=black */
+static void layout_battery_4g(epd_ui_dl_t *dl, unsigned int bx, unsigned int by, int percent) {
+  const unsigned int w = EPD_UI_BATTERY_ICON_W;
+  const unsigned int h = EPD_UI_BATTERY_ICON_H;
+  const unsigned int t = 2u;  /* outline thickness */
+  const unsigned int v = EPD_UI_BATTERY_GRAY;
+  /* 2px outline: top, bottom, left, right */
+  dl_rect(dl, bx, by, w, t, v);
+  dl_rect(dl, bx, by + h - t, w, t, v);
+  dl_rect(dl, bx, by, t, h, v);
+  dl_rect(dl, bx + w - t, by, t, h, v);
+  /* Nub on right, 2px wide */
+  dl_rect(dl, bx + w, by + 6u, 2u, h - 12u, v);
+  /* Number centered in inner area */
+  char str[8];
+  format_fixed(str, sizeof(str), (percent <= 0) ? 0 : (percent >= 100) ? 100 : percent, 0u, 100);
+  unsigned int str_w = text_width(str, InterTempSemiBold14pt7bMetrics);
+  unsigned int inner_w = w - 2u * t;
+  int tx = (int)bx + (int)t + (int)((inner_w > str_w) ? (inner_w - str_w) / 2u : 0u);
+  int ty = (int)by + 26;
+  dl_text(dl, tx, ty, str, &InterTempSemiBold14pt7b, v);
 }
 
-void epd_ui_draw_indoor_block(float indoor_temp_c, float indoor_humidity) {
+/* Temperature (72px number, °C in Inter Regular 32px) and humidity (48px number, % in
+ * 32px), right-aligned; min_x if they do not fit. */
+static void layout_temp_humidity_4g(epd_ui_dl_t *dl, int16_t temp_dc, int humidity, unsigned int temp_y,
+                                    unsigned int humid_y, unsigned int min_x) {
   char str[48];
-  memset(epd_4g_buffer, 0, sizeof(epd_4g_buffer));
-  epd_ui_4g_flip_y = 1;
-
-  format_temp_number(str, sizeof(str), indoor_temp_c);
-  {
-    unsigned int tw_num = gfxfont_string_width(str, &InterTempSemiBold72pt7b);
-    unsigned int tw_deg = gfxfont_string_width(degree_c, &InterTempRegular32pt7b);
-    unsigned int tw_unit = tw_deg + gfxfont_string_width("C", &InterTempRegular32pt7b);
+  format_temp_number(str, sizeof(str), temp_dc);
+  { constexpr unsigned int tw_deg = gfxmetrics_width(InterTempRegular32pt7bMetrics, "°");
+    constexpr unsigned int tw_unit = tw_deg + gfxmetrics_width(InterTempRegular32pt7bMetrics, "C");
+    unsigned int tw_num = text_width(str, InterTempSemiBold72pt7bMetrics);
     unsigned int total = tw_num + 2u + tw_unit;
-    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - total : EPD_UI_MARGIN);
-    int by = (int)EPD_UI_IN_TEMP_Y + 103;
-    draw_gfxfont_string_4g(tx, by, str, &InterTempSemiBold72pt7b, 3u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2, by, degree_c, &InterTempRegular32pt7b, 3u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2 + (int)tw_deg, by, "C", &InterTempRegular32pt7b, 3u);
-  }
-
-  format_humidity_number(str, sizeof(str), indoor_humidity);
-  {
-    unsigned int tw_num = gfxfont_string_width(str, &InterTempSemiBold48pt7b);
-    unsigned int tw_unit = gfxfont_string_width("%", &InterTempRegular32pt7b);
+    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - total : min_x);
+    int by = (int)temp_y + 103;
+    dl_text(dl, tx, by, str, &InterTempSemiBold72pt7b, 3u);
+    dl_text(dl, tx + (int)tw_num + 2, by, "°", &InterTempRegular32pt7b, 3u);
+    dl_text(dl, tx + (int)tw_num + 2 + (int)tw_deg, by, "C", &InterTempRegular32pt7b, 3u); }
+  format_humidity_number(str, sizeof(str), humidity);
+  { constexpr unsigned int tw_unit = gfxmetrics_width(InterTempRegular32pt7bMetrics, "%");
+    unsigned int tw_num = text_width(str, InterTempSemiBold48pt7bMetrics);
     unsigned int total = tw_num + 2u + tw_unit;
-    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - total : EPD_UI_MARGIN);
-    int by = (int)EPD_UI_IN_HUMID_Y + 68;
-    draw_gfxfont_string_4g(tx, by, str, &InterTempSemiBold48pt7b, 2u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2, by, "%", &InterTempRegular32pt7b, 2u);
+    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - total : min_x);
+    int by = (int)humid_y + 68;
+    dl_text(dl, tx, by, str, &InterTempSemiBold48pt7b, 2u);
+    dl_text(dl, tx + (int)tw_num + 2, by, "%", &InterTempRegular32pt7b, 2u); }
+}
+
+/* What every frame draws the same: IN and OUT labels Source Sans 22px, the separator, and the
+ * forecast card outlines with their temperature divider lines. Baked into epd_ui_static_layer.h
+ * by tools/static_layer_bake.cpp; recorded by dl_begin_4g() only with EPD_UI_STATIC_LAYER 0. */
+static void layout_static_4g(epd_ui_dl_t *dl) {
+  dl_text(dl, (int)EPD_UI_IN_LABEL_X, (int)EPD_UI_IN_LABEL_Y + 28, "IN", &SourceSansLabel22pt7b, 1u);
+  dl_hline(dl, EPD_UI_MARGIN, 480u - EPD_UI_MARGIN - 1u, EPD_UI_SEPARATOR_Y, 3u);
+  dl_text(dl, (int)EPD_UI_OUT_LABEL_X, (int)EPD_UI_OUT_LABEL_Y + 28, "OUT", &SourceSansLabel22pt7b, 1u);
+  unsigned int cx = EPD_UI_FORECAST_SIDE_MARGIN;
+  for (int i = 0; i < 3; i++) {
+    dl_rect_outline(dl, cx, EPD_UI_FORECAST_CARDS_Y, EPD_UI_FORECAST_CARD_W, EPD_UI_FORECAST_CARD_H);
+    dl_hline(dl, cx + (EPD_UI_FORECAST_CARD_W - EPD_UI_FORECAST_TEMP_LINE_LEN) / 2u,
+             cx + (EPD_UI_FORECAST_CARD_W - EPD_UI_FORECAST_TEMP_LINE_LEN) / 2u + EPD_UI_FORECAST_TEMP_LINE_LEN - 1u,
+             EPD_UI_FORECAST_CARDS_Y + EPD_UI_FORECAST_TEMP_LINE_Y, 3u);
+    cx += EPD_UI_FORECAST_CARD_W + EPD_UI_FORECAST_GAP;
   }
-
-  draw_gfxfont_string_4g((int)EPD_UI_IN_LABEL_X, (int)EPD_UI_IN_LABEL_Y + 28, "IN",
-                         &SourceSansLabel22pt7b, 1u);
-  draw_hline_4g(EPD_UI_MARGIN, 480u - EPD_UI_MARGIN - 1u, EPD_UI_SEPARATOR_Y);
-  push_4g_region_as_1bit(0u, EPD_UI_IN_TEMP_Y, EPD_WIDTH, EPD_UI_SEPARATOR_Y - EPD_UI_IN_TEMP_Y + 1u);
 }
 
-void epd_ui_draw_outdoor_block(float outdoor_temp_c, float outdoor_humidity, int wmo_weather_code) {
-  char str[48];
-  memset(epd_4g_buffer, 0, sizeof(epd_4g_buffer));
-  epd_ui_4g_flip_y = 1;
-
-  draw_gfxfont_string_4g((int)EPD_UI_OUT_LABEL_X, (int)EPD_UI_OUT_LABEL_Y + 28, "OUT",
-                         &SourceSansLabel22pt7b, 1u);
-
-  const unsigned char *icon_4g = weather_icon_4g_by_wmo(wmo_weather_code);
-  if (icon_4g) {
-    unsigned int iw = weather_icon_4g_width_by_wmo(wmo_weather_code);
-    unsigned int ih = weather_icon_4g_height_by_wmo(wmo_weather_code);
-    unsigned int ox = (WEATHER_ICON_FRAME_W - iw) / 2u;
-    unsigned int oy = (WEATHER_ICON_FRAME_H - ih) / 2u;
-    blit_4g_icon_to_4g(icon_4g, EPD_UI_OUT_ICON_X + ox, EPD_UI_OUT_ICON_Y + oy, iw, ih);
-  } else {
-    static unsigned char icon_buf[ICON_BUF_SIZE];
-    epd_ui_weather_icon_t fallback_icon = epd_ui_weather_code_to_icon(wmo_weather_code);
-    fill_icon_buf_64x64(icon_buf, wmo_weather_code, fallback_icon);
-    blit_1bit_to_4g(icon_buf, EPD_UI_ICON_REGION_W, EPD_UI_ICON_REGION_H, EPD_UI_OUT_ICON_X, EPD_UI_OUT_ICON_Y);
-  }
+/* Layout values the static layer depends on (FNV-1a); the baked header records the key it was
+ * made with, so a layout change without a new bake fails to compile. Fonts are not covered. */
+static constexpr uint32_t static_layer_key(void) {
+  const uint32_t v[] = { EPD_UI_IN_LABEL_X, EPD_UI_IN_LABEL_Y, EPD_UI_MARGIN, EPD_UI_SEPARATOR_Y,
+                         EPD_UI_OUT_LABEL_X, EPD_UI_OUT_LABEL_Y, EPD_UI_FORECAST_SIDE_MARGIN,
+                         EPD_UI_FORECAST_CARDS_Y, EPD_UI_FORECAST_CARD_W, EPD_UI_FORECAST_CARD_H,
+                         EPD_UI_FORECAST_GAP, EPD_UI_FORECAST_TEMP_LINE_LEN, EPD_UI_FORECAST_TEMP_LINE_Y };
+  uint32_t h = 2166136261ul;
+  for (unsigned int i = 0; i < sizeof(v) / sizeof(v[0]); i++) h = (h ^ v[i]) * 16777619ul;
+  return h;
+}
+#if EPD_UI_STATIC_LAYER
+static_assert(EPD_UI_STATIC_LAYER_KEY == static_layer_key(),
+              "layout changed: rebake epd_ui_static_layer.h with tools/static_layer_bake.cpp");
+#endif
 
-  format_temp_number(str, sizeof(str), outdoor_temp_c);
-  {
-    unsigned int tw_num = gfxfont_string_width(str, &InterTempSemiBold72pt7b);
-    unsigned int tw_deg = gfxfont_string_width(degree_c, &InterTempRegular32pt7b);
-    unsigned int tw_unit = tw_deg + gfxfont_string_width("C", &InterTempRegular32pt7b);
-    unsigned int total = tw_num + 2u + tw_unit;
-    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - (int)total : (int)EPD_UI_OUT_DATA_X);
-    int by = (int)EPD_UI_OUT_TEMP_Y + 103;
-    draw_gfxfont_string_4g(tx, by, str, &InterTempSemiBold72pt7b, 3u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2, by, degree_c, &InterTempRegular32pt7b, 3u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2 + (int)tw_deg, by, "C", &InterTempRegular32pt7b, 3u);
-  }
+/* Empty dl and give it the static layer: as the band background (EPD_UI_STATIC_LAYER) or as
+ * its first items. */
+static void dl_begin_4g(epd_ui_ctx_t *ctx, epd_ui_dl_t *dl) {
+  dl_reset(ctx, dl);
+  dl->background = EPD_UI_STATIC_LAYER ? 1u : 0u;
+  if (!EPD_UI_STATIC_LAYER) layout_static_4g(dl);
+}
 
-  format_humidity_number(str, sizeof(str), outdoor_humidity);
-  {
-    unsigned int tw_num = gfxfont_string_width(str, &InterTempSemiBold48pt7b);
-    unsigned int tw_unit = gfxfont_string_width("%", &InterTempRegular32pt7b);
-    unsigned int total = tw_num + 2u + tw_unit;
-    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - (int)total : (int)EPD_UI_OUT_DATA_X);
-    int by = (int)EPD_UI_OUT_HUMID_Y + 68;
-    draw_gfxfont_string_4g(tx, by, str, &InterTempSemiBold48pt7b, 2u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2, by, "%", &InterTempRegular32pt7b, 2u);
+/* IN section: temperature, humidity (IN label and separator: layout_static_4g). */
+static void layout_indoor_4g(epd_ui_dl_t *dl, int16_t indoor_temp_dc, int indoor_humidity) {
+  layout_temp_humidity_4g(dl, indoor_temp_dc, indoor_humidity, EPD_UI_IN_TEMP_Y, EPD_UI_IN_HUMID_Y, EPD_UI_MARGIN);
+}
+
+/* Weather icon of a WMO code in the 106 px frame at (x, y): the recipe, else the vector icon. */
+static void layout_weather_icon_4g(epd_ui_dl_t *dl, int wmo_weather_code, unsigned int x, unsigned int y) {
+  const weather_icon_desc_t *d = weather_icon_desc_by_wmo(wmo_weather_code);
+  const weather_icon_recipe_t *r = EPD_UI_VECTOR_ICONS ? nullptr : weather_icon_recipe(d->recipe);
+  if (r) {
+    dl_icon_recipe(dl, r, x, y);
+  } else {
+    dl_icon_vector(dl, (epd_ui_weather_icon_t)d->kind, x, y, EPD_UI_ICON_REGION_W);
   }
+}
 
-  unsigned int y0 = EPD_UI_OUT_LABEL_Y;
-  unsigned int y1 = EPD_UI_OUT_ICON_Y + EPD_UI_OUT_ICON_H;
-  push_4g_region_as_1bit(0u, y0, EPD_WIDTH, y1 - y0 + 1u);
+/* OUT section: icon, temperature, humidity (OUT label: layout_static_4g). */
+static void layout_outdoor_4g(epd_ui_dl_t *dl, int16_t outdoor_temp_dc, int outdoor_humidity, int wmo_weather_code) {
+  layout_weather_icon_4g(dl, wmo_weather_code, EPD_UI_OUT_ICON_X, EPD_UI_OUT_ICON_Y);
+  layout_temp_humidity_4g(dl, outdoor_temp_dc, outdoor_humidity, EPD_UI_OUT_TEMP_Y, EPD_UI_OUT_HUMID_Y,
+                          EPD_UI_OUT_DATA_X);
 }
 
-void epd_ui_draw_forecast_block(const epd_ui_forecast_day_t *forecast) {
+/* FORECAST: 3 cards (no title); date Atkinson 24px, temps Inter 28px. NULL = placeholders.
+ * Outlines and divider lines: layout_static_4g. */
+static void layout_forecast_4g(epd_ui_dl_t *dl, const epd_ui_forecast_day_t *forecast) {
   char str[48];
-  memset(epd_4g_buffer, 0, sizeof(epd_4g_buffer));
-  epd_ui_4g_flip_y = 1;
-
-  static unsigned char icon_buf[ICON_BUF_SIZE];
   unsigned int cy = EPD_UI_FORECAST_CARDS_Y;
   unsigned int cx = EPD_UI_FORECAST_SIDE_MARGIN;
   for (int i = 0; i < 3; i++) {
     const char *date_str = (forecast && forecast[i].date && forecast[i].date[0]) ? forecast[i].date : "---";
-    int wmo = (forecast && i < 3) ? forecast[i].wmo_code : 0;
-    int tmin = (forecast && i < 3) ? forecast[i].temp_min_c : 0;
-    int tmax = (forecast && i < 3) ? forecast[i].temp_max_c : 0;
+    int wmo = forecast ? forecast[i].wmo_code : 0;
+    int tmin = forecast ? forecast[i].temp_min_c : 0;
+    int tmax = forecast ? forecast[i].temp_max_c : 0;
 
-    draw_rect_outline_4g(cx, cy, EPD_UI_FORECAST_CARD_W, EPD_UI_FORECAST_CARD_H);
+    /* Card contents stay inside the outline. */
+    dl_clip_push(dl, (int)cx + 1, (int)cy + 1, (int)EPD_UI_FORECAST_CARD_W - 2, (int)EPD_UI_FORECAST_CARD_H - 2);
 
-    {
-      unsigned int date_w = gfxfont_string_width(date_str, &AtkinsonForecast24pt7b);
+    /* Date Atkinson 24px Black, centered in card */
+    { unsigned int date_w = text_width(date_str, AtkinsonForecast24pt7bMetrics);
       int tx = (int)cx + (int)(EPD_UI_FORECAST_CARD_W > date_w ? (EPD_UI_FORECAST_CARD_W - date_w) / 2u : 0u);
-      draw_gfxfont_string_4g(tx, (int)cy + (int)EPD_UI_FORECAST_DATE_Y, date_str, &AtkinsonForecast24pt7b, 3u);
-    }
+      dl_text(dl, tx, (int)cy + (int)EPD_UI_FORECAST_DATE_Y, date_str, &AtkinsonForecast24pt7b, 3u); }
 
+    /* 70x70 box: icon fitted inside preserving aspect ratio, centered. Baked variant of the box
+     * size if there is one (straight copy), else the composed icon scaled at draw time, else the
+     * vector icon drawn at the box size. */
     unsigned int icon_x = cx + EPD_UI_FORECAST_ICON_OFFSET_X;
     unsigned int icon_y = cy + EPD_UI_FORECAST_ICON_Y;
-    const unsigned char *icon_4g = weather_icon_4g_by_wmo(wmo);
-    if (icon_4g) {
-      unsigned int iw = weather_icon_4g_width_by_wmo(wmo);
-      unsigned int ih = weather_icon_4g_height_by_wmo(wmo);
-      blit_4g_icon_to_4g_fit(icon_4g, icon_x, icon_y, iw, ih, EPD_UI_FORECAST_ICON_W);
+    const weather_icon_desc_t *d = weather_icon_desc_by_wmo(wmo);
+    const weather_icon_image_t *scaled = (EPD_UI_FORECAST_ICON_W == WEATHER_ICON_SCALED_SIZE && !EPD_UI_VECTOR_ICONS)
+                                             ? weather_icon_image(d->scaled) : nullptr;
+    const weather_icon_recipe_t *r = EPD_UI_VECTOR_ICONS ? nullptr : weather_icon_recipe(d->recipe);
+    if (scaled) {
+      dl_icon_atlas(dl, scaled, icon_x + (EPD_UI_FORECAST_ICON_W - scaled->w) / 2u,
+                    icon_y + (EPD_UI_FORECAST_ICON_H - scaled->h) / 2u);
+    } else if (r) {
+      dl_icon_recipe_fit(dl, r, icon_x, icon_y, EPD_UI_FORECAST_ICON_W);
     } else {
-      epd_ui_weather_icon_t fallback = epd_ui_weather_code_to_icon(wmo);
-      fill_icon_buf_64x64(icon_buf, wmo, fallback);
-      blit_1bit_to_4g_fit(icon_buf, EPD_UI_ICON_REGION_W, EPD_UI_ICON_REGION_H, icon_x, icon_y, EPD_UI_FORECAST_ICON_W);
+      dl_icon_vector(dl, (epd_ui_weather_icon_t)d->kind, icon_x, icon_y, EPD_UI_FORECAST_ICON_W);
     }
 
+    /* MAX on top, line, min below; Inter 28px Black, centered */
     format_temp_int_degree(str, sizeof(str), tmax);
-    {
-      unsigned int w = gfxfont_string_width(str, &InterTempRegular28pt7b);
+    { unsigned int w = text_width(str, InterTempRegular28pt7bMetrics);
       int tx = (int)cx + (int)(EPD_UI_FORECAST_CARD_W > w ? (EPD_UI_FORECAST_CARD_W - w) / 2u : 0u);
-      draw_gfxfont_string_4g(tx, (int)cy + (int)EPD_UI_FORECAST_TEMP_Y + 33, str, &InterTempRegular28pt7b, 3u);
-    }
-    draw_hline_4g(cx + (EPD_UI_FORECAST_CARD_W - EPD_UI_FORECAST_TEMP_LINE_LEN) / 2u,
-                  cx + (EPD_UI_FORECAST_CARD_W - EPD_UI_FORECAST_TEMP_LINE_LEN) / 2u + EPD_UI_FORECAST_TEMP_LINE_LEN - 1u,
-                  cy + EPD_UI_FORECAST_TEMP_LINE_Y);
+      dl_text(dl, tx, (int)cy + (int)EPD_UI_FORECAST_TEMP_Y + 33, str, &InterTempRegular28pt7b, 3u); }
     format_temp_int_degree(str, sizeof(str), tmin);
-    {
-      unsigned int w = gfxfont_string_width(str, &InterTempRegular28pt7b);
+    { unsigned int w = text_width(str, InterTempRegular28pt7bMetrics);
       int tx = (int)cx + (int)(EPD_UI_FORECAST_CARD_W > w ? (EPD_UI_FORECAST_CARD_W - w) / 2u : 0u);
-      draw_gfxfont_string_4g(tx, (int)cy + (int)EPD_UI_FORECAST_TEMP_MAX_Y + 33, str, &InterTempRegular28pt7b, 3u);
-    }
+      dl_text(dl, tx, (int)cy + (int)EPD_UI_FORECAST_TEMP_MAX_Y + 33, str, &InterTempRegular28pt7b, 3u); }
+    dl_clip_pop(dl);
 
     cx += EPD_UI_FORECAST_CARD_W + EPD_UI_FORECAST_GAP;
   }
+}
+
+/* Bottom: "Last update HH:MM" InterLabel14, centered. The time is its own item, so a new time
+ * alone is a numbers-only change. */
+static void layout_last_update_4g(epd_ui_dl_t *dl, const char *last_update_str) {
+  if (!last_update_str || !last_update_str[0]) return;
+  constexpr unsigned int prefix_w = gfxmetrics_width(InterLabel14pt7bMetrics, "Last update ");
+  unsigned int w = prefix_w + text_width(last_update_str, InterLabel14pt7bMetrics);
+  int tx = (int)(480u > w ? (480u - w) / 2u : 0u);
+  dl_text(dl, tx, (int)EPD_UI_LAST_UPDATE_Y, "Last update ", &InterLabel14pt7b, 2u);
+  dl_text(dl, tx + (int)prefix_w, (int)EPD_UI_LAST_UPDATE_Y, last_update_str, &InterLabel14pt7b, 2u);
+}
+
+/* Widest strings the layouts above must place inside their boxes. */
+static_assert(gfxmetrics_width(InterTempSemiBold14pt7bMetrics, "100") <= EPD_UI_BATTERY_ICON_W - 4u,
+              "battery percent overflows the icon");
+static_assert(gfxmetrics_width(InterTempSemiBold72pt7bMetrics, "---") + 2u +
+              gfxmetrics_width(InterTempRegular32pt7bMetrics, "°C") <= EPD_UI_RIGHT_EDGE - EPD_UI_OUT_DATA_X,
+              "temperature placeholder overflows the OUT block");
+static_assert(gfxmetrics_width(InterTempSemiBold48pt7bMetrics, "100") + 2u +
+              gfxmetrics_width(InterTempRegular32pt7bMetrics, "%") <= EPD_UI_RIGHT_EDGE - EPD_UI_OUT_DATA_X,
+              "humidity overflows the OUT block");
+static_assert(gfxmetrics_width(InterTempRegular28pt7bMetrics, "-99") <= EPD_UI_FORECAST_CARD_W,
+              "forecast temperature overflows the card");
+static_assert(gfxmetrics_width(InterLabel14pt7bMetrics, "Last update 00:00") <= 480u,
+              "last-update line overflows the width");
+
+/* Time only, then push header region. */
+void epd_ui_draw_time_header(epd_ui_ctx_t *ctx, const char *time_str) {
+  dl_begin_4g(ctx, &ctx->block_dl);
+  layout_time_4g(&ctx->block_dl, time_str);
+  push_4g_block(ctx, EPD_UI_PART_TIME, &ctx->block_dl, 0u, 0u, EPD_WIDTH, EPD_UI_IN_TEMP_Y);
+}
+
+/* Battery icon only, then push battery region. */
+void epd_ui_draw_battery_header(epd_ui_ctx_t *ctx, int percent) {
+  dl_begin_4g(ctx, &ctx->block_dl);
+  layout_battery_4g(&ctx->block_dl, EPD_UI_BATTERY_ICON_X, EPD_UI_BATTERY_ICON_Y, percent);
+  push_4g_block(ctx, EPD_UI_PART_BATTERY, &ctx->block_dl, EPD_UI_BATTERY_ICON_X, EPD_UI_BATTERY_ICON_Y,
+                EPD_UI_BATTERY_ICON_W + 2u, EPD_UI_BATTERY_ICON_H);
+}
+
+void epd_ui_draw_indoor_block(epd_ui_ctx_t *ctx, int16_t indoor_temp_dc, int indoor_humidity) {
+  dl_begin_4g(ctx, &ctx->block_dl);
+  layout_indoor_4g(&ctx->block_dl, indoor_temp_dc, indoor_humidity);
+  push_4g_block(ctx, EPD_UI_PART_INDOOR, &ctx->block_dl,
+                0u, EPD_UI_IN_TEMP_Y, EPD_WIDTH, EPD_UI_SEPARATOR_Y - EPD_UI_IN_TEMP_Y + 1u);
+}
+
+void epd_ui_draw_outdoor_block(epd_ui_ctx_t *ctx, int16_t outdoor_temp_dc, int outdoor_humidity, int wmo_weather_code) {
+  dl_begin_4g(ctx, &ctx->block_dl);
+  layout_outdoor_4g(&ctx->block_dl, outdoor_temp_dc, outdoor_humidity, wmo_weather_code);
+  unsigned int y0 = EPD_UI_OUT_LABEL_Y;
+  unsigned int y1 = EPD_UI_OUT_ICON_Y + EPD_UI_OUT_ICON_H;
+  push_4g_block(ctx, EPD_UI_PART_OUTDOOR, &ctx->block_dl, 0u, y0, EPD_WIDTH, y1 - y0 + 1u);
+}
 
+void epd_ui_draw_forecast_block(epd_ui_ctx_t *ctx, const epd_ui_forecast_day_t *forecast) {
+  dl_begin_4g(ctx, &ctx->block_dl);
+  layout_forecast_4g(&ctx->block_dl, forecast);
   unsigned int w = 3u * EPD_UI_FORECAST_CARD_W + 2u * EPD_UI_FORECAST_GAP;
-  push_4g_region_as_1bit(EPD_UI_FORECAST_SIDE_MARGIN, EPD_UI_FORECAST_CARDS_Y, w, EPD_UI_FORECAST_CARD_H);
+  push_4g_block(ctx, EPD_UI_PART_FORECAST, &ctx->block_dl,
+                EPD_UI_FORECAST_SIDE_MARGIN, EPD_UI_FORECAST_CARDS_Y, w, EPD_UI_FORECAST_CARD_H);
 }
 
-const unsigned char *epd_ui_build_demo_4g(float indoor_temp_c, float indoor_humidity,
-  float outdoor_temp_c, float outdoor_humidity, int wmo_weather_code, const char *last_update_str,
-  const char *status1, float wind_speed_m_s, const epd_ui_forecast_day_t *forecast,
-  bool zigbee_sync_warning) {
-  memset(epd_4g_buffer, 0, sizeof(epd_4g_buffer));  /* white background */
-  epd_ui_4g_flip_y = 1;  /* flip Y only: orientation matches HELLO, text L→R */
+void epd_ui_ctx_init(epd_ui_ctx_t *ctx, unsigned char *band_buf) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->band = band_buf;
+  const epd_ui_rect_t band = { 0u, 0u, (uint16_t)EPD_UI_BAND_COLS, (uint16_t)EPD_HEIGHT };
+  clip_reset_4g(ctx, &band);
+  dl_reset(ctx, &ctx->frame_dl);
+  dl_reset(ctx, &ctx->block_dl);
+}
 
-  char str[48];
+const unsigned char *epd_ui_build_demo_4g(epd_ui_ctx_t *ctx, int16_t indoor_temp_dc, int indoor_humidity,
+  int16_t outdoor_temp_dc, int outdoor_humidity, int wmo_weather_code, const char *last_update_str,
+  const char *status1, const epd_ui_forecast_day_t *forecast,
+  bool zigbee_sync_warning) {
+  epd_ui_dl_t *dl = &ctx->frame_dl;
+  dl_begin_4g(ctx, dl);
+  memset(ctx->part_history, 0, sizeof(ctx->part_history));  /* full refresh: panel no longer matches */
 
   /* Top-left: no-signal icon when Zigbee failed. Left margin EPD_UI_MARGIN; 10px up from header. */
   if (zigbee_sync_warning) {
     const unsigned int wx = (unsigned int)(EPD_UI_WARNING_ICON_X >= 0 ? EPD_UI_WARNING_ICON_X : 0);
     const unsigned int icon_top_y = (EPD_UI_MARGIN >= 10u) ? (EPD_UI_MARGIN - 10u) : 0u;
-    blit_4g_icon_to_4g(no_signal_4g, wx, icon_top_y, NO_SIGNAL_4G_W, NO_SIGNAL_4G_H);
+    dl_icon_4g(dl, no_signal_4g, wx, icon_top_y, NO_SIGNAL_4G_W, NO_SIGNAL_4G_H);
   }
+  layout_time_4g(dl, status1);
+  layout_indoor_4g(dl, indoor_temp_dc, indoor_humidity);
+  layout_outdoor_4g(dl, outdoor_temp_dc, outdoor_humidity, wmo_weather_code);
+  layout_forecast_4g(dl, forecast);
+  layout_last_update_4g(dl, last_update_str);
+
+  if (EPD_UI_BAND_COLS != EPD_WIDTH) return NULL;
+  band_render_4g(ctx, dl, 0u, NULL);
+  return ctx->band;
+}
+
+/* -------- Pages: history, forecast, diagnostics -------- */
+
+/* Empty the frame for a page other than the conditions page (white background, no static
+ * layer): title Source Sans 22px (capitals only), one dot per page at the right with this page's
+ * black, a rule below. */
+static epd_ui_dl_t *page_begin_4g(epd_ui_ctx_t *ctx, const char *title, epd_ui_page_t page) {
+  epd_ui_dl_t *dl = &ctx->frame_dl;
+  dl_reset(ctx, dl);
+  memset(ctx->part_history, 0, sizeof(ctx->part_history));
+  dl_text(dl, (int)EPD_UI_MARGIN, (int)EPD_UI_PAGE_TITLE_Y, title, &SourceSansLabel22pt7b, 3u);
+  const unsigned int dot = 10u, pitch = 18u, dy = EPD_UI_PAGE_TITLE_Y - 16u;
+  unsigned int x = EPD_UI_RIGHT_EDGE - (EPD_UI_PAGE_COUNT - 1u) * pitch - dot;
+  for (unsigned int i = 0; i < EPD_UI_PAGE_COUNT; i++, x += pitch) {
+    if (i == (unsigned int)page) dl_rect(dl, x, dy, dot, dot, 3u);
+    else dl_rect(dl, x + 2u, dy + 2u, dot - 4u, dot - 4u, 2u);
+  }
+  dl_hline(dl, EPD_UI_MARGIN, EPD_UI_RIGHT_EDGE - 1u, EPD_UI_PAGE_RULE_Y, 3u);
+  return dl;
+}
 
-  /* Header: time (status1) Inter Regular 32px if set */
-  if (status1 && status1[0])
-    draw_gfxfont_string_4g((int)EPD_UI_TIME_X, (int)EPD_UI_TIME_Y + 46, status1,
-                           &InterTempRegular32pt7b, 2u);
+/* Text right-aligned at EPD_UI_RIGHT_EDGE. */
+static void dl_text_right(epd_ui_dl_t *dl, int y, const char *str, const GFXfont *font, const GFXmetrics &m,
+                          unsigned int gray) {
+  const unsigned int w = text_width(str, m);
+  dl_text(dl, (int)(EPD_UI_RIGHT_EDGE > w ? EPD_UI_RIGHT_EDGE - w : 0u), y, str, font, gray);
+}
 
-  /* IN section: number in 72px/48px, °C in Inter Regular 32px (° at 0x2A); IN label Source Sans 22px */
-  format_temp_number(str, sizeof(str), indoor_temp_c);
-  { unsigned int tw_num = gfxfont_string_width(str, &InterTempSemiBold72pt7b);
-    unsigned int tw_deg = gfxfont_string_width(degree_c, &InterTempRegular32pt7b);
-    unsigned int tw_unit = tw_deg + gfxfont_string_width("C", &InterTempRegular32pt7b);
-    unsigned int total = tw_num + 2u + tw_unit;
-    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - total : EPD_UI_MARGIN);
-    int by = (int)EPD_UI_IN_TEMP_Y + 103;
-    draw_gfxfont_string_4g(tx, by, str, &InterTempSemiBold72pt7b, 3u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2, by, degree_c, &InterTempRegular32pt7b, 3u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2 + (int)tw_deg, by, "C", &InterTempRegular32pt7b, 3u); }
-  format_humidity_number(str, sizeof(str), indoor_humidity);
-  { unsigned int tw_num = gfxfont_string_width(str, &InterTempSemiBold48pt7b);
-    unsigned int tw_unit = gfxfont_string_width("%", &InterTempRegular32pt7b);
-    unsigned int total = tw_num + 2u + tw_unit;
-    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - total : EPD_UI_MARGIN);
-    int by = (int)EPD_UI_IN_HUMID_Y + 68;
-    draw_gfxfont_string_4g(tx, by, str, &InterTempSemiBold48pt7b, 2u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2, by, "%", &InterTempRegular32pt7b, 2u); }
-  draw_gfxfont_string_4g((int)EPD_UI_IN_LABEL_X, (int)EPD_UI_IN_LABEL_Y + 28, "IN",
-                         &SourceSansLabel22pt7b, 1u);
-
-  /* Separator */
-  draw_hline_4g(EPD_UI_MARGIN, 480u - EPD_UI_MARGIN - 1u, EPD_UI_SEPARATOR_Y);
-
-  /* OUT section: OUT label Source Sans 22px, icon, -3.2°C Inter SemiBold 72px, humidity 48px Dark Gray */
-  draw_gfxfont_string_4g((int)EPD_UI_OUT_LABEL_X, (int)EPD_UI_OUT_LABEL_Y + 28, "OUT",
-                         &SourceSansLabel22pt7b, 1u);
-  const unsigned char *icon_4g = weather_icon_4g_by_wmo(wmo_weather_code);
-  if (icon_4g) {
-    unsigned int iw = weather_icon_4g_width_by_wmo(wmo_weather_code);
-    unsigned int ih = weather_icon_4g_height_by_wmo(wmo_weather_code);
-    unsigned int ox = (WEATHER_ICON_FRAME_W - iw) / 2u;
-    unsigned int oy = (WEATHER_ICON_FRAME_H - ih) / 2u;
-    blit_4g_icon_to_4g(icon_4g,
-                       EPD_UI_OUT_ICON_X + ox, EPD_UI_OUT_ICON_Y + oy, iw, ih);
+/* -------- Indoor history -------- */
+
+#define EPD_UI_HISTORY_MAGIC  0x48495331ul  /* "HIS1"; bump when epd_ui_history_t changes */
+
+bool epd_ui_history_add(epd_ui_history_t *history, uint32_t t, int16_t temp_dc, int humidity) {
+  if (history->magic != EPD_UI_HISTORY_MAGIC || history->count > EPD_UI_HISTORY_LEN ||
+      history->head >= EPD_UI_HISTORY_LEN) {
+    memset(history, 0, sizeof(*history));
+    history->magic = EPD_UI_HISTORY_MAGIC;
+  }
+  if (history->count) {
+    const epd_ui_sample_t *last = &history->samples[(history->head + EPD_UI_HISTORY_LEN - 1u) % EPD_UI_HISTORY_LEN];
+    if (last->t > t) {
+      history->count = 0;
+      history->head = 0;
+    } else if (t - last->t < EPD_UI_HISTORY_STEP_S) {
+      return false;
+    }
+  }
+  epd_ui_sample_t *s = &history->samples[history->head];
+  s->t = t;
+  s->temp_dc = temp_dc;
+  s->humidity = (uint8_t)((humidity < 0) ? 0 : (humidity > 100) ? 100 : humidity);
+  s->reserved = 0;
+  history->head = (uint16_t)((history->head + 1u) % EPD_UI_HISTORY_LEN);
+  if (history->count < EPD_UI_HISTORY_LEN) history->count++;
+  return true;
+}
+
+const epd_ui_sample_t *epd_ui_history_newest(const epd_ui_history_t *history) {
+  if (history->magic != EPD_UI_HISTORY_MAGIC || !history->count || history->count > EPD_UI_HISTORY_LEN ||
+      history->head >= EPD_UI_HISTORY_LEN)
+    return NULL;
+  return &history->samples[(history->head + EPD_UI_HISTORY_LEN - 1u) % EPD_UI_HISTORY_LEN];
+}
+
+/* Sample i of history, 0 = the oldest. */
+static inline const epd_ui_sample_t *history_at(const epd_ui_history_t *h, unsigned int i) {
+  return &h->samples[(h->head + EPD_UI_HISTORY_LEN - h->count + i) % EPD_UI_HISTORY_LEN];
+}
+
+/* Value of a sample in series 0 (temperature, 0.1 °C) or 1 (humidity, %). */
+static inline int sample_value(const epd_ui_sample_t *s, unsigned int series) {
+  return series ? (int)s->humidity : (int)s->temp_dc;
+}
+
+/* Largest-Triangle-Three-Buckets: indices of m of the samples first .. first + n - 1 (all of them
+ * if n <= m) that keep the shape of series: the first and the last, and from each of m - 2 equal
+ * buckets between them the sample spanning the largest triangle with the one picked before and
+ * the mean of the next bucket. Integer arithmetic; returns the count. */
+static unsigned int history_lttb(const epd_ui_history_t *h, unsigned int first, unsigned int n, unsigned int series,
+                                 uint16_t *out, unsigned int m) {
+  if (n <= m) {
+    for (unsigned int i = 0; i < n; i++) out[i] = (uint16_t)(first + i);
+    return n;
+  }
+  const uint32_t t0 = history_at(h, first)->t;
+  unsigned int k = 0, a = first;
+  out[k++] = (uint16_t)first;
+  for (unsigned int b = 0; b < m - 2u; b++) {
+    /* Bucket b covers samples b0 .. b1 - 1 of 1 .. n - 2; the next one, or the last sample. */
+    const unsigned int b0 = 1u + b * (n - 2u) / (m - 2u), b1 = 1u + (b + 1u) * (n - 2u) / (m - 2u);
+    const unsigned int c1 = (b + 1u < m - 2u) ? 1u + (b + 2u) * (n - 2u) / (m - 2u) : n;
+    int64_t cx = 0, cy = 0;
+    for (unsigned int i = b1; i < c1; i++) {
+      cx += history_at(h, first + i)->t - t0;
+      cy += sample_value(history_at(h, first + i), series);
+    }
+    cx /= (int64_t)(c1 - b1);
+    cy /= (int64_t)(c1 - b1);
+    const int64_t ax = history_at(h, a)->t - t0, ay = sample_value(history_at(h, a), series);
+    int64_t best = -1;
+    unsigned int pick = first + b0;
+    for (unsigned int i = b0; i < b1; i++) {
+      const epd_ui_sample_t *s = history_at(h, first + i);
+      int64_t area = (ax - cx) * (sample_value(s, series) - ay) - (ax - (int64_t)(s->t - t0)) * (cy - ay);
+      if (area < 0) area = -area;
+      if (area > best) {
+        best = area;
+        pick = first + i;
+      }
+    }
+    out[k++] = (uint16_t)pick;
+    a = pick;
+  }
+  out[k++] = (uint16_t)(first + n - 1u);
+  return k;
+}
+static_assert(EPD_UI_CHART_POINTS >= 3u, "LTTB keeps the first and last sample and at least one bucket");
+
+/* Largest multiple of step at or below v. */
+static int floor_to(int v, int step) {
+  return ((v >= 0) ? v / step : -((-v + step - 1) / step)) * step;
+}
+
+/* One chart of series (see sample_value()) in the panel at y: caption, the LTTB-reduced line
+ * over the area below it, the value range at the right and the time axis below. */
+static void layout_history_series_4g(epd_ui_dl_t *dl, const epd_ui_history_t *h, uint32_t now, unsigned int series,
+                                     unsigned int y) {
+  const unsigned int px = EPD_UI_MARGIN, py = y + EPD_UI_CHART_CAPTION_H, w = EPD_UI_CHART_W, ph = EPD_UI_CHART_H;
+  dl_text(dl, (int)px, (int)y + 20, series ? "Humidity" : "Temperature", &InterLabel14pt7b, 2u);
+  dl_hline(dl, px, px + w - 1u, py + ph, 2u);
+  for (unsigned int q = 0; q <= 4u; q++) dl_rect(dl, px + q * (w - 1u) / 4u, py + ph + 1u, 1u, 5u, 2u);
+  /* Counted back from the newest sample (ticks every 6 h): the timestamps are uptime, not the
+   * time of day. */
+  constexpr unsigned int last_w = gfxmetrics_width(InterLabel14pt7bMetrics, "latest");
+  dl_text(dl, (int)px, (int)(py + ph + 21u), "24 h ago", &InterLabel14pt7b, 2u);
+  dl_text(dl, (int)(px + w - last_w), (int)(py + ph + 21u), "latest", &InterLabel14pt7b, 2u);
+
+  /* Samples of the EPD_UI_HISTORY_SPAN_S up to now (uptime: now may be less than the span). */
+  unsigned int first = 0, n = h ? h->count : 0u;
+  while (n > first && history_at(h, n - 1u)->t > now) n--;
+  while (first < n && now - history_at(h, first)->t > EPD_UI_HISTORY_SPAN_S) first++;
+  n -= first;
+  if (n < 2u) {
+    constexpr unsigned int msg_w = gfxmetrics_width(InterLabel14pt7bMetrics, "No samples yet");
+    dl_text(dl, (int)(px + (w - msg_w) / 2u), (int)(py + ph / 2u + 5u), "No samples yet", &InterLabel14pt7b, 2u);
+    return;
+  }
+  uint16_t pick[EPD_UI_CHART_POINTS];
+  const unsigned int m = history_lttb(h, first, n, series, pick, EPD_UI_CHART_POINTS);
+
+  /* Range: whole degrees or steps of 5 %, at least 2 °C or 10 % tall. */
+  const int step = series ? 5 : 10, min_range = series ? 10 : 20;
+  int lo = sample_value(history_at(h, pick[0]), series), hi = lo;
+  for (unsigned int i = 1; i < m; i++) {
+    const int v = sample_value(history_at(h, pick[i]), series);
+    if (v < lo) lo = v;
+    if (v > hi) hi = v;
+  }
+  lo = floor_to(lo, step);
+  hi = -floor_to(-hi, step);
+  while (hi - lo < min_range) {
+    hi += step;
+    if (hi - lo < min_range) lo -= step;
+  }
+  uint16_t xs[EPD_UI_CHART_POINTS];
+  uint8_t ys[EPD_UI_CHART_POINTS];
+  for (unsigned int i = 0; i < m; i++) {
+    const epd_ui_sample_t *s = history_at(h, pick[i]);
+    xs[i] = (uint16_t)((w - 1u) - (uint64_t)(now - s->t) * (w - 1u) / EPD_UI_HISTORY_SPAN_S);
+    ys[i] = (uint8_t)((int)ph - 1 - ((sample_value(s, series) - lo) * ((int)ph - 1) + (hi - lo) / 2) / (hi - lo));
+  }
+  dl_chart(dl, px, py, w, ph, xs, ys, m, 3u, 1u);
+
+  char str[8];
+  format_fixed(str, sizeof(str), series ? hi : hi / 10, 0u, 999);
+  dl_text(dl, (int)(px + w + 8u), (int)py + 18, str, &AtkinsonForecast24pt7b, 2u);
+  format_fixed(str, sizeof(str), series ? lo : lo / 10, 0u, 999);
+  dl_text(dl, (int)(px + w + 8u), (int)(py + ph), str, &AtkinsonForecast24pt7b, 2u);
+}
+static_assert(gfxmetrics_width(AtkinsonForecast24pt7bMetrics, "-88") + 8u <= EPD_UI_CHART_LABEL_W,
+              "chart range label overflows");
+
+void epd_ui_build_history_page(epd_ui_ctx_t *ctx, int16_t indoor_temp_dc, int indoor_humidity,
+                               const epd_ui_history_t *history, uint32_t now) {
+  epd_ui_dl_t *dl = page_begin_4g(ctx, "INDOOR HISTORY", EPD_UI_PAGE_HISTORY);
+  layout_temp_humidity_4g(dl, indoor_temp_dc, indoor_humidity, EPD_UI_HISTORY_TEMP_Y, EPD_UI_HISTORY_HUMID_Y,
+                          EPD_UI_MARGIN);
+  if (history && history->magic != EPD_UI_HISTORY_MAGIC) history = NULL;
+  layout_history_series_4g(dl, history, now, 0u, EPD_UI_HISTORY_CHART_Y);
+  layout_history_series_4g(dl, history, now, 1u, EPD_UI_HISTORY_CHART_Y + EPD_UI_CHART_PANEL_H);
+}
+
+/* Whole degrees in font with ° in Inter 32px, right-aligned, baseline y; "---" past ±99. The
+ * number is its own item, so a new value alone is a numbers-only change. */
+static void layout_degrees_right_4g(epd_ui_dl_t *dl, unsigned int y, int temp_c, const GFXfont *font,
+                                    const GFXmetrics &m, unsigned int gray) {
+  constexpr unsigned int tw_deg = gfxmetrics_width(InterTempRegular32pt7bMetrics, "°");
+  char str[8];
+  format_temp_int_degree(str, sizeof(str), temp_c);
+  if (str[0] == '-' && str[1] == '-') {
+    dl_text_right(dl, (int)y, str, font, m, gray);
+    return;
+  }
+  const unsigned int w = text_width(str, m);
+  const int tx = (int)(EPD_UI_RIGHT_EDGE - tw_deg - 2u - w);
+  dl_text(dl, tx, (int)y, str, font, gray);
+  dl_text(dl, tx + (int)w + 2, (int)y, "°", &InterTempRegular32pt7b, gray);
+}
+
+/* Condition of a WMO code in words (Open-Meteo's code table, grouped); letters only, as
+ * InterLabel14 has no punctuation. */
+static const char *wmo_condition_name(int wmo) {
+  if (wmo < 0 || wmo > 99) return "Unknown";
+  if (wmo == 0) return "Clear sky";
+  if (wmo == 1) return "Mainly clear";
+  if (wmo == 2) return "Partly cloudy";
+  if (wmo == 3) return "Overcast";
+  if (wmo == 45 || wmo == 48) return "Fog";
+  if (wmo >= 51 && wmo <= 57) return "Drizzle";
+  if (wmo >= 61 && wmo <= 67) return "Rain";
+  if (wmo >= 71 && wmo <= 77) return "Snow";
+  if (wmo >= 80 && wmo <= 82) return "Rain showers";
+  if (wmo == 85 || wmo == 86) return "Snow showers";
+  if (wmo >= 95) return "Thunderstorm";
+  return "Unknown";
+}
+
+void epd_ui_build_forecast_page(epd_ui_ctx_t *ctx, const epd_ui_forecast_day_t *forecast,
+                                const char *last_update_str) {
+  epd_ui_dl_t *dl = page_begin_4g(ctx, "FORECAST", EPD_UI_PAGE_FORECAST);
+  for (unsigned int i = 0; i < 3u; i++) {
+    const unsigned int ry = EPD_UI_PAGE_TOP + i * EPD_UI_FC_PAGE_ROW_H;
+    const char *date_str = (forecast && forecast[i].date && forecast[i].date[0]) ? forecast[i].date : "---";
+    const int wmo = forecast ? forecast[i].wmo_code : -1;
+
+    /* Date Atkinson 24px black, condition Inter 14px dark gray, icon below the date. */
+    dl_text(dl, (int)EPD_UI_MARGIN, (int)(ry + EPD_UI_FC_PAGE_DATE_Y), date_str, &AtkinsonForecast24pt7b, 3u);
+    dl_text(dl, (int)EPD_UI_FC_PAGE_TEXT_X, (int)(ry + EPD_UI_FC_PAGE_DATE_Y), wmo_condition_name(wmo),
+            &InterLabel14pt7b, 2u);
+    layout_weather_icon_4g(dl, wmo, EPD_UI_MARGIN, ry + EPD_UI_FC_PAGE_ICON_Y);
+
+    /* Max Inter 48px black with ° in 32px, min Inter 32px dark gray; right-aligned, labelled. */
+    dl_text(dl, (int)EPD_UI_FC_PAGE_TEXT_X, (int)(ry + EPD_UI_FC_PAGE_MAX_Y), "max", &InterLabel14pt7b, 2u);
+    dl_text(dl, (int)EPD_UI_FC_PAGE_TEXT_X, (int)(ry + EPD_UI_FC_PAGE_MIN_Y), "min", &InterLabel14pt7b, 2u);
+    layout_degrees_right_4g(dl, ry + EPD_UI_FC_PAGE_MAX_Y, forecast ? forecast[i].temp_max_c : 100,
+                            &InterTempSemiBold48pt7b, InterTempSemiBold48pt7bMetrics, 3u);
+    layout_degrees_right_4g(dl, ry + EPD_UI_FC_PAGE_MIN_Y, forecast ? forecast[i].temp_min_c : 100,
+                            &InterTempRegular32pt7b, InterTempRegular32pt7bMetrics, 2u);
+    if (i < 2u) dl_hline(dl, EPD_UI_MARGIN, EPD_UI_RIGHT_EDGE - 1u, ry + EPD_UI_FC_PAGE_ROW_H - 12u, 1u);
+  }
+  layout_last_update_4g(dl, last_update_str);
+}
+static_assert(gfxmetrics_width(InterTempSemiBold48pt7bMetrics, "-99") + 2u +
+              gfxmetrics_width(InterTempRegular32pt7bMetrics, "°") <= EPD_UI_RIGHT_EDGE - EPD_UI_FC_PAGE_TEXT_X -
+              gfxmetrics_width(InterLabel14pt7bMetrics, "max") - 8u, "forecast page temperature overflows");
+static_assert(gfxmetrics_width(InterLabel14pt7bMetrics, "Partly cloudy") <= EPD_UI_RIGHT_EDGE - EPD_UI_FC_PAGE_TEXT_X,
+              "forecast page condition overflows");
+
+/* value with a unit suffix ("1234 ms"). */
+static void format_count(char *out, size_t out_size, uint32_t value, const char *unit) {
+  size_t n = format_fixed(out, out_size, (int)(value > 999999u ? 999999u : value), 0u, 999999);
+  if (n + strlen(unit) + 1u < out_size) strcpy(out + n, unit);
+}
+
+/* Values are InterLabel14 too: letters, digits and ':' only ("---" would stay blank). */
+void epd_ui_build_diagnostics_page(epd_ui_ctx_t *ctx, const epd_ui_diag_t *diag) {
+  epd_ui_dl_t *dl = page_begin_4g(ctx, "DIAGNOSTICS", EPD_UI_PAGE_DIAGNOSTICS);
+  char wakes[12], wake_ms[12], partials[12], cache[24];
+  format_count(wakes, sizeof(wakes), diag->wakes, "");
+  if (diag->last_wake_ms) format_count(wake_ms, sizeof(wake_ms), diag->last_wake_ms, " ms");
+  else strcpy(wake_ms, "unknown");
+  format_count(partials, sizeof(partials), diag->partials, "");
+  if (diag->cache_total_kb) {
+    size_t n = format_fixed(cache, sizeof(cache), diag->cache_used_kb, 0u, 65535);
+    strcpy(cache + n, " of ");
+    format_count(cache + n + 4u, sizeof(cache) - n - 4u, diag->cache_total_kb, " KB");
   } else {
-    static unsigned char icon_buf[ICON_BUF_SIZE];
-    epd_ui_weather_icon_t fallback_icon = epd_ui_weather_code_to_icon(wmo_weather_code);
-    fill_icon_buf_64x64(icon_buf, wmo_weather_code, fallback_icon);
-    blit_1bit_to_4g(icon_buf, EPD_UI_ICON_REGION_W, EPD_UI_ICON_REGION_H,
-                    EPD_UI_OUT_ICON_X, EPD_UI_OUT_ICON_Y);
-  }
-  format_temp_number(str, sizeof(str), outdoor_temp_c);
-  { unsigned int tw_num = gfxfont_string_width(str, &InterTempSemiBold72pt7b);
-    unsigned int tw_deg = gfxfont_string_width(degree_c, &InterTempRegular32pt7b);
-    unsigned int tw_unit = tw_deg + gfxfont_string_width("C", &InterTempRegular32pt7b);
-    unsigned int total = tw_num + 2u + tw_unit;
-    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - (int)total : (int)EPD_UI_OUT_DATA_X);
-    int by = (int)EPD_UI_OUT_TEMP_Y + 103;
-    draw_gfxfont_string_4g(tx, by, str, &InterTempSemiBold72pt7b, 3u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2, by, degree_c, &InterTempRegular32pt7b, 3u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2 + (int)tw_deg, by, "C", &InterTempRegular32pt7b, 3u); }
-  format_humidity_number(str, sizeof(str), outdoor_humidity);
-  { unsigned int tw_num = gfxfont_string_width(str, &InterTempSemiBold48pt7b);
-    unsigned int tw_unit = gfxfont_string_width("%", &InterTempRegular32pt7b);
-    unsigned int total = tw_num + 2u + tw_unit;
-    int tx = (int)((EPD_UI_RIGHT_EDGE > total) ? EPD_UI_RIGHT_EDGE - (int)total : (int)EPD_UI_OUT_DATA_X);
-    int by = (int)EPD_UI_OUT_HUMID_Y + 68;
-    draw_gfxfont_string_4g(tx, by, str, &InterTempSemiBold48pt7b, 2u);
-    draw_gfxfont_string_4g(tx + (int)tw_num + 2, by, "%", &InterTempRegular32pt7b, 2u); }
-
-  /* FORECAST: 3 cards (no title); date Atkinson 24px, temps Inter 28px */
-  {
-    static unsigned char icon_buf[ICON_BUF_SIZE];
-    unsigned int cy = EPD_UI_FORECAST_CARDS_Y;
-    unsigned int cx = EPD_UI_FORECAST_SIDE_MARGIN;
-    for (int i = 0; i < 3; i++) {
-      const char *date_str = (forecast && forecast[i].date && forecast[i].date[0])
-          ? forecast[i].date : "---";
-      int wmo = (forecast && i < 3) ? forecast[i].wmo_code : 0;
-      int tmin = (forecast && i < 3) ? forecast[i].temp_min_c : 0;
-      int tmax = (forecast && i < 3) ? forecast[i].temp_max_c : 0;
-
-      draw_rect_outline_4g(cx, cy, EPD_UI_FORECAST_CARD_W, EPD_UI_FORECAST_CARD_H);
-
-      /* Date Atkinson 24px Black, centered in card */
-      { unsigned int date_w = gfxfont_string_width(date_str, &AtkinsonForecast24pt7b);
-        int tx = (int)cx + (int)(EPD_UI_FORECAST_CARD_W > date_w ? (EPD_UI_FORECAST_CARD_W - date_w) / 2u : 0u);
-        draw_gfxfont_string_4g(tx, (int)cy + (int)EPD_UI_FORECAST_DATE_Y, date_str, &AtkinsonForecast24pt7b, 3u); }
-
-      /* 70x70 box: icon scaled to fit inside preserving aspect ratio, centered */
-      unsigned int icon_x = cx + EPD_UI_FORECAST_ICON_OFFSET_X;
-      unsigned int icon_y = cy + EPD_UI_FORECAST_ICON_Y;
-      const unsigned char *icon_4g = weather_icon_4g_by_wmo(wmo);
-      if (icon_4g) {
-        unsigned int iw = weather_icon_4g_width_by_wmo(wmo);
-        unsigned int ih = weather_icon_4g_height_by_wmo(wmo);
-        blit_4g_icon_to_4g_fit(icon_4g, icon_x, icon_y, iw, ih, EPD_UI_FORECAST_ICON_W);
-      } else {
-        epd_ui_weather_icon_t fallback = epd_ui_weather_code_to_icon(wmo);
-        fill_icon_buf_64x64(icon_buf, wmo, fallback);
-        blit_1bit_to_4g_fit(icon_buf, EPD_UI_ICON_REGION_W, EPD_UI_ICON_REGION_H, icon_x, icon_y, EPD_UI_FORECAST_ICON_W);
+    strcpy(cache, "off");
+  }
+  const char *const rows[][2] = {
+    { "Zigbee", diag->zigbee_ok ? "connected" : "no data" },
+    { "Indoor sensor", diag->sensor_ok ? "SHT40 ok" : "not found" },
+    { "Last HA update", (diag->last_update && diag->last_update[0] && diag->last_update[0] != '-')
+                            ? diag->last_update : "none" },
+    { "Wake cause", diag->wake_cause ? diag->wake_cause : "unknown" },
+    { "Wakes since power on", wakes },
+    { "Previous wake", wake_ms },
+    { "Previous refresh", epd_ui_refresh_mode_name((epd_ui_refresh_mode_t)diag->last_refresh) },
+    { "Refreshes since full", partials },
+    { "Page cache", cache },
+  };
+  for (unsigned int i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+    const int y = (int)(EPD_UI_DIAG_ROW_Y + i * EPD_UI_DIAG_ROW_H);
+    dl_text(dl, (int)EPD_UI_MARGIN, y, rows[i][0], &InterLabel14pt7b, 2u);
+    dl_text_right(dl, y, rows[i][1], &InterLabel14pt7b, InterLabel14pt7bMetrics, 3u);
+  }
+}
+static_assert(EPD_UI_DIAG_ROW_Y + 8u * EPD_UI_DIAG_ROW_H + 8u <= 800u, "diagnostics rows overflow");
+
+/* -------- Frame diff: none / partial / full refresh -------- */
+
+#define EPD_UI_FRAME_SIG_MAGIC  0x45504441ul  /* "EPDA"; bump when the tile layout or a hash changes */
+
+/* Per context: tile_hash of the frame last built, tile_light_gray (tile holds gray value 1),
+ * item_hash (dl_item_hash of frame_dl), item_content (dl_item_content of frame_dl) and
+ * tile_changed (differs from the panel). */
+
+/* A reading: digits, signs and separators only ("21.5", "-3", "12:34", "18.2."). */
+static bool text_is_numeric(const char *s) {
+  if (!*s) return false;
+  for (; *s; s++)
+    if (!((*s >= '0' && *s <= '9') || *s == '.' || *s == '-' || *s == ':' || *s == ' ')) return false;
+  return true;
+}
+
+/* Content key of an item: 0 for numeric text, else a non-zero hash of what it draws without its
+ * position, so units and labels that only move with a reading's width keep their key. */
+static uint16_t dl_item_content(const epd_ui_dl_t *dl, const epd_ui_dl_item_t *it) {
+  const bool text = (it->kind == EPD_UI_DL_TEXT);
+  if (text && text_is_numeric(dl->text + it->arg)) return 0u;
+  const bool spans = (it->kind == EPD_UI_DL_SPANS || it->kind == EPD_UI_DL_SPANS_FILL);
+  const uint32_t v[] = { it->kind, it->gray, (uint32_t)(uintptr_t)it->src, text ? 0u : it->w, text ? 0u : it->h,
+                         (text || spans) ? 0u : (uint32_t)it->arg };
+  uint32_t h = 2166136261ul;
+  for (unsigned int i = 0; i < sizeof(v) / sizeof(v[0]); i++)
+    h = (h ^ v[i]) * 16777619ul;
+  if (text)
+    for (const char *c = dl->text + it->arg; *c; c++) h = (h ^ (unsigned char)*c) * 16777619ul;
+  if (spans)
+    for (unsigned int i = 0; i < 2u * it->w; i++) h = (h ^ dl->spans[it->arg + (int)i]) * 16777619ul;
+  h ^= h >> 16;
+  return (uint16_t)((uint16_t)h ? h : 1u);
+}
+
+/* Dirty list = bounding boxes of the 4-connected groups of changed tiles, so unrelated changes
+ * (digits at the top, "Last update" at the bottom) stay separate planner inputs. */
+static void changed_tiles_to_dirty(epd_ui_ctx_t *ctx) {
+  uint16_t *stack = ctx->tile_stack;
+  uint8_t seen[(EPD_UI_TILE_COUNT + 7u) / 8u];
+  memcpy(seen, ctx->tile_changed, sizeof(seen));  /* cleared as tiles are visited */
+  dirty_reset_4g(ctx);
+  for (unsigned int t0 = 0; t0 < EPD_UI_TILE_COUNT; t0++) {
+    if (!(seen[t0 >> 3] & (1u << (t0 & 7u)))) continue;
+    unsigned int tx0 = EPD_UI_TILES_X, ty0 = EPD_UI_TILES_Y, tx1 = 0, ty1 = 0, sp = 0;
+    seen[t0 >> 3] &= (uint8_t)~(1u << (t0 & 7u));
+    stack[sp++] = (uint16_t)t0;
+    while (sp) {
+      unsigned int t = stack[--sp], tx = t % EPD_UI_TILES_X, ty = t / EPD_UI_TILES_X;
+      if (tx < tx0) tx0 = tx;
+      if (tx > tx1) tx1 = tx;
+      if (ty < ty0) ty0 = ty;
+      if (ty > ty1) ty1 = ty;
+      unsigned int nb[4];
+      unsigned int nn = 0;
+      if (tx > 0u) nb[nn++] = t - 1u;
+      if (tx + 1u < EPD_UI_TILES_X) nb[nn++] = t + 1u;
+      if (ty > 0u) nb[nn++] = t - EPD_UI_TILES_X;
+      if (ty + 1u < EPD_UI_TILES_Y) nb[nn++] = t + EPD_UI_TILES_X;
+      for (unsigned int k = 0; k < nn; k++) {
+        if (!(seen[nb[k] >> 3] & (1u << (nb[k] & 7u)))) continue;
+        seen[nb[k] >> 3] &= (uint8_t)~(1u << (nb[k] & 7u));
+        stack[sp++] = (uint16_t)nb[k];
       }
+    }
+    dirty_add_4g(ctx, (int)(tx0 * EPD_UI_TILE_W), (int)(ty0 * EPD_UI_TILE_H),
+                 (int)((tx1 - tx0 + 1u) * EPD_UI_TILE_W), (int)((ty1 - ty0 + 1u) * EPD_UI_TILE_H));
+  }
+}
 
-      /* MAX on top, line, min below; Inter 28px Black, centered */
-      format_temp_int_degree(str, sizeof(str), tmax);
-      { unsigned int w = gfxfont_string_width(str, &InterTempRegular28pt7b);
-        int tx = (int)cx + (int)(EPD_UI_FORECAST_CARD_W > w ? (EPD_UI_FORECAST_CARD_W - w) / 2u : 0u);
-        draw_gfxfont_string_4g(tx, (int)cy + (int)EPD_UI_FORECAST_TEMP_Y + 33, str, &InterTempRegular28pt7b, 3u); }
-      draw_hline_4g(cx + (EPD_UI_FORECAST_CARD_W - EPD_UI_FORECAST_TEMP_LINE_LEN) / 2u,
-                    cx + (EPD_UI_FORECAST_CARD_W - EPD_UI_FORECAST_TEMP_LINE_LEN) / 2u + EPD_UI_FORECAST_TEMP_LINE_LEN - 1u,
-                    cy + EPD_UI_FORECAST_TEMP_LINE_Y);
-      format_temp_int_degree(str, sizeof(str), tmin);
-      { unsigned int w = gfxfont_string_width(str, &InterTempRegular28pt7b);
-        int tx = (int)cx + (int)(EPD_UI_FORECAST_CARD_W > w ? (EPD_UI_FORECAST_CARD_W - w) / 2u : 0u);
-        draw_gfxfont_string_4g(tx, (int)cy + (int)EPD_UI_FORECAST_TEMP_MAX_Y + 33, str, &InterTempRegular28pt7b, 3u); }
-
-      cx += EPD_UI_FORECAST_CARD_W + EPD_UI_FORECAST_GAP;
+/* Hash the tiles set in rescan (all tiles if NULL) of the 4G band in ctx (FNV-1a over their column
+ * segments in both planes) and flag those with light gray. A tile's rows are one contiguous run of
+ * bytes in each plane column. */
+static void band_tiles_hash(epd_ui_ctx_t *ctx, const uint8_t *rescan) {
+  const unsigned int seg = EPD_UI_TILE_H / 8u;  /* bytes per tile column and plane */
+  const unsigned char *lo = band_fb(ctx).plane_bits(0), *hi = band_fb(ctx).plane_bits(1);
+  const unsigned int bx = ctx->band_x;
+  for (unsigned int ty = 0; ty < EPD_UI_TILES_Y; ty++) {
+    unsigned int b0 = epd_fb_plane_t::byte_index(0u, ty * EPD_UI_TILE_H);
+    for (unsigned int tx = bx / EPD_UI_TILE_W; tx < (bx + EPD_UI_BAND_COLS) / EPD_UI_TILE_W; tx++) {
+      unsigned int t = ty * EPD_UI_TILES_X + tx;
+      if (rescan && !(rescan[t >> 3] & (1u << (t & 7u)))) continue;
+      uint32_t h = 2166136261ul;
+      unsigned char light = 0;
+      for (unsigned int x = tx * EPD_UI_TILE_W; x < (tx + 1u) * EPD_UI_TILE_W; x++) {
+        unsigned int i = (x - bx) * EPD_4G_BYTES_PER_COL + b0;
+        for (unsigned int n = 0; n < seg; n++, i++) {
+          light |= (unsigned char)(lo[i] & ~hi[i]);  /* 2-bit pixel == 01 */
+          h = (h ^ lo[i]) * 16777619ul;
+          h = (h ^ hi[i]) * 16777619ul;
+        }
+      }
+      ctx->tile_hash[t] = h;
+      if (light) ctx->tile_light_gray[t >> 3] |= (uint8_t)(1u << (t & 7u));
+      else ctx->tile_light_gray[t >> 3] &= (uint8_t)~(1u << (t & 7u));
     }
   }
+}
 
-  /* Bottom: "Last update HH:MM" InterLabel14, centered */
-  if (last_update_str && last_update_str[0]) {
-    snprintf(str, sizeof(str), "Last update %s", last_update_str);
-    { unsigned int w = gfxfont_string_width(str, &InterLabel14pt7b);
-      int tx = (int)(480u > w ? (480u - w) / 2u : 0u);
-      draw_gfxfont_string_4g(tx, (int)EPD_UI_LAST_UPDATE_Y, str, &InterLabel14pt7b, 2u); }
+/* band_tiles_hash() over the frame; bands without a tile in rescan are not rasterized. */
+static void frame_tiles_scan(epd_ui_ctx_t *ctx, const uint8_t *rescan) {
+  for (unsigned int bx = 0; bx < EPD_WIDTH; bx += EPD_UI_BAND_COLS) {
+    const epd_ui_rect_t band = { (uint16_t)bx, 0u, (uint16_t)EPD_UI_BAND_COLS, (uint16_t)EPD_HEIGHT };
+    if (rescan && !rect_hits_tiles(&band, rescan)) continue;
+    band_render_4g(ctx, &ctx->frame_dl, bx, NULL);
+    band_tiles_hash(ctx, rescan);
   }
+}
 
-  epd_ui_4g_flip_y = 0;
+/* Set the tiles r touches in mask. */
+static void tiles_mark(uint8_t *mask, const epd_ui_rect_t *r) {
+  if (r->w == 0u || r->h == 0u) return;
+  for (unsigned int ty = r->y / EPD_UI_TILE_H; ty <= (r->y + r->h - 1u) / EPD_UI_TILE_H; ty++) {
+    for (unsigned int tx = r->x / EPD_UI_TILE_W; tx <= (r->x + r->w - 1u) / EPD_UI_TILE_W; tx++) {
+      unsigned int t = ty * EPD_UI_TILES_X + tx;
+      mask[t >> 3] |= (uint8_t)(1u << (t & 7u));
+    }
+  }
+}
 
-#if EPD_UI_4G_INVERT
-  /* Panel shows our 0 as black; invert so we get white background, black content. */
-  for (unsigned int i = 0; i < EPD_UI_4G_BUFFER_SIZE; i++)
-    epd_4g_buffer[i] = (unsigned char)(~epd_4g_buffer[i]);
-#endif
+/* Tiles whose pixels may differ from the frame in sig: those touched by an item, old or new, that
+ * differs at its list position. Every other tile is drawn by the same items in the same order. */
+static void frame_items_diff(const epd_ui_ctx_t *ctx, const epd_ui_frame_sig_t *sig, uint8_t *rescan) {
+  const epd_ui_dl_t *dl = &ctx->frame_dl;
+  unsigned int n = (dl->count > sig->item_count) ? dl->count : sig->item_count;
+  memset(rescan, 0, (EPD_UI_TILE_COUNT + 7u) / 8u);
+  for (unsigned int i = 0; i < n; i++) {
+    int in_new = i < dl->count, in_old = i < sig->item_count;
+    if (in_new && in_old && ctx->item_hash[i] == sig->item_hash[i]) continue;
+    if (in_new) tiles_mark(rescan, &dl->items[i].box);
+    if (in_old) tiles_mark(rescan, &sig->item_box[i]);
+  }
+}
+
+/* True if every item that differs from the frame in sig is numeric text or the same content
+ * moved, so the change is new readings on an unchanged screen. */
+static bool frame_numbers_only(const epd_ui_ctx_t *ctx, const epd_ui_frame_sig_t *sig) {
+  const epd_ui_dl_t *dl = &ctx->frame_dl;
+  unsigned int n = (dl->count > sig->item_count) ? dl->count : sig->item_count;
+  for (unsigned int i = 0; i < n; i++) {
+    int in_new = i < dl->count, in_old = i < sig->item_count;
+    if (in_new && in_old && ctx->item_hash[i] == sig->item_hash[i]) continue;
+    /* An item only one frame has must be numeric (key 0). */
+    if ((in_new ? ctx->item_content[i] : 0u) != (in_old ? sig->item_content[i] : 0u)) return false;
+  }
+  return true;
+}
+
+const char *epd_ui_refresh_mode_name(epd_ui_refresh_mode_t mode) {
+  switch (mode) {
+    case EPD_UI_REFRESH_NONE:    return "none";
+    case EPD_UI_REFRESH_PARTIAL: return "partial";
+    case EPD_UI_REFRESH_FULL:    return "full";
+    case EPD_UI_REFRESH_FAST:    return "fast";
+    default:                     return "?";
+  }
+}
+
+void epd_ui_plan_refresh(epd_ui_ctx_t *ctx, const epd_ui_frame_sig_t *sig, unsigned int flags,
+                         epd_ui_refresh_plan_t *plan) {
+  memset(plan, 0, sizeof(*plan));
+  int known = (sig && sig->magic == EPD_UI_FRAME_SIG_MAGIC && sig->item_count <= EPD_UI_DL_MAX);
+  for (unsigned int i = 0; i < ctx->frame_dl.count; i++) {
+    ctx->item_hash[i] = dl_item_hash(&ctx->frame_dl, &ctx->frame_dl.items[i]);
+    ctx->item_content[i] = dl_item_content(&ctx->frame_dl, &ctx->frame_dl.items[i]);
+  }
+  if (ctx->cache_hit) {
+    /* Tile hashes came with the cached page (epd_ui_page_cache_open()). */
+  } else if (known && sig->background == ctx->frame_dl.background) {
+    /* Tiles no changed item touches keep the panel's hashes; only the rest are rasterized. */
+    uint8_t rescan[(EPD_UI_TILE_COUNT + 7u) / 8u];
+    memcpy(ctx->tile_hash, sig->tile_hash, sizeof(ctx->tile_hash));
+    memcpy(ctx->tile_light_gray, sig->tile_light_gray, sizeof(ctx->tile_light_gray));
+    frame_items_diff(ctx, sig, rescan);
+    frame_tiles_scan(ctx, rescan);
+  } else {
+    frame_tiles_scan(ctx, NULL);
+  }
+
+  unsigned int changed = 0;
+  for (unsigned int t = 0; t < EPD_UI_TILE_COUNT; t++) {
+    int diff = !known || sig->tile_hash[t] != ctx->tile_hash[t];
+    if (diff) ctx->tile_changed[t >> 3] |= (uint8_t)(1u << (t & 7u));
+    else ctx->tile_changed[t >> 3] &= (uint8_t)~(1u << (t & 7u));
+    changed += (unsigned int)diff;
+  }
+  plan->changed_tiles = (uint16_t)changed;
+  changed_tiles_to_dirty(ctx);
 
-  return epd_4g_buffer;
+  plan->mode = EPD_UI_REFRESH_FULL;
+  if (!known) {
+    plan->reason = "panel content unknown";
+    return;
+  }
+  const bool fast_ok = (flags & EPD_UI_PLAN_FAST_OK) || frame_numbers_only(ctx, sig);
+  /* Instead of partial windows: fast when allowed, else full. */
+  const epd_ui_refresh_mode_t whole = fast_ok ? EPD_UI_REFRESH_FAST : EPD_UI_REFRESH_FULL;
+  plan->dither = sig->dithered;
+  if (changed == 0u) {
+    plan->mode = EPD_UI_REFRESH_NONE;
+    plan->reason = "frame unchanged";
+  } else if (sig->partials >= EPD_UI_FULL_REFRESH_EVERY) {
+    plan->reason = "periodic full refresh";
+  } else if (sig->dithered && !fast_ok) {
+    plan->reason = "restore grays after fast refresh";
+  } else if (changed > EPD_UI_PARTIAL_MAX_TILES) {
+    plan->mode = whole;
+    plan->reason = "large change";
+  } else {
+    const epd_ui_rect_t screen = { 0u, 0u, (uint16_t)EPD_WIDTH, (uint16_t)EPD_HEIGHT };
+    epd_ui_rect_t win[EPD_UI_DIRTY_MAX];
+    unsigned int n = plan_part_windows(ctx, &screen, win, ctx->tile_light_gray);
+    unsigned long cost = 0;
+    for (unsigned int i = 0; i < n; i++) {
+      if (rect_hits_tiles(&win[i], ctx->tile_light_gray)) {
+        plan->mode = whole;
+        plan->reason = "light gray in changed area";
+        return;
+      }
+      cost += part_window_cost(&win[i]);
+    }
+    if (cost >= (fast_ok ? EPD_UI_FAST_REFRESH_COST_US : EPD_UI_FULL_REFRESH_COST_US)) {
+      plan->mode = whole;
+      plan->reason = fast_ok ? "partial windows cost more than fast" : "partial windows cost more than full";
+      return;
+    }
+    plan->mode = EPD_UI_REFRESH_PARTIAL;
+    plan->reason = "tiles changed";
+    plan->window_count = (uint8_t)n;
+    memcpy(plan->windows, win, n * sizeof(win[0]));
+  }
+}
+
+void epd_ui_apply_refresh(epd_ui_ctx_t *ctx, epd_ui_frame_sig_t *sig, const epd_ui_refresh_plan_t *plan) {
+  if (plan->mode == EPD_UI_REFRESH_NONE) return;
+  if (plan->mode == EPD_UI_REFRESH_FULL) {
+    EPD_HW_Init_4G();
+    for (unsigned int bx = 0; bx < EPD_WIDTH; bx += EPD_UI_BAND_COLS) {
+      band_render_4g(ctx, &ctx->frame_dl, bx, NULL);
+      EPD_Write_4G_Band(bx, EPD_UI_BAND_COLS, band_fb(ctx).plane_bits(0), band_fb(ctx).plane_bits(1));
+    }
+    EPD_Update_4G();
+    sig->partials = 0;
+    sig->dithered = 0;
+  } else if (plan->mode == EPD_UI_REFRESH_FAST) {
+    EPD_HW_Init_Fast();
+    for (unsigned int bx = 0; bx < EPD_WIDTH; bx += EPD_UI_BAND_COLS) {
+      band_render_4g(ctx, &ctx->frame_dl, bx, NULL);
+      band_to_1bit(ctx);
+      EPD_Write_Fast_Band(bx, EPD_UI_BAND_COLS, ctx->band);
+    }
+    EPD_Update_Fast();
+    sig->partials++;  /* the fast waveform leaves ghosting like a partial one */
+    sig->dithered = 1;
+  } else {
+    for (unsigned int i = 0; i < plan->window_count; i++)
+      push_4g_region_as_1bit(ctx, &ctx->frame_dl, plan->windows[i].x, plan->windows[i].y, plan->windows[i].w,
+                             plan->windows[i].h, plan->dither != 0u);
+    sig->partials++;
+  }
+  memset(ctx->part_history, 0, sizeof(ctx->part_history));  /* block pushes start from full bands */
+  memcpy(sig->tile_hash, ctx->tile_hash, sizeof(sig->tile_hash));
+  memcpy(sig->tile_light_gray, ctx->tile_light_gray, sizeof(sig->tile_light_gray));
+  sig->background = ctx->frame_dl.background;
+  sig->item_count = (uint16_t)ctx->frame_dl.count;
+  for (unsigned int i = 0; i < ctx->frame_dl.count; i++) {
+    sig->item_hash[i] = ctx->item_hash[i];
+    sig->item_box[i] = ctx->frame_dl.items[i].box;
+    sig->item_content[i] = ctx->item_content[i];
+  }
+  sig->magic = EPD_UI_FRAME_SIG_MAGIC;
+}
+
+/* -------- Page cache -------- */
+
+#define EPD_UI_PAGE_CACHE_MAGIC  0x45504731ul  /* "EPG1"; bump when the index or the packing changes */
+
+/* Index part of a cached page at fixed offsets, written front to back: the key, the tile hashes,
+ * cache_cols, tile_light_gray, and the magic last, so an index cut short is never taken. */
+#define EPD_UI_PAGE_INDEX_TILES  4u
+#define EPD_UI_PAGE_INDEX_COLS   (EPD_UI_PAGE_INDEX_TILES + 4u * EPD_UI_TILE_COUNT)
+#define EPD_UI_PAGE_INDEX_LIGHT  (EPD_UI_PAGE_INDEX_COLS + 4u * (EPD_WIDTH + 1u))
+#define EPD_UI_PAGE_INDEX_MAGIC  (EPD_UI_PAGE_INDEX_LIGHT + (EPD_UI_TILE_COUNT + 7u) / 8u)
+static_assert(sizeof(((epd_ui_ctx_t *)0)->cache_cols) == 4u * (EPD_WIDTH + 1u), "cache_cols: one per column + end");
+
+/* What a page looks like: FNV-1a over the format, the firmware build, the background and the
+ * frame's item hashes. Equal keys mean equal pixels. */
+static uint32_t page_cache_key(const epd_ui_ctx_t *ctx, const epd_ui_page_store_t *store) {
+  const epd_ui_dl_t *dl = &ctx->frame_dl;
+  const uint32_t v[] = { EPD_UI_PAGE_CACHE_MAGIC, store->build_id, dl->background, dl->count };
+  uint32_t h = 2166136261ul;
+  for (unsigned int i = 0; i < sizeof(v) / sizeof(v[0]); i++) h = (h ^ v[i]) * 16777619ul;
+  for (unsigned int i = 0; i < dl->count; i++) h = (h ^ dl_item_hash(dl, &dl->items[i])) * 16777619ul;
+  return h;
+}
+
+static bool page_cache_read(const epd_ui_page_store_t *store, unsigned int page, uint32_t offset, void *buf,
+                            size_t len) {
+  return store->read(store->user, page, 0u, offset, buf, len) == len;
+}
+
+static bool page_cache_write(const epd_ui_page_store_t *store, unsigned int page, unsigned int part,
+                             uint32_t offset, const void *buf, size_t len) {
+  return store->write(store->user, page, part, offset, buf, len) == len;
+}
+
+/* True if store holds page with this key and a complete index. */
+static bool page_cache_holds(const epd_ui_page_store_t *store, unsigned int page, uint32_t key) {
+  uint32_t v[2];
+  return page_cache_read(store, page, 0u, &v[0], 4u) && v[0] == key &&
+         page_cache_read(store, page, EPD_UI_PAGE_INDEX_MAGIC, &v[1], 4u) && v[1] == EPD_UI_PAGE_CACHE_MAGIC;
+}
+
+bool epd_ui_page_cache_open(epd_ui_ctx_t *ctx, const epd_ui_page_store_t *store, unsigned int page) {
+  ctx->cache_hit = 0;
+  if (!store || !page_cache_holds(store, page, page_cache_key(ctx, store))) return false;
+  if (!page_cache_read(store, page, EPD_UI_PAGE_INDEX_TILES, ctx->tile_hash, sizeof(ctx->tile_hash)) ||
+      !page_cache_read(store, page, EPD_UI_PAGE_INDEX_COLS, ctx->cache_cols, sizeof(ctx->cache_cols)) ||
+      !page_cache_read(store, page, EPD_UI_PAGE_INDEX_LIGHT, ctx->tile_light_gray, sizeof(ctx->tile_light_gray)))
+    return false;
+  if (ctx->band_dl == &ctx->frame_dl) ctx->band_dl = NULL;
+  ctx->cache_store = store;
+  ctx->cache_page = page;
+  ctx->cache_hit = 1;
+  return true;
+}
+
+bool epd_ui_page_cache_update(epd_ui_ctx_t *ctx, const epd_ui_page_store_t *store, unsigned int page) {
+  if (!store) return false;
+  const uint32_t key = page_cache_key(ctx, store);
+  if (page_cache_holds(store, page, key)) return false;
+  /* cache_buf holds the packed pixels now: rasterize even a frame that is cached as another page. */
+  ctx->cache_hit = 0;
+  const uint32_t none = 0u;  /* no key and no magic until the index is complete */
+  if (!page_cache_write(store, page, 0u, 0u, &none, 4u)) return false;
+  uint32_t written = 0u;
+  unsigned int fill = 0u;
+  for (unsigned int bx = 0; bx < EPD_WIDTH; bx += EPD_UI_BAND_COLS) {
+    band_render_4g(ctx, &ctx->frame_dl, bx, NULL);
+    band_tiles_hash(ctx, NULL);
+    const epd_fb_4g_t fb = band_fb(ctx);
+    for (unsigned int x = bx; x < bx + EPD_UI_BAND_COLS; x++) {
+      if (fill + EPD_UI_PACKED_COLUMN_MAX > EPD_UI_PAGE_CACHE_CHUNK) {
+        if (!page_cache_write(store, page, 1u, written, ctx->cache_buf, fill)) return false;
+        written += fill;
+        fill = 0u;
+      }
+      ctx->cache_cols[x] = written + fill;
+      for (unsigned int k = 0; k < epd_fb_4g_t::kPlanes; k++)
+        fill += packbits_encode(fb.plane_bits(k) + epd_fb_plane_t::byte_index(x - bx, 0u), EPD_4G_BYTES_PER_COL,
+                                ctx->cache_buf + fill);
+    }
+  }
+  if (fill && !page_cache_write(store, page, 1u, written, ctx->cache_buf, fill)) return false;
+  ctx->cache_cols[EPD_WIDTH] = written + fill;
+  const uint32_t magic = EPD_UI_PAGE_CACHE_MAGIC;
+  return page_cache_write(store, page, 0u, 0u, &key, 4u) &&
+         page_cache_write(store, page, 0u, EPD_UI_PAGE_INDEX_TILES, ctx->tile_hash, sizeof(ctx->tile_hash)) &&
+         page_cache_write(store, page, 0u, EPD_UI_PAGE_INDEX_COLS, ctx->cache_cols, sizeof(ctx->cache_cols)) &&
+         page_cache_write(store, page, 0u, EPD_UI_PAGE_INDEX_LIGHT, ctx->tile_light_gray,
+                          sizeof(ctx->tile_light_gray)) &&
+         page_cache_write(store, page, 0u, EPD_UI_PAGE_INDEX_MAGIC, &magic, 4u);
 }
@@ -6,6 +6,7 @@
 #ifndef EPD_UI_H
 #define EPD_UI_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 /* Region sizes (pixels). */
@@ -110,6 +111,36 @@
 #define EPD_UI_FORECAST_BOTTOM_INSET   24u   /* extra offset: add if margin not visible on your panel */
 #define EPD_UI_FORECAST_CARDS_Y        (800u - EPD_UI_FORECAST_BOTTOM_INSET - EPD_UI_FORECAST_CARD_H - EPD_UI_LAST_UPDATE_STRIP_H)
 
+/* Pages other than conditions: title Source Sans 22px with the page dots at the right, a rule,
+ * then the content from EPD_UI_PAGE_TOP. */
+#define EPD_UI_PAGE_TITLE_Y       44u    /* title baseline */
+#define EPD_UI_PAGE_RULE_Y        60u
+#define EPD_UI_PAGE_TOP           (EPD_UI_PAGE_RULE_Y + 16u)
+/* History page: temperature and humidity rows as on the conditions page, the chart below. */
+#define EPD_UI_HISTORY_TEMP_Y     EPD_UI_PAGE_TOP
+#define EPD_UI_HISTORY_HUMID_Y    (EPD_UI_HISTORY_TEMP_Y + EPD_UI_TEMP_ROW_H + EPD_UI_TEMP_HUM_GAP)
+#define EPD_UI_HISTORY_CHART_Y    (EPD_UI_HISTORY_HUMID_Y + EPD_UI_BOX_H + 24u)
+#define EPD_UI_HISTORY_CHART_H    (800u - EPD_UI_MARGIN - EPD_UI_HISTORY_CHART_Y)
+/* Its two charts, temperature above humidity: each a caption, the plot with its range at the
+ * right, and the time axis below. */
+#define EPD_UI_CHART_PANEL_H      (EPD_UI_HISTORY_CHART_H / 2u)
+#define EPD_UI_CHART_CAPTION_H    28u
+#define EPD_UI_CHART_AXIS_H       30u
+#define EPD_UI_CHART_LABEL_W      88u
+#define EPD_UI_CHART_W            (EPD_UI_RIGHT_EDGE - EPD_UI_MARGIN - EPD_UI_CHART_LABEL_W)
+#define EPD_UI_CHART_H            (EPD_UI_CHART_PANEL_H - EPD_UI_CHART_CAPTION_H - EPD_UI_CHART_AXIS_H)
+#define EPD_UI_CHART_POINTS       (EPD_UI_CHART_W / 2u)   /* LTTB vertices per line: one per 2 columns */
+/* Forecast page: one row per day above the last-update line; icon left, max/min right. */
+#define EPD_UI_FC_PAGE_ROW_H      ((EPD_UI_LAST_UPDATE_Y - 28u - EPD_UI_PAGE_TOP) / 3u)
+#define EPD_UI_FC_PAGE_DATE_Y     30u    /* date baseline from the row top */
+#define EPD_UI_FC_PAGE_ICON_Y     44u    /* icon frame top from the row top */
+#define EPD_UI_FC_PAGE_TEXT_X     (EPD_UI_MARGIN + EPD_UI_ICON_REGION_W + 16u)
+#define EPD_UI_FC_PAGE_MAX_Y      110u   /* max temperature baseline from the row top */
+#define EPD_UI_FC_PAGE_MIN_Y      170u   /* min temperature baseline from the row top */
+/* Diagnostics page: one label/value row per field. */
+#define EPD_UI_DIAG_ROW_Y         (EPD_UI_PAGE_TOP + 36u)   /* first baseline */
+#define EPD_UI_DIAG_ROW_H         52u
+
 #define EPD_UI_SEPARATOR2_Y   (800u - EPD_UI_MARGIN)  /* unused; no line drawn */
 #define EPD_UI_FOOTER_Y       (800u - EPD_UI_MARGIN)
 
@@ -149,6 +180,28 @@
 #define EPD_UI_OUTDOOR_HUMID_X    EPD_UI_OUTDOOR_VAL_X
 #define EPD_UI_OUTDOOR_HUMID_Y    EPD_UI_OUTDOOR_VAL_Y
 
+/* Layout checks: the unsigned offsets above must not wrap and the blocks must stack top to bottom
+ * (text extents are checked next to the layout code in epd_ui.cpp). */
+static_assert(EPD_UI_MARGIN >= EPD_UI_DATA_SHIFT_LEFT, "EPD_UI_IN_DATA_X wraps");
+static_assert(EPD_UI_MARGIN + 4u >= EPD_UI_BATTERY_SHIFT_Y, "EPD_UI_BATTERY_ICON_Y wraps");
+static_assert(EPD_UI_MARGIN + EPD_UI_HEADER_H + 20u >= EPD_UI_LAYOUT_SHIFT_Y + EPD_UI_INOUT_SHIFT_Y,
+              "EPD_UI_IN_TEMP_Y wraps");
+static_assert(EPD_UI_IN_LABEL_Y + EPD_UI_LABEL_2X_H <= EPD_UI_SEPARATOR_Y &&
+              EPD_UI_SEPARATOR_Y < EPD_UI_OUT_LABEL_Y, "separator must sit between IN and OUT");
+static_assert(EPD_UI_OUT_ICON_X + EPD_UI_OUT_ICON_W <= EPD_UI_OUT_DATA_X, "OUT icon overlaps OUT data");
+static_assert(EPD_UI_OUT_HUMID_Y + EPD_UI_BOX_H <= EPD_UI_FORECAST_CARDS_Y &&
+              EPD_UI_OUT_ICON_Y + EPD_UI_OUT_ICON_H <= EPD_UI_FORECAST_CARDS_Y, "OUT block overlaps forecast");
+static_assert(2u * EPD_UI_FORECAST_SIDE_MARGIN + 3u * EPD_UI_FORECAST_CARD_W + 2u * EPD_UI_FORECAST_GAP <= 480u,
+              "forecast cards exceed the width");
+static_assert(EPD_UI_FORECAST_ICON_W <= EPD_UI_FORECAST_CARD_W &&
+              EPD_UI_FORECAST_TEMP_LINE_LEN <= EPD_UI_FORECAST_CARD_W &&
+              EPD_UI_FORECAST_TEMP_MAX_Y + 32u <= EPD_UI_FORECAST_CARD_H, "forecast card content overflows");
+static_assert(EPD_UI_FORECAST_CARDS_Y + EPD_UI_FORECAST_CARD_H + 14u <= EPD_UI_LAST_UPDATE_Y,
+              "forecast cards overlap the last-update line");
+static_assert(EPD_UI_CHART_H >= 64u && EPD_UI_CHART_H <= 255u, "chart rows are 8-bit, and need room");
+static_assert(EPD_UI_FC_PAGE_ICON_Y + EPD_UI_ICON_REGION_H <= EPD_UI_FC_PAGE_ROW_H &&
+              EPD_UI_FC_PAGE_MIN_Y + 16u <= EPD_UI_FC_PAGE_ROW_H, "forecast page row overflows");
+
 /** Weather icon / condition (maps from Open-Meteo WMO or HA). */
 typedef enum {
   EPD_UI_ICON_CLEAR = 0,
@@ -167,44 +220,60 @@ typedef enum {
  */
 epd_ui_weather_icon_t epd_ui_weather_code_to_icon(int wmo_code);
 
+/* Measurements are fixed point end to end: temperatures in tenths of a degree C (int16_t "_dc",
+ * 215 = 21.5°C), humidity and battery in whole percent. Values outside the range show "---". */
+#define EPD_UI_TEMP_DC_MAX  999   /* |temp_dc| <= 99.9°C */
+
+/** Renderer context: the band buffer it draws into (caller-owned, EPD_UI_BAND_BUFFER_SIZE bytes),
+ *  its display lists, clip and dirty state, partial-push history, frame-diff hashes and icon
+ *  scratch. Every drawing call takes one; separate contexts share nothing, so one can build the
+ *  next frame while another streams, and a host can render many layouts at once. Defined at the
+ *  end of this file; initialize with epd_ui_ctx_init(). */
+typedef struct epd_ui_ctx epd_ui_ctx_t;
+
+/** Reset ctx and point it at band_buf (EPD_UI_BAND_BUFFER_SIZE bytes, kept by the caller). */
+void epd_ui_ctx_init(epd_ui_ctx_t *ctx, unsigned char *band_buf);
+
+/* Legacy 1-bit partial updates: drawn into ctx's band buffer, then pushed with EPD_Dis_Part. */
+
 /** Draw indoor temperature (e.g. "21.5°C"). Partial update only this region. */
-void epd_ui_draw_indoor_temp(float temp_c);
+void epd_ui_draw_indoor_temp(epd_ui_ctx_t *ctx, int16_t temp_dc);
 
 /** Draw outdoor temperature. */
-void epd_ui_draw_outdoor_temp(float temp_c);
+void epd_ui_draw_outdoor_temp(epd_ui_ctx_t *ctx, int16_t temp_dc);
 
-/** Draw indoor humidity (e.g. "45%"). */
-void epd_ui_draw_indoor_humidity(float humidity_percent);
+/** Draw indoor humidity (e.g. "45%"; 0..100). */
+void epd_ui_draw_indoor_humidity(epd_ui_ctx_t *ctx, int humidity_percent);
 
 /** Draw outdoor humidity. */
-void epd_ui_draw_outdoor_humidity(float humidity_percent);
+void epd_ui_draw_outdoor_humidity(epd_ui_ctx_t *ctx, int humidity_percent);
 
 /** Draw outdoor weather icon 64x64 (clear, rain, snow, etc.). */
-void epd_ui_draw_outdoor_icon(epd_ui_weather_icon_t icon);
+void epd_ui_draw_outdoor_icon(epd_ui_ctx_t *ctx, epd_ui_weather_icon_t icon);
 
 /** Draw large centered weather icon 128x128 (2x scaled). */
-void epd_ui_draw_large_weather_icon(epd_ui_weather_icon_t icon);
+void epd_ui_draw_large_weather_icon(epd_ui_ctx_t *ctx, epd_ui_weather_icon_t icon);
 
 /** Draw battery percentage (0–100). Partial update only this region. */
-void epd_ui_draw_battery(float percent);
+void epd_ui_draw_battery(epd_ui_ctx_t *ctx, int percent);
 
 /** Draw status line (e.g. "Updated 12:34"). Max ~50 chars. */
-void epd_ui_draw_status(const char *str);
+void epd_ui_draw_status(epd_ui_ctx_t *ctx, const char *str);
 
 /** Draw second status line. */
-void epd_ui_draw_status2(const char *str);
+void epd_ui_draw_status2(epd_ui_ctx_t *ctx, const char *str);
 
 /** Partial redraw: time in header (always refreshed on wake). */
-void epd_ui_draw_time_header(const char *time_str);
+void epd_ui_draw_time_header(epd_ui_ctx_t *ctx, const char *time_str);
 
 /** Partial redraw: battery icon in header. */
-void epd_ui_draw_battery_header(float percent);
+void epd_ui_draw_battery_header(epd_ui_ctx_t *ctx, int percent);
 
 /** Partial redraw: full IN section (temp, humidity, label). */
-void epd_ui_draw_indoor_block(float indoor_temp_c, float indoor_humidity);
+void epd_ui_draw_indoor_block(epd_ui_ctx_t *ctx, int16_t indoor_temp_dc, int indoor_humidity);
 
 /** Partial redraw: full OUT section (label, icon, temp, humidity). */
-void epd_ui_draw_outdoor_block(float outdoor_temp_c, float outdoor_humidity, int wmo_weather_code);
+void epd_ui_draw_outdoor_block(epd_ui_ctx_t *ctx, int16_t outdoor_temp_dc, int outdoor_humidity, int wmo_weather_code);
 
 /** One day of forecast: date (e.g. "18.2."), WMO code for icon, temp min/max °C (integer). */
 typedef struct {
@@ -215,18 +284,302 @@ typedef struct {
 } epd_ui_forecast_day_t;
 
 /** Partial redraw: forecast cards area. */
-void epd_ui_draw_forecast_block(const epd_ui_forecast_day_t *forecast);
+void epd_ui_draw_forecast_block(epd_ui_ctx_t *ctx, const epd_ui_forecast_day_t *forecast);
 
-/** Build full-screen 4G image buffer (96000 bytes) with demo layout (per ASCII art).
- *  status1: time (top-left). wind_speed_m_s: unused (kept for API compatibility).
+/** Build the conditions screen (demo layout, per ASCII art) as ctx's frame.
+ *  Temperatures in tenths of a degree C, humidity in percent (see EPD_UI_TEMP_DC_MAX).
+ *  status1: time (top-left).
  *  forecast: 3 days (date, icon, temp min-max); NULL = placeholders.
- *  zigbee_sync_warning: if true, draw "!" top-left (Zigbee timeout after previous join; OUT not synced).
+ *  zigbee_sync_warning: if true, draw the no-signal icon top-left (Zigbee timeout after previous
+ *  join; OUT not synced).
+ *  Only records the frame as a display list (text is copied). epd_ui_plan_refresh() and
+ *  epd_ui_apply_refresh() rasterize it EPD_UI_BAND_COLS columns at a time into the band buffer
+ *  given to epd_ui_ctx_init() (EPD_UI_BAND_BUFFER_SIZE bytes, both RAM planes of the band) and
+ *  stream each band to the panel. With EPD_UI_BAND_COLS 480 the band is the whole frame: it is
+ *  rendered here and returned (RAM 0x24 plane, then RAM 0x26 plane); otherwise returns NULL.
  */
-const unsigned char *epd_ui_build_demo_4g(float indoor_temp_c, float indoor_humidity,
-  float outdoor_temp_c, float outdoor_humidity, int wmo_weather_code, const char *last_update_str,
-  const char *status1, float wind_speed_m_s, const epd_ui_forecast_day_t *forecast,
+const unsigned char *epd_ui_build_demo_4g(epd_ui_ctx_t *ctx, int16_t indoor_temp_dc, int indoor_humidity,
+  int16_t outdoor_temp_dc, int outdoor_humidity, int wmo_weather_code, const char *last_update_str,
+  const char *status1, const epd_ui_forecast_day_t *forecast,
   bool zigbee_sync_warning);
 
-#define EPD_UI_4G_BUFFER_SIZE  (96000u)  /* EPD_ARRAY * 2 for 4-gray full screen */
+/* Pages touch cycles through. The conditions page is epd_ui_build_demo_4g(); the others have a
+ * title line with one dot per page and no static layer. */
+typedef enum {
+  EPD_UI_PAGE_CONDITIONS = 0,
+  EPD_UI_PAGE_HISTORY,
+  EPD_UI_PAGE_FORECAST,
+  EPD_UI_PAGE_DIAGNOSTICS,
+  EPD_UI_PAGE_COUNT
+} epd_ui_page_t;
+
+/* Indoor history: SHT40 samples in a ring the caller keeps across deep sleep (RTC memory), on
+ * the caller's clock in seconds. In the sketch that is uptime, not wall time: the system clock is
+ * never set, it keeps counting through deep sleep and restarts at 0 on power loss, which loses
+ * the RTC memory (and so the history) as well. A history whose newest sample is later than the
+ * clock starts over. The chart therefore labels its time axis relative to the newest sample. */
+#define EPD_UI_HISTORY_LEN      320u     /* a little over 24 h at one sample per 5 min wake */
+#define EPD_UI_HISTORY_SPAN_S   86400u   /* the charts show the last 24 h */
+#define EPD_UI_HISTORY_STEP_S   240u     /* samples closer to the newest (touch wakes) are not kept */
+
+typedef struct {
+  uint32_t t;
+  int16_t temp_dc;
+  uint8_t humidity;
+  uint8_t reserved;
+} epd_ui_sample_t;
+
+typedef struct {
+  uint32_t magic;
+  uint16_t head;   /* slot of the next sample */
+  uint16_t count;
+  epd_ui_sample_t samples[EPD_UI_HISTORY_LEN];
+} epd_ui_history_t;
+
+/** Append a sample; the oldest drops out when the ring is full. A history that is not
+ *  initialized, or whose newest sample is later than t (clock reset), starts over. Returns true
+ *  if the sample was kept (false within EPD_UI_HISTORY_STEP_S of the newest). */
+bool epd_ui_history_add(epd_ui_history_t *history, uint32_t t, int16_t temp_dc, int humidity);
+
+/** The newest sample of history, or NULL while it holds none. */
+const epd_ui_sample_t *epd_ui_history_newest(const epd_ui_history_t *history);
+
+/** History page: indoor temperature and humidity now, and charts of both over the
+ *  EPD_UI_HISTORY_SPAN_S before now (history may be NULL). */
+void epd_ui_build_history_page(epd_ui_ctx_t *ctx, int16_t indoor_temp_dc, int indoor_humidity,
+                               const epd_ui_history_t *history, uint32_t now);
+
+/** Forecast page: one row per day with date, condition, icon and max/min temperature, and the
+ *  last-update line. forecast: 3 days; NULL = placeholders. */
+void epd_ui_build_forecast_page(epd_ui_ctx_t *ctx, const epd_ui_forecast_day_t *forecast,
+                                const char *last_update_str);
+
+/** What the diagnostics page lists. */
+typedef struct {
+  const char *wake_cause;      /* "timer", "touch", "power on" */
+  uint32_t wakes;              /* since power on */
+  uint32_t last_wake_ms;       /* boot to sleep of the previous wake; 0 = unknown */
+  bool zigbee_ok;
+  bool sensor_ok;
+  const char *last_update;     /* HA's last update time, "HH:MM" or "---" */
+  uint8_t last_refresh;        /* epd_ui_refresh_mode_t of the previous wake */
+  uint16_t partials;           /* partial and fast refreshes since the last full one */
+  uint16_t cache_used_kb;      /* page cache storage in use */
+  uint16_t cache_total_kb;     /* page cache storage; 0 = no cache */
+} epd_ui_diag_t;
+
+/** Diagnostics page: one "label  value" row per field of diag. */
+void epd_ui_build_diagnostics_page(epd_ui_ctx_t *ctx, const epd_ui_diag_t *diag);
+
+/* Banded rendering: the 4G frame is drawn EPD_UI_BAND_COLS logical columns (panel RAM rows) at
+ * a time into an EPD_UI_BAND_COLS * 200 byte buffer, and each band is streamed to the panel before
+ * the next one is drawn; drawing re-runs once per band. Must divide 480 and be a multiple of
+ * EPD_UI_TILE_W: 32, 96, 160, or 480 to keep the whole frame in RAM. */
+#ifndef EPD_UI_BAND_COLS
+#define EPD_UI_BAND_COLS        32u
+#endif
+#define EPD_UI_BAND_BUFFER_SIZE (EPD_UI_BAND_COLS * 200u)
+
+/* 1: draw every weather icon from the vector icon of its kind (weather_icon_vectors.h, one asset
+ * rasterized at each size) instead of the composed atlas recipes and the baked 70 px images. */
+#ifndef EPD_UI_VECTOR_ICONS
+#define EPD_UI_VECTOR_ICONS     0
+#endif
+
+/* 1: start every band from the static layer baked into flash (epd_ui_static_layer.h: labels,
+ * separator, forecast card outlines and divider lines) instead of white, and record only the
+ * dynamic content. 0: record the static items with the rest (needed to bake the layer, see
+ * tools/static_layer_bake.cpp). */
+#ifndef EPD_UI_STATIC_LAYER
+#define EPD_UI_STATIC_LAYER     1
+#endif
+
+/** Rectangle in logical pixels (dirty boxes, partial-update windows). */
+typedef struct {
+  uint16_t x;
+  uint16_t y;
+  uint16_t w;
+  uint16_t h;
+} epd_ui_rect_t;
+
+#define EPD_UI_PART_MAX_WINDOWS   4u   /* partial-update windows per refresh */
+
+/* Frame diff: the frame on the panel is remembered as one 32-bit hash per tile and per display-list
+ * item; only tiles under changed items are rasterized again to compare. Tile height is a
+ * multiple of the 8 px partial alignment and small enough to keep gray labels out of digit rows. */
+#define EPD_UI_TILE_W             32u
+#define EPD_UI_TILE_H             16u
+#define EPD_UI_TILES_X            (480u / EPD_UI_TILE_W)   /* 15 */
+#define EPD_UI_TILES_Y            (800u / EPD_UI_TILE_H)   /* 50 */
+#define EPD_UI_TILE_COUNT         (EPD_UI_TILES_X * EPD_UI_TILES_Y)
+#define EPD_UI_FULL_REFRESH_EVERY 12u  /* full 4G refresh after this many partials (~1 h at 5 min) */
+#define EPD_UI_PARTIAL_MAX_TILES  (EPD_UI_TILE_COUNT / 3u)  /* more changed tiles -> full refresh */
+static_assert(480u % EPD_UI_TILE_W == 0u && 800u % EPD_UI_TILE_H == 0u && EPD_UI_TILE_H % 8u == 0u,
+              "tiles must cover the screen on the 8 px partial grid");
+
+/* Display list: items (text runs, icons, rects, lines) a frame may record; the frame uses ~25
+ * (~45 with EPD_UI_STATIC_LAYER 0). */
+#define EPD_UI_DL_MAX             64u
+
+/** Signature of the frame on the panel. Caller-owned; keep it across deep sleep (RTC_DATA_ATTR).
+ *  All zero (cold boot) = unknown panel content, next refresh is full. */
+typedef struct {
+  uint32_t magic;
+  uint16_t partials;   /* partial and fast refreshes since the last full refresh */
+  uint8_t dithered;    /* panel shows a fast 1-bit frame: grays as dither patterns */
+  uint8_t background;  /* the frame started from the static layer (epd_ui_dl_t.background) */
+  uint32_t tile_hash[EPD_UI_TILE_COUNT];
+  uint8_t tile_light_gray[(EPD_UI_TILE_COUNT + 7u) / 8u];
+  uint16_t item_count; /* display list of the frame: per item hash, box and content key */
+  uint32_t item_hash[EPD_UI_DL_MAX];
+  epd_ui_rect_t item_box[EPD_UI_DL_MAX];
+  uint16_t item_content[EPD_UI_DL_MAX];
+} epd_ui_frame_sig_t;
+
+typedef enum {
+  EPD_UI_REFRESH_NONE = 0,   /* frame unchanged: no panel activity */
+  EPD_UI_REFRESH_PARTIAL,    /* 1-bit partial update of the windows below */
+  EPD_UI_REFRESH_FULL,       /* full 4-gray refresh */
+  EPD_UI_REFRESH_FAST        /* full-screen 1-bit refresh on the fast waveform, grays dithered */
+} epd_ui_refresh_mode_t;
+
+typedef struct {
+  epd_ui_refresh_mode_t mode;
+  const char *reason;        /* short text for logging */
+  uint16_t changed_tiles;
+  uint8_t dither;            /* 1-bit output dithers the grays (fast, or partial over a fast frame) */
+  uint8_t window_count;
+  epd_ui_rect_t windows[EPD_UI_PART_MAX_WINDOWS];
+} epd_ui_refresh_plan_t;
+
+/* epd_ui_plan_refresh() flags. */
+#define EPD_UI_PLAN_FAST_OK  0x01u  /* a fast 1-bit refresh is fine for any change (touch wake: answer quickly) */
+
+/** Compare the frame from epd_ui_build_demo_4g() with sig and choose none / partial / full / fast.
+ *  Partial windows never cover light-gray content (1-bit partial would drop it). Fast refreshes
+ *  (EPD_HW_Init_Fast, ~half the time of a 4G one; dark and light gray become 4x4 ordered-dither
+ *  patterns) replace full ones when flags has EPD_UI_PLAN_FAST_OK or only numeric text changed;
+ *  the next change without either restores the grays with a full refresh. */
+void epd_ui_plan_refresh(epd_ui_ctx_t *ctx, const epd_ui_frame_sig_t *sig, unsigned int flags,
+                         epd_ui_refresh_plan_t *plan);
+
+/** Drive the panel per plan (full: EPD_HW_Init_4G, EPD_Write_4G_Band per band, EPD_Update_4G;
+ *  fast: EPD_HW_Init_Fast, each band dithered to 1 bpp in place, EPD_Write_Fast_Band,
+ *  EPD_Update_Fast), then update sig. */
+void epd_ui_apply_refresh(epd_ui_ctx_t *ctx, epd_ui_frame_sig_t *sig, const epd_ui_refresh_plan_t *plan);
+
+/** "none" / "partial" / "full" / "fast" for logging. */
+const char *epd_ui_refresh_mode_name(epd_ui_refresh_mode_t mode);
+
+/* Page cache: built frames kept rasterized and packed (per column one PackBits stream per plane,
+ * the static layer's format) with their tile hashes, in storage the caller supplies (the SPIFFS
+ * partition in the sketch). A page whose content matches its cached copy is decoded and streamed
+ * instead of rasterized, and its refresh is planned from the cached tile hashes. */
+#define EPD_UI_PAGE_CACHE_CHUNK  1024u  /* bytes moved per storage call */
+
+/** Storage of the page cache. Each page has two parts: 0 its index, 1 its packed pixels.
+ *  read: len bytes at offset into buf, returns the bytes read. write: len bytes at offset, where
+ *  offset 0 starts the part anew and later writes follow on; returns the bytes written. */
+typedef struct {
+  void *user;
+  uint32_t build_id;  /* identifies the firmware: item hashes hold flash addresses, so pages cached
+                       * by another build are never taken */
+  size_t (*read)(void *user, unsigned int page, unsigned int part, uint32_t offset, void *buf, size_t len);
+  size_t (*write)(void *user, unsigned int page, unsigned int part, uint32_t offset, const void *buf,
+                  size_t len);
+} epd_ui_page_store_t;
+
+/** Look the frame built last up as page in store. On a hit (same content, same firmware build)
+ *  epd_ui_plan_refresh() takes its tile hashes from the cache and every band of it is decoded
+ *  instead of rasterized, until the next frame is built. Returns true on a hit. */
+bool epd_ui_page_cache_open(epd_ui_ctx_t *ctx, const epd_ui_page_store_t *store, unsigned int page);
+
+/** Store the frame built last as page unless store already holds it: every band is rasterized,
+ *  hashed into ctx's tiles and packed. Returns true if the page was written. */
+bool epd_ui_page_cache_update(epd_ui_ctx_t *ctx, const epd_ui_page_store_t *store, unsigned int page);
+
+/* -------- Renderer context: fields are private to epd_ui.cpp -------- */
+
+#define EPD_UI_DIRTY_MAX       16u   /* dirty boxes per list */
+#define EPD_UI_CLIP_DEPTH      4u    /* nested clip rectangles */
+#define EPD_UI_DL_TEXT_MAX     320u  /* text bytes a display list copies */
+#define EPD_UI_DL_CLIPS        8u    /* clip rectangles per list, clips[0] = the screen */
+#define EPD_UI_DL_SPAN_COLS    (2u * EPD_UI_CHART_W)  /* chart columns a display list holds */
+#define EPD_UI_PART_BLOCKS     5u    /* time, battery, indoor, outdoor, forecast */
+/* Composed weather icon: the 106 px frame, 4 px per byte, column-major. */
+#define EPD_UI_ICON_SCRATCH_SIZE  (EPD_UI_ICON_REGION_W * ((EPD_UI_ICON_REGION_H + 3u) / 4u))
+
+/* Clip rectangle, half-open, in screen coordinates. */
+typedef struct {
+  int x0, y0, x1, y1;
+} epd_ui_clip_t;
+
+/* One recorded drawing operation (see the display list in epd_ui.cpp). */
+typedef struct {
+  epd_ui_rect_t box;
+  const void *src;
+  int arg;
+  int16_t x, y;
+  uint16_t w, h;
+  uint8_t kind;
+  uint8_t gray;
+  uint8_t clip;  /* index into clips[] of its list */
+} epd_ui_dl_item_t;
+
+typedef struct {
+  epd_ui_dl_item_t items[EPD_UI_DL_MAX];
+  char text[EPD_UI_DL_TEXT_MAX];
+  uint8_t spans[2u * EPD_UI_DL_SPAN_COLS];  /* chart columns: top and bottom row each */
+  epd_ui_rect_t clips[EPD_UI_DL_CLIPS];
+  uint8_t clip_stack[EPD_UI_CLIP_DEPTH];
+  unsigned int count;
+  unsigned int text_len;
+  unsigned int span_len;
+  unsigned int clip_count;
+  unsigned int clip_depth;
+  uint8_t clip;  /* clip of the items recorded now */
+  uint8_t background;  /* 1: bands start from the static layer (EPD_UI_STATIC_LAYER), else white */
+} epd_ui_dl_t;
+
+/* Boxes a block's previous partial push drew. */
+typedef struct {
+  epd_ui_rect_t rects[EPD_UI_DIRTY_MAX];
+  uint8_t count;
+  uint8_t valid;
+} epd_ui_part_history_t;
+
+struct epd_ui_ctx {
+  /* Band: columns band_x .. + EPD_UI_BAND_COLS - 1 of band_dl, drawn inside band_region, in 4G
+   * or as ink only (band_ink: the dark gray and black plane, for 1-bit partial updates). */
+  unsigned char *band;
+  unsigned int band_x;
+  uint8_t band_ink;
+  const epd_ui_dl_t *band_dl;
+  epd_ui_rect_t band_region;
+  epd_ui_clip_t clip;
+  epd_ui_clip_t clip_stack[EPD_UI_CLIP_DEPTH];
+  unsigned int clip_depth;
+  epd_ui_rect_t dirty[EPD_UI_DIRTY_MAX];
+  unsigned int dirty_count;
+  epd_ui_dl_t frame_dl;  /* epd_ui_build_demo_4g() */
+  epd_ui_dl_t block_dl;  /* epd_ui_draw_*_block / *_header */
+  epd_ui_part_history_t part_history[EPD_UI_PART_BLOCKS];
+  /* Frame diff of frame_dl against the panel. */
+  uint32_t tile_hash[EPD_UI_TILE_COUNT];
+  uint8_t tile_light_gray[(EPD_UI_TILE_COUNT + 7u) / 8u];
+  uint8_t tile_changed[(EPD_UI_TILE_COUNT + 7u) / 8u];
+  uint32_t item_hash[EPD_UI_DL_MAX];
+  uint16_t item_content[EPD_UI_DL_MAX];
+  uint16_t tile_stack[EPD_UI_TILE_COUNT];
+  /* Page cache: with cache_hit, frame_dl's bands are decoded from page cache_page of cache_store. */
+  const epd_ui_page_store_t *cache_store;
+  unsigned int cache_page;
+  uint8_t cache_hit;
+  uint32_t cache_cols[480u + 1u];  /* offset of each column's streams in the packed pixels, then the end */
+  uint8_t cache_buf[EPD_UI_PAGE_CACHE_CHUNK];
+  /* Last weather icon recipe composed, and the result. */
+  const void *icon_recipe;
+  unsigned char icon[EPD_UI_ICON_SCRATCH_SIZE];
+};
 
 #endif /* EPD_UI_H */
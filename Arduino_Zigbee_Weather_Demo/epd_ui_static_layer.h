@@ -0,0 +1,160 @@
+/* Static layer of the screen (labels, separator, forecast card outlines and divider lines) in
+ * the 4G band buffer's format: per column a PackBits stream of its 100 bytes in plane 0, then one
+ * for plane 1, at epd_ui_static_layer + epd_ui_static_layer_cols[x] (identical columns share
+ * them). Drawn under every band by band_render_4g() in epd_ui.cpp.
+ * Generated by tools/static_layer_bake.cpp; do not edit. */
+#ifndef EPD_UI_STATIC_LAYER_H
+#define EPD_UI_STATIC_LAYER_H
+
+#define EPD_UI_STATIC_LAYER_KEY  0xA4929256ul  /* static_layer_key() it was baked with */
+
+constexpr uint16_t epd_ui_static_layer_cols[480] = {
+      0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0,     0,     0,     4,    32,    60,    91,   123,   158,   194,   229,
+    261,   293,   327,   361,   361,   361,   395,   429,   429,   429,   466,   504,
+    540,   577,   614,   651,   688,   723,   758,   789,   819,   849,   879,   909,
+    939,   970,  1006,  1042,  1075,  1107,  1139,  1180,  1180,  1180,  1221,  1262,
+   1180,  1180,  1180,  1139,  1303,  1343,  1384,  1425,  1466,  1507,  1507,  1507,
+   1507,  1507,  1543,  1543,  1543,  1543,  1543,  1543,  1543,  1543,  1543,  1580,
+   1580,  1580,  1543,  1543,  1543,  1543,  1543,  1543,  1543,  1543,  1543,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+      4,  1621,  1621,  1621,  1621,  1621,  1621,  1621,  1621,  1621,  1621,  1621,
+   1621,     4,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,     4,  1621,  1621,
+   1621,  1621,  1621,  1621,  1621,  1621,  1621,  1621,  1621,  1621,     4,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,  1507,
+   1507,  1507,  1507,  1507,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
+     32,    32,    32,    32,    32,    32,     4,  1621,     0,     0,     0,     0,
+      0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+};
+
+constexpr uint8_t epd_ui_static_layer[1633] = {
+  0xE2, 0x00, 0xE2, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x3F, 0x9A, 0xFF, 0x00, 0xF0,
+  0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x3F, 0x9A, 0xFF, 0x00, 0xF0, 0x84, 0x00,
+  0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00,
+  0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x03, 0x08,
+  0x00, 0x01, 0xFC, 0x9C, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00,
+  0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x04, 0x08, 0x00,
+  0x1F, 0xFF, 0xC0, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00,
+  0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00, 0x81, 0xFF, 0x05,
+  0xF8, 0x08, 0x00, 0x7F, 0xFF, 0xF0, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00,
+  0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00,
+  0x81, 0xFF, 0x02, 0xF8, 0x08, 0x00, 0x80, 0xFF, 0x00, 0xF8, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00,
+  0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10,
+  0x84, 0x00, 0x98, 0x00, 0x81, 0xFF, 0x05, 0xF8, 0x08, 0x03, 0xF8, 0x01, 0xFC, 0x9B, 0x00, 0x00,
+  0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x04, 0x08, 0x03, 0xE0, 0x00, 0x3E, 0x9B, 0x00, 0x00,
+  0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x04, 0x08, 0x07, 0x80, 0x00, 0x0F, 0x9B, 0x00, 0x00,
+  0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x01, 0x08, 0x0F, 0x80, 0x00, 0x01, 0x07, 0x80, 0x9A,
+  0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00,
+  0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x01, 0x08, 0x0E, 0x80, 0x00, 0x01, 0x07,
+  0x80, 0x9A, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F,
+  0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x01, 0x08, 0x0E, 0x80, 0x00,
+  0x01, 0x03, 0x80, 0x9A, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00,
+  0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x01, 0x08, 0x1C,
+  0x80, 0x00, 0x01, 0x01, 0xC0, 0x9A, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C,
+  0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00, 0x81,
+  0xFF, 0x02, 0xF8, 0x08, 0x0E, 0x80, 0x00, 0x01, 0x03, 0x80, 0x9A, 0x00, 0x00, 0x20, 0x9A, 0x00,
+  0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10,
+  0x84, 0x00, 0x98, 0x00, 0x00, 0xFC, 0x81, 0x00, 0x01, 0x08, 0x0F, 0x80, 0x00, 0x01, 0x07, 0x80,
+  0x9A, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00,
+  0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00, 0x00, 0x7F, 0x81, 0x00, 0x04, 0x08,
+  0x07, 0x80, 0x00, 0x0F, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00,
+  0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00, 0x01, 0x1F,
+  0xC0, 0x80, 0x00, 0x04, 0x08, 0x07, 0xC0, 0x00, 0x1F, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84,
+  0x00, 0x98, 0x00, 0x01, 0x07, 0xF0, 0x80, 0x00, 0x04, 0x08, 0x03, 0xF0, 0x00, 0x7E, 0x9B, 0x00,
+  0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20,
+  0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00, 0x01, 0x01, 0xFC, 0x80, 0x00, 0x04, 0x08, 0x01,
+  0xFF, 0x07, 0xFC, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00,
+  0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x99, 0x00, 0x00, 0xFE, 0x80,
+  0x00, 0x01, 0x08, 0x00, 0x80, 0xFF, 0x00, 0xF8, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10,
+  0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00,
+  0x99, 0x00, 0x07, 0x3F, 0x80, 0x00, 0x08, 0x00, 0x3F, 0xFF, 0xE0, 0x9B, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x99, 0x00, 0x07, 0x0F, 0xE0, 0x00, 0x08, 0x00, 0x0F, 0xFF, 0x80, 0x9B, 0x00,
+  0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20,
+  0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x99, 0x00, 0x03, 0x03, 0xF8, 0x00, 0x08, 0x9F, 0x00, 0x00,
+  0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9A, 0x00, 0x02, 0xFE, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9A, 0x00, 0x02, 0x7F, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84,
+  0x00, 0x9A, 0x00, 0x02, 0x1F, 0xC0, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84,
+  0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9A,
+  0x00, 0x02, 0x07, 0xF0, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C,
+  0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9A, 0x00, 0x02,
+  0x01, 0xF8, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00,
+  0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00, 0x81, 0xFF, 0x01,
+  0xF8, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08,
+  0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00, 0x81, 0xFF, 0x02, 0xF8,
+  0x08, 0x0F, 0x80, 0xFF, 0x00, 0xE0, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00,
+  0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10, 0x84, 0x00, 0x98, 0x00,
+  0x81, 0xFF, 0x02, 0xF8, 0x08, 0x0F, 0x80, 0xFF, 0x00, 0xF8, 0x9B, 0x00, 0x00, 0x20, 0x9A, 0x00,
+  0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x10,
+  0x84, 0x00, 0x9C, 0x00, 0x01, 0x08, 0x0F, 0x80, 0xFF, 0x00, 0xFE, 0x9B, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0xFF, 0x9B, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x1F, 0x9B, 0x00, 0x00, 0x20, 0x9A,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x81, 0x00, 0x01, 0x07, 0x80, 0x9A, 0x00, 0x00, 0x20,
+  0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00,
+  0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08,
+  0x81, 0x00, 0x01, 0x03, 0x80, 0x9A, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x81, 0x00, 0x01, 0x01, 0xC0, 0x9A, 0x00,
+  0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08,
+  0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00,
+  0x00, 0x08, 0x81, 0x00, 0x01, 0x03, 0xC0, 0x9A, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00,
+  0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x1F, 0x9B,
+  0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00,
+  0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x01, 0x01, 0xFE, 0x9B, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08,
+  0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00,
+  0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x01, 0x08, 0x0F, 0x80, 0xFF, 0x00,
+  0xFC, 0x9B, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C,
+  0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84,
+  0x00, 0x9C, 0x00, 0x01, 0x08, 0x0F, 0x80, 0xFF, 0x00, 0xF8, 0x9B, 0x00, 0x00, 0x20, 0x93, 0x00,
+  0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20,
+  0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x01, 0x08, 0x0F, 0x80,
+  0xFF, 0x00, 0xC0, 0x9B, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84,
+  0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00,
+  0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x01, 0x08, 0x0E, 0x9E, 0x00, 0x00, 0x20,
+  0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00,
+  0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x01, 0x08,
+  0x0F, 0x81, 0xFF, 0x00, 0x80, 0x9A, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00,
+  0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0x9F, 0x00, 0x00, 0x20, 0x93, 0x00, 0x00, 0x08, 0x84,
+  0x00, 0x00, 0x10, 0x84, 0x00, 0x9C, 0x00, 0x00, 0x08, 0xC3, 0x00, 0x9C, 0x00, 0x00, 0x08, 0xC3,
+  0x00,
+};
+
+#endif /* EPD_UI_STATIC_LAYER_H */
@@ -183,6 +183,6 @@ const GFXglyph AtkinsonForecast24pt7bGlyphs[] PROGMEM = {
 const GFXfont AtkinsonForecast24pt7b PROGMEM = {
   (uint8_t  *)AtkinsonForecast24pt7bBitmaps,
   (GFXglyph *)AtkinsonForecast24pt7bGlyphs,
-  0x20, 0x7E, 58 };
+  0x20, 0x7E, 58, GFXFONT_ENC_BITMAP, NULL, 0 };
 
 // Approx. 1662 bytes
@@ -0,0 +1,22 @@
+/* AtkinsonForecast24pt7b glyph advances as constexpr tables (compile-time text widths). */
+/* Generated by tools/gfxfont_to_metrics_header.py from Aktinson24.h. */
+#ifndef AKTINSON24_METRICS_H
+#define AKTINSON24_METRICS_H
+
+#include "gfxfont.h"
+
+constexpr uint8_t AtkinsonForecast24pt7bAdvance[] = {
+   25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  17,  10,  25,
+   30,  19,  26,  27,  29,  27,  28,  24,  29,  28,  25,  25,  25,  25,  25,  25,
+   25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+   25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+   25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+   25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+};
+
+constexpr GFXmetrics AtkinsonForecast24pt7bMetrics = {
+  AtkinsonForecast24pt7bAdvance,
+  AtkinsonForecast24pt7bAdvance + (0x30 - 0x20),
+  0x20, 0x7E, nullptr, 0 };
+
+#endif /* AKTINSON24_METRICS_H */
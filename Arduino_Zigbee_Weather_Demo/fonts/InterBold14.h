@@ -154,6 +154,6 @@ const GFXglyph InterTempSemiBold14pt7bGlyphs[] PROGMEM = {
 const GFXfont InterTempSemiBold14pt7b PROGMEM = {
   (uint8_t  *)InterTempSemiBold14pt7bBitmaps,
   (GFXglyph *)InterTempSemiBold14pt7bGlyphs,
-  0x20, 0x7E, 33 };
+  0x20, 0x7E, 33, GFXFONT_ENC_BITMAP, NULL, 0 };
 
 // Approx. 1318 bytes
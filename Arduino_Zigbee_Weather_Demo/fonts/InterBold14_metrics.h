@@ -0,0 +1,22 @@
+/* InterTempSemiBold14pt7b glyph advances as constexpr tables (compile-time text widths). */
+/* Generated by tools/gfxfont_to_metrics_header.py from InterBold14.h. */
+#ifndef INTERBOLD14_METRICS_H
+#define INTERBOLD14_METRICS_H
+
+#include "gfxfont.h"
+
+constexpr uint8_t InterTempSemiBold14pt7bAdvance[] = {
+   18,  18,  18,  18,  18,  28,  18,  18,  18,  18,  18,  18,  18,  13,   9,  10,
+   18,  12,  17,  17,  18,  17,  18,  16,  18,  18,   9,  18,  18,  18,  18,  18,
+   18,  18,  18,  20,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+   18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+   18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  25,  18,  18,
+   18,  18,  18,  15,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+};
+
+constexpr GFXmetrics InterTempSemiBold14pt7bMetrics = {
+  InterTempSemiBold14pt7bAdvance,
+  InterTempSemiBold14pt7bAdvance + (0x30 - 0x20),
+  0x20, 0x7E, nullptr, 0 };
+
+#endif /* INTERBOLD14_METRICS_H */
@@ -653,6 +653,6 @@ const GFXglyph InterTempSemiBold48pt7bGlyphs[] PROGMEM = {
 const GFXfont InterTempSemiBold48pt7b PROGMEM = {
   (uint8_t  *)InterTempSemiBold48pt7bBitmaps,
   (GFXglyph *)InterTempSemiBold48pt7bGlyphs,
-  0x20, 0x7E, 114 };
+  0x20, 0x7E, 114, GFXFONT_ENC_BITMAP, NULL, 0 };
 
 // Approx. 7297 bytes
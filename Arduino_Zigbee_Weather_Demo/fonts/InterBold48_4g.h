@@ -0,0 +1,308 @@
+/* InterTempSemiBold48pt7b glyphs pre-transposed to column-major 1-bit masks (RAM plane order). */
+/* Generated by tools/gfxfont_to_4g_header.py from InterBold48.h; include after the base font. */
+#ifndef INTERBOLD48_4G_H
+#define INTERBOLD48_4G_H
+
+#include "gfxfont.h"
+
+const uint8_t InterTempSemiBold48pt7b4gBitmaps[] PROGMEM = {
+  0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+  0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+  0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+  0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0xE0,
+  0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE,
+  0xFF, 0xFE, 0x7F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xF0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x3F, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+  0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x3F,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xF8, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x7F, 0xFF, 0x9F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0xF8,
+  0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFC,
+  0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
+  0xFF, 0xE0, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xF8, 0xFF, 0xC0, 0x00,
+  0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xF8, 0xFF,
+  0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x1F,
+  0xF8, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0xF0,
+  0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x3F, 0xFF, 0x00, 0xFF,
+  0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF8,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x1F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xFF,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+  0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x3F,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xC0,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC,
+  0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00,
+  0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE,
+  0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00,
+  0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xFF,
+  0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F,
+  0xFC, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0x80,
+  0x00, 0x3F, 0xF8, 0x7F, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x7F, 0xFE, 0x00, 0xFF,
+  0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x3F, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xBF, 0xF8, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x0F,
+  0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+  0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+  0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC7,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFE, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFE,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
+  0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+  0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F,
+  0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00,
+  0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xFE, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0xF0,
+  0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
+  0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0x80,
+  0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00,
+  0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0xFF,
+  0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F,
+  0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00,
+  0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x01, 0xFF,
+  0x80, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0,
+  0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0,
+  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x01,
+  0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
+  0x00, 0x07, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0xFF, 0xC0, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+  0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+  0xF8, 0x00, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xF0,
+  0x3F, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+  0xFF, 0xF0, 0x3F, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xFC, 0x00, 0x1F, 0xF0,
+  0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00,
+  0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0xFF,
+  0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F,
+  0xFC, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00,
+  0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0xFF,
+  0xC0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0,
+  0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC,
+  0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0x3F, 0xF8, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xFC, 0x00, 0x7F, 0xF8,
+  0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0x00,
+  0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+  0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
+  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F,
+  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0,
+  0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+  0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xFF, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
+  0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+  0xC0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
+  0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
+  0x80, 0x07, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x3F, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF8,
+  0x7F, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00,
+  0x3F, 0xF8, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x1F, 0xFF,
+  0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00,
+  0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF,
+  0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F,
+  0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00,
+  0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0,
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
+  0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x00,
+  0x1F, 0xF8, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x7F, 0xFC, 0x00, 0xFF, 0xFF,
+  0xC0, 0x00, 0x7F, 0xF8, 0x3F, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFE, 0x0F, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF8,
+  0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
+  0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFC,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0,
+  0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x01,
+  0xFF, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x7F,
+  0xF8, 0x00, 0x7F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x7F, 0xE0, 0x00,
+  0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0xFF,
+  0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
+  0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC,
+  0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0x00,
+  0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0xFF, 0xC0,
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xFC,
+  0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x7F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x7F,
+  0xC0, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x3F, 0xFE, 0x00,
+  0x01, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x1F,
+  0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+};
+
+const GFXglyph4g InterTempSemiBold48pt7b4gGlyphs[] PROGMEM = {
+  {     0,   2 },   // 0x2D '-'
+  {    62,   2 },   // 0x2E '.'
+  {     0,   0 },   // 0x2F '/'
+  {    90,   9 },   // 0x30 '0'
+  {   558,   9 },   // 0x31 '1'
+  {   819,   9 },   // 0x32 '2'
+  {  1242,   9 },   // 0x33 '3'
+  {  1692,   9 },   // 0x34 '4'
+  {  2169,   9 },   // 0x35 '5'
+  {  2601,   9 },   // 0x36 '6'
+  {  3051,   9 },   // 0x37 '7'
+  {  3465,   9 },   // 0x38 '8'
+  {  3915,   9 },   // 0x39 '9'
+};
+
+const GFXfont4g InterTempSemiBold48pt7b4g PROGMEM = {
+  InterTempSemiBold48pt7b4gBitmaps,
+  InterTempSemiBold48pt7b4gGlyphs,
+  &InterTempSemiBold48pt7b,
+  0x2D, 0x39 };
+
+// Approx. 4416 bytes
+
+#endif /* INTERBOLD48_4G_H */
@@ -0,0 +1,22 @@
+/* InterTempSemiBold48pt7b glyph advances as constexpr tables (compile-time text widths). */
+/* Generated by tools/gfxfont_to_metrics_header.py from InterBold48.h. */
+#ifndef INTERBOLD48_METRICS_H
+#define INTERBOLD48_METRICS_H
+
+#include "gfxfont.h"
+
+constexpr uint8_t InterTempSemiBold48pt7bAdvance[] = {
+   62,  62,  62,  62,  62,  94,  62,  62,  62,  62,  62,  62,  62,  44,  30,  36,
+   62,  40,  59,  60,  63,  58,  60,  54,  60,  60,  30,  62,  62,  62,  62,  62,
+   62,  62,  62,  69,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,
+   62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,
+   62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  85,  62,  62,
+   62,  62,  62,  52,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,
+};
+
+constexpr GFXmetrics InterTempSemiBold48pt7bMetrics = {
+  InterTempSemiBold48pt7bAdvance,
+  InterTempSemiBold48pt7bAdvance + (0x30 - 0x20),
+  0x20, 0x7E, nullptr, 0 };
+
+#endif /* INTERBOLD48_METRICS_H */
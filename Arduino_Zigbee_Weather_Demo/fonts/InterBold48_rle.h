@@ -0,0 +1,429 @@
+/* InterTempSemiBold48pt7b as column run-lengths (GFXFONT_ENC_RLE_COL). */
+/* Generated by tools/gfxfont_to_rle_header.py from InterBold48.h; use instead of it. */
+
+const uint8_t InterTempSemiBold48pt7bBitmaps[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x0A, 0x01, 0x08, 0x10, 0x01,
+  0x06, 0x14, 0x01, 0x05, 0x16, 0x01, 0x04, 0x18, 0x01, 0x03, 0x1A, 0x01,
+  0x02, 0x1C, 0x01, 0x02, 0x1D, 0x01, 0x01, 0x1E, 0x02, 0x01, 0x0B, 0x09,
+  0x0A, 0x03, 0x00, 0x0A, 0x0C, 0x0A, 0x24, 0x01, 0x03, 0x00, 0x09, 0x0E,
+  0x09, 0x23, 0x02, 0x03, 0x00, 0x08, 0x10, 0x08, 0x21, 0x04, 0x03, 0x00,
+  0x08, 0x10, 0x08, 0x20, 0x05, 0x03, 0x00, 0x08, 0x10, 0x08, 0x1E, 0x07,
+  0x03, 0x00, 0x08, 0x10, 0x08, 0x1D, 0x08, 0x03, 0x00, 0x08, 0x10, 0x08,
+  0x1C, 0x09, 0x03, 0x00, 0x09, 0x0E, 0x09, 0x1A, 0x0B, 0x03, 0x00, 0x09,
+  0x0E, 0x09, 0x19, 0x0C, 0x03, 0x01, 0x0A, 0x0A, 0x0A, 0x18, 0x0D, 0x02,
+  0x01, 0x1E, 0x17, 0x0D, 0x02, 0x01, 0x1E, 0x15, 0x0D, 0x02, 0x02, 0x1C,
+  0x15, 0x0D, 0x02, 0x03, 0x1A, 0x14, 0x0D, 0x02, 0x03, 0x1A, 0x13, 0x0D,
+  0x02, 0x04, 0x18, 0x13, 0x0D, 0x02, 0x06, 0x14, 0x13, 0x0D, 0x02, 0x07,
+  0x11, 0x14, 0x0D, 0x02, 0x0A, 0x0C, 0x14, 0x0D, 0x01, 0x29, 0x0D, 0x01,
+  0x27, 0x0D, 0x01, 0x26, 0x0D, 0x01, 0x24, 0x0D, 0x01, 0x23, 0x0D, 0x01,
+  0x22, 0x0D, 0x01, 0x20, 0x0D, 0x01, 0x1F, 0x0D, 0x01, 0x1D, 0x0D, 0x01,
+  0x1C, 0x0D, 0x01, 0x1A, 0x0D, 0x01, 0x19, 0x0D, 0x01, 0x17, 0x0D, 0x01,
+  0x16, 0x0D, 0x01, 0x15, 0x0D, 0x01, 0x13, 0x0D, 0x01, 0x12, 0x0D, 0x01,
+  0x10, 0x0D, 0x02, 0x0F, 0x0D, 0x15, 0x09, 0x02, 0x0D, 0x0D, 0x14, 0x10,
+  0x02, 0x0C, 0x0D, 0x13, 0x14, 0x02, 0x0A, 0x0D, 0x13, 0x17, 0x02, 0x09,
+  0x0D, 0x13, 0x19, 0x02, 0x07, 0x0D, 0x14, 0x1B, 0x02, 0x06, 0x0D, 0x14,
+  0x1D, 0x02, 0x05, 0x0D, 0x15, 0x1D, 0x02, 0x03, 0x0D, 0x16, 0x1F, 0x03,
+  0x02, 0x0D, 0x17, 0x0B, 0x09, 0x0B, 0x03, 0x01, 0x0C, 0x19, 0x09, 0x0D,
+  0x0A, 0x03, 0x01, 0x0B, 0x19, 0x09, 0x0F, 0x09, 0x03, 0x01, 0x09, 0x1B,
+  0x08, 0x11, 0x08, 0x03, 0x01, 0x08, 0x1C, 0x08, 0x11, 0x08, 0x03, 0x01,
+  0x06, 0x1E, 0x08, 0x11, 0x08, 0x03, 0x01, 0x05, 0x1F, 0x08, 0x11, 0x08,
+  0x03, 0x01, 0x04, 0x20, 0x08, 0x11, 0x08, 0x03, 0x01, 0x02, 0x22, 0x09,
+  0x0F, 0x09, 0x03, 0x01, 0x01, 0x23, 0x09, 0x0F, 0x09, 0x02, 0x26, 0x0A,
+  0x0B, 0x0A, 0x01, 0x26, 0x1F, 0x01, 0x26, 0x1F, 0x01, 0x27, 0x1D, 0x01,
+  0x28, 0x1B, 0x01, 0x28, 0x1B, 0x01, 0x29, 0x19, 0x01, 0x2B, 0x15, 0x01,
+  0x2C, 0x13, 0x01, 0x2F, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x04, 0x07,
+  0x01, 0x02, 0x0B, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x0D, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x01, 0x0D, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B,
+  0x01, 0x04, 0x07, 0x01, 0x4E, 0x04, 0x01, 0x4B, 0x07, 0x01, 0x47, 0x0B,
+  0x01, 0x43, 0x0F, 0x01, 0x40, 0x12, 0x01, 0x3C, 0x16, 0x01, 0x38, 0x1A,
+  0x01, 0x34, 0x1E, 0x01, 0x31, 0x21, 0x01, 0x2D, 0x25, 0x01, 0x29, 0x27,
+  0x01, 0x26, 0x27, 0x01, 0x22, 0x27, 0x01, 0x1E, 0x27, 0x01, 0x1A, 0x27,
+  0x01, 0x17, 0x27, 0x01, 0x13, 0x27, 0x01, 0x0F, 0x27, 0x01, 0x0B, 0x28,
+  0x01, 0x08, 0x27, 0x01, 0x04, 0x27, 0x01, 0x00, 0x27, 0x01, 0x00, 0x24,
+  0x01, 0x00, 0x20, 0x01, 0x00, 0x1C, 0x01, 0x00, 0x18, 0x01, 0x00, 0x15,
+  0x01, 0x00, 0x11, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x02, 0x01, 0x19, 0x15, 0x01, 0x14, 0x1E, 0x01, 0x11, 0x24,
+  0x01, 0x0F, 0x29, 0x01, 0x0D, 0x2D, 0x01, 0x0B, 0x30, 0x01, 0x09, 0x34,
+  0x01, 0x08, 0x36, 0x01, 0x07, 0x38, 0x01, 0x06, 0x3A, 0x01, 0x05, 0x3C,
+  0x01, 0x04, 0x3E, 0x02, 0x04, 0x17, 0x10, 0x17, 0x02, 0x03, 0x13, 0x1A,
+  0x13, 0x02, 0x03, 0x10, 0x20, 0x11, 0x02, 0x02, 0x0F, 0x24, 0x0F, 0x02,
+  0x02, 0x0D, 0x28, 0x0D, 0x02, 0x01, 0x0D, 0x2A, 0x0D, 0x02, 0x01, 0x0C,
+  0x2C, 0x0C, 0x02, 0x01, 0x0B, 0x2E, 0x0B, 0x02, 0x01, 0x0A, 0x30, 0x0B,
+  0x02, 0x00, 0x0B, 0x30, 0x0B, 0x02, 0x00, 0x0A, 0x32, 0x0A, 0x02, 0x00,
+  0x0A, 0x32, 0x0A, 0x02, 0x00, 0x0A, 0x32, 0x0A, 0x02, 0x00, 0x0A, 0x32,
+  0x0A, 0x02, 0x00, 0x0A, 0x32, 0x0A, 0x02, 0x00, 0x0A, 0x32, 0x0A, 0x02,
+  0x00, 0x0A, 0x32, 0x0A, 0x02, 0x00, 0x0A, 0x32, 0x0A, 0x02, 0x00, 0x0B,
+  0x30, 0x0B, 0x02, 0x00, 0x0B, 0x30, 0x0A, 0x02, 0x01, 0x0B, 0x2E, 0x0B,
+  0x02, 0x01, 0x0C, 0x2C, 0x0C, 0x02, 0x01, 0x0D, 0x2A, 0x0D, 0x02, 0x02,
+  0x0D, 0x28, 0x0D, 0x02, 0x02, 0x0F, 0x24, 0x0F, 0x02, 0x03, 0x10, 0x20,
+  0x10, 0x02, 0x03, 0x13, 0x1A, 0x13, 0x02, 0x04, 0x18, 0x0F, 0x17, 0x01,
+  0x04, 0x3E, 0x01, 0x05, 0x3C, 0x01, 0x06, 0x3A, 0x01, 0x07, 0x38, 0x01,
+  0x08, 0x36, 0x01, 0x09, 0x34, 0x01, 0x0B, 0x30, 0x01, 0x0D, 0x2C, 0x01,
+  0x0F, 0x28, 0x01, 0x11, 0x24, 0x01, 0x14, 0x1E, 0x01, 0x19, 0x14, 0x01,
+  0x0B, 0x0C, 0x01, 0x0A, 0x0C, 0x01, 0x0A, 0x0B, 0x01, 0x09, 0x0B, 0x01,
+  0x08, 0x0C, 0x01, 0x07, 0x0C, 0x01, 0x07, 0x0B, 0x01, 0x06, 0x0C, 0x01,
+  0x05, 0x0C, 0x01, 0x04, 0x0C, 0x01, 0x04, 0x0B, 0x01, 0x03, 0x0C, 0x01,
+  0x02, 0x0C, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0C, 0x01, 0x00, 0x0C, 0x01,
+  0x00, 0x0B, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01,
+  0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01,
+  0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01,
+  0x00, 0x44, 0x02, 0x0F, 0x06, 0x27, 0x09, 0x02, 0x0C, 0x09, 0x26, 0x0A,
+  0x02, 0x0A, 0x0B, 0x25, 0x0B, 0x02, 0x09, 0x0C, 0x24, 0x0C, 0x02, 0x08,
+  0x0D, 0x23, 0x0D, 0x02, 0x07, 0x0E, 0x22, 0x0E, 0x02, 0x06, 0x0F, 0x21,
+  0x0F, 0x02, 0x05, 0x10, 0x20, 0x10, 0x02, 0x04, 0x11, 0x1F, 0x11, 0x02,
+  0x03, 0x12, 0x1E, 0x12, 0x02, 0x03, 0x12, 0x1D, 0x13, 0x02, 0x02, 0x12,
+  0x1D, 0x14, 0x02, 0x02, 0x0E, 0x20, 0x15, 0x02, 0x02, 0x0C, 0x21, 0x16,
+  0x02, 0x01, 0x0C, 0x21, 0x17, 0x02, 0x01, 0x0B, 0x21, 0x18, 0x02, 0x01,
+  0x0A, 0x21, 0x19, 0x02, 0x00, 0x0B, 0x20, 0x1A, 0x03, 0x00, 0x0A, 0x20,
+  0x10, 0x01, 0x0A, 0x03, 0x00, 0x0A, 0x1F, 0x10, 0x02, 0x0A, 0x03, 0x00,
+  0x0A, 0x1E, 0x10, 0x03, 0x0A, 0x03, 0x00, 0x0A, 0x1D, 0x10, 0x04, 0x0A,
+  0x03, 0x00, 0x0A, 0x1C, 0x10, 0x05, 0x0A, 0x03, 0x00, 0x0A, 0x1B, 0x0F,
+  0x07, 0x0A, 0x03, 0x00, 0x0A, 0x1A, 0x0F, 0x08, 0x0A, 0x03, 0x00, 0x0A,
+  0x19, 0x0F, 0x09, 0x0A, 0x03, 0x00, 0x0A, 0x18, 0x0F, 0x0A, 0x0A, 0x03,
+  0x00, 0x0B, 0x16, 0x0F, 0x0B, 0x0A, 0x03, 0x00, 0x0B, 0x15, 0x0F, 0x0C,
+  0x0A, 0x03, 0x01, 0x0B, 0x13, 0x0F, 0x0D, 0x0A, 0x03, 0x01, 0x0B, 0x12,
+  0x0F, 0x0E, 0x0A, 0x03, 0x01, 0x0C, 0x0F, 0x10, 0x0F, 0x0A, 0x03, 0x02,
+  0x0C, 0x0D, 0x10, 0x10, 0x0A, 0x03, 0x02, 0x0E, 0x08, 0x12, 0x11, 0x0A,
+  0x02, 0x02, 0x27, 0x12, 0x0A, 0x02, 0x03, 0x25, 0x13, 0x0A, 0x02, 0x03,
+  0x24, 0x14, 0x0A, 0x02, 0x04, 0x22, 0x15, 0x0A, 0x02, 0x05, 0x20, 0x16,
+  0x0A, 0x02, 0x06, 0x1E, 0x17, 0x0A, 0x02, 0x07, 0x1B, 0x19, 0x0A, 0x02,
+  0x08, 0x19, 0x1A, 0x0A, 0x02, 0x09, 0x16, 0x1C, 0x0A, 0x02, 0x0A, 0x14,
+  0x1D, 0x0A, 0x02, 0x0D, 0x0E, 0x20, 0x0A, 0x02, 0x10, 0x08, 0x23, 0x0A,
+  0x01, 0x3B, 0x0A, 0x01, 0x33, 0x04, 0x02, 0x11, 0x02, 0x20, 0x07, 0x02,
+  0x0D, 0x06, 0x20, 0x09, 0x02, 0x0B, 0x08, 0x20, 0x0A, 0x02, 0x09, 0x0A,
+  0x20, 0x0B, 0x02, 0x08, 0x0B, 0x20, 0x0C, 0x02, 0x07, 0x0C, 0x20, 0x0D,
+  0x02, 0x06, 0x0D, 0x20, 0x0E, 0x02, 0x05, 0x0E, 0x20, 0x0F, 0x02, 0x04,
+  0x0F, 0x20, 0x0F, 0x02, 0x04, 0x0F, 0x20, 0x10, 0x02, 0x03, 0x10, 0x20,
+  0x10, 0x02, 0x03, 0x10, 0x22, 0x0F, 0x02, 0x02, 0x0E, 0x27, 0x0D, 0x02,
+  0x02, 0x0C, 0x2A, 0x0D, 0x02, 0x02, 0x0B, 0x2C, 0x0C, 0x02, 0x01, 0x0B,
+  0x2E, 0x0B, 0x02, 0x01, 0x0B, 0x2F, 0x0A, 0x03, 0x01, 0x0A, 0x12, 0x0A,
+  0x14, 0x0A, 0x03, 0x00, 0x0B, 0x12, 0x0A, 0x14, 0x0B, 0x03, 0x00, 0x0A,
+  0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03,
+  0x00, 0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A, 0x15,
+  0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13,
+  0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00,
+  0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0B, 0x14, 0x0A,
+  0x03, 0x00, 0x0A, 0x12, 0x0C, 0x14, 0x0A, 0x03, 0x00, 0x0B, 0x11, 0x0C,
+  0x13, 0x0B, 0x03, 0x01, 0x0A, 0x10, 0x0E, 0x12, 0x0A, 0x03, 0x01, 0x0B,
+  0x0E, 0x0F, 0x11, 0x0B, 0x03, 0x01, 0x0C, 0x0C, 0x11, 0x10, 0x0B, 0x03,
+  0x01, 0x0E, 0x09, 0x13, 0x0E, 0x0C, 0x03, 0x02, 0x10, 0x03, 0x17, 0x0C,
+  0x0C, 0x03, 0x02, 0x1F, 0x01, 0x0B, 0x09, 0x0E, 0x02, 0x03, 0x1E, 0x01,
+  0x22, 0x02, 0x03, 0x1D, 0x03, 0x20, 0x02, 0x04, 0x1C, 0x03, 0x20, 0x02,
+  0x05, 0x1A, 0x04, 0x1F, 0x02, 0x06, 0x19, 0x05, 0x1D, 0x02, 0x06, 0x18,
+  0x06, 0x1D, 0x02, 0x08, 0x15, 0x08, 0x1B, 0x02, 0x09, 0x13, 0x0A, 0x19,
+  0x02, 0x0A, 0x11, 0x0C, 0x17, 0x02, 0x0D, 0x0C, 0x0F, 0x15, 0x02, 0x11,
+  0x04, 0x14, 0x12, 0x01, 0x2B, 0x0E, 0x01, 0x2D, 0x0A, 0x01, 0x2D, 0x0A,
+  0x01, 0x2B, 0x0C, 0x01, 0x2A, 0x0D, 0x01, 0x28, 0x0F, 0x01, 0x26, 0x11,
+  0x01, 0x25, 0x12, 0x01, 0x23, 0x14, 0x01, 0x22, 0x15, 0x01, 0x20, 0x17,
+  0x01, 0x1F, 0x18, 0x01, 0x1D, 0x1A, 0x01, 0x1B, 0x1C, 0x01, 0x1A, 0x1D,
+  0x02, 0x18, 0x14, 0x01, 0x0A, 0x02, 0x17, 0x13, 0x03, 0x0A, 0x02, 0x15,
+  0x13, 0x05, 0x0A, 0x02, 0x14, 0x13, 0x06, 0x0A, 0x02, 0x12, 0x13, 0x08,
+  0x0A, 0x02, 0x10, 0x14, 0x09, 0x0A, 0x02, 0x0F, 0x13, 0x0B, 0x0A, 0x02,
+  0x0D, 0x14, 0x0C, 0x0A, 0x02, 0x0C, 0x13, 0x0E, 0x0A, 0x02, 0x0A, 0x13,
+  0x10, 0x0A, 0x02, 0x09, 0x13, 0x11, 0x0A, 0x02, 0x07, 0x13, 0x13, 0x0A,
+  0x02, 0x05, 0x14, 0x14, 0x0A, 0x02, 0x04, 0x13, 0x16, 0x0A, 0x02, 0x02,
+  0x14, 0x17, 0x0A, 0x02, 0x01, 0x13, 0x19, 0x0A, 0x02, 0x00, 0x12, 0x1B,
+  0x0A, 0x02, 0x00, 0x11, 0x1C, 0x0A, 0x02, 0x00, 0x0F, 0x1E, 0x0A, 0x02,
+  0x00, 0x0E, 0x1F, 0x17, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00,
+  0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00,
+  0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00, 0x44, 0x01, 0x00,
+  0x44, 0x01, 0x2D, 0x0A, 0x01, 0x2D, 0x0A, 0x01, 0x2D, 0x0A, 0x01, 0x2D,
+  0x0A, 0x01, 0x2D, 0x0A, 0x01, 0x2D, 0x0A, 0x01, 0x2D, 0x0A, 0x01, 0x2D,
+  0x0A, 0x01, 0x2D, 0x0A, 0x01, 0x32, 0x04, 0x02, 0x1F, 0x04, 0x0F, 0x07,
+  0x02, 0x15, 0x0E, 0x0F, 0x09, 0x02, 0x0C, 0x18, 0x0E, 0x0A, 0x02, 0x02,
+  0x22, 0x0E, 0x0C, 0x02, 0x00, 0x24, 0x0E, 0x0D, 0x02, 0x00, 0x24, 0x0E,
+  0x0D, 0x02, 0x00, 0x24, 0x0E, 0x0E, 0x02, 0x00, 0x24, 0x0E, 0x0F, 0x02,
+  0x00, 0x25, 0x0D, 0x10, 0x02, 0x00, 0x25, 0x0D, 0x10, 0x02, 0x00, 0x25,
+  0x0D, 0x11, 0x02, 0x00, 0x25, 0x10, 0x0E, 0x03, 0x00, 0x17, 0x05, 0x08,
+  0x13, 0x0C, 0x03, 0x00, 0x0D, 0x0E, 0x08, 0x15, 0x0C, 0x03, 0x00, 0x0A,
+  0x10, 0x09, 0x16, 0x0B, 0x03, 0x00, 0x0A, 0x10, 0x08, 0x17, 0x0B, 0x03,
+  0x00, 0x0A, 0x0F, 0x09, 0x18, 0x0A, 0x03, 0x00, 0x0A, 0x0F, 0x08, 0x19,
+  0x0B, 0x03, 0x00, 0x0A, 0x0E, 0x09, 0x1A, 0x0A, 0x03, 0x00, 0x0A, 0x0E,
+  0x09, 0x1A, 0x0A, 0x03, 0x00, 0x0A, 0x0E, 0x09, 0x1A, 0x0A, 0x03, 0x00,
+  0x0A, 0x0D, 0x0A, 0x1A, 0x0A, 0x03, 0x00, 0x0A, 0x0D, 0x0A, 0x1A, 0x0A,
+  0x03, 0x00, 0x0A, 0x0D, 0x0A, 0x1A, 0x0A, 0x03, 0x00, 0x0A, 0x0D, 0x0A,
+  0x1A, 0x0A, 0x03, 0x00, 0x0A, 0x0D, 0x0A, 0x1A, 0x0A, 0x03, 0x00, 0x0A,
+  0x0D, 0x0A, 0x1A, 0x0A, 0x03, 0x00, 0x0A, 0x0D, 0x0B, 0x18, 0x0B, 0x03,
+  0x00, 0x0A, 0x0D, 0x0B, 0x18, 0x0A, 0x03, 0x00, 0x0A, 0x0D, 0x0C, 0x16,
+  0x0B, 0x03, 0x00, 0x0A, 0x0E, 0x0C, 0x14, 0x0C, 0x03, 0x00, 0x0A, 0x0E,
+  0x0D, 0x12, 0x0D, 0x03, 0x00, 0x0A, 0x0E, 0x0E, 0x10, 0x0D, 0x03, 0x00,
+  0x0A, 0x0E, 0x10, 0x0D, 0x0E, 0x03, 0x00, 0x0A, 0x0F, 0x12, 0x07, 0x10,
+  0x02, 0x00, 0x0A, 0x0F, 0x29, 0x02, 0x00, 0x0A, 0x10, 0x27, 0x02, 0x00,
+  0x0A, 0x11, 0x25, 0x02, 0x00, 0x0A, 0x11, 0x25, 0x02, 0x00, 0x0A, 0x12,
+  0x23, 0x02, 0x00, 0x0A, 0x13, 0x21, 0x02, 0x00, 0x0A, 0x14, 0x1F, 0x02,
+  0x00, 0x0A, 0x16, 0x1B, 0x01, 0x21, 0x19, 0x01, 0x23, 0x15, 0x01, 0x25,
+  0x11, 0x01, 0x29, 0x09, 0x01, 0x1A, 0x15, 0x01, 0x16, 0x1D, 0x01, 0x12,
+  0x24, 0x01, 0x10, 0x29, 0x01, 0x0E, 0x2C, 0x01, 0x0C, 0x30, 0x01, 0x0A,
+  0x33, 0x01, 0x09, 0x35, 0x01, 0x08, 0x38, 0x01, 0x07, 0x39, 0x01, 0x06,
+  0x3B, 0x01, 0x05, 0x3D, 0x02, 0x04, 0x15, 0x08, 0x22, 0x03, 0x04, 0x11,
+  0x0B, 0x0B, 0x08, 0x10, 0x03, 0x03, 0x10, 0x0B, 0x0B, 0x0C, 0x0F, 0x03,
+  0x02, 0x0F, 0x0C, 0x0A, 0x10, 0x0D, 0x03, 0x02, 0x0E, 0x0C, 0x0A, 0x12,
+  0x0C, 0x03, 0x02, 0x0D, 0x0D, 0x09, 0x14, 0x0C, 0x03, 0x01, 0x0D, 0x0D,
+  0x09, 0x16, 0x0B, 0x03, 0x01, 0x0C, 0x0D, 0x09, 0x18, 0x0A, 0x03, 0x01,
+  0x0B, 0x0E, 0x09, 0x18, 0x0B, 0x03, 0x00, 0x0C, 0x0D, 0x09, 0x1A, 0x0A,
+  0x03, 0x00, 0x0C, 0x0D, 0x09, 0x1A, 0x0A, 0x03, 0x00, 0x0B, 0x0E, 0x09,
+  0x1A, 0x0A, 0x03, 0x00, 0x0B, 0x0E, 0x09, 0x1A, 0x0A, 0x03, 0x00, 0x0B,
+  0x0D, 0x0A, 0x1A, 0x0A, 0x03, 0x00, 0x0B, 0x0D, 0x0A, 0x1A, 0x0A, 0x03,
+  0x00, 0x0B, 0x0D, 0x0A, 0x1A, 0x0A, 0x03, 0x00, 0x0B, 0x0D, 0x0A, 0x1A,
+  0x0A, 0x03, 0x00, 0x0B, 0x0D, 0x0A, 0x1A, 0x0A, 0x03, 0x00, 0x0C, 0x0C,
+  0x0B, 0x18, 0x0B, 0x03, 0x00, 0x0C, 0x0C, 0x0B, 0x18, 0x0A, 0x03, 0x01,
+  0x0B, 0x0C, 0x0C, 0x16, 0x0B, 0x03, 0x01, 0x0C, 0x0B, 0x0C, 0x16, 0x0B,
+  0x03, 0x01, 0x0D, 0x0B, 0x0C, 0x14, 0x0C, 0x03, 0x01, 0x0E, 0x0A, 0x0D,
+  0x12, 0x0C, 0x03, 0x02, 0x0E, 0x09, 0x0F, 0x0E, 0x0E, 0x03, 0x02, 0x11,
+  0x07, 0x10, 0x0A, 0x10, 0x02, 0x03, 0x10, 0x07, 0x29, 0x02, 0x03, 0x10,
+  0x08, 0x28, 0x02, 0x04, 0x0F, 0x08, 0x27, 0x02, 0x05, 0x0E, 0x09, 0x25,
+  0x02, 0x06, 0x0D, 0x0A, 0x23, 0x02, 0x07, 0x0C, 0x0B, 0x21, 0x02, 0x08,
+  0x0B, 0x0C, 0x1F, 0x02, 0x09, 0x0A, 0x0D, 0x1D, 0x02, 0x0A, 0x09, 0x0E,
+  0x1B, 0x02, 0x0C, 0x07, 0x10, 0x17, 0x02, 0x0E, 0x05, 0x12, 0x13, 0x02,
+  0x12, 0x01, 0x14, 0x0E, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00,
+  0x0B, 0x01, 0x00, 0x0B, 0x02, 0x00, 0x0B, 0x38, 0x01, 0x02, 0x00, 0x0B,
+  0x37, 0x02, 0x02, 0x00, 0x0B, 0x35, 0x04, 0x02, 0x00, 0x0B, 0x33, 0x06,
+  0x02, 0x00, 0x0B, 0x31, 0x08, 0x02, 0x00, 0x0B, 0x2F, 0x0A, 0x02, 0x00,
+  0x0B, 0x2D, 0x0C, 0x02, 0x00, 0x0B, 0x2B, 0x0E, 0x02, 0x00, 0x0B, 0x29,
+  0x10, 0x02, 0x00, 0x0B, 0x27, 0x12, 0x02, 0x00, 0x0B, 0x25, 0x14, 0x02,
+  0x00, 0x0B, 0x23, 0x16, 0x02, 0x00, 0x0B, 0x21, 0x18, 0x02, 0x00, 0x0B,
+  0x1F, 0x1A, 0x02, 0x00, 0x0B, 0x1E, 0x19, 0x02, 0x00, 0x0B, 0x1C, 0x19,
+  0x02, 0x00, 0x0B, 0x1A, 0x19, 0x02, 0x00, 0x0B, 0x18, 0x19, 0x02, 0x00,
+  0x0B, 0x16, 0x19, 0x02, 0x00, 0x0B, 0x14, 0x19, 0x02, 0x00, 0x0B, 0x12,
+  0x19, 0x02, 0x00, 0x0B, 0x10, 0x19, 0x02, 0x00, 0x0B, 0x0E, 0x19, 0x02,
+  0x00, 0x0B, 0x0C, 0x19, 0x02, 0x00, 0x0B, 0x0A, 0x19, 0x02, 0x00, 0x0B,
+  0x08, 0x19, 0x02, 0x00, 0x0B, 0x06, 0x19, 0x02, 0x00, 0x0B, 0x04, 0x1A,
+  0x02, 0x00, 0x0B, 0x02, 0x1A, 0x01, 0x00, 0x25, 0x01, 0x00, 0x23, 0x01,
+  0x00, 0x21, 0x01, 0x00, 0x1F, 0x01, 0x00, 0x1D, 0x01, 0x00, 0x1B, 0x01,
+  0x00, 0x19, 0x01, 0x00, 0x17, 0x01, 0x00, 0x15, 0x01, 0x00, 0x13, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x10, 0x01, 0x00, 0x0E, 0x01, 0x2D, 0x0B, 0x01,
+  0x2B, 0x0F, 0x02, 0x0F, 0x06, 0x14, 0x13, 0x02, 0x0C, 0x0D, 0x0F, 0x15,
+  0x02, 0x0A, 0x10, 0x0D, 0x18, 0x02, 0x08, 0x14, 0x0A, 0x1A, 0x02, 0x07,
+  0x16, 0x08, 0x1B, 0x02, 0x06, 0x18, 0x06, 0x1D, 0x02, 0x05, 0x1A, 0x05,
+  0x1E, 0x02, 0x05, 0x1A, 0x04, 0x1F, 0x02, 0x04, 0x1C, 0x03, 0x20, 0x02,
+  0x03, 0x1D, 0x02, 0x21, 0x03, 0x03, 0x1E, 0x01, 0x0E, 0x04, 0x10, 0x03,
+  0x02, 0x1F, 0x01, 0x0B, 0x0A, 0x0D, 0x03, 0x02, 0x0F, 0x05, 0x15, 0x0D,
+  0x0D, 0x03, 0x01, 0x0D, 0x0A, 0x12, 0x0F, 0x0C, 0x03, 0x01, 0x0C, 0x0D,
+  0x0F, 0x11, 0x0B, 0x03, 0x01, 0x0B, 0x0E, 0x0F, 0x12, 0x0A, 0x03, 0x01,
+  0x0A, 0x10, 0x0D, 0x13, 0x0A, 0x03, 0x00, 0x0B, 0x11, 0x0C, 0x13, 0x0B,
+  0x03, 0x00, 0x0A, 0x12, 0x0B, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A,
+  0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A,
+  0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03,
+  0x00, 0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A, 0x15,
+  0x0A, 0x03, 0x00, 0x0A, 0x13, 0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x13,
+  0x0A, 0x15, 0x0A, 0x03, 0x00, 0x0A, 0x12, 0x0B, 0x15, 0x0A, 0x03, 0x00,
+  0x0B, 0x11, 0x0C, 0x14, 0x0A, 0x03, 0x01, 0x0A, 0x10, 0x0D, 0x13, 0x0B,
+  0x03, 0x01, 0x0B, 0x0F, 0x0E, 0x12, 0x0A, 0x03, 0x01, 0x0C, 0x0D, 0x0F,
+  0x11, 0x0B, 0x03, 0x01, 0x0D, 0x0A, 0x12, 0x0F, 0x0C, 0x03, 0x02, 0x0E,
+  0x06, 0x15, 0x0D, 0x0C, 0x03, 0x02, 0x1F, 0x01, 0x0B, 0x0A, 0x0D, 0x03,
+  0x03, 0x1E, 0x01, 0x0D, 0x05, 0x10, 0x02, 0x03, 0x1D, 0x02, 0x21, 0x02,
+  0x04, 0x1C, 0x02, 0x21, 0x02, 0x04, 0x1B, 0x04, 0x1F, 0x02, 0x05, 0x1A,
+  0x04, 0x1F, 0x02, 0x06, 0x18, 0x06, 0x1D, 0x02, 0x07, 0x16, 0x08, 0x1B,
+  0x02, 0x08, 0x14, 0x0A, 0x1A, 0x02, 0x0A, 0x11, 0x0C, 0x18, 0x02, 0x0B,
+  0x0E, 0x0F, 0x15, 0x02, 0x0E, 0x08, 0x13, 0x13, 0x01, 0x2B, 0x10, 0x01,
+  0x2D, 0x0B, 0x02, 0x11, 0x0D, 0x14, 0x02, 0x02, 0x0E, 0x13, 0x11, 0x05,
+  0x02, 0x0C, 0x17, 0x0F, 0x08, 0x02, 0x0A, 0x1B, 0x0D, 0x0A, 0x02, 0x09,
+  0x1D, 0x0C, 0x0B, 0x02, 0x08, 0x1F, 0x0B, 0x0C, 0x02, 0x07, 0x21, 0x0A,
+  0x0D, 0x02, 0x06, 0x23, 0x09, 0x0E, 0x02, 0x05, 0x25, 0x08, 0x0F, 0x02,
+  0x04, 0x26, 0x08, 0x10, 0x02, 0x04, 0x27, 0x07, 0x11, 0x02, 0x03, 0x29,
+  0x06, 0x11, 0x03, 0x03, 0x0F, 0x0A, 0x10, 0x07, 0x11, 0x03, 0x02, 0x0E,
+  0x0E, 0x0E, 0x09, 0x0F, 0x03, 0x02, 0x0C, 0x11, 0x0E, 0x0A, 0x0D, 0x03,
+  0x01, 0x0C, 0x13, 0x0D, 0x0B, 0x0D, 0x03, 0x01, 0x0B, 0x15, 0x0C, 0x0C,
+  0x0C, 0x03, 0x01, 0x0B, 0x16, 0x0B, 0x0C, 0x0C, 0x03, 0x01, 0x0A, 0x18,
+  0x0B, 0x0C, 0x0C, 0x03, 0x00, 0x0B, 0x18, 0x0B, 0x0C, 0x0C, 0x03, 0x00,
+  0x0A, 0x19, 0x0B, 0x0D, 0x0B, 0x03, 0x00, 0x0A, 0x1A, 0x0A, 0x0D, 0x0B,
+  0x03, 0x00, 0x0A, 0x1A, 0x0A, 0x0D, 0x0B, 0x03, 0x00, 0x0A, 0x1A, 0x0A,
+  0x0D, 0x0B, 0x03, 0x00, 0x0A, 0x1A, 0x09, 0x0E, 0x0B, 0x03, 0x00, 0x0A,
+  0x1A, 0x09, 0x0E, 0x0B, 0x03, 0x00, 0x0A, 0x1A, 0x09, 0x0E, 0x0B, 0x03,
+  0x00, 0x0A, 0x1A, 0x09, 0x0D, 0x0C, 0x03, 0x00, 0x0A, 0x19, 0x09, 0x0E,
+  0x0C, 0x03, 0x00, 0x0B, 0x18, 0x09, 0x0E, 0x0B, 0x03, 0x01, 0x0A, 0x17,
+  0x09, 0x0E, 0x0C, 0x03, 0x01, 0x0B, 0x16, 0x09, 0x0D, 0x0D, 0x03, 0x01,
+  0x0C, 0x14, 0x09, 0x0E, 0x0C, 0x03, 0x02, 0x0C, 0x12, 0x09, 0x0D, 0x0E,
+  0x03, 0x02, 0x0D, 0x10, 0x09, 0x0D, 0x0F, 0x03, 0x02, 0x0E, 0x0D, 0x0A,
+  0x0C, 0x10, 0x03, 0x03, 0x10, 0x08, 0x0B, 0x0B, 0x11, 0x02, 0x03, 0x22,
+  0x09, 0x14, 0x01, 0x04, 0x3D, 0x01, 0x05, 0x3B, 0x01, 0x05, 0x3A, 0x01,
+  0x06, 0x38, 0x01, 0x07, 0x36, 0x01, 0x08, 0x34, 0x01, 0x0A, 0x30, 0x01,
+  0x0B, 0x2D, 0x01, 0x0D, 0x29, 0x01, 0x0F, 0x25, 0x01, 0x12, 0x1F, 0x01,
+  0x16, 0x16, 0x02, 0x04, 0x07, 0x1C, 0x07, 0x02, 0x02, 0x0B, 0x18, 0x0B,
+  0x02, 0x01, 0x0D, 0x16, 0x0D, 0x02, 0x01, 0x0D, 0x16, 0x0D, 0x02, 0x00,
+  0x0F, 0x14, 0x0F, 0x02, 0x00, 0x0F, 0x14, 0x0F, 0x02, 0x00, 0x0F, 0x14,
+  0x0F, 0x02, 0x00, 0x0F, 0x14, 0x0F, 0x02, 0x00, 0x0F, 0x14, 0x0F, 0x02,
+  0x00, 0x0F, 0x14, 0x0F, 0x02, 0x01, 0x0D, 0x16, 0x0D, 0x02, 0x02, 0x0B,
+  0x18, 0x0B, 0x02, 0x02, 0x0B, 0x18, 0x0B, 0x02, 0x04, 0x07, 0x1C, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x12, 0x01,
+  0x16, 0x1A, 0x01, 0x13, 0x20, 0x01, 0x11, 0x24, 0x01, 0x0F, 0x28, 0x01,
+  0x0D, 0x2C, 0x01, 0x0C, 0x2E, 0x01, 0x0B, 0x31, 0x01, 0x09, 0x34, 0x01,
+  0x08, 0x36, 0x01, 0x07, 0x38, 0x01, 0x07, 0x38, 0x02, 0x06, 0x17, 0x0C,
+  0x17, 0x02, 0x05, 0x14, 0x15, 0x13, 0x02, 0x04, 0x12, 0x1A, 0x12, 0x02,
+  0x04, 0x10, 0x1E, 0x10, 0x02, 0x03, 0x0F, 0x22, 0x0F, 0x02, 0x03, 0x0E,
+  0x24, 0x0E, 0x02, 0x02, 0x0E, 0x26, 0x0E, 0x02, 0x02, 0x0D, 0x28, 0x0D,
+  0x02, 0x02, 0x0C, 0x2A, 0x0C, 0x02, 0x01, 0x0D, 0x2A, 0x0D, 0x02, 0x01,
+  0x0C, 0x2C, 0x0C, 0x02, 0x01, 0x0C, 0x2C, 0x0C, 0x02, 0x01, 0x0B, 0x2E,
+  0x0B, 0x02, 0x00, 0x0C, 0x2E, 0x0C, 0x02, 0x00, 0x0C, 0x2E, 0x0C, 0x02,
+  0x00, 0x0B, 0x30, 0x0B, 0x02, 0x00, 0x0B, 0x30, 0x0B, 0x02, 0x00, 0x0B,
+  0x30, 0x0B, 0x02, 0x00, 0x0B, 0x30, 0x0B, 0x02, 0x00, 0x0B, 0x30, 0x0B,
+  0x02, 0x00, 0x0B, 0x30, 0x0B, 0x02, 0x00, 0x0B, 0x30, 0x0B, 0x02, 0x00,
+  0x0B, 0x30, 0x0B, 0x02, 0x00, 0x0B, 0x30, 0x0B, 0x02, 0x00, 0x0C, 0x2E,
+  0x0C, 0x02, 0x01, 0x0B, 0x2E, 0x0B, 0x02, 0x01, 0x0B, 0x2E, 0x0B, 0x02,
+  0x01, 0x0C, 0x2C, 0x0C, 0x02, 0x01, 0x0C, 0x2C, 0x0C, 0x02, 0x02, 0x0C,
+  0x2A, 0x0C, 0x02, 0x02, 0x0D, 0x28, 0x0D, 0x02, 0x02, 0x0E, 0x26, 0x0E,
+  0x02, 0x03, 0x0E, 0x24, 0x0E, 0x02, 0x03, 0x0F, 0x22, 0x0F, 0x02, 0x04,
+  0x10, 0x1E, 0x10, 0x02, 0x04, 0x14, 0x16, 0x14, 0x02, 0x05, 0x13, 0x16,
+  0x13, 0x02, 0x06, 0x12, 0x16, 0x12, 0x02, 0x06, 0x12, 0x16, 0x11, 0x02,
+  0x07, 0x11, 0x16, 0x10, 0x02, 0x08, 0x10, 0x16, 0x0F, 0x02, 0x09, 0x0F,
+  0x16, 0x0E, 0x02, 0x0B, 0x0D, 0x16, 0x0D, 0x02, 0x0C, 0x0C, 0x16, 0x0C,
+  0x02, 0x0E, 0x0A, 0x16, 0x0A, 0x02, 0x0F, 0x09, 0x16, 0x08, 0x02, 0x12,
+  0x06, 0x16, 0x06, 0x02, 0x16, 0x02, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x01,
+  0x33, 0x01, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x01,
+  0x33, 0x01, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x01,
+  0x33, 0x01, 0x0A, 0x08, 0x01, 0x08, 0x07, 0x01, 0x06, 0x07, 0x01, 0x05,
+  0x07, 0x01, 0x04, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x02,
+  0x08, 0x01, 0x02, 0x08, 0x01, 0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x01,
+  0x09, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x0A, 0x01, 0x00, 0x0B, 0x01, 0x01,
+  0x0B, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x33, 0x01, 0x01,
+  0x33, 0x01, 0x02, 0x32, 0x01, 0x02, 0x32, 0x01, 0x03, 0x31, 0x01, 0x04,
+  0x30, 0x01, 0x05, 0x2F, 0x01, 0x07, 0x2D, 0x01, 0x09, 0x2B, 0x01, 0x0B,
+  0x29, 0x01, 0x0A, 0x2A, 0x01, 0x08, 0x2C, 0x01, 0x06, 0x0B, 0x01, 0x05,
+  0x09, 0x01, 0x04, 0x09, 0x01, 0x04, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03,
+  0x08, 0x01, 0x02, 0x09, 0x01, 0x02, 0x08, 0x01, 0x01, 0x09, 0x01, 0x01,
+  0x09, 0x01, 0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x01, 0x0A, 0x01, 0x01,
+  0x0A, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0C, 0x01, 0x01,
+  0x0E, 0x01, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x02, 0x32, 0x01, 0x02,
+  0x32, 0x01, 0x03, 0x31, 0x01, 0x03, 0x31, 0x01, 0x04, 0x30, 0x01, 0x05,
+  0x2F, 0x01, 0x06, 0x2E, 0x01, 0x07, 0x2D, 0x01, 0x09, 0x2B, 0x01, 0x0C,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x26, 0x02, 0x02, 0x0F, 0x02,
+  0x15, 0x05, 0x02, 0x0A, 0x0B, 0x11, 0x07, 0x02, 0x08, 0x0F, 0x0F, 0x08,
+  0x02, 0x07, 0x11, 0x0D, 0x0A, 0x02, 0x06, 0x13, 0x0C, 0x0B, 0x02, 0x05,
+  0x15, 0x0B, 0x0C, 0x02, 0x04, 0x17, 0x0A, 0x0C, 0x02, 0x04, 0x17, 0x0A,
+  0x0D, 0x02, 0x03, 0x19, 0x08, 0x0F, 0x02, 0x03, 0x19, 0x08, 0x0F, 0x02,
+  0x02, 0x1B, 0x08, 0x0E, 0x02, 0x02, 0x1B, 0x0A, 0x0D, 0x03, 0x02, 0x0C,
+  0x02, 0x0D, 0x0B, 0x0C, 0x03, 0x01, 0x0B, 0x06, 0x0B, 0x0C, 0x0B, 0x03,
+  0x01, 0x0B, 0x07, 0x0B, 0x0C, 0x0A, 0x03, 0x01, 0x0A, 0x09, 0x0A, 0x0C,
+  0x0B, 0x03, 0x01, 0x09, 0x0A, 0x0A, 0x0D, 0x0A, 0x03, 0x01, 0x09, 0x0B,
+  0x09, 0x0D, 0x0A, 0x03, 0x01, 0x09, 0x0B, 0x0A, 0x0C, 0x0A, 0x03, 0x01,
+  0x09, 0x0B, 0x0A, 0x0C, 0x0A, 0x03, 0x01, 0x09, 0x0B, 0x0A, 0x0C, 0x0A,
+  0x03, 0x00, 0x0A, 0x0C, 0x09, 0x0C, 0x0A, 0x03, 0x01, 0x09, 0x0C, 0x09,
+  0x0C, 0x0A, 0x03, 0x01, 0x09, 0x0C, 0x0A, 0x0B, 0x0A, 0x03, 0x01, 0x09,
+  0x0C, 0x0A, 0x0B, 0x0A, 0x03, 0x01, 0x09, 0x0D, 0x09, 0x0B, 0x0A, 0x03,
+  0x01, 0x0A, 0x0C, 0x09, 0x0A, 0x0B, 0x03, 0x01, 0x0A, 0x0C, 0x0A, 0x09,
+  0x0A, 0x03, 0x01, 0x0B, 0x0B, 0x0B, 0x07, 0x0B, 0x03, 0x02, 0x0B, 0x0A,
+  0x0B, 0x06, 0x0C, 0x03, 0x02, 0x0D, 0x09, 0x0D, 0x01, 0x0E, 0x02, 0x02,
+  0x0E, 0x08, 0x1B, 0x02, 0x03, 0x0D, 0x08, 0x1B, 0x02, 0x03, 0x0D, 0x09,
+  0x19, 0x02, 0x04, 0x0B, 0x0A, 0x19, 0x02, 0x05, 0x0A, 0x0A, 0x18, 0x02,
+  0x05, 0x0A, 0x0B, 0x17, 0x02, 0x06, 0x09, 0x0C, 0x15, 0x02, 0x08, 0x07,
+  0x0C, 0x14, 0x02, 0x09, 0x05, 0x0E, 0x12, 0x02, 0x0B, 0x03, 0x10, 0x0E,
+  0x02, 0x0D, 0x01, 0x11, 0x0C, 0x01, 0x22, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const GFXglyph InterTempSemiBold48pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  62,    0,    0 },   // 0x20 ' '
+  {     1,   1,   1,  62,    0,    0 },   // 0x21 '!'
+  {     2,   1,   1,  62,    0,    0 },   // 0x22 '"'
+  {     3,   1,   1,  62,    0,    0 },   // 0x23 '#'
+  {     4,   1,   1,  62,    0,    0 },   // 0x24 '$'
+  {     5,  76,  70,  94,    9,  -68 },   // 0x25 '%'
+  {   353,   1,   1,  62,    0,    0 },   // 0x26 '&'
+  {   354,   1,   1,  62,    0,    0 },   // 0x27 '''
+  {   355,   1,   1,  62,    0,    0 },   // 0x28 '('
+  {   356,   1,   1,  62,    0,    0 },   // 0x29 ')'
+  {   357,   1,   1,  62,    0,    0 },   // 0x2A '*'
+  {   358,   1,   1,  62,    0,    0 },   // 0x2B '+'
+  {   359,   1,   1,  62,    0,    0 },   // 0x2C ','
+  {   360,  31,  10,  44,    6,  -33 },   // 0x2D '-'
+  {   453,  14,  15,  30,    8,  -13 },   // 0x2E '.'
+  {   495,  32,  82,  36,    2,  -71 },   // 0x2F '/'
+  {   591,  52,  70,  62,    5,  -68 },   // 0x30 '0'
+  {   803,  29,  68,  40,    4,  -67 },   // 0x31 '1'
+  {   890,  47,  69,  59,    6,  -68 },   // 0x32 '2'
+  {  1155,  50,  70,  60,    5,  -68 },   // 0x33 '3'
+  {  1437,  53,  68,  63,    5,  -67 },   // 0x34 '4'
+  {  1636,  48,  69,  58,    5,  -67 },   // 0x35 '5'
+  {  1912,  50,  70,  60,    5,  -68 },   // 0x36 '6'
+  {  2188,  46,  68,  54,    4,  -67 },   // 0x37 '7'
+  {  2384,  50,  70,  60,    5,  -68 },   // 0x38 '8'
+  {  2678,  50,  70,  60,    5,  -68 },   // 0x39 '9'
+  {  2954,  14,  50,  30,    8,  -48 },   // 0x3A ':'
+  {  3024,   1,   1,  62,    0,    0 },   // 0x3B ';'
+  {  3025,   1,   1,  62,    0,    0 },   // 0x3C '<'
+  {  3026,   1,   1,  62,    0,    0 },   // 0x3D '='
+  {  3027,   1,   1,  62,    0,    0 },   // 0x3E '>'
+  {  3028,   1,   1,  62,    0,    0 },   // 0x3F '?'
+  {  3029,   1,   1,  62,    0,    0 },   // 0x40 '@'
+  {  3030,   1,   1,  62,    0,    0 },   // 0x41 'A'
+  {  3031,   1,   1,  62,    0,    0 },   // 0x42 'B'
+  {  3032,  60,  70,  69,    5,  -68 },   // 0x43 'C'
+  {  3308,   1,   1,  62,    0,    0 },   // 0x44 'D'
+  {  3309,   1,   1,  62,    0,    0 },   // 0x45 'E'
+  {  3310,   1,   1,  62,    0,    0 },   // 0x46 'F'
+  {  3311,   1,   1,  62,    0,    0 },   // 0x47 'G'
+  {  3312,   1,   1,  62,    0,    0 },   // 0x48 'H'
+  {  3313,   1,   1,  62,    0,    0 },   // 0x49 'I'
+  {  3314,   1,   1,  62,    0,    0 },   // 0x4A 'J'
+  {  3315,   1,   1,  62,    0,    0 },   // 0x4B 'K'
+  {  3316,   1,   1,  62,    0,    0 },   // 0x4C 'L'
+  {  3317,   1,   1,  62,    0,    0 },   // 0x4D 'M'
+  {  3318,   1,   1,  62,    0,    0 },   // 0x4E 'N'
+  {  3319,   1,   1,  62,    0,    0 },   // 0x4F 'O'
+  {  3320,   1,   1,  62,    0,    0 },   // 0x50 'P'
+  {  3321,   1,   1,  62,    0,    0 },   // 0x51 'Q'
+  {  3322,   1,   1,  62,    0,    0 },   // 0x52 'R'
+  {  3323,   1,   1,  62,    0,    0 },   // 0x53 'S'
+  {  3324,   1,   1,  62,    0,    0 },   // 0x54 'T'
+  {  3325,   1,   1,  62,    0,    0 },   // 0x55 'U'
+  {  3326,   1,   1,  62,    0,    0 },   // 0x56 'V'
+  {  3327,   1,   1,  62,    0,    0 },   // 0x57 'W'
+  {  3328,   1,   1,  62,    0,    0 },   // 0x58 'X'
+  {  3329,   1,   1,  62,    0,    0 },   // 0x59 'Y'
+  {  3330,   1,   1,  62,    0,    0 },   // 0x5A 'Z'
+  {  3331,   1,   1,  62,    0,    0 },   // 0x5B '['
+  {  3332,   1,   1,  62,    0,    0 },   // 0x5C '\'
+  {  3333,   1,   1,  62,    0,    0 },   // 0x5D ']'
+  {  3334,   1,   1,  62,    0,    0 },   // 0x5E '^'
+  {  3335,   1,   1,  62,    0,    0 },   // 0x5F '_'
+  {  3336,   1,   1,  62,    0,    0 },   // 0x60 '`'
+  {  3337,   1,   1,  62,    0,    0 },   // 0x61 'a'
+  {  3338,   1,   1,  62,    0,    0 },   // 0x62 'b'
+  {  3339,   1,   1,  62,    0,    0 },   // 0x63 'c'
+  {  3340,   1,   1,  62,    0,    0 },   // 0x64 'd'
+  {  3341,   1,   1,  62,    0,    0 },   // 0x65 'e'
+  {  3342,   1,   1,  62,    0,    0 },   // 0x66 'f'
+  {  3343,   1,   1,  62,    0,    0 },   // 0x67 'g'
+  {  3344,   1,   1,  62,    0,    0 },   // 0x68 'h'
+  {  3345,   1,   1,  62,    0,    0 },   // 0x69 'i'
+  {  3346,   1,   1,  62,    0,    0 },   // 0x6A 'j'
+  {  3347,   1,   1,  62,    0,    0 },   // 0x6B 'k'
+  {  3348,   1,   1,  62,    0,    0 },   // 0x6C 'l'
+  {  3349,  72,  52,  85,    6,  -51 },   // 0x6D 'm'
+  {  3565,   1,   1,  62,    0,    0 },   // 0x6E 'n'
+  {  3566,   1,   1,  62,    0,    0 },   // 0x6F 'o'
+  {  3567,   1,   1,  62,    0,    0 },   // 0x70 'p'
+  {  3568,   1,   1,  62,    0,    0 },   // 0x71 'q'
+  {  3569,   1,   1,  62,    0,    0 },   // 0x72 'r'
+  {  3570,  44,  53,  52,    4,  -51 },   // 0x73 's'
+  {  3824,   1,   1,  62,    0,    0 },   // 0x74 't'
+  {  3825,   1,   1,  62,    0,    0 },   // 0x75 'u'
+  {  3826,   1,   1,  62,    0,    0 },   // 0x76 'v'
+  {  3827,   1,   1,  62,    0,    0 },   // 0x77 'w'
+  {  3828,   1,   1,  62,    0,    0 },   // 0x78 'x'
+  {  3829,   1,   1,  62,    0,    0 },   // 0x79 'y'
+  {  3830,   1,   1,  62,    0,    0 },   // 0x7A 'z'
+  {  3831,   1,   1,  62,    0,    0 },   // 0x7B '{'
+  {  3832,   1,   1,  62,    0,    0 },   // 0x7C '|'
+  {  3833,   1,   1,  62,    0,    0 },   // 0x7D '}'
+  {  3834,   1,   1,  62,    0,    0 } }; // 0x7E '~'
+
+const GFXfont InterTempSemiBold48pt7b PROGMEM = {
+  (uint8_t  *)InterTempSemiBold48pt7bBitmaps,
+  (GFXglyph *)InterTempSemiBold48pt7bGlyphs,
+  0x20, 0x7E, 114, GFXFONT_ENC_RLE_COL, NULL, 0 };
+
+// Approx. 4508 bytes
@@ -1346,6 +1346,6 @@ const GFXglyph InterTempSemiBold72pt7bGlyphs[] PROGMEM = {
 const GFXfont InterTempSemiBold72pt7b PROGMEM = {
   (uint8_t  *)InterTempSemiBold72pt7bBitmaps,
   (GFXglyph *)InterTempSemiBold72pt7bGlyphs,
-  0x20, 0x7E, 171 };
+  0x20, 0x7E, 171, GFXFONT_ENC_BITMAP, NULL, 0 };
 
 // Approx. 15615 bytes
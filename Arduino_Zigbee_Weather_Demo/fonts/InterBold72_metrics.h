@@ -0,0 +1,22 @@
+/* InterTempSemiBold72pt7b glyph advances as constexpr tables (compile-time text widths). */
+/* Generated by tools/gfxfont_to_metrics_header.py from InterBold72.h. */
+#ifndef INTERBOLD72_METRICS_H
+#define INTERBOLD72_METRICS_H
+
+#include "gfxfont.h"
+
+constexpr uint8_t InterTempSemiBold72pt7bAdvance[] = {
+   93,  93,  93,  93,  93, 142,  93,  93,  93,  93,  93,  93,  93,  66,  45,  53,
+   93,  60,  88,  90,  94,  86,  90,  81,  90,  90,  45,  93,  93,  93,  93,  93,
+   93,  93,  93, 104,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,
+   93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,
+   93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93, 127,  93,  93,
+   93,  93,  93,  77,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,
+};
+
+constexpr GFXmetrics InterTempSemiBold72pt7bMetrics = {
+  InterTempSemiBold72pt7bAdvance,
+  InterTempSemiBold72pt7bAdvance + (0x30 - 0x20),
+  0x20, 0x7E, nullptr, 0 };
+
+#endif /* INTERBOLD72_METRICS_H */
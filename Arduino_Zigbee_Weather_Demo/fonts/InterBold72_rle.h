@@ -0,0 +1,588 @@
+/* InterTempSemiBold72pt7b as column run-lengths (GFXFONT_ENC_RLE_COL). */
+/* Generated by tools/gfxfont_to_rle_header.py from InterBold72.h; use instead of it. */
+
+const uint8_t InterTempSemiBold72pt7bBitmaps[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x12, 0x01, 0x0C, 0x18, 0x01,
+  0x0A, 0x1C, 0x01, 0x09, 0x1E, 0x01, 0x07, 0x22, 0x01, 0x06, 0x24, 0x01,
+  0x05, 0x26, 0x01, 0x04, 0x28, 0x01, 0x04, 0x28, 0x01, 0x03, 0x2A, 0x01,
+  0x02, 0x2C, 0x01, 0x02, 0x2C, 0x01, 0x02, 0x2D, 0x02, 0x01, 0x10, 0x0E,
+  0x10, 0x03, 0x01, 0x0E, 0x12, 0x0E, 0x39, 0x01, 0x03, 0x01, 0x0C, 0x16,
+  0x0C, 0x38, 0x01, 0x03, 0x00, 0x0C, 0x18, 0x0C, 0x35, 0x03, 0x03, 0x00,
+  0x0C, 0x18, 0x0C, 0x34, 0x04, 0x03, 0x00, 0x0B, 0x1A, 0x0B, 0x32, 0x06,
+  0x03, 0x00, 0x0B, 0x1A, 0x0B, 0x31, 0x07, 0x03, 0x00, 0x0B, 0x1A, 0x0B,
+  0x2F, 0x09, 0x03, 0x00, 0x0B, 0x1A, 0x0B, 0x2E, 0x0A, 0x03, 0x00, 0x0B,
+  0x1A, 0x0B, 0x2C, 0x0C, 0x03, 0x00, 0x0B, 0x1A, 0x0B, 0x2B, 0x0D, 0x03,
+  0x00, 0x0B, 0x1A, 0x0B, 0x29, 0x0F, 0x03, 0x00, 0x0C, 0x18, 0x0C, 0x28,
+  0x10, 0x03, 0x00, 0x0C, 0x18, 0x0C, 0x26, 0x12, 0x03, 0x01, 0x0C, 0x16,
+  0x0C, 0x26, 0x13, 0x03, 0x01, 0x0E, 0x12, 0x0E, 0x25, 0x13, 0x03, 0x01,
+  0x11, 0x0C, 0x11, 0x23, 0x14, 0x02, 0x02, 0x2C, 0x23, 0x13, 0x02, 0x02,
+  0x2C, 0x21, 0x14, 0x02, 0x02, 0x2B, 0x21, 0x13, 0x02, 0x03, 0x2A, 0x1F,
+  0x14, 0x02, 0x04, 0x28, 0x1F, 0x13, 0x02, 0x04, 0x27, 0x1E, 0x14, 0x02,
+  0x05, 0x26, 0x1D, 0x13, 0x02, 0x06, 0x24, 0x1C, 0x14, 0x02, 0x07, 0x21,
+  0x1D, 0x14, 0x02, 0x09, 0x1E, 0x1C, 0x14, 0x02, 0x0B, 0x1A, 0x1D, 0x14,
+  0x02, 0x0D, 0x16, 0x1E, 0x13, 0x02, 0x10, 0x10, 0x1F, 0x14, 0x01, 0x3E,
+  0x13, 0x01, 0x3C, 0x14, 0x01, 0x3B, 0x13, 0x01, 0x39, 0x14, 0x01, 0x38,
+  0x13, 0x01, 0x36, 0x14, 0x01, 0x35, 0x13, 0x01, 0x33, 0x14, 0x01, 0x32,
+  0x14, 0x01, 0x30, 0x14, 0x01, 0x2F, 0x14, 0x01, 0x2E, 0x13, 0x01, 0x2C,
+  0x14, 0x01, 0x2B, 0x13, 0x01, 0x29, 0x14, 0x01, 0x28, 0x13, 0x01, 0x26,
+  0x14, 0x01, 0x25, 0x13, 0x01, 0x23, 0x14, 0x01, 0x22, 0x14, 0x01, 0x20,
+  0x14, 0x01, 0x1F, 0x14, 0x01, 0x1D, 0x14, 0x01, 0x1C, 0x14, 0x01, 0x1B,
+  0x13, 0x01, 0x19, 0x14, 0x01, 0x18, 0x13, 0x01, 0x16, 0x14, 0x02, 0x15,
+  0x13, 0x1F, 0x13, 0x02, 0x13, 0x14, 0x1D, 0x19, 0x02, 0x12, 0x13, 0x1D,
+  0x1D, 0x02, 0x10, 0x14, 0x1D, 0x20, 0x02, 0x0F, 0x14, 0x1C, 0x23, 0x02,
+  0x0D, 0x14, 0x1D, 0x25, 0x02, 0x0C, 0x14, 0x1D, 0x27, 0x02, 0x0A, 0x14,
+  0x1E, 0x29, 0x02, 0x09, 0x14, 0x1F, 0x29, 0x02, 0x08, 0x13, 0x20, 0x2B,
+  0x02, 0x06, 0x14, 0x20, 0x2D, 0x02, 0x05, 0x13, 0x22, 0x2D, 0x02, 0x03,
+  0x14, 0x22, 0x2F, 0x03, 0x02, 0x13, 0x24, 0x10, 0x0F, 0x10, 0x03, 0x01,
+  0x13, 0x25, 0x0E, 0x14, 0x0D, 0x03, 0x01, 0x11, 0x27, 0x0C, 0x17, 0x0C,
+  0x03, 0x01, 0x10, 0x27, 0x0C, 0x19, 0x0C, 0x03, 0x01, 0x0F, 0x28, 0x0C,
+  0x19, 0x0C, 0x03, 0x01, 0x0D, 0x2A, 0x0B, 0x1B, 0x0B, 0x03, 0x01, 0x0C,
+  0x2B, 0x0B, 0x1B, 0x0B, 0x03, 0x01, 0x0A, 0x2D, 0x0B, 0x1B, 0x0B, 0x03,
+  0x01, 0x09, 0x2E, 0x0B, 0x1B, 0x0B, 0x03, 0x01, 0x07, 0x30, 0x0B, 0x1B,
+  0x0B, 0x03, 0x01, 0x06, 0x31, 0x0B, 0x1B, 0x0B, 0x03, 0x01, 0x04, 0x33,
+  0x0C, 0x1A, 0x0B, 0x03, 0x01, 0x03, 0x34, 0x0C, 0x19, 0x0C, 0x03, 0x01,
+  0x01, 0x36, 0x0D, 0x17, 0x0D, 0x02, 0x39, 0x0D, 0x15, 0x0D, 0x02, 0x39,
+  0x0F, 0x11, 0x0F, 0x02, 0x39, 0x12, 0x0B, 0x12, 0x01, 0x3A, 0x2D, 0x01,
+  0x3A, 0x2D, 0x01, 0x3B, 0x2B, 0x01, 0x3B, 0x2B, 0x01, 0x3C, 0x29, 0x01,
+  0x3D, 0x27, 0x01, 0x3E, 0x25, 0x01, 0x3F, 0x23, 0x01, 0x40, 0x21, 0x01,
+  0x41, 0x1E, 0x01, 0x43, 0x1B, 0x01, 0x46, 0x15, 0x01, 0x4A, 0x0D, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x09, 0x04, 0x01, 0x06, 0x0A, 0x01, 0x04, 0x0E, 0x01, 0x03, 0x10,
+  0x01, 0x02, 0x12, 0x01, 0x02, 0x12, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x01, 0x14,
+  0x01, 0x01, 0x14, 0x01, 0x02, 0x12, 0x01, 0x02, 0x12, 0x01, 0x03, 0x10,
+  0x01, 0x05, 0x0C, 0x01, 0x06, 0x0A, 0x01, 0x0A, 0x02, 0x01, 0x7A, 0x01,
+  0x01, 0x77, 0x04, 0x01, 0x73, 0x08, 0x01, 0x6F, 0x0C, 0x01, 0x6B, 0x10,
+  0x01, 0x68, 0x13, 0x01, 0x64, 0x17, 0x01, 0x60, 0x1B, 0x01, 0x5D, 0x1E,
+  0x01, 0x59, 0x22, 0x01, 0x55, 0x26, 0x01, 0x51, 0x2A, 0x01, 0x4E, 0x2D,
+  0x01, 0x4A, 0x31, 0x01, 0x46, 0x35, 0x01, 0x43, 0x38, 0x01, 0x3F, 0x3A,
+  0x01, 0x3B, 0x3B, 0x01, 0x37, 0x3B, 0x01, 0x34, 0x3A, 0x01, 0x30, 0x3A,
+  0x01, 0x2C, 0x3B, 0x01, 0x28, 0x3B, 0x01, 0x25, 0x3A, 0x01, 0x21, 0x3B,
+  0x01, 0x1D, 0x3B, 0x01, 0x1A, 0x3A, 0x01, 0x16, 0x3A, 0x01, 0x12, 0x3B,
+  0x01, 0x0E, 0x3B, 0x01, 0x0B, 0x3A, 0x01, 0x07, 0x3A, 0x01, 0x03, 0x3B,
+  0x01, 0x00, 0x3A, 0x01, 0x00, 0x36, 0x01, 0x00, 0x33, 0x01, 0x00, 0x2F,
+  0x01, 0x00, 0x2B, 0x01, 0x00, 0x27, 0x01, 0x00, 0x24, 0x01, 0x00, 0x20,
+  0x01, 0x00, 0x1C, 0x01, 0x00, 0x19, 0x01, 0x00, 0x15, 0x01, 0x00, 0x11,
+  0x01, 0x00, 0x0D, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02,
+  0x01, 0x2B, 0x13, 0x01, 0x24, 0x22, 0x01, 0x1F, 0x2B, 0x01, 0x1C, 0x32,
+  0x01, 0x19, 0x37, 0x01, 0x16, 0x3D, 0x01, 0x14, 0x41, 0x01, 0x12, 0x45,
+  0x01, 0x11, 0x47, 0x01, 0x0F, 0x4B, 0x01, 0x0E, 0x4D, 0x01, 0x0D, 0x50,
+  0x01, 0x0B, 0x53, 0x01, 0x0A, 0x55, 0x01, 0x09, 0x57, 0x01, 0x08, 0x59,
+  0x01, 0x08, 0x5A, 0x01, 0x07, 0x5B, 0x01, 0x06, 0x5D, 0x02, 0x05, 0x22,
+  0x1B, 0x22, 0x02, 0x05, 0x1D, 0x25, 0x1D, 0x02, 0x04, 0x1B, 0x2B, 0x1B,
+  0x02, 0x04, 0x18, 0x31, 0x18, 0x02, 0x03, 0x17, 0x35, 0x17, 0x02, 0x03,
+  0x15, 0x39, 0x15, 0x02, 0x02, 0x15, 0x3C, 0x14, 0x02, 0x02, 0x13, 0x3F,
+  0x13, 0x02, 0x02, 0x12, 0x41, 0x12, 0x02, 0x01, 0x12, 0x43, 0x12, 0x02,
+  0x01, 0x11, 0x45, 0x11, 0x02, 0x01, 0x11, 0x45, 0x11, 0x02, 0x01, 0x10,
+  0x47, 0x10, 0x02, 0x01, 0x0F, 0x49, 0x0F, 0x02, 0x00, 0x10, 0x49, 0x10,
+  0x02, 0x00, 0x10, 0x49, 0x10, 0x02, 0x00, 0x0F, 0x4B, 0x0F, 0x02, 0x00,
+  0x0F, 0x4B, 0x0F, 0x02, 0x00, 0x0F, 0x4B, 0x0F, 0x02, 0x00, 0x0F, 0x4B,
+  0x0F, 0x02, 0x00, 0x0F, 0x4B, 0x0F, 0x02, 0x00, 0x0F, 0x4B, 0x0F, 0x02,
+  0x00, 0x0F, 0x4B, 0x0F, 0x02, 0x00, 0x0F, 0x4B, 0x0F, 0x02, 0x00, 0x0F,
+  0x4B, 0x0F, 0x02, 0x00, 0x10, 0x49, 0x10, 0x02, 0x00, 0x10, 0x49, 0x10,
+  0x02, 0x01, 0x0F, 0x49, 0x0F, 0x02, 0x01, 0x10, 0x47, 0x10, 0x02, 0x01,
+  0x11, 0x45, 0x11, 0x02, 0x01, 0x11, 0x45, 0x11, 0x02, 0x01, 0x12, 0x43,
+  0x12, 0x02, 0x02, 0x12, 0x41, 0x12, 0x02, 0x02, 0x13, 0x3F, 0x13, 0x02,
+  0x02, 0x14, 0x3D, 0x14, 0x02, 0x03, 0x15, 0x39, 0x15, 0x02, 0x03, 0x17,
+  0x35, 0x17, 0x02, 0x04, 0x18, 0x31, 0x18, 0x02, 0x04, 0x1B, 0x2B, 0x1B,
+  0x02, 0x05, 0x1D, 0x25, 0x1D, 0x02, 0x05, 0x23, 0x1A, 0x22, 0x01, 0x06,
+  0x5D, 0x01, 0x07, 0x5B, 0x01, 0x08, 0x5A, 0x01, 0x08, 0x59, 0x01, 0x09,
+  0x57, 0x01, 0x0A, 0x55, 0x01, 0x0B, 0x53, 0x01, 0x0D, 0x50, 0x01, 0x0E,
+  0x4D, 0x01, 0x0F, 0x4B, 0x01, 0x11, 0x48, 0x01, 0x12, 0x45, 0x01, 0x14,
+  0x41, 0x01, 0x16, 0x3D, 0x01, 0x19, 0x37, 0x01, 0x1C, 0x31, 0x01, 0x1F,
+  0x2B, 0x01, 0x24, 0x21, 0x01, 0x2B, 0x13, 0x01, 0x10, 0x12, 0x01, 0x10,
+  0x11, 0x01, 0x0F, 0x12, 0x01, 0x0E, 0x12, 0x01, 0x0E, 0x11, 0x01, 0x0D,
+  0x11, 0x01, 0x0C, 0x12, 0x01, 0x0B, 0x12, 0x01, 0x0B, 0x11, 0x01, 0x0A,
+  0x11, 0x01, 0x09, 0x12, 0x01, 0x08, 0x12, 0x01, 0x08, 0x11, 0x01, 0x07,
+  0x12, 0x01, 0x06, 0x12, 0x01, 0x05, 0x12, 0x01, 0x05, 0x11, 0x01, 0x04,
+  0x12, 0x01, 0x03, 0x12, 0x01, 0x03, 0x11, 0x01, 0x02, 0x12, 0x01, 0x01,
+  0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00,
+  0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00,
+  0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00,
+  0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00,
+  0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00,
+  0x67, 0x01, 0x00, 0x67, 0x02, 0x18, 0x08, 0x3A, 0x0E, 0x02, 0x14, 0x0C,
+  0x39, 0x0F, 0x02, 0x12, 0x0E, 0x38, 0x10, 0x02, 0x10, 0x10, 0x37, 0x11,
+  0x02, 0x0E, 0x12, 0x36, 0x12, 0x02, 0x0D, 0x13, 0x35, 0x13, 0x02, 0x0C,
+  0x14, 0x34, 0x14, 0x02, 0x0A, 0x16, 0x33, 0x15, 0x02, 0x09, 0x17, 0x32,
+  0x16, 0x02, 0x09, 0x17, 0x31, 0x17, 0x02, 0x08, 0x18, 0x30, 0x18, 0x02,
+  0x07, 0x19, 0x2F, 0x19, 0x02, 0x06, 0x1A, 0x2E, 0x1A, 0x02, 0x06, 0x1A,
+  0x2D, 0x1B, 0x02, 0x05, 0x1B, 0x2C, 0x1C, 0x02, 0x04, 0x1C, 0x2B, 0x1D,
+  0x02, 0x04, 0x1C, 0x2A, 0x1E, 0x02, 0x03, 0x19, 0x2D, 0x1F, 0x02, 0x03,
+  0x15, 0x30, 0x20, 0x02, 0x03, 0x13, 0x32, 0x20, 0x02, 0x02, 0x13, 0x32,
+  0x21, 0x02, 0x02, 0x11, 0x33, 0x22, 0x02, 0x02, 0x10, 0x33, 0x23, 0x02,
+  0x01, 0x11, 0x32, 0x24, 0x02, 0x01, 0x10, 0x32, 0x25, 0x02, 0x01, 0x0F,
+  0x32, 0x26, 0x03, 0x01, 0x0F, 0x31, 0x16, 0x01, 0x10, 0x03, 0x00, 0x10,
+  0x30, 0x16, 0x02, 0x10, 0x03, 0x00, 0x0F, 0x30, 0x16, 0x03, 0x10, 0x03,
+  0x00, 0x0F, 0x2F, 0x16, 0x04, 0x10, 0x03, 0x00, 0x0F, 0x2E, 0x16, 0x05,
+  0x10, 0x03, 0x00, 0x0F, 0x2D, 0x16, 0x06, 0x10, 0x03, 0x00, 0x0F, 0x2C,
+  0x16, 0x07, 0x10, 0x03, 0x00, 0x0F, 0x2B, 0x16, 0x08, 0x10, 0x03, 0x00,
+  0x0F, 0x2A, 0x16, 0x09, 0x10, 0x03, 0x00, 0x0F, 0x29, 0x16, 0x0A, 0x10,
+  0x03, 0x00, 0x0F, 0x28, 0x16, 0x0B, 0x10, 0x03, 0x00, 0x0F, 0x27, 0x16,
+  0x0C, 0x10, 0x03, 0x00, 0x0F, 0x26, 0x16, 0x0D, 0x10, 0x03, 0x00, 0x0F,
+  0x25, 0x16, 0x0E, 0x10, 0x03, 0x00, 0x10, 0x22, 0x17, 0x0F, 0x10, 0x03,
+  0x00, 0x10, 0x21, 0x17, 0x10, 0x10, 0x03, 0x01, 0x0F, 0x20, 0x17, 0x11,
+  0x10, 0x03, 0x01, 0x10, 0x1E, 0x17, 0x12, 0x10, 0x03, 0x01, 0x10, 0x1D,
+  0x17, 0x13, 0x10, 0x03, 0x01, 0x11, 0x1B, 0x17, 0x14, 0x10, 0x03, 0x02,
+  0x11, 0x18, 0x18, 0x15, 0x10, 0x03, 0x02, 0x12, 0x16, 0x18, 0x16, 0x10,
+  0x03, 0x02, 0x13, 0x13, 0x19, 0x17, 0x10, 0x03, 0x03, 0x14, 0x0F, 0x1A,
+  0x18, 0x10, 0x03, 0x03, 0x16, 0x0A, 0x1C, 0x19, 0x10, 0x02, 0x03, 0x3B,
+  0x1A, 0x10, 0x02, 0x04, 0x39, 0x1B, 0x10, 0x02, 0x04, 0x38, 0x1C, 0x10,
+  0x02, 0x05, 0x36, 0x1D, 0x10, 0x02, 0x06, 0x33, 0x1F, 0x10, 0x02, 0x06,
+  0x32, 0x20, 0x10, 0x02, 0x07, 0x30, 0x21, 0x10, 0x02, 0x08, 0x2E, 0x22,
+  0x10, 0x02, 0x09, 0x2C, 0x23, 0x10, 0x02, 0x0A, 0x29, 0x25, 0x10, 0x02,
+  0x0B, 0x27, 0x26, 0x10, 0x02, 0x0C, 0x25, 0x27, 0x10, 0x02, 0x0D, 0x22,
+  0x29, 0x10, 0x02, 0x0E, 0x1F, 0x2B, 0x10, 0x02, 0x10, 0x1C, 0x2C, 0x10,
+  0x02, 0x12, 0x17, 0x2F, 0x10, 0x02, 0x15, 0x12, 0x31, 0x10, 0x02, 0x19,
+  0x09, 0x36, 0x10, 0x01, 0x58, 0x10, 0x01, 0x4C, 0x03, 0x01, 0x4C, 0x07,
+  0x02, 0x1C, 0x01, 0x2F, 0x0A, 0x02, 0x16, 0x07, 0x2F, 0x0C, 0x02, 0x13,
+  0x0A, 0x2F, 0x0E, 0x02, 0x11, 0x0C, 0x2F, 0x0F, 0x02, 0x0F, 0x0E, 0x2F,
+  0x11, 0x02, 0x0E, 0x0F, 0x2F, 0x12, 0x02, 0x0C, 0x11, 0x2F, 0x13, 0x02,
+  0x0B, 0x12, 0x2F, 0x14, 0x02, 0x0A, 0x13, 0x2F, 0x15, 0x02, 0x09, 0x14,
+  0x2F, 0x15, 0x02, 0x08, 0x15, 0x2F, 0x16, 0x02, 0x08, 0x15, 0x2F, 0x17,
+  0x02, 0x07, 0x16, 0x2F, 0x17, 0x02, 0x06, 0x17, 0x2F, 0x18, 0x02, 0x06,
+  0x17, 0x2F, 0x18, 0x02, 0x05, 0x18, 0x2F, 0x19, 0x02, 0x04, 0x19, 0x2F,
+  0x19, 0x02, 0x04, 0x19, 0x33, 0x16, 0x02, 0x03, 0x17, 0x38, 0x14, 0x02,
+  0x03, 0x14, 0x3C, 0x14, 0x02, 0x03, 0x12, 0x3F, 0x13, 0x02, 0x02, 0x12,
+  0x41, 0x12, 0x02, 0x02, 0x11, 0x43, 0x11, 0x02, 0x02, 0x10, 0x45, 0x11,
+  0x02, 0x01, 0x11, 0x45, 0x11, 0x03, 0x01, 0x10, 0x1B, 0x0F, 0x1D, 0x10,
+  0x03, 0x01, 0x10, 0x1B, 0x0F, 0x1D, 0x10, 0x03, 0x01, 0x0F, 0x1C, 0x0F,
+  0x1E, 0x0F, 0x03, 0x01, 0x0F, 0x1C, 0x0F, 0x1E, 0x10, 0x03, 0x00, 0x0F,
+  0x1D, 0x0F, 0x1E, 0x10, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03,
+  0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F,
+  0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D,
+  0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00,
+  0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F,
+  0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1C, 0x10,
+  0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1C, 0x10, 0x1F, 0x0F, 0x03, 0x00, 0x0F,
+  0x1C, 0x10, 0x1E, 0x10, 0x03, 0x00, 0x10, 0x1A, 0x12, 0x1D, 0x10, 0x03,
+  0x01, 0x0F, 0x1A, 0x12, 0x1D, 0x10, 0x03, 0x01, 0x0F, 0x1A, 0x12, 0x1D,
+  0x0F, 0x03, 0x01, 0x10, 0x18, 0x14, 0x1B, 0x10, 0x03, 0x01, 0x11, 0x16,
+  0x15, 0x1B, 0x10, 0x03, 0x01, 0x11, 0x15, 0x17, 0x19, 0x11, 0x03, 0x02,
+  0x11, 0x13, 0x18, 0x18, 0x11, 0x03, 0x02, 0x13, 0x10, 0x1A, 0x17, 0x11,
+  0x03, 0x02, 0x14, 0x0E, 0x1C, 0x15, 0x12, 0x04, 0x03, 0x16, 0x08, 0x11,
+  0x01, 0x0E, 0x13, 0x13, 0x03, 0x03, 0x2F, 0x01, 0x10, 0x0F, 0x14, 0x03,
+  0x04, 0x2E, 0x02, 0x11, 0x0B, 0x16, 0x03, 0x04, 0x2E, 0x02, 0x14, 0x05,
+  0x18, 0x02, 0x05, 0x2C, 0x03, 0x31, 0x02, 0x05, 0x2C, 0x03, 0x31, 0x02,
+  0x06, 0x2A, 0x05, 0x2F, 0x02, 0x07, 0x29, 0x05, 0x2F, 0x02, 0x07, 0x28,
+  0x06, 0x2E, 0x02, 0x08, 0x26, 0x08, 0x2C, 0x02, 0x09, 0x25, 0x08, 0x2C,
+  0x02, 0x0A, 0x23, 0x0A, 0x2A, 0x02, 0x0B, 0x21, 0x0B, 0x29, 0x02, 0x0C,
+  0x1F, 0x0D, 0x27, 0x02, 0x0E, 0x1C, 0x0F, 0x25, 0x02, 0x0F, 0x19, 0x12,
+  0x23, 0x02, 0x11, 0x16, 0x14, 0x21, 0x02, 0x14, 0x10, 0x18, 0x1F, 0x02,
+  0x18, 0x09, 0x1C, 0x1D, 0x01, 0x3F, 0x19, 0x01, 0x41, 0x15, 0x01, 0x43,
+  0x10, 0x01, 0x48, 0x06, 0x01, 0x45, 0x0F, 0x01, 0x44, 0x10, 0x01, 0x42,
+  0x12, 0x01, 0x41, 0x13, 0x01, 0x3F, 0x15, 0x01, 0x3D, 0x17, 0x01, 0x3C,
+  0x18, 0x01, 0x3A, 0x1A, 0x01, 0x39, 0x1B, 0x01, 0x37, 0x1D, 0x01, 0x35,
+  0x1F, 0x01, 0x34, 0x20, 0x01, 0x32, 0x22, 0x01, 0x31, 0x23, 0x01, 0x2F,
+  0x25, 0x01, 0x2D, 0x27, 0x01, 0x2C, 0x28, 0x01, 0x2A, 0x2A, 0x01, 0x29,
+  0x2B, 0x02, 0x27, 0x1D, 0x01, 0x0F, 0x02, 0x25, 0x1E, 0x02, 0x0F, 0x02,
+  0x24, 0x1D, 0x04, 0x0F, 0x02, 0x22, 0x1E, 0x05, 0x0F, 0x02, 0x21, 0x1D,
+  0x07, 0x0F, 0x02, 0x1F, 0x1D, 0x09, 0x0F, 0x02, 0x1D, 0x1E, 0x0A, 0x0F,
+  0x02, 0x1C, 0x1D, 0x0C, 0x0F, 0x02, 0x1A, 0x1E, 0x0D, 0x0F, 0x02, 0x19,
+  0x1D, 0x0F, 0x0F, 0x02, 0x17, 0x1D, 0x11, 0x0F, 0x02, 0x15, 0x1E, 0x12,
+  0x0F, 0x02, 0x14, 0x1D, 0x14, 0x0F, 0x02, 0x12, 0x1E, 0x15, 0x0F, 0x02,
+  0x11, 0x1D, 0x17, 0x0F, 0x02, 0x0F, 0x1D, 0x19, 0x0F, 0x02, 0x0D, 0x1E,
+  0x1A, 0x0F, 0x02, 0x0C, 0x1D, 0x1C, 0x0F, 0x02, 0x0A, 0x1E, 0x1D, 0x0F,
+  0x02, 0x09, 0x1D, 0x1F, 0x0F, 0x02, 0x07, 0x1D, 0x21, 0x0F, 0x02, 0x05,
+  0x1E, 0x22, 0x0F, 0x02, 0x04, 0x1D, 0x24, 0x0F, 0x02, 0x02, 0x1E, 0x25,
+  0x0F, 0x02, 0x01, 0x1D, 0x27, 0x0F, 0x02, 0x00, 0x1C, 0x29, 0x0F, 0x02,
+  0x00, 0x1B, 0x2A, 0x0F, 0x02, 0x00, 0x19, 0x2C, 0x0F, 0x02, 0x00, 0x17,
+  0x2E, 0x0F, 0x02, 0x00, 0x16, 0x2F, 0x0F, 0x02, 0x00, 0x16, 0x2F, 0x22,
+  0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67,
+  0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67,
+  0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67,
+  0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67, 0x01, 0x00, 0x67,
+  0x01, 0x00, 0x67, 0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F,
+  0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F,
+  0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F,
+  0x01, 0x45, 0x0F, 0x01, 0x45, 0x0F, 0x01, 0x4B, 0x04, 0x01, 0x4B, 0x08,
+  0x02, 0x32, 0x03, 0x16, 0x0B, 0x02, 0x28, 0x0D, 0x16, 0x0D, 0x02, 0x1E,
+  0x18, 0x15, 0x0E, 0x02, 0x14, 0x22, 0x15, 0x10, 0x02, 0x0A, 0x2C, 0x15,
+  0x11, 0x02, 0x00, 0x36, 0x15, 0x12, 0x02, 0x00, 0x36, 0x15, 0x13, 0x02,
+  0x00, 0x36, 0x15, 0x14, 0x02, 0x00, 0x37, 0x14, 0x15, 0x02, 0x00, 0x37,
+  0x14, 0x16, 0x02, 0x00, 0x37, 0x14, 0x16, 0x02, 0x00, 0x37, 0x14, 0x17,
+  0x02, 0x00, 0x37, 0x14, 0x18, 0x02, 0x00, 0x37, 0x14, 0x18, 0x02, 0x00,
+  0x38, 0x13, 0x19, 0x02, 0x00, 0x38, 0x13, 0x19, 0x02, 0x00, 0x38, 0x16,
+  0x17, 0x02, 0x00, 0x37, 0x1A, 0x14, 0x03, 0x00, 0x25, 0x06, 0x0B, 0x1C,
+  0x14, 0x03, 0x00, 0x1B, 0x0F, 0x0C, 0x1E, 0x12, 0x03, 0x00, 0x12, 0x17,
+  0x0C, 0x20, 0x11, 0x03, 0x00, 0x0F, 0x19, 0x0C, 0x21, 0x11, 0x03, 0x00,
+  0x0F, 0x18, 0x0D, 0x22, 0x11, 0x03, 0x00, 0x0F, 0x18, 0x0C, 0x24, 0x10,
+  0x03, 0x00, 0x0F, 0x17, 0x0D, 0x24, 0x10, 0x03, 0x00, 0x0F, 0x17, 0x0D,
+  0x25, 0x0F, 0x03, 0x00, 0x0F, 0x16, 0x0D, 0x26, 0x10, 0x03, 0x00, 0x0F,
+  0x16, 0x0D, 0x27, 0x0F, 0x03, 0x00, 0x0F, 0x15, 0x0E, 0x27, 0x0F, 0x03,
+  0x00, 0x0F, 0x15, 0x0E, 0x27, 0x0F, 0x03, 0x00, 0x0F, 0x15, 0x0E, 0x27,
+  0x0F, 0x03, 0x00, 0x0F, 0x15, 0x0E, 0x27, 0x0F, 0x03, 0x00, 0x0F, 0x14,
+  0x0F, 0x27, 0x0F, 0x03, 0x00, 0x0F, 0x14, 0x0F, 0x27, 0x0F, 0x03, 0x00,
+  0x0F, 0x14, 0x0F, 0x27, 0x0F, 0x03, 0x00, 0x0F, 0x14, 0x0F, 0x27, 0x0F,
+  0x03, 0x00, 0x0F, 0x14, 0x0F, 0x27, 0x0F, 0x03, 0x00, 0x0F, 0x14, 0x0F,
+  0x27, 0x0F, 0x03, 0x00, 0x0F, 0x14, 0x0F, 0x27, 0x0F, 0x03, 0x00, 0x0F,
+  0x14, 0x10, 0x26, 0x0F, 0x03, 0x00, 0x0F, 0x14, 0x10, 0x25, 0x0F, 0x03,
+  0x00, 0x0F, 0x14, 0x10, 0x25, 0x0F, 0x03, 0x00, 0x0F, 0x14, 0x11, 0x23,
+  0x10, 0x03, 0x00, 0x0F, 0x14, 0x11, 0x23, 0x10, 0x03, 0x00, 0x0F, 0x15,
+  0x11, 0x21, 0x11, 0x03, 0x00, 0x0F, 0x15, 0x12, 0x1F, 0x11, 0x03, 0x00,
+  0x0F, 0x15, 0x13, 0x1D, 0x12, 0x03, 0x00, 0x0F, 0x15, 0x14, 0x1B, 0x13,
+  0x03, 0x00, 0x0F, 0x16, 0x14, 0x19, 0x13, 0x03, 0x00, 0x0F, 0x16, 0x16,
+  0x16, 0x14, 0x03, 0x00, 0x0F, 0x16, 0x18, 0x12, 0x16, 0x03, 0x00, 0x0F,
+  0x17, 0x19, 0x0D, 0x18, 0x02, 0x00, 0x0F, 0x17, 0x3E, 0x02, 0x00, 0x0F,
+  0x18, 0x3C, 0x02, 0x00, 0x0F, 0x18, 0x3B, 0x02, 0x00, 0x0F, 0x19, 0x3A,
+  0x02, 0x00, 0x0F, 0x1A, 0x38, 0x02, 0x00, 0x0F, 0x1A, 0x37, 0x02, 0x00,
+  0x0F, 0x1B, 0x35, 0x02, 0x00, 0x0F, 0x1C, 0x34, 0x02, 0x00, 0x0F, 0x1D,
+  0x32, 0x02, 0x00, 0x0F, 0x1E, 0x30, 0x02, 0x00, 0x0F, 0x1F, 0x2D, 0x02,
+  0x00, 0x0F, 0x20, 0x2B, 0x02, 0x00, 0x0F, 0x22, 0x28, 0x01, 0x32, 0x25,
+  0x01, 0x34, 0x21, 0x01, 0x36, 0x1D, 0x01, 0x39, 0x17, 0x01, 0x3D, 0x10,
+  0x01, 0x2E, 0x13, 0x01, 0x26, 0x22, 0x01, 0x21, 0x2B, 0x01, 0x1E, 0x31,
+  0x01, 0x1B, 0x37, 0x01, 0x18, 0x3C, 0x01, 0x16, 0x40, 0x01, 0x14, 0x44,
+  0x01, 0x12, 0x48, 0x01, 0x11, 0x4A, 0x01, 0x0F, 0x4D, 0x01, 0x0E, 0x4F,
+  0x01, 0x0D, 0x52, 0x01, 0x0B, 0x54, 0x01, 0x0A, 0x56, 0x01, 0x09, 0x58,
+  0x01, 0x09, 0x59, 0x01, 0x08, 0x5B, 0x02, 0x07, 0x23, 0x09, 0x30, 0x02,
+  0x06, 0x1E, 0x0D, 0x33, 0x03, 0x06, 0x1A, 0x10, 0x12, 0x09, 0x1A, 0x03,
+  0x05, 0x19, 0x11, 0x10, 0x0F, 0x17, 0x03, 0x04, 0x18, 0x11, 0x10, 0x13,
+  0x16, 0x03, 0x04, 0x16, 0x12, 0x0F, 0x17, 0x14, 0x03, 0x03, 0x15, 0x13,
+  0x0F, 0x19, 0x13, 0x03, 0x03, 0x14, 0x14, 0x0E, 0x1C, 0x12, 0x03, 0x02,
+  0x14, 0x14, 0x0E, 0x1E, 0x11, 0x03, 0x02, 0x13, 0x14, 0x0E, 0x1F, 0x11,
+  0x03, 0x02, 0x12, 0x14, 0x0E, 0x21, 0x11, 0x03, 0x01, 0x12, 0x15, 0x0D,
+  0x23, 0x10, 0x03, 0x01, 0x11, 0x15, 0x0E, 0x23, 0x10, 0x03, 0x01, 0x11,
+  0x15, 0x0D, 0x25, 0x0F, 0x03, 0x01, 0x10, 0x15, 0x0E, 0x25, 0x0F, 0x03,
+  0x01, 0x10, 0x15, 0x0D, 0x27, 0x0F, 0x03, 0x00, 0x11, 0x15, 0x0D, 0x27,
+  0x0F, 0x03, 0x00, 0x11, 0x14, 0x0E, 0x27, 0x0F, 0x03, 0x00, 0x10, 0x15,
+  0x0E, 0x27, 0x0F, 0x03, 0x00, 0x10, 0x15, 0x0E, 0x27, 0x0F, 0x03, 0x00,
+  0x10, 0x15, 0x0E, 0x27, 0x0F, 0x03, 0x00, 0x10, 0x14, 0x0F, 0x27, 0x0F,
+  0x03, 0x00, 0x10, 0x14, 0x0F, 0x27, 0x0F, 0x03, 0x00, 0x10, 0x14, 0x0F,
+  0x27, 0x0F, 0x03, 0x00, 0x10, 0x14, 0x0F, 0x27, 0x0F, 0x03, 0x00, 0x10,
+  0x14, 0x0F, 0x27, 0x0F, 0x03, 0x00, 0x10, 0x14, 0x0F, 0x27, 0x0F, 0x03,
+  0x00, 0x11, 0x13, 0x10, 0x25, 0x10, 0x03, 0x00, 0x11, 0x13, 0x10, 0x25,
+  0x0F, 0x03, 0x01, 0x10, 0x13, 0x10, 0x25, 0x0F, 0x03, 0x01, 0x11, 0x12,
+  0x11, 0x23, 0x10, 0x03, 0x01, 0x11, 0x12, 0x11, 0x22, 0x11, 0x03, 0x01,
+  0x12, 0x12, 0x11, 0x21, 0x11, 0x03, 0x01, 0x13, 0x11, 0x12, 0x1F, 0x11,
+  0x03, 0x02, 0x13, 0x10, 0x13, 0x1D, 0x12, 0x03, 0x02, 0x14, 0x0F, 0x14,
+  0x1B, 0x13, 0x03, 0x02, 0x15, 0x0F, 0x14, 0x19, 0x13, 0x03, 0x03, 0x16,
+  0x0D, 0x16, 0x15, 0x15, 0x03, 0x03, 0x18, 0x0B, 0x18, 0x11, 0x16, 0x03,
+  0x04, 0x19, 0x0A, 0x1A, 0x0B, 0x19, 0x02, 0x04, 0x19, 0x0A, 0x3D, 0x02,
+  0x05, 0x18, 0x0B, 0x3C, 0x02, 0x06, 0x17, 0x0B, 0x3B, 0x02, 0x06, 0x17,
+  0x0C, 0x3A, 0x02, 0x07, 0x16, 0x0D, 0x38, 0x02, 0x08, 0x15, 0x0D, 0x37,
+  0x02, 0x09, 0x14, 0x0E, 0x35, 0x02, 0x09, 0x14, 0x0F, 0x33, 0x02, 0x0A,
+  0x13, 0x10, 0x31, 0x02, 0x0C, 0x11, 0x11, 0x2F, 0x02, 0x0D, 0x10, 0x12,
+  0x2D, 0x02, 0x0E, 0x0F, 0x13, 0x2B, 0x02, 0x10, 0x0D, 0x15, 0x27, 0x02,
+  0x11, 0x0C, 0x17, 0x24, 0x02, 0x13, 0x0A, 0x18, 0x21, 0x02, 0x16, 0x07,
+  0x1B, 0x1C, 0x02, 0x19, 0x04, 0x1D, 0x17, 0x01, 0x3F, 0x0E, 0x01, 0x00,
+  0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00,
+  0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x02, 0x00, 0x10, 0x55, 0x02,
+  0x02, 0x00, 0x10, 0x53, 0x04, 0x02, 0x00, 0x10, 0x51, 0x06, 0x02, 0x00,
+  0x10, 0x4F, 0x08, 0x02, 0x00, 0x10, 0x4D, 0x0A, 0x02, 0x00, 0x10, 0x4B,
+  0x0C, 0x02, 0x00, 0x10, 0x49, 0x0E, 0x02, 0x00, 0x10, 0x47, 0x10, 0x02,
+  0x00, 0x10, 0x46, 0x11, 0x02, 0x00, 0x10, 0x44, 0x13, 0x02, 0x00, 0x10,
+  0x42, 0x15, 0x02, 0x00, 0x10, 0x40, 0x17, 0x02, 0x00, 0x10, 0x3E, 0x19,
+  0x02, 0x00, 0x10, 0x3C, 0x1B, 0x02, 0x00, 0x10, 0x3A, 0x1D, 0x02, 0x00,
+  0x10, 0x38, 0x1F, 0x02, 0x00, 0x10, 0x36, 0x21, 0x02, 0x00, 0x10, 0x34,
+  0x23, 0x02, 0x00, 0x10, 0x32, 0x25, 0x02, 0x00, 0x10, 0x30, 0x26, 0x02,
+  0x00, 0x10, 0x2E, 0x26, 0x02, 0x00, 0x10, 0x2C, 0x26, 0x02, 0x00, 0x10,
+  0x2A, 0x26, 0x02, 0x00, 0x10, 0x28, 0x26, 0x02, 0x00, 0x10, 0x26, 0x26,
+  0x02, 0x00, 0x10, 0x24, 0x26, 0x02, 0x00, 0x10, 0x22, 0x26, 0x02, 0x00,
+  0x10, 0x20, 0x26, 0x02, 0x00, 0x10, 0x1E, 0x26, 0x02, 0x00, 0x10, 0x1C,
+  0x26, 0x02, 0x00, 0x10, 0x1A, 0x26, 0x02, 0x00, 0x10, 0x18, 0x26, 0x02,
+  0x00, 0x10, 0x16, 0x26, 0x02, 0x00, 0x10, 0x14, 0x26, 0x02, 0x00, 0x10,
+  0x12, 0x26, 0x02, 0x00, 0x10, 0x10, 0x26, 0x02, 0x00, 0x10, 0x0E, 0x26,
+  0x02, 0x00, 0x10, 0x0C, 0x26, 0x02, 0x00, 0x10, 0x0A, 0x26, 0x02, 0x00,
+  0x10, 0x08, 0x26, 0x02, 0x00, 0x10, 0x06, 0x26, 0x02, 0x00, 0x10, 0x04,
+  0x26, 0x02, 0x00, 0x10, 0x02, 0x26, 0x01, 0x00, 0x36, 0x01, 0x00, 0x34,
+  0x01, 0x00, 0x32, 0x01, 0x00, 0x30, 0x01, 0x00, 0x2E, 0x01, 0x00, 0x2C,
+  0x01, 0x00, 0x2A, 0x01, 0x00, 0x28, 0x01, 0x00, 0x26, 0x01, 0x00, 0x24,
+  0x01, 0x00, 0x22, 0x01, 0x00, 0x20, 0x01, 0x00, 0x1E, 0x01, 0x00, 0x1C,
+  0x01, 0x00, 0x1A, 0x01, 0x00, 0x18, 0x01, 0x00, 0x16, 0x01, 0x00, 0x14,
+  0x01, 0x00, 0x12, 0x01, 0x00, 0x10, 0x01, 0x48, 0x09, 0x01, 0x44, 0x11,
+  0x01, 0x41, 0x16, 0x01, 0x3F, 0x1A, 0x02, 0x15, 0x0D, 0x1C, 0x1D, 0x02,
+  0x12, 0x13, 0x17, 0x20, 0x02, 0x10, 0x17, 0x14, 0x22, 0x02, 0x0E, 0x1A,
+  0x12, 0x24, 0x02, 0x0D, 0x1D, 0x0F, 0x26, 0x02, 0x0C, 0x1F, 0x0D, 0x28,
+  0x02, 0x0B, 0x21, 0x0C, 0x29, 0x02, 0x0A, 0x23, 0x0A, 0x2B, 0x02, 0x09,
+  0x25, 0x08, 0x2C, 0x02, 0x08, 0x27, 0x07, 0x2D, 0x02, 0x07, 0x28, 0x06,
+  0x2E, 0x02, 0x06, 0x2A, 0x05, 0x2F, 0x02, 0x06, 0x2B, 0x03, 0x30, 0x02,
+  0x05, 0x2C, 0x03, 0x31, 0x02, 0x05, 0x2C, 0x03, 0x31, 0x03, 0x04, 0x2E,
+  0x01, 0x14, 0x08, 0x17, 0x03, 0x04, 0x2E, 0x01, 0x11, 0x0E, 0x14, 0x02,
+  0x03, 0x3F, 0x11, 0x14, 0x03, 0x03, 0x15, 0x0A, 0x1F, 0x14, 0x12, 0x03,
+  0x02, 0x14, 0x0E, 0x1C, 0x16, 0x11, 0x03, 0x02, 0x12, 0x12, 0x19, 0x17,
+  0x11, 0x03, 0x02, 0x11, 0x14, 0x17, 0x19, 0x11, 0x03, 0x01, 0x11, 0x16,
+  0x16, 0x1A, 0x10, 0x03, 0x01, 0x11, 0x17, 0x14, 0x1B, 0x10, 0x03, 0x01,
+  0x10, 0x18, 0x13, 0x1D, 0x0F, 0x03, 0x01, 0x0F, 0x1A, 0x12, 0x1D, 0x0F,
+  0x03, 0x01, 0x0F, 0x1B, 0x11, 0x1D, 0x10, 0x03, 0x00, 0x10, 0x1B, 0x10,
+  0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1C, 0x10, 0x1F, 0x0F, 0x03, 0x00, 0x0F,
+  0x1C, 0x10, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03,
+  0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F,
+  0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D,
+  0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00,
+  0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F,
+  0x03, 0x00, 0x0F, 0x1D, 0x0F, 0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1C, 0x10,
+  0x1F, 0x0F, 0x03, 0x00, 0x0F, 0x1C, 0x10, 0x1F, 0x0F, 0x03, 0x01, 0x0F,
+  0x1B, 0x11, 0x1E, 0x0F, 0x03, 0x01, 0x0F, 0x1A, 0x12, 0x1D, 0x0F, 0x03,
+  0x01, 0x10, 0x19, 0x12, 0x1D, 0x0F, 0x03, 0x01, 0x10, 0x18, 0x14, 0x1B,
+  0x10, 0x03, 0x01, 0x11, 0x16, 0x16, 0x1A, 0x10, 0x03, 0x02, 0x11, 0x14,
+  0x17, 0x19, 0x11, 0x03, 0x02, 0x12, 0x12, 0x19, 0x18, 0x10, 0x03, 0x02,
+  0x14, 0x0F, 0x1B, 0x16, 0x11, 0x03, 0x03, 0x15, 0x0A, 0x1F, 0x14, 0x12,
+  0x02, 0x03, 0x3F, 0x12, 0x13, 0x03, 0x03, 0x2F, 0x01, 0x11, 0x0E, 0x14,
+  0x03, 0x04, 0x2E, 0x01, 0x13, 0x0A, 0x16, 0x02, 0x04, 0x2D, 0x02, 0x32,
+  0x02, 0x05, 0x2C, 0x03, 0x31, 0x02, 0x06, 0x2B, 0x03, 0x31, 0x02, 0x06,
+  0x2A, 0x05, 0x2F, 0x02, 0x07, 0x28, 0x06, 0x2E, 0x02, 0x08, 0x27, 0x07,
+  0x2D, 0x02, 0x09, 0x25, 0x08, 0x2C, 0x02, 0x09, 0x24, 0x0A, 0x2B, 0x02,
+  0x0A, 0x22, 0x0B, 0x2A, 0x02, 0x0C, 0x1F, 0x0D, 0x28, 0x02, 0x0D, 0x1D,
+  0x0F, 0x26, 0x02, 0x0E, 0x1B, 0x11, 0x24, 0x02, 0x10, 0x17, 0x14, 0x22,
+  0x02, 0x12, 0x13, 0x17, 0x20, 0x02, 0x15, 0x0D, 0x1C, 0x1D, 0x01, 0x3F,
+  0x1A, 0x01, 0x41, 0x17, 0x01, 0x43, 0x12, 0x01, 0x46, 0x0C, 0x01, 0x1D,
+  0x0C, 0x02, 0x19, 0x15, 0x1E, 0x03, 0x02, 0x16, 0x1B, 0x1B, 0x06, 0x02,
+  0x14, 0x1F, 0x19, 0x09, 0x02, 0x12, 0x23, 0x17, 0x0B, 0x02, 0x10, 0x26,
+  0x16, 0x0D, 0x02, 0x0E, 0x2A, 0x14, 0x0F, 0x02, 0x0D, 0x2C, 0x13, 0x10,
+  0x02, 0x0C, 0x2E, 0x12, 0x11, 0x02, 0x0B, 0x30, 0x11, 0x12, 0x02, 0x0A,
+  0x32, 0x10, 0x13, 0x02, 0x09, 0x34, 0x0F, 0x14, 0x02, 0x08, 0x36, 0x0E,
+  0x15, 0x02, 0x07, 0x38, 0x0D, 0x16, 0x02, 0x07, 0x39, 0x0C, 0x17, 0x02,
+  0x06, 0x3A, 0x0C, 0x17, 0x02, 0x05, 0x3C, 0x0B, 0x18, 0x02, 0x05, 0x3C,
+  0x0B, 0x19, 0x03, 0x04, 0x1A, 0x09, 0x1B, 0x0A, 0x19, 0x03, 0x04, 0x16,
+  0x10, 0x18, 0x0B, 0x19, 0x03, 0x03, 0x15, 0x14, 0x17, 0x0D, 0x16, 0x03,
+  0x03, 0x14, 0x17, 0x15, 0x0E, 0x15, 0x03, 0x02, 0x13, 0x1A, 0x14, 0x10,
+  0x14, 0x03, 0x02, 0x12, 0x1C, 0x13, 0x11, 0x13, 0x03, 0x02, 0x11, 0x1E,
+  0x13, 0x11, 0x12, 0x03, 0x01, 0x11, 0x20, 0x12, 0x12, 0x12, 0x03, 0x01,
+  0x11, 0x21, 0x11, 0x13, 0x11, 0x03, 0x01, 0x10, 0x23, 0x10, 0x13, 0x11,
+  0x03, 0x01, 0x10, 0x23, 0x10, 0x14, 0x10, 0x03, 0x01, 0x0F, 0x25, 0x0F,
+  0x14, 0x11, 0x03, 0x00, 0x10, 0x25, 0x10, 0x13, 0x11, 0x03, 0x00, 0x0F,
+  0x26, 0x10, 0x14, 0x10, 0x03, 0x00, 0x0F, 0x27, 0x0F, 0x14, 0x10, 0x03,
+  0x00, 0x0F, 0x27, 0x0E, 0x15, 0x10, 0x03, 0x00, 0x0F, 0x27, 0x0E, 0x15,
+  0x10, 0x03, 0x00, 0x0F, 0x27, 0x0E, 0x15, 0x10, 0x03, 0x00, 0x0F, 0x27,
+  0x0E, 0x15, 0x10, 0x03, 0x00, 0x0F, 0x27, 0x0E, 0x15, 0x10, 0x03, 0x00,
+  0x0F, 0x27, 0x0E, 0x15, 0x10, 0x03, 0x00, 0x0F, 0x27, 0x0E, 0x15, 0x10,
+  0x03, 0x00, 0x0F, 0x27, 0x0D, 0x16, 0x10, 0x03, 0x00, 0x0F, 0x26, 0x0E,
+  0x15, 0x11, 0x03, 0x00, 0x0F, 0x26, 0x0E, 0x15, 0x10, 0x03, 0x00, 0x10,
+  0x25, 0x0D, 0x16, 0x10, 0x03, 0x01, 0x0F, 0x24, 0x0E, 0x15, 0x11, 0x03,
+  0x01, 0x0F, 0x24, 0x0D, 0x16, 0x11, 0x03, 0x01, 0x10, 0x22, 0x0E, 0x15,
+  0x12, 0x03, 0x01, 0x11, 0x21, 0x0D, 0x15, 0x12, 0x03, 0x02, 0x10, 0x20,
+  0x0E, 0x14, 0x13, 0x03, 0x02, 0x11, 0x1E, 0x0E, 0x15, 0x13, 0x03, 0x02,
+  0x12, 0x1C, 0x0E, 0x14, 0x14, 0x03, 0x03, 0x12, 0x1A, 0x0F, 0x13, 0x15,
+  0x03, 0x03, 0x13, 0x18, 0x0F, 0x13, 0x15, 0x03, 0x03, 0x15, 0x14, 0x10,
+  0x12, 0x17, 0x03, 0x04, 0x16, 0x10, 0x10, 0x12, 0x18, 0x03, 0x04, 0x19,
+  0x0B, 0x11, 0x10, 0x1B, 0x02, 0x05, 0x33, 0x0E, 0x1D, 0x02, 0x05, 0x31,
+  0x0B, 0x21, 0x01, 0x06, 0x5C, 0x01, 0x07, 0x5A, 0x01, 0x08, 0x58, 0x01,
+  0x08, 0x57, 0x01, 0x09, 0x55, 0x01, 0x0A, 0x53, 0x01, 0x0B, 0x50, 0x01,
+  0x0C, 0x4E, 0x01, 0x0E, 0x4B, 0x01, 0x0F, 0x48, 0x01, 0x11, 0x44, 0x01,
+  0x12, 0x41, 0x01, 0x14, 0x3D, 0x01, 0x17, 0x37, 0x01, 0x19, 0x33, 0x01,
+  0x1C, 0x2C, 0x01, 0x20, 0x24, 0x01, 0x26, 0x17, 0x02, 0x09, 0x04, 0x31,
+  0x04, 0x02, 0x06, 0x0A, 0x2B, 0x0A, 0x02, 0x04, 0x0E, 0x27, 0x0E, 0x02,
+  0x03, 0x10, 0x25, 0x10, 0x02, 0x02, 0x12, 0x23, 0x12, 0x02, 0x02, 0x12,
+  0x23, 0x12, 0x02, 0x01, 0x14, 0x21, 0x14, 0x02, 0x01, 0x14, 0x21, 0x14,
+  0x02, 0x00, 0x16, 0x1F, 0x16, 0x02, 0x00, 0x16, 0x1F, 0x16, 0x02, 0x00,
+  0x16, 0x1F, 0x16, 0x02, 0x00, 0x16, 0x1F, 0x16, 0x02, 0x00, 0x16, 0x1F,
+  0x16, 0x02, 0x00, 0x16, 0x1F, 0x16, 0x02, 0x00, 0x16, 0x1F, 0x16, 0x02,
+  0x01, 0x14, 0x21, 0x14, 0x02, 0x01, 0x14, 0x21, 0x14, 0x02, 0x02, 0x12,
+  0x23, 0x12, 0x02, 0x02, 0x12, 0x23, 0x12, 0x02, 0x03, 0x10, 0x25, 0x10,
+  0x02, 0x05, 0x0C, 0x29, 0x0C, 0x02, 0x06, 0x0A, 0x2B, 0x0A, 0x02, 0x0A,
+  0x02, 0x33, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x2C, 0x11, 0x01, 0x26, 0x1D, 0x01, 0x22, 0x25, 0x01, 0x1F, 0x2C, 0x01,
+  0x1C, 0x31, 0x01, 0x1A, 0x35, 0x01, 0x18, 0x39, 0x01, 0x16, 0x3D, 0x01,
+  0x14, 0x41, 0x01, 0x13, 0x43, 0x01, 0x11, 0x47, 0x01, 0x10, 0x49, 0x01,
+  0x0F, 0x4B, 0x01, 0x0E, 0x4D, 0x01, 0x0D, 0x4F, 0x01, 0x0C, 0x51, 0x01,
+  0x0B, 0x53, 0x01, 0x0A, 0x55, 0x01, 0x09, 0x57, 0x02, 0x09, 0x20, 0x17,
+  0x21, 0x02, 0x08, 0x1D, 0x1F, 0x1D, 0x02, 0x07, 0x1B, 0x25, 0x1B, 0x02,
+  0x07, 0x19, 0x29, 0x1A, 0x02, 0x06, 0x18, 0x2D, 0x18, 0x02, 0x05, 0x17,
+  0x31, 0x17, 0x02, 0x05, 0x16, 0x33, 0x16, 0x02, 0x04, 0x16, 0x35, 0x16,
+  0x02, 0x04, 0x14, 0x39, 0x14, 0x02, 0x03, 0x15, 0x3A, 0x14, 0x02, 0x03,
+  0x13, 0x3D, 0x13, 0x02, 0x03, 0x13, 0x3D, 0x13, 0x02, 0x02, 0x13, 0x3F,
+  0x13, 0x02, 0x02, 0x12, 0x41, 0x12, 0x02, 0x02, 0x12, 0x41, 0x12, 0x02,
+  0x02, 0x11, 0x43, 0x12, 0x02, 0x01, 0x12, 0x43, 0x12, 0x02, 0x01, 0x11,
+  0x45, 0x11, 0x02, 0x01, 0x11, 0x45, 0x11, 0x02, 0x01, 0x10, 0x47, 0x10,
+  0x02, 0x01, 0x10, 0x47, 0x11, 0x02, 0x00, 0x11, 0x47, 0x11, 0x02, 0x00,
+  0x11, 0x47, 0x11, 0x02, 0x00, 0x10, 0x49, 0x10, 0x02, 0x00, 0x10, 0x49,
+  0x10, 0x02, 0x00, 0x10, 0x49, 0x10, 0x02, 0x00, 0x10, 0x49, 0x10, 0x02,
+  0x00, 0x10, 0x49, 0x10, 0x02, 0x00, 0x10, 0x49, 0x10, 0x02, 0x00, 0x10,
+  0x49, 0x10, 0x02, 0x00, 0x10, 0x49, 0x10, 0x02, 0x00, 0x10, 0x49, 0x10,
+  0x02, 0x00, 0x10, 0x49, 0x10, 0x02, 0x00, 0x10, 0x49, 0x10, 0x02, 0x00,
+  0x11, 0x47, 0x11, 0x02, 0x00, 0x11, 0x47, 0x10, 0x02, 0x01, 0x10, 0x47,
+  0x10, 0x02, 0x01, 0x10, 0x47, 0x10, 0x02, 0x01, 0x11, 0x45, 0x11, 0x02,
+  0x01, 0x11, 0x45, 0x11, 0x02, 0x01, 0x12, 0x43, 0x12, 0x02, 0x02, 0x11,
+  0x43, 0x11, 0x02, 0x02, 0x12, 0x41, 0x12, 0x02, 0x02, 0x12, 0x41, 0x12,
+  0x02, 0x03, 0x12, 0x3F, 0x12, 0x02, 0x03, 0x13, 0x3D, 0x13, 0x02, 0x03,
+  0x14, 0x3B, 0x14, 0x02, 0x04, 0x14, 0x39, 0x14, 0x02, 0x04, 0x15, 0x37,
+  0x15, 0x02, 0x05, 0x16, 0x33, 0x16, 0x02, 0x05, 0x17, 0x31, 0x17, 0x02,
+  0x06, 0x19, 0x2B, 0x19, 0x02, 0x06, 0x1C, 0x25, 0x1B, 0x02, 0x07, 0x1C,
+  0x23, 0x1C, 0x02, 0x08, 0x1B, 0x23, 0x1B, 0x02, 0x08, 0x1B, 0x23, 0x1A,
+  0x02, 0x09, 0x1A, 0x23, 0x1A, 0x02, 0x0A, 0x19, 0x23, 0x19, 0x02, 0x0B,
+  0x18, 0x23, 0x18, 0x02, 0x0C, 0x17, 0x23, 0x17, 0x02, 0x0D, 0x16, 0x23,
+  0x16, 0x02, 0x0E, 0x15, 0x23, 0x15, 0x02, 0x0F, 0x14, 0x23, 0x14, 0x02,
+  0x10, 0x13, 0x23, 0x13, 0x02, 0x11, 0x12, 0x23, 0x11, 0x02, 0x13, 0x10,
+  0x23, 0x10, 0x02, 0x15, 0x0E, 0x23, 0x0E, 0x02, 0x17, 0x0C, 0x23, 0x0C,
+  0x02, 0x19, 0x0A, 0x23, 0x0A, 0x02, 0x1C, 0x07, 0x23, 0x07, 0x02, 0x1F,
+  0x04, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x4D, 0x01,
+  0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01,
+  0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01,
+  0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01,
+  0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01,
+  0x06, 0x48, 0x01, 0x0E, 0x0E, 0x01, 0x0C, 0x0C, 0x01, 0x0A, 0x0C, 0x01,
+  0x09, 0x0B, 0x01, 0x08, 0x0B, 0x01, 0x06, 0x0C, 0x01, 0x06, 0x0B, 0x01,
+  0x05, 0x0C, 0x01, 0x04, 0x0C, 0x01, 0x03, 0x0D, 0x01, 0x03, 0x0D, 0x01,
+  0x02, 0x0D, 0x01, 0x02, 0x0D, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0E, 0x01,
+  0x01, 0x0E, 0x01, 0x01, 0x0E, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x13, 0x01, 0x00, 0x14, 0x01, 0x00, 0x16, 0x01,
+  0x01, 0x18, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01, 0x02, 0x4C, 0x01,
+  0x02, 0x4C, 0x01, 0x03, 0x4B, 0x01, 0x04, 0x4A, 0x01, 0x05, 0x49, 0x01,
+  0x06, 0x48, 0x01, 0x07, 0x47, 0x01, 0x08, 0x46, 0x01, 0x0A, 0x44, 0x01,
+  0x0B, 0x43, 0x01, 0x0E, 0x40, 0x01, 0x10, 0x3E, 0x01, 0x0E, 0x40, 0x01,
+  0x0C, 0x42, 0x01, 0x0B, 0x43, 0x01, 0x09, 0x11, 0x01, 0x08, 0x0F, 0x01,
+  0x07, 0x0E, 0x01, 0x06, 0x0E, 0x01, 0x05, 0x0D, 0x01, 0x05, 0x0D, 0x01,
+  0x04, 0x0D, 0x01, 0x03, 0x0D, 0x01, 0x03, 0x0D, 0x01, 0x02, 0x0E, 0x01,
+  0x02, 0x0D, 0x01, 0x02, 0x0D, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0E, 0x01,
+  0x01, 0x0E, 0x01, 0x01, 0x0E, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x12, 0x01, 0x00, 0x13, 0x01, 0x00, 0x15, 0x01,
+  0x00, 0x16, 0x01, 0x01, 0x1B, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x4D, 0x01,
+  0x02, 0x4C, 0x01, 0x02, 0x4C, 0x01, 0x03, 0x4B, 0x01, 0x03, 0x4B, 0x01,
+  0x04, 0x4A, 0x01, 0x04, 0x4A, 0x01, 0x05, 0x49, 0x01, 0x06, 0x48, 0x01,
+  0x07, 0x47, 0x01, 0x08, 0x46, 0x01, 0x09, 0x45, 0x01, 0x0A, 0x44, 0x01,
+  0x0C, 0x42, 0x01, 0x0E, 0x40, 0x01, 0x12, 0x3C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x39, 0x02, 0x01, 0x39, 0x05, 0x02, 0x13, 0x08, 0x1E, 0x07,
+  0x02, 0x10, 0x0F, 0x19, 0x0A, 0x02, 0x0D, 0x14, 0x17, 0x0C, 0x02, 0x0C,
+  0x16, 0x16, 0x0D, 0x02, 0x0A, 0x1A, 0x14, 0x0E, 0x02, 0x09, 0x1C, 0x13,
+  0x0F, 0x02, 0x08, 0x1E, 0x11, 0x11, 0x02, 0x07, 0x1F, 0x11, 0x11, 0x02,
+  0x07, 0x20, 0x10, 0x12, 0x02, 0x06, 0x22, 0x0F, 0x13, 0x02, 0x05, 0x23,
+  0x0F, 0x13, 0x02, 0x05, 0x24, 0x0D, 0x15, 0x02, 0x04, 0x25, 0x0D, 0x15,
+  0x02, 0x04, 0x26, 0x0C, 0x16, 0x02, 0x03, 0x27, 0x0C, 0x16, 0x02, 0x03,
+  0x28, 0x0D, 0x15, 0x02, 0x02, 0x29, 0x0F, 0x13, 0x02, 0x02, 0x29, 0x11,
+  0x11, 0x03, 0x02, 0x11, 0x05, 0x14, 0x11, 0x11, 0x03, 0x01, 0x11, 0x08,
+  0x12, 0x12, 0x10, 0x03, 0x01, 0x10, 0x0A, 0x11, 0x12, 0x10, 0x03, 0x01,
+  0x0F, 0x0C, 0x10, 0x13, 0x0F, 0x03, 0x01, 0x0E, 0x0E, 0x10, 0x12, 0x0F,
+  0x03, 0x01, 0x0E, 0x0E, 0x10, 0x13, 0x0F, 0x03, 0x00, 0x0E, 0x10, 0x0F,
+  0x13, 0x0F, 0x03, 0x00, 0x0E, 0x10, 0x0F, 0x13, 0x0F, 0x03, 0x00, 0x0E,
+  0x10, 0x0F, 0x14, 0x0E, 0x03, 0x00, 0x0D, 0x12, 0x0F, 0x13, 0x0E, 0x03,
+  0x00, 0x0D, 0x12, 0x0F, 0x13, 0x0E, 0x03, 0x00, 0x0D, 0x12, 0x0F, 0x13,
+  0x0E, 0x03, 0x00, 0x0D, 0x12, 0x0F, 0x13, 0x0E, 0x03, 0x00, 0x0D, 0x12,
+  0x0F, 0x13, 0x0E, 0x03, 0x00, 0x0D, 0x13, 0x0F, 0x12, 0x0E, 0x03, 0x00,
+  0x0D, 0x13, 0x0F, 0x12, 0x0E, 0x03, 0x00, 0x0D, 0x13, 0x0F, 0x12, 0x0E,
+  0x03, 0x00, 0x0D, 0x13, 0x0F, 0x12, 0x0E, 0x03, 0x00, 0x0E, 0x12, 0x10,
+  0x10, 0x0F, 0x03, 0x00, 0x0E, 0x13, 0x0F, 0x10, 0x0F, 0x03, 0x00, 0x0E,
+  0x13, 0x0F, 0x10, 0x0E, 0x03, 0x01, 0x0E, 0x12, 0x10, 0x0E, 0x0F, 0x03,
+  0x01, 0x0E, 0x12, 0x10, 0x0E, 0x0F, 0x03, 0x01, 0x0F, 0x12, 0x10, 0x0C,
+  0x10, 0x03, 0x01, 0x10, 0x11, 0x10, 0x0C, 0x10, 0x03, 0x01, 0x11, 0x10,
+  0x11, 0x0A, 0x10, 0x03, 0x02, 0x12, 0x0E, 0x13, 0x06, 0x12, 0x02, 0x02,
+  0x14, 0x0C, 0x2B, 0x02, 0x02, 0x15, 0x0C, 0x29, 0x02, 0x03, 0x14, 0x0C,
+  0x29, 0x02, 0x03, 0x13, 0x0D, 0x29, 0x02, 0x04, 0x12, 0x0E, 0x27, 0x02,
+  0x04, 0x12, 0x0E, 0x27, 0x02, 0x05, 0x11, 0x0F, 0x25, 0x02, 0x06, 0x10,
+  0x0F, 0x25, 0x02, 0x07, 0x0E, 0x11, 0x23, 0x02, 0x07, 0x0E, 0x11, 0x22,
+  0x02, 0x08, 0x0D, 0x12, 0x20, 0x02, 0x09, 0x0C, 0x13, 0x1E, 0x02, 0x0B,
+  0x0A, 0x13, 0x1D, 0x02, 0x0C, 0x08, 0x15, 0x1B, 0x02, 0x0E, 0x06, 0x16,
+  0x19, 0x02, 0x10, 0x04, 0x18, 0x16, 0x02, 0x12, 0x02, 0x19, 0x13, 0x01,
+  0x30, 0x0E, 0x01, 0x34, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+
+const GFXglyph InterTempSemiBold72pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  93,    0,    0 },   // 0x20 ' '
+  {     1,   1,   1,  93,    0,    0 },   // 0x21 '!'
+  {     2,   1,   1,  93,    0,    0 },   // 0x22 '"'
+  {     3,   1,   1,  93,    0,    0 },   // 0x23 '#'
+  {     4,   1,   1,  93,    0,    0 },   // 0x24 '$'
+  {     5, 114, 105, 142,   14, -103 },   // 0x25 '%'
+  {   527,   1,   1,  93,    0,    0 },   // 0x26 '&'
+  {   528,   1,   1,  93,    0,    0 },   // 0x27 '''
+  {   529,   1,   1,  93,    0,    0 },   // 0x28 '('
+  {   530,   1,   1,  93,    0,    0 },   // 0x29 ')'
+  {   531,   1,   1,  93,    0,    0 },   // 0x2A '*'
+  {   532,   1,   1,  93,    0,    0 },   // 0x2B '+'
+  {   533,   1,   1,  93,    0,    0 },   // 0x2C ','
+  {   534,  46,  15,  66,   10,  -49 },   // 0x2D '-'
+  {   672,  23,  22,  45,   11,  -20 },   // 0x2E '.'
+  {   741,  49, 123,  53,    2, -107 },   // 0x2F '/'
+  {   888,  79, 105,  93,    7, -103 },   // 0x30 '0'
+  {  1207,  43, 103,  60,    6, -102 },   // 0x31 '1'
+  {  1336,  70, 104,  88,    9, -103 },   // 0x32 '2'
+  {  1734,  76, 105,  90,    7, -103 },   // 0x33 '3'
+  {  2164,  80, 103,  94,    7, -102 },   // 0x34 '4'
+  {  2466,  72, 104,  86,    7, -102 },   // 0x35 '5'
+  {  2880,  76, 105,  90,    7, -103 },   // 0x36 '6'
+  {  3298,  70, 103,  81,    6, -102 },   // 0x37 '7'
+  {  3594,  76, 105,  90,    7, -103 },   // 0x38 '8'
+  {  4030,  76, 105,  90,    7, -103 },   // 0x39 '9'
+  {  4448,  23,  75,  45,   11,  -73 },   // 0x3A ':'
+  {  4563,   1,   1,  93,    0,    0 },   // 0x3B ';'
+  {  4564,   1,   1,  93,    0,    0 },   // 0x3C '<'
+  {  4565,   1,   1,  93,    0,    0 },   // 0x3D '='
+  {  4566,   1,   1,  93,    0,    0 },   // 0x3E '>'
+  {  4567,   1,   1,  93,    0,    0 },   // 0x3F '?'
+  {  4568,   1,   1,  93,    0,    0 },   // 0x40 '@'
+  {  4569,   1,   1,  93,    0,    0 },   // 0x41 'A'
+  {  4570,   1,   1,  93,    0,    0 },   // 0x42 'B'
+  {  4571,  90, 105, 104,    7, -103 },   // 0x43 'C'
+  {  4983,   1,   1,  93,    0,    0 },   // 0x44 'D'
+  {  4984,   1,   1,  93,    0,    0 },   // 0x45 'E'
+  {  4985,   1,   1,  93,    0,    0 },   // 0x46 'F'
+  {  4986,   1,   1,  93,    0,    0 },   // 0x47 'G'
+  {  4987,   1,   1,  93,    0,    0 },   // 0x48 'H'
+  {  4988,   1,   1,  93,    0,    0 },   // 0x49 'I'
+  {  4989,   1,   1,  93,    0,    0 },   // 0x4A 'J'
+  {  4990,   1,   1,  93,    0,    0 },   // 0x4B 'K'
+  {  4991,   1,   1,  93,    0,    0 },   // 0x4C 'L'
+  {  4992,   1,   1,  93,    0,    0 },   // 0x4D 'M'
+  {  4993,   1,   1,  93,    0,    0 },   // 0x4E 'N'
+  {  4994,   1,   1,  93,    0,    0 },   // 0x4F 'O'
+  {  4995,   1,   1,  93,    0,    0 },   // 0x50 'P'
+  {  4996,   1,   1,  93,    0,    0 },   // 0x51 'Q'
+  {  4997,   1,   1,  93,    0,    0 },   // 0x52 'R'
+  {  4998,   1,   1,  93,    0,    0 },   // 0x53 'S'
+  {  4999,   1,   1,  93,    0,    0 },   // 0x54 'T'
+  {  5000,   1,   1,  93,    0,    0 },   // 0x55 'U'
+  {  5001,   1,   1,  93,    0,    0 },   // 0x56 'V'
+  {  5002,   1,   1,  93,    0,    0 },   // 0x57 'W'
+  {  5003,   1,   1,  93,    0,    0 },   // 0x58 'X'
+  {  5004,   1,   1,  93,    0,    0 },   // 0x59 'Y'
+  {  5005,   1,   1,  93,    0,    0 },   // 0x5A 'Z'
+  {  5006,   1,   1,  93,    0,    0 },   // 0x5B '['
+  {  5007,   1,   1,  93,    0,    0 },   // 0x5C '\'
+  {  5008,   1,   1,  93,    0,    0 },   // 0x5D ']'
+  {  5009,   1,   1,  93,    0,    0 },   // 0x5E '^'
+  {  5010,   1,   1,  93,    0,    0 },   // 0x5F '_'
+  {  5011,   1,   1,  93,    0,    0 },   // 0x60 '`'
+  {  5012,   1,   1,  93,    0,    0 },   // 0x61 'a'
+  {  5013,   1,   1,  93,    0,    0 },   // 0x62 'b'
+  {  5014,   1,   1,  93,    0,    0 },   // 0x63 'c'
+  {  5015,   1,   1,  93,    0,    0 },   // 0x64 'd'
+  {  5016,   1,   1,  93,    0,    0 },   // 0x65 'e'
+  {  5017,   1,   1,  93,    0,    0 },   // 0x66 'f'
+  {  5018,   1,   1,  93,    0,    0 },   // 0x67 'g'
+  {  5019,   1,   1,  93,    0,    0 },   // 0x68 'h'
+  {  5020,   1,   1,  93,    0,    0 },   // 0x69 'i'
+  {  5021,   1,   1,  93,    0,    0 },   // 0x6A 'j'
+  {  5022,   1,   1,  93,    0,    0 },   // 0x6B 'k'
+  {  5023,   1,   1,  93,    0,    0 },   // 0x6C 'l'
+  {  5024, 108,  78, 127,    9,  -77 },   // 0x6D 'm'
+  {  5348,   1,   1,  93,    0,    0 },   // 0x6E 'n'
+  {  5349,   1,   1,  93,    0,    0 },   // 0x6F 'o'
+  {  5350,   1,   1,  93,    0,    0 },   // 0x70 'p'
+  {  5351,   1,   1,  93,    0,    0 },   // 0x71 'q'
+  {  5352,   1,   1,  93,    0,    0 },   // 0x72 'r'
+  {  5353,  66,  79,  77,    6,  -77 },   // 0x73 's'
+  {  5729,   1,   1,  93,    0,    0 },   // 0x74 't'
+  {  5730,   1,   1,  93,    0,    0 },   // 0x75 'u'
+  {  5731,   1,   1,  93,    0,    0 },   // 0x76 'v'
+  {  5732,   1,   1,  93,    0,    0 },   // 0x77 'w'
+  {  5733,   1,   1,  93,    0,    0 },   // 0x78 'x'
+  {  5734,   1,   1,  93,    0,    0 },   // 0x79 'y'
+  {  5735,   1,   1,  93,    0,    0 },   // 0x7A 'z'
+  {  5736,   1,   1,  93,    0,    0 },   // 0x7B '{'
+  {  5737,   1,   1,  93,    0,    0 },   // 0x7C '|'
+  {  5738,   1,   1,  93,    0,    0 },   // 0x7D '}'
+  {  5739,   1,   1,  93,    0,    0 } }; // 0x7E '~'
+
+const GFXfont InterTempSemiBold72pt7b PROGMEM = {
+  (uint8_t  *)InterTempSemiBold72pt7bBitmaps,
+  (GFXglyph *)InterTempSemiBold72pt7bGlyphs,
+  0x20, 0x7E, 171, GFXFONT_ENC_RLE_COL, NULL, 0 };
+
+// Approx. 6413 bytes
@@ -1,3 +1,5 @@
+/* InterLabel14pt7b; codepoints past 0x7E through InterLabel14pt7bCmap, added by tools/gfxfont_add_glyphs.py. */
+
 const uint8_t InterLabel14pt7bBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x83, 0x8F, 0x1C, 0x1C, 0x60,
@@ -170,7 +172,142 @@ const uint8_t InterLabel14pt7bBitmaps[] PROGMEM = {
   0xDC, 0x03, 0x60, 0x0F, 0x80, 0x1E, 0x00, 0x70, 0x01, 0xC0, 0x06, 0x00,
   0x18, 0x00, 0xE0, 0x1F, 0x00, 0x78, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0x80,
   0xE0, 0x38, 0x06, 0x01, 0xC0, 0x70, 0x1C, 0x03, 0x80, 0xE0, 0x38, 0x0E,
-  0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+  0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x3C, 0x07,
+  0x80, 0xF0, 0x1E, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x83, 0xFE, 0x78,
+  0xF7, 0x03, 0x00, 0x30, 0x03, 0x07, 0xF3, 0xFF, 0x78, 0x3E, 0x03, 0xE0,
+  0x3E, 0x07, 0x70, 0xF7, 0xFB, 0x1F, 0x30, 0x20, 0x23, 0x83, 0x9E, 0x3C,
+  0x7B, 0xC1, 0xFC, 0x07, 0xC0, 0x1C, 0x00, 0x40, 0x00, 0x00, 0x7E, 0x07,
+  0xFC, 0x70, 0xF7, 0x03, 0xB0, 0x09, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00,
+  0x18, 0x00, 0xC0, 0x27, 0x03, 0x9C, 0x38, 0x7F, 0xC1, 0xF8, 0x00, 0x00,
+  0x70, 0x01, 0xC7, 0x00, 0x1C, 0x70, 0x01, 0xCE, 0x00, 0x1C, 0xE0, 0x01,
+  0xCE, 0x0F, 0x9D, 0xE1, 0xFD, 0xCC, 0x38, 0x7C, 0x07, 0x03, 0xC0, 0x60,
+  0x1C, 0x06, 0x01, 0xC0, 0xE0, 0x1C, 0x0E, 0x01, 0xC0, 0xE0, 0x1C, 0x06,
+  0x01, 0xC0, 0x60, 0x1C, 0x07, 0x03, 0xC0, 0x38, 0x7C, 0x01, 0xFD, 0xC0,
+  0x0F, 0x9C, 0x00, 0x00, 0xE0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x83, 0x87, 0x1C, 0x0E,
+  0x60, 0x19, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x80, 0x06, 0x00,
+  0x1C, 0x06, 0x3C, 0x78, 0x7F, 0xC0, 0xFC, 0x00, 0x38, 0x70, 0xF3, 0xC3,
+  0xFF, 0x07, 0xF8, 0x0F, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
+  0x7F, 0x83, 0x87, 0x1C, 0x0E, 0x60, 0x19, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x01, 0x80, 0x06, 0x00, 0x1C, 0x06, 0x3C, 0x78, 0x7F, 0xC0, 0xFC,
+  0x00, 0x0E, 0x3C, 0xF3, 0xCF, 0x1C, 0x00, 0x00, 0x70, 0xE1, 0xC3, 0x87,
+  0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x00, 0x70, 0xE7,
+  0x9E, 0x7F, 0xE3, 0xFC, 0x1F, 0x80, 0xF0, 0x00, 0x00, 0x00, 0xC7, 0x8D,
+  0xFE, 0xD8, 0xEE, 0x07, 0xE0, 0x7E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E,
+  0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x30, 0x00, 0xE0, 0x07,
+  0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xC0, 0x7F, 0xC3, 0x87, 0x9C, 0x0E, 0x60, 0x1D, 0x80, 0x7E, 0x00, 0xF8,
+  0x03, 0xE0, 0x0D, 0x80, 0x76, 0x01, 0xDC, 0x0E, 0x38, 0x78, 0x7F, 0xC0,
+  0xFC, 0x00, 0xE1, 0xFC, 0xFF, 0xFD, 0xFE, 0x3F, 0x07, 0x80, 0x00, 0x00,
+  0x67, 0x9B, 0xE7, 0x81, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C,
+  0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x00, 0x70, 0xE7, 0x9E, 0x7F, 0xE3,
+  0xFC, 0x1F, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x83, 0xFE, 0x78, 0xE7,
+  0x07, 0x60, 0x07, 0x00, 0x3E, 0x01, 0xFC, 0x03, 0xE0, 0x07, 0x00, 0x3E,
+  0x07, 0x70, 0xF3, 0xFE, 0x1F, 0x80, 0x00, 0x1C, 0x60, 0x71, 0x81, 0xC6,
+  0x0E, 0x18, 0x3B, 0xFC, 0xEF, 0xF7, 0x86, 0x0C, 0x18, 0x00, 0x60, 0x01,
+  0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00,
+  0x60, 0x01, 0xF0, 0x03, 0xC0, 0x01, 0xC0, 0x3C, 0x07, 0x80, 0xF0, 0x1E,
+  0x01, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0,
+  0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x7E, 0x07, 0x70,
+  0xF7, 0xFB, 0x1E, 0x30, 0x0F, 0x01, 0xF8, 0x19, 0x81, 0xF8, 0x0F, 0x00,
+  0x00, 0x00, 0x0E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E,
+  0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x07, 0xE0, 0x77, 0x0F, 0x7F, 0xB1,
+  0xE3, 0x00, 0xE0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0xE0, 0x1F, 0x80, 0x66, 0x03, 0x9C, 0x0C, 0x70, 0x70,
+  0xC1, 0xC3, 0x86, 0x06, 0x38, 0x18, 0xE0, 0x73, 0x00, 0xDC, 0x03, 0x60,
+  0x0F, 0x80, 0x1E, 0x00, 0x70, 0x01, 0xC0, 0x06, 0x00, 0x18, 0x00, 0xE0,
+  0x1F, 0x00, 0x78, 0x00, 0x40, 0x5C, 0x1F, 0xC7, 0xBD, 0xE3, 0xF8, 0x3E,
+  0x03, 0x80, 0x20, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x70, 0x1C, 0x07, 0x00,
+  0xC0, 0x38, 0x0E, 0x03, 0x80, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x3F, 0xFF,
+  0xFF, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+  0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xF8,
+  0x00, 0x6C, 0x00, 0x77, 0x00, 0x33, 0x80, 0x18, 0xC0, 0x1C, 0x70, 0x0C,
+  0x38, 0x0E, 0x0C, 0x07, 0x07, 0x03, 0x01, 0x83, 0xFF, 0xC1, 0xFF, 0xF0,
+  0xC0, 0x18, 0xE0, 0x0E, 0x70, 0x07, 0x30, 0x01, 0xB8, 0x00, 0xFC, 0x00,
+  0x70, 0x08, 0x08, 0x0E, 0x0E, 0x07, 0x8F, 0x01, 0xEF, 0x00, 0x7F, 0x00,
+  0x1F, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFF,
+  0x07, 0x83, 0xC7, 0x80, 0xE3, 0x80, 0x3B, 0x80, 0x0D, 0xC0, 0x01, 0xC0,
+  0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03,
+  0x80, 0x03, 0xC0, 0x06, 0x70, 0x07, 0x3C, 0x07, 0x0F, 0x07, 0x83, 0xFF,
+  0x00, 0x7F, 0x00, 0x1C, 0x38, 0x1E, 0x78, 0x1F, 0xF8, 0x0F, 0xF0, 0x07,
+  0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xE0,
+  0x7C, 0xE0, 0x1C, 0xE0, 0x0E, 0xE0, 0x06, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x06, 0xE0, 0x0E, 0xE0, 0x1C, 0xE0, 0x78, 0xFF, 0xF0, 0xFF, 0xC0, 0x00,
+  0xE0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C,
+  0x00, 0xE0, 0x07, 0xFF, 0xBF, 0xFD, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x07, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x20, 0x23, 0x83,
+  0x9E, 0x3C, 0x7B, 0xC1, 0xFC, 0x07, 0xC0, 0x1C, 0x00, 0x40, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0,
+  0x07, 0x00, 0x3F, 0xFD, 0xFF, 0xEE, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00,
+  0xE0, 0x07, 0x00, 0x38, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0x3C, 0xF3,
+  0xCF, 0x1C, 0x00, 0x00, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70,
+  0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x80, 0x1C, 0x38,
+  0x1E, 0x78, 0x1F, 0xF8, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x03,
+  0xEE, 0x03, 0xE7, 0x03, 0xE7, 0x03, 0xE3, 0x83, 0xE3, 0x83, 0xE1, 0xC3,
+  0xE0, 0xE3, 0xE0, 0xE3, 0xE0, 0x73, 0xE0, 0x3B, 0xE0, 0x3B, 0xE0, 0x1F,
+  0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x3C,
+  0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF0, 0x0F, 0xFC, 0x0F, 0x07, 0x8F, 0x01, 0xC7, 0x00, 0x77, 0x00, 0x1F,
+  0x80, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00,
+  0x3C, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x0E, 0xE0, 0x0E, 0x78, 0x0E, 0x1E,
+  0x0F, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x10, 0x10, 0x70, 0x70, 0xF1, 0xE0,
+  0xF7, 0x80, 0xFE, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x80, 0x00, 0x01, 0xFF,
+  0x83, 0xFF, 0xC7, 0x03, 0xCE, 0x01, 0xDC, 0x03, 0xB8, 0x07, 0x70, 0x0E,
+  0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0xE7, 0xFF, 0x8F, 0xFE, 0x1C, 0x1C, 0x38,
+  0x38, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0x73, 0x80, 0x67, 0x00, 0xEE, 0x00,
+  0xE0, 0x38, 0x70, 0xF3, 0xC3, 0xFF, 0x07, 0xF8, 0x0F, 0xC0, 0x1E, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xC7, 0x87, 0xB8, 0x06, 0xE0, 0x1F,
+  0x80, 0x0E, 0x00, 0x1C, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x3E,
+  0x00, 0x1C, 0x00, 0x70, 0x00, 0xF0, 0x07, 0xE0, 0x1D, 0xE1, 0xE3, 0xFF,
+  0x07, 0xF0, 0x10, 0x10, 0x70, 0x70, 0xF1, 0xE0, 0xF7, 0x80, 0xFE, 0x00,
+  0xF8, 0x00, 0xE0, 0x00, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x0C,
+  0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00,
+  0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01,
+  0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x70, 0x00,
+  0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0x60, 0x07, 0x70, 0x07, 0x70, 0x0E, 0x3C,
+  0x3C, 0x1F, 0xF8, 0x07, 0xE0, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60, 0x07,
+  0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x60,
+  0x07, 0x70, 0x07, 0x70, 0x0E, 0x3C, 0x3C, 0x1F, 0xF8, 0x07, 0xE0, 0x00,
+  0x38, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0xB8, 0x03, 0x9C, 0x03, 0x87, 0x01,
+  0xC3, 0x81, 0xC0, 0xE0, 0xE0, 0x38, 0xE0, 0x1C, 0xE0, 0x07, 0x70, 0x01,
+  0xF0, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00,
+  0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38,
+  0x70, 0xF3, 0xC3, 0xFF, 0x07, 0xF8, 0x0F, 0xC0, 0x1E, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0x80, 0x0C, 0x00, 0x70, 0x03, 0x80,
+  0x0C, 0x00, 0x70, 0x03, 0x80, 0x0C, 0x00, 0x70, 0x03, 0x80, 0x0C, 0x00,
+  0x70, 0x03, 0x80, 0x0C, 0x00, 0x70, 0x03, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
+  0x71, 0xC7, 0x1C, 0x71, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0xE7, 0x8F,
+  0x70, 0x30, 0x03, 0x00, 0x30, 0x7F, 0x3F, 0xF7, 0x83, 0xE0, 0x3E, 0x03,
+  0xE0, 0x77, 0x0F, 0x7F, 0xB1, 0xF3, 0x38, 0xE0, 0xE3, 0x83, 0x8E, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0x0E, 0x1E, 0x70, 0x39, 0x80, 0x76,
+  0x01, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x36, 0x01, 0xD8, 0x07, 0x70, 0x38,
+  0xE1, 0xE1, 0xFF, 0x03, 0xF0, 0x71, 0xC7, 0x1C, 0x71, 0xC0, 0x00, 0x00,
+  0x0E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0,
+  0x3E, 0x03, 0xE0, 0x3E, 0x07, 0xE0, 0x77, 0x0F, 0x7F, 0xB1, 0xE3, 0x1C,
+  0x70, 0x0E, 0x38, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
+  0x0F, 0x00, 0x07, 0xC0, 0x03, 0x60, 0x03, 0xB8, 0x01, 0x9C, 0x00, 0xC6,
+  0x00, 0xE3, 0x80, 0x61, 0xC0, 0x70, 0x60, 0x38, 0x38, 0x18, 0x0C, 0x1F,
+  0xFE, 0x0F, 0xFF, 0x86, 0x00, 0xC7, 0x00, 0x73, 0x80, 0x39, 0x80, 0x0D,
+  0xC0, 0x07, 0xE0, 0x03, 0x80, 0x0E, 0x38, 0x07, 0x1C, 0x03, 0x8E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0xE0, 0x78, 0x3C, 0x78, 0x0E,
+  0x38, 0x03, 0xB8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x77,
+  0x00, 0x73, 0xC0, 0x70, 0xF0, 0x78, 0x3F, 0xF0, 0x07, 0xE0, 0x00, 0x1C,
+  0x70, 0x1C, 0x70, 0x1C, 0x70, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0x60, 0x07, 0x70, 0x07, 0x70, 0x0E, 0x3C, 0x3C, 0x1F, 0xF8, 0x07,
+  0xE0,
+};
 
 const GFXglyph InterLabel14pt7bGlyphs[] PROGMEM = {
   {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
@@ -267,11 +404,86 @@ const GFXglyph InterLabel14pt7bGlyphs[] PROGMEM = {
   {  2056,   1,   1,  18,    0,    0 },   // 0x7B '{'
   {  2057,   1,   1,  18,    0,    0 },   // 0x7C '|'
   {  2058,   1,   1,  18,    0,    0 },   // 0x7D '}'
-  {  2059,   1,   1,  18,    0,    0 } }; // 0x7E '~'
+  {  2059,   1,   1,  18,    0,    0 },   // 0x7E '~'
+  {  2060,  12,  23,  15,    1,  -22 },   // U+00E1 'á'
+  {  2095,  13,  24,  16,    1,  -23 },   // U+010D 'č'
+  {  2134,  20,  21,  22,    1,  -20 },   // U+010F 'ď'
+  {  2187,  14,  23,  16,    1,  -22 },   // U+00E9 'é'
+  {  2228,  14,  23,  16,    1,  -22 },   // U+011B 'ě'
+  {  2269,   7,  23,   7,    1,  -22 },   // U+00ED 'í'
+  {  2290,  12,  23,  16,    2,  -22 },   // U+0148 'ň'
+  {  2325,  14,  23,  16,    1,  -22 },   // U+00F3 'ó'
+  {  2366,  10,  23,  10,    1,  -22 },   // U+0159 'ř'
+  {  2395,  12,  23,  14,    1,  -22 },   // U+0161 'š'
+  {  2430,  14,  20,  14,    0,  -19 },   // U+0165 'ť'
+  {  2465,  12,  23,  16,    2,  -22 },   // U+00FA 'ú'
+  {  2500,  12,  22,  16,    2,  -21 },   // U+016F 'ů'
+  {  2533,  14,  29,  15,    1,  -22 },   // U+00FD 'ý'
+  {  2584,  11,  24,  15,    2,  -23 },   // U+017E 'ž'
+  {  2617,  17,  28,  19,    1,  -27 },   // U+00C1 'Á'
+  {  2677,  17,  29,  20,    2,  -28 },   // U+010C 'Č'
+  {  2739,  16,  28,  20,    2,  -27 },   // U+010E 'Ď'
+  {  2795,  13,  28,  16,    2,  -27 },   // U+00C9 'É'
+  {  2841,  13,  29,  16,    2,  -28 },   // U+011A 'Ě'
+  {  2889,   7,  28,   7,    1,  -27 },   // U+00CD 'Í'
+  {  2914,  16,  28,  21,    2,  -27 },   // U+0147 'Ň'
+  {  2970,  17,  28,  21,    2,  -27 },   // U+00D3 'Ó'
+  {  3030,  15,  29,  18,    2,  -28 },   // U+0158 'Ř'
+  {  3085,  14,  28,  18,    2,  -27 },   // U+0160 'Š'
+  {  3134,  15,  29,  18,    1,  -28 },   // U+0164 'Ť'
+  {  3189,  16,  28,  20,    2,  -27 },   // U+00DA 'Ú'
+  {  3245,  16,  27,  20,    2,  -26 },   // U+016E 'Ů'
+  {  3299,  17,  28,  19,    1,  -27 },   // U+00DD 'Ý'
+  {  3359,  14,  28,  17,    2,  -27 },   // U+017D 'Ž'
+  {  3408,  12,  20,  15,    1,  -19 },   // U+00E4 'ä'
+  {  3438,  14,  20,  16,    1,  -19 },   // U+00F6 'ö'
+  {  3473,  12,  20,  16,    2,  -19 },   // U+00FC 'ü'
+  {  3503,  17,  25,  19,    1,  -24 },   // U+00C4 'Ä'
+  {  3557,  17,  25,  21,    2,  -24 },   // U+00D6 'Ö'
+  {  3611,  16,  25,  20,    2,  -24 } }; // U+00DC 'Ü'
+
+const GFXcmap InterLabel14pt7bCmap[] PROGMEM = {
+  { 0x00C1, 110 },  // U+00C1 'Á'
+  { 0x00C4, 128 },  // U+00C4 'Ä'
+  { 0x00C9, 113 },  // U+00C9 'É'
+  { 0x00CD, 115 },  // U+00CD 'Í'
+  { 0x00D3, 117 },  // U+00D3 'Ó'
+  { 0x00D6, 129 },  // U+00D6 'Ö'
+  { 0x00DA, 121 },  // U+00DA 'Ú'
+  { 0x00DC, 130 },  // U+00DC 'Ü'
+  { 0x00DD, 123 },  // U+00DD 'Ý'
+  { 0x00E1,  95 },  // U+00E1 'á'
+  { 0x00E4, 125 },  // U+00E4 'ä'
+  { 0x00E9,  98 },  // U+00E9 'é'
+  { 0x00ED, 100 },  // U+00ED 'í'
+  { 0x00F3, 102 },  // U+00F3 'ó'
+  { 0x00F6, 126 },  // U+00F6 'ö'
+  { 0x00FA, 106 },  // U+00FA 'ú'
+  { 0x00FC, 127 },  // U+00FC 'ü'
+  { 0x00FD, 108 },  // U+00FD 'ý'
+  { 0x010C, 111 },  // U+010C 'Č'
+  { 0x010D,  96 },  // U+010D 'č'
+  { 0x010E, 112 },  // U+010E 'Ď'
+  { 0x010F,  97 },  // U+010F 'ď'
+  { 0x011A, 114 },  // U+011A 'Ě'
+  { 0x011B,  99 },  // U+011B 'ě'
+  { 0x0147, 116 },  // U+0147 'Ň'
+  { 0x0148, 101 },  // U+0148 'ň'
+  { 0x0158, 118 },  // U+0158 'Ř'
+  { 0x0159, 103 },  // U+0159 'ř'
+  { 0x0160, 119 },  // U+0160 'Š'
+  { 0x0161, 104 },  // U+0161 'š'
+  { 0x0164, 120 },  // U+0164 'Ť'
+  { 0x0165, 105 },  // U+0165 'ť'
+  { 0x016E, 122 },  // U+016E 'Ů'
+  { 0x016F, 107 },  // U+016F 'ů'
+  { 0x017D, 124 },  // U+017D 'Ž'
+  { 0x017E, 109 },  // U+017E 'ž'
+};
 
 const GFXfont InterLabel14pt7b PROGMEM = {
   (uint8_t  *)InterLabel14pt7bBitmaps,
   (GFXglyph *)InterLabel14pt7bGlyphs,
-  0x20, 0x7E, 33 };
+  0x20, 0x7E, 33, GFXFONT_ENC_BITMAP, InterLabel14pt7bCmap, 36 };
 
-// Approx. 2732 bytes
+// Approx. 4736 bytes
@@ -0,0 +1,65 @@
+/* InterLabel14pt7b glyph advances as constexpr tables (compile-time text widths). */
+/* Generated by tools/gfxfont_to_metrics_header.py from InterLabel14.h. */
+#ifndef INTERLABEL14_METRICS_H
+#define INTERLABEL14_METRICS_H
+
+#include "gfxfont.h"
+
+constexpr uint8_t InterLabel14pt7bAdvance[] = {
+    8,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+   17,  11,  17,  17,  18,  16,  17,  16,  17,  17,   8,  18,  18,  18,  18,  18,
+   18,  19,  18,  20,  20,  16,  16,  20,  20,   7,  16,  18,  16,  25,  21,  21,
+   18,  21,  18,  18,  18,  20,  19,  27,  19,  19,  17,  18,  18,  18,  18,  18,
+   18,  15,  17,  16,  17,  16,  10,  17,  16,   7,   7,  15,   7,  24,  16,  16,
+   17,  17,  10,  14,   9,  16,  15,  22,  15,  15,  15,  18,  18,  18,  18,  15,
+   16,  22,  16,  16,   7,  16,  16,  10,  14,  14,  16,  16,  15,  15,  19,  20,
+   20,  16,  16,   7,  21,  21,  18,  18,  18,  20,  20,  19,  17,  15,  16,  16,
+   19,  21,  20,
+};
+
+constexpr GFXcmap InterLabel14pt7bMetricsCmap[] = {
+  { 0x00C1, 110 },
+  { 0x00C4, 128 },
+  { 0x00C9, 113 },
+  { 0x00CD, 115 },
+  { 0x00D3, 117 },
+  { 0x00D6, 129 },
+  { 0x00DA, 121 },
+  { 0x00DC, 130 },
+  { 0x00DD, 123 },
+  { 0x00E1,  95 },
+  { 0x00E4, 125 },
+  { 0x00E9,  98 },
+  { 0x00ED, 100 },
+  { 0x00F3, 102 },
+  { 0x00F6, 126 },
+  { 0x00FA, 106 },
+  { 0x00FC, 127 },
+  { 0x00FD, 108 },
+  { 0x010C, 111 },
+  { 0x010D,  96 },
+  { 0x010E, 112 },
+  { 0x010F,  97 },
+  { 0x011A, 114 },
+  { 0x011B,  99 },
+  { 0x0147, 116 },
+  { 0x0148, 101 },
+  { 0x0158, 118 },
+  { 0x0159, 103 },
+  { 0x0160, 119 },
+  { 0x0161, 104 },
+  { 0x0164, 120 },
+  { 0x0165, 105 },
+  { 0x016E, 122 },
+  { 0x016F, 107 },
+  { 0x017D, 124 },
+  { 0x017E, 109 },
+};
+
+constexpr GFXmetrics InterLabel14pt7bMetrics = {
+  InterLabel14pt7bAdvance,
+  InterLabel14pt7bAdvance + (0x30 - 0x20),
+  0x20, 0x7E,
+  InterLabel14pt7bMetricsCmap, 36 };
+
+#endif /* INTERLABEL14_METRICS_H */
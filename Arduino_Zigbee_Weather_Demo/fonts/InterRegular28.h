@@ -282,6 +282,6 @@ const GFXglyph InterTempRegular28pt7bGlyphs[] PROGMEM = {
 const GFXfont InterTempRegular28pt7b PROGMEM = {
   (uint8_t  *)InterTempRegular28pt7bBitmaps,
   (GFXglyph *)InterTempRegular28pt7bGlyphs,
-  0x20, 0x7E, 66 };
+  0x20, 0x7E, 66, GFXFONT_ENC_BITMAP, NULL, 0 };
 
 // Approx. 2848 bytes
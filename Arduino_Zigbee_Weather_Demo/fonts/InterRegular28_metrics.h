@@ -0,0 +1,22 @@
+/* InterTempRegular28pt7b glyph advances as constexpr tables (compile-time text widths). */
+/* Generated by tools/gfxfont_to_metrics_header.py from InterRegular28.h. */
+#ifndef INTERREGULAR28_METRICS_H
+#define INTERREGULAR28_METRICS_H
+
+#include "gfxfont.h"
+
+constexpr uint8_t InterTempRegular28pt7bAdvance[] = {
+   36,  36,  36,  36,  36,  54,  36,  36,  36,  36,  36,  36,  36,  25,  16,  20,
+   35,  22,  33,  34,  35,  33,  34,  31,  34,  34,  16,  36,  36,  36,  36,  36,
+   36,  36,  36,  40,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,
+   36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,
+   36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  48,  36,  36,
+   36,  36,  36,  29,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,
+};
+
+constexpr GFXmetrics InterTempRegular28pt7bMetrics = {
+  InterTempRegular28pt7bAdvance,
+  InterTempRegular28pt7bAdvance + (0x30 - 0x20),
+  0x20, 0x7E, nullptr, 0 };
+
+#endif /* INTERREGULAR28_METRICS_H */
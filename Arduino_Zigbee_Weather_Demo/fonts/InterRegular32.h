@@ -1,243 +1,245 @@
+/* InterTempRegular32pt7b; codepoints past 0x7E through InterTempRegular32pt7bCmap, added by tools/gfxfont_add_glyphs.py. */
+
 const uint8_t InterTempRegular32pt7bBitmaps[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 
-  0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x3F, 
-  0xFF, 0x00, 0x00, 0x1F, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x7C, 
-  0x0F, 0x80, 0x00, 0x3E, 0x00, 0xF8, 0x07, 0x80, 0x00, 0x7C, 0x00, 0xF8, 
-  0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF8, 
-  0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 
-  0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 
-  0x07, 0xC0, 0x0F, 0x80, 0x00, 0xF8, 0x07, 0xC0, 0x1F, 0x80, 0x00, 0x7C, 
-  0x0F, 0x80, 0x1F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x3E, 0x00, 0x00, 0x3F, 
-  0xFF, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x0F, 
-  0xFC, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00, 
-  0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 
-  0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x00, 
-  0x00, 0x1F, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xF8, 0x00, 
-  0x00, 0x7C, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x7C, 0x00, 
-  0x00, 0xF8, 0x03, 0xE0, 0x3E, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x3E, 0x00, 
-  0x01, 0xF0, 0x03, 0xE0, 0x1E, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x1E, 0x00, 
-  0x07, 0xC0, 0x03, 0xC0, 0x1E, 0x00, 0x0F, 0xC0, 0x03, 0xC0, 0x1E, 0x00, 
-  0x0F, 0x80, 0x03, 0xC0, 0x1E, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x1E, 0x00, 
-  0x3F, 0x00, 0x03, 0xC0, 0x1E, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x3E, 0x00, 
-  0x7C, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x7E, 0x00, 
-  0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x03, 
-  0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFF, 
-  0x1F, 0xFC, 0xFF, 0xEF, 0x8F, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF8, 0xFB, 
-  0xFF, 0x9F, 0xFC, 0x7F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x08, 0x7E, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x1F, 
-  0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x07, 
-  0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 
-  0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 
-  0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 
-  0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 
-  0x00, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xF0, 
-  0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 
-  0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 
-  0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x01, 
-  0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 
-  0x3E, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 
-  0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0xFF, 
-  0xE0, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x07, 0xF0, 0x1F, 0x80, 0x03, 
-  0xF8, 0x3F, 0x80, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 
-  0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x7E, 0x7C, 0x00, 0x00, 
-  0x7E, 0xFC, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 
-  0x3E, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
-  0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
-  0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 
-  0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 
-  0x3E, 0xFC, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 
-  0x7E, 0x7C, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 
-  0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x01, 
-  0xF8, 0x1F, 0x80, 0x03, 0xF8, 0x1F, 0xC0, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 
-  0xE0, 0x07, 0xFE, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 
-  0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0x80, 
-  0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0xFF, 0xF0, 0xFF, 0xF8, 
-  0xFF, 0xFC, 0xFF, 0x7F, 0xFF, 0x3F, 0xFF, 0x1F, 0xFE, 0x0F, 0xFE, 0x07, 
-  0xFE, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 
-  0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 
-  0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 
-  0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 
-  0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 
-  0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 
-  0xF8, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF, 
-  0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 
-  0xC0, 0xFE, 0x00, 0xFF, 0x0F, 0xE0, 0x01, 0xFC, 0x7E, 0x00, 0x07, 0xE3, 
-  0xE0, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07, 0xEF, 0xC0, 
-  0x00, 0x3F, 0x7C, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 
-  0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF8, 
-  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 
-  0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 
-  0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 
-  0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 
-  0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF8, 
-  0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 
-  0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 
-  0xFC, 0x01, 0xFF, 0x9F, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x1F, 0xC0, 0x03, 
-  0xF8, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x07, 
-  0xE3, 0xF0, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 
-  0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 
-  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 
-  0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 
-  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 
-  0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 
-  0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
-  0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 
-  0x3F, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x1F, 
-  0xF0, 0x7F, 0xF3, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 
-  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x00, 
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 
-  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 
-  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xF7, 
-  0xE0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0xFC, 
-  0xFC, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x7E, 
-  0x1F, 0x80, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x3F, 
-  0x03, 0xF0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x1F, 
-  0x80, 0x7E, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x0F, 
-  0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xF0, 0x07, 
-  0xE0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x7E, 0x03, 
-  0xF0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x0F, 0xC0, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 
-  0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 
-  0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 
-  0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 
-  0xC1, 0xFF, 0xFF, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 
-  0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 
-  0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x1F, 0xE0, 0x03, 
-  0xF3, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 
-  0xFF, 0xF8, 0x3F, 0xE0, 0x3F, 0xE1, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x01, 
-  0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 
-  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00, 
-  0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 
-  0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 
-  0xFF, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0x3F, 
-  0xC0, 0x1F, 0xE0, 0xFF, 0xCF, 0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 
-  0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x08, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 
-  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xCF, 0xFE, 
-  0x01, 0xFC, 0x01, 0xFC, 0x07, 0xE0, 0x01, 0xFC, 0x1F, 0x80, 0x01, 0xFC, 
-  0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x03, 0xF1, 0xF0, 0x00, 0x03, 0xF3, 
-  0xE0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 
-  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xF0, 0x03, 0xE0, 
-  0x7F, 0xF8, 0x07, 0xC3, 0xFF, 0xFC, 0x0F, 0x8F, 0xFF, 0xFC, 0x1F, 0x3F, 
-  0xFF, 0xFC, 0x3E, 0xFE, 0x07, 0xFC, 0x7F, 0xF0, 0x03, 0xFC, 0xFF, 0x80, 
-  0x03, 0xF9, 0xFF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x03, 0xF7, 0xF0, 0x00, 
-  0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 
-  0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 
-  0xFD, 0xF0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x07, 
-  0xE7, 0xC0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0xFC, 
-  0x1F, 0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x1F, 0xE0, 0x3F, 0xFB, 0xFF, 0x80, 
-  0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 
-  0x0F, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 
-  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 
-  0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 
-  0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 
-  0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 
-  0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 
-  0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 
-  0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 
-  0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 
-  0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 
-  0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 
-  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 
-  0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 
-  0xFC, 0x01, 0xFF, 0x9F, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x0F, 0xC0, 0x03, 
-  0xF8, 0x3F, 0x00, 0x03, 0xF8, 0x7E, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x07, 
-  0xE3, 0xF0, 0x00, 0x07, 0xC7, 0xE0, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x1F, 
-  0x1F, 0x80, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 
-  0x7E, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x7F, 0x00, 
-  0xFF, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 
-  0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 
-  0xC0, 0x7F, 0xC1, 0xFC, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 
-  0x00, 0x3F, 0xBF, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0xFC, 0x00, 
-  0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 
-  0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 
-  0x3F, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x0F, 
-  0xF0, 0x7F, 0xFB, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 
-  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x00, 
-  0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 
-  0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xDF, 0xF8, 0x07, 
-  0xF8, 0x07, 0xF8, 0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00, 0x03, 0xF0, 0xFC, 
-  0x00, 0x03, 0xF1, 0xF8, 0x00, 0x07, 0xE7, 0xE0, 0x00, 0x07, 0xEF, 0xC0, 
-  0x00, 0x0F, 0xDF, 0x80, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x1F, 0x7C, 0x00, 
-  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 
-  0x3F, 0xDF, 0xC0, 0x00, 0xFF, 0x9F, 0xC0, 0x03, 0xFF, 0x3F, 0xC0, 0x0F, 
-  0xFE, 0x3F, 0xE0, 0x7F, 0x7C, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xF1, 
-  0xF0, 0x3F, 0xFF, 0xC3, 0xE0, 0x1F, 0xFE, 0x0F, 0xC0, 0x0F, 0xF0, 0x1F, 
-  0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 
-  0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x07, 0xCF, 0xC0, 0x00, 0x1F, 0x8F, 
-  0xC0, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x80, 0x03, 0xF0, 0x3F, 
-  0x80, 0x0F, 0xE0, 0x7F, 0x80, 0x3F, 0x80, 0x7F, 0xF7, 0xFE, 0x00, 0x7F, 
-  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 
-  0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7E, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 
-  0x07, 0xFF, 0x9F, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x01, 0xFE, 0x00, 
-  0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x0F, 0xC1, 
-  0xF8, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 
-  0x00, 0xFD, 0xF8, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x00, 0x0F, 0xDF, 
-  0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 
-  0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 
-  0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 
-  0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 
-  0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 
-  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
-  0x01, 0xF8, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 
-  0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x0F, 
-  0xE1, 0xFC, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x07, 0xF8, 
-  0x00, 0x1F, 0xE0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x1F, 0xFE, 0x7F, 0xF8, 
-  0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xFC, 0x07, 0xC1, 
-  0xFF, 0x80, 0x7F, 0xF8, 0x3E, 0x3F, 0xFE, 0x07, 0xFF, 0xE1, 0xF3, 0xFF, 
-  0xF8, 0x7F, 0xFF, 0x8F, 0x9F, 0xFF, 0xC7, 0xFF, 0xFE, 0x7D, 0xE0, 0x7F, 
-  0x7E, 0x0F, 0xFB, 0xFC, 0x01, 0xFB, 0xC0, 0x1F, 0xDF, 0xC0, 0x07, 0xFC, 
-  0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 
-  0x0F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x00, 0x01, 
-  0xFF, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 
-  0xE0, 0x00, 0x3E, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xF8, 
-  0x00, 0x0F, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00, 
-  0x03, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0x80, 0x00, 
-  0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x3E, 
-  0x00, 0x03, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0x80, 
-  0x00, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xE0, 0x00, 
-  0x3F, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x0F, 
-  0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xFF, 
-  0x00, 0x01, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xC0, 
-  0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF0, 0x3F, 0xC0, 0xFF, 0x0F, 
-  0xE0, 0x07, 0xE1, 0xF8, 0x00, 0x7E, 0x7E, 0x00, 0x07, 0xCF, 0xC0, 0x00, 
-  0xC1, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 
-  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 
-  0x00, 0x7F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 
-  0x1F, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 
-  0x00, 0x00, 0x07, 0xE1, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xBF, 0x00, 
-  0x03, 0xF7, 0xE0, 0x00, 0xFC, 0xFF, 0x00, 0x7F, 0x8F, 0xFE, 0xFF, 0xE0, 
-  0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 
-  0xC0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x3F,
+  0xFF, 0x00, 0x00, 0x1F, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x7C,
+  0x0F, 0x80, 0x00, 0x3E, 0x00, 0xF8, 0x07, 0x80, 0x00, 0x7C, 0x00, 0xF8,
+  0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF8,
+  0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF8,
+  0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0xF8,
+  0x07, 0xC0, 0x0F, 0x80, 0x00, 0xF8, 0x07, 0xC0, 0x1F, 0x80, 0x00, 0x7C,
+  0x0F, 0x80, 0x1F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x3E, 0x00, 0x00, 0x3F,
+  0xFF, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x0F,
+  0xFC, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x00,
+  0x00, 0x1F, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xF8, 0x00,
+  0x00, 0x7C, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x7C, 0x00,
+  0x00, 0xF8, 0x03, 0xE0, 0x3E, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x3E, 0x00,
+  0x01, 0xF0, 0x03, 0xE0, 0x1E, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x1E, 0x00,
+  0x07, 0xC0, 0x03, 0xC0, 0x1E, 0x00, 0x0F, 0xC0, 0x03, 0xC0, 0x1E, 0x00,
+  0x0F, 0x80, 0x03, 0xC0, 0x1E, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x1E, 0x00,
+  0x3F, 0x00, 0x03, 0xC0, 0x1E, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x3E, 0x00,
+  0x7C, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x7E, 0x00,
+  0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x03,
+  0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFF,
+  0x1F, 0xFC, 0xFF, 0xEF, 0x8F, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF8, 0xFB,
+  0xFF, 0x9F, 0xFC, 0x7F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x08, 0x7E,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x1F,
+  0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x07,
+  0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00,
+  0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00,
+  0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00,
+  0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x00, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xF0,
+  0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E,
+  0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F,
+  0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x01,
+  0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00,
+  0x3E, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFE,
+  0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0xFF,
+  0xE0, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x07, 0xF0, 0x1F, 0x80, 0x03,
+  0xF8, 0x3F, 0x80, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00,
+  0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x7E, 0x7C, 0x00, 0x00,
+  0x7E, 0xFC, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00,
+  0x3E, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+  0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+  0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+  0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
+  0x3E, 0xFC, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00,
+  0x7E, 0x7C, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00,
+  0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x01,
+  0xF8, 0x1F, 0x80, 0x03, 0xF8, 0x1F, 0xC0, 0x07, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xE0, 0x07, 0xFE, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
+  0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0x80,
+  0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0xFF, 0xF0, 0xFF, 0xF8,
+  0xFF, 0xFC, 0xFF, 0x7F, 0xFF, 0x3F, 0xFF, 0x1F, 0xFE, 0x0F, 0xFE, 0x07,
+  0xFE, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00,
+  0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC,
+  0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03,
+  0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80,
+  0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
+  0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01,
+  0xF8, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF,
+  0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF,
+  0xC0, 0xFE, 0x00, 0xFF, 0x0F, 0xE0, 0x01, 0xFC, 0x7E, 0x00, 0x07, 0xE3,
+  0xE0, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07, 0xEF, 0xC0,
+  0x00, 0x3F, 0x7C, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF8,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
+  0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+  0xFC, 0x01, 0xFF, 0x9F, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x1F, 0xC0, 0x03,
+  0xF8, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x07,
+  0xE3, 0xF0, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8,
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00,
+  0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+  0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+  0x3F, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x1F,
+  0xF0, 0x7F, 0xF3, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xF7,
+  0xE0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0xFC,
+  0xFC, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x7E,
+  0x1F, 0x80, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x3F,
+  0x03, 0xF0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x1F,
+  0x80, 0x7E, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x0F,
+  0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xF0, 0x07,
+  0xE0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x7E, 0x03,
+  0xF0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x0F, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
+  0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFF,
+  0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
+  0xC1, 0xFF, 0xFF, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
+  0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x1F, 0xE0, 0x03,
+  0xF3, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
+  0xFF, 0xF8, 0x3F, 0xE0, 0x3F, 0xE1, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F,
+  0xFF, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0x3F,
+  0xC0, 0x1F, 0xE0, 0xFF, 0xCF, 0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+  0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xFC,
+  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xCF, 0xFE,
+  0x01, 0xFC, 0x01, 0xFC, 0x07, 0xE0, 0x01, 0xFC, 0x1F, 0x80, 0x01, 0xFC,
+  0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x03, 0xF1, 0xF0, 0x00, 0x03, 0xF3,
+  0xE0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xF0, 0x03, 0xE0,
+  0x7F, 0xF8, 0x07, 0xC3, 0xFF, 0xFC, 0x0F, 0x8F, 0xFF, 0xFC, 0x1F, 0x3F,
+  0xFF, 0xFC, 0x3E, 0xFE, 0x07, 0xFC, 0x7F, 0xF0, 0x03, 0xFC, 0xFF, 0x80,
+  0x03, 0xF9, 0xFF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x03, 0xF7, 0xF0, 0x00,
+  0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+  0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
+  0xFD, 0xF0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x07,
+  0xE7, 0xC0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0xFC,
+  0x1F, 0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x1F, 0xE0, 0x3F, 0xFB, 0xFF, 0x80,
+  0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
+  0x0F, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00,
+  0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
+  0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
+  0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
+  0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF,
+  0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+  0xFC, 0x01, 0xFF, 0x9F, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x0F, 0xC0, 0x03,
+  0xF8, 0x3F, 0x00, 0x03, 0xF8, 0x7E, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x07,
+  0xE3, 0xF0, 0x00, 0x07, 0xC7, 0xE0, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x1F,
+  0x1F, 0x80, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8,
+  0x7E, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x7F, 0x00,
+  0xFF, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
+  0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xC1, 0xFC, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x3F, 0x8F, 0xC0,
+  0x00, 0x3F, 0xBF, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+  0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+  0x3F, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x0F,
+  0xF0, 0x7F, 0xFB, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00,
+  0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xDF, 0xF8, 0x07,
+  0xF8, 0x07, 0xF8, 0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00, 0x03, 0xF0, 0xFC,
+  0x00, 0x03, 0xF1, 0xF8, 0x00, 0x07, 0xE7, 0xE0, 0x00, 0x07, 0xEF, 0xC0,
+  0x00, 0x0F, 0xDF, 0x80, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x1F, 0x7C, 0x00,
+  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xEF, 0xC0, 0x00,
+  0x3F, 0xDF, 0xC0, 0x00, 0xFF, 0x9F, 0xC0, 0x03, 0xFF, 0x3F, 0xC0, 0x0F,
+  0xFE, 0x3F, 0xE0, 0x7F, 0x7C, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xF1,
+  0xF0, 0x3F, 0xFF, 0xC3, 0xE0, 0x1F, 0xFE, 0x0F, 0xC0, 0x0F, 0xF0, 0x1F,
+  0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x07, 0xCF, 0xC0, 0x00, 0x1F, 0x8F,
+  0xC0, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x80, 0x03, 0xF0, 0x3F,
+  0x80, 0x0F, 0xE0, 0x7F, 0x80, 0x3F, 0x80, 0x7F, 0xF7, 0xFE, 0x00, 0x7F,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F,
+  0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x7E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7E, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x7E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+  0x07, 0xFF, 0x9F, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x01, 0xFE, 0x00,
+  0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x0F, 0xC1,
+  0xF8, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
+  0x00, 0xFD, 0xF8, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x00, 0x0F, 0xDF,
+  0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0,
+  0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
+  0x01, 0xF8, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
+  0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x0F,
+  0xE1, 0xFC, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x07, 0xF8,
+  0x00, 0x1F, 0xE0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x1F, 0xFE, 0x7F, 0xF8,
+  0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
+  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xFC, 0x07, 0xC1,
+  0xFF, 0x80, 0x7F, 0xF8, 0x3E, 0x3F, 0xFE, 0x07, 0xFF, 0xE1, 0xF3, 0xFF,
+  0xF8, 0x7F, 0xFF, 0x8F, 0x9F, 0xFF, 0xC7, 0xFF, 0xFE, 0x7D, 0xE0, 0x7F,
+  0x7E, 0x0F, 0xFB, 0xFC, 0x01, 0xFB, 0xC0, 0x1F, 0xDF, 0xC0, 0x07, 0xFC,
+  0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x00, 0x01,
+  0xFF, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7F,
+  0xE0, 0x00, 0x3E, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xF8,
+  0x00, 0x0F, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00,
+  0x03, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0x80, 0x00,
+  0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x3E,
+  0x00, 0x03, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0x80,
+  0x00, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xE0, 0x00,
+  0x3F, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x0F,
+  0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xFF,
+  0x00, 0x01, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xC0,
+  0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF,
+  0xF0, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF0, 0x3F, 0xC0, 0xFF, 0x0F,
+  0xE0, 0x07, 0xE1, 0xF8, 0x00, 0x7E, 0x7E, 0x00, 0x07, 0xCF, 0xC0, 0x00,
+  0xC1, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF0,
+  0x00, 0x7F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x07, 0xE1, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xBF, 0x00,
+  0x03, 0xF7, 0xE0, 0x00, 0xFC, 0xFF, 0x00, 0x7F, 0x8F, 0xFE, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
+  0xC0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
 };
 
 const GFXglyph InterTempRegular32pt7bGlyphs[] PROGMEM = {
@@ -335,11 +337,15 @@ const GFXglyph InterTempRegular32pt7bGlyphs[] PROGMEM = {
   {  2856,   1,   1,  41,    0,    0 },   // 0x7B '{'
   {  2857,   1,   1,  41,    0,    0 },   // 0x7C '|'
   {  2858,   1,   1,  41,    0,    0 },   // 0x7D '}'
-  {  2859,   1,   1,  41,    0,    0 }    // 0x7E '~'
+  {  2859,   1,   1,  41,    0,    0 } }; // 0x7E '~'
+
+const GFXcmap InterTempRegular32pt7bCmap[] PROGMEM = {
+  { 0x00B0,  10 },  // U+00B0 '°'
 };
 
 const GFXfont InterTempRegular32pt7b PROGMEM = {
-  (uint8_t  *)InterTempRegular32pt7bBitmaps, 
-  (GFXglyph *)InterTempRegular32pt7bGlyphs, 0x20, 0x7E,  76 };
+  (uint8_t  *)InterTempRegular32pt7bBitmaps,
+  (GFXglyph *)InterTempRegular32pt7bGlyphs,
+  0x20, 0x7E, 76, GFXFONT_ENC_BITMAP, InterTempRegular32pt7bCmap, 1 };
 
-// Approx. 3511 bytes
+// Approx. 3543 bytes
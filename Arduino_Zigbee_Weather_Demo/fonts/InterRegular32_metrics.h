@@ -0,0 +1,27 @@
+/* InterTempRegular32pt7b glyph advances as constexpr tables (compile-time text widths). */
+/* Generated by tools/gfxfont_to_metrics_header.py from InterRegular32.h. */
+#ifndef INTERREGULAR32_METRICS_H
+#define INTERREGULAR32_METRICS_H
+
+#include "gfxfont.h"
+
+constexpr uint8_t InterTempRegular32pt7bAdvance[] = {
+   41,  41,  41,  41,  41,  62,  41,  40,  41,  41,  18,  41,  41,  29,  18,  23,
+   40,  25,  38,  39,  40,  37,  39,  35,  39,  39,  18,  41,  41,  41,  41,  41,
+   41,  41,  41,  46,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,
+   41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,
+   41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  55,  41,  41,
+   41,  41,  41,  33,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,  41,
+};
+
+constexpr GFXcmap InterTempRegular32pt7bMetricsCmap[] = {
+  { 0x00B0,  10 },
+};
+
+constexpr GFXmetrics InterTempRegular32pt7bMetrics = {
+  InterTempRegular32pt7bAdvance,
+  InterTempRegular32pt7bAdvance + (0x30 - 0x20),
+  0x20, 0x7E,
+  InterTempRegular32pt7bMetricsCmap, 1 };
+
+#endif /* INTERREGULAR32_METRICS_H */
@@ -1,4 +1,6 @@
-const uint8_t SourceSansLabel22pt7bBitmaps[] = {
+/* SourceSansLabel22pt7b; codepoints past 0x7E through SourceSansLabel22pt7bCmap, added by tools/gfxfont_add_glyphs.py. */
+
+const uint8_t SourceSansLabel22pt7bBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
@@ -166,7 +168,153 @@ const uint8_t SourceSansLabel22pt7bBitmaps[] = {
   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0D, 0xC0, 0x00,
+  0x3B, 0x80, 0x00, 0x77, 0x80, 0x00, 0xE7, 0x00, 0x03, 0x8E, 0x00, 0x07,
+  0x1E, 0x00, 0x0E, 0x1C, 0x00, 0x38, 0x38, 0x00, 0x70, 0x78, 0x00, 0xE0,
+  0xF0, 0x03, 0xC0, 0xE0, 0x07, 0x01, 0xE0, 0x0E, 0x03, 0xC0, 0x3C, 0x03,
+  0x80, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x07, 0x00, 0x1E,
+  0x0E, 0x00, 0x3C, 0x3C, 0x00, 0x38, 0x70, 0x00, 0x78, 0xE0, 0x00, 0xF3,
+  0xC0, 0x01, 0xE7, 0x80, 0x01, 0xCE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0x80,
+  0x0E, 0x03, 0x80, 0x70, 0x1C, 0x03, 0xC1, 0xE0, 0x0F, 0x1E, 0x00, 0x3D,
+  0xE0, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xFE, 0x03, 0xFF,
+  0xFC, 0x3E, 0x01, 0xC3, 0xE0, 0x04, 0x3E, 0x00, 0x01, 0xE0, 0x00, 0x1E,
+  0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00,
+  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0,
+  0x00, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x04, 0x3E, 0x00, 0x60, 0xF8,
+  0x07, 0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x08, 0x00,
+  0x08, 0x01, 0x01, 0xC0, 0x38, 0x1E, 0x07, 0x80, 0xF0, 0xF0, 0x07, 0x9E,
+  0x00, 0x3F, 0xC0, 0x01, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xE0,
+  0x3F, 0x8E, 0x00, 0xFC, 0xE0, 0x03, 0xCE, 0x00, 0x3E, 0xE0, 0x01, 0xEE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x00,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0E, 0xE0, 0x01, 0xEE, 0x00,
+  0x3E, 0xE0, 0x03, 0xCE, 0x00, 0xF8, 0xE0, 0x3F, 0x8F, 0xFF, 0xE0, 0xFF,
+  0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+  0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xF7, 0x00, 0x03, 0x80, 0x01,
+  0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
+  0x07, 0x00, 0x03, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xFC, 0x70, 0x00, 0x38,
+  0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,
+  0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x38, 0x0E, 0x1C, 0x07, 0x0F, 0x07, 0x83, 0xC7, 0x80,
+  0xF7, 0x80, 0x3F, 0x80, 0x0F, 0x80, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00,
+  0x3F, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xF7, 0x00, 0x03, 0x80, 0x01, 0xC0,
+  0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07,
+  0x00, 0x03, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xFC, 0x70, 0x00, 0x38, 0x00,
+  0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x03, 0x83, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC1, 0xC0, 0x00,
+  0x00, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0,
+  0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x08, 0x01,
+  0x01, 0xC0, 0x38, 0x1E, 0x07, 0x80, 0xF0, 0xF0, 0x07, 0x9E, 0x00, 0x3F,
+  0xC0, 0x01, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x7F,
+  0xC0, 0x07, 0xFE, 0x00, 0x7E, 0xE0, 0x07, 0xEF, 0x00, 0x7E, 0x78, 0x07,
+  0xE7, 0x80, 0x7E, 0x3C, 0x07, 0xE3, 0xC0, 0x7E, 0x1E, 0x07, 0xE1, 0xE0,
+  0x7E, 0x0F, 0x07, 0xE0, 0x70, 0x7E, 0x07, 0x87, 0xE0, 0x3C, 0x7E, 0x03,
+  0xC7, 0xE0, 0x1E, 0x7E, 0x01, 0xE7, 0xE0, 0x0F, 0x7E, 0x00, 0xF7, 0xE0,
+  0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFE,
+  0x00, 0x0F, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
+  0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x0F, 0xF7, 0xF0, 0x0F, 0x00, 0xF8, 0x1E,
+  0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x78,
+  0x00, 0x0F, 0x70, 0x00, 0x0F, 0x70, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0,
+  0x00, 0x07, 0xF0, 0x00, 0x0F, 0x70, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0x78,
+  0x00, 0x0F, 0x78, 0x00, 0x1E, 0x3C, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x1E,
+  0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xF7, 0xF0, 0x03, 0xFF, 0xE0, 0x01,
+  0xFF, 0x80, 0x00, 0x08, 0x00, 0x1C, 0x07, 0x03, 0x80, 0xE0, 0x78, 0x3C,
+  0x07, 0x8F, 0x00, 0x7B, 0xC0, 0x07, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xFF, 0x0F, 0xFF, 0xF9,
+  0xC0, 0x1F, 0x38, 0x00, 0xF7, 0x00, 0x1E, 0xE0, 0x01, 0xDC, 0x00, 0x3F,
+  0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1D, 0xC0, 0x07, 0xB8, 0x01, 0xF7,
+  0x00, 0x7C, 0xFF, 0xFF, 0x1F, 0xFF, 0xC3, 0xFF, 0xC0, 0x70, 0x3C, 0x0E,
+  0x07, 0x81, 0xC0, 0x78, 0x38, 0x07, 0x87, 0x00, 0xF0, 0xE0, 0x0F, 0x1C,
+  0x01, 0xE3, 0x80, 0x1E, 0x70, 0x03, 0xCE, 0x00, 0x3D, 0xC0, 0x03, 0xF8,
+  0x00, 0x78, 0x1C, 0x07, 0x03, 0x80, 0xE0, 0x78, 0x3C, 0x07, 0x8F, 0x00,
+  0x7B, 0xC0, 0x07, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0xF8, 0x3F, 0x3F, 0x8F,
+  0x00, 0xF1, 0xC0, 0x04, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C,
+  0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x07,
+  0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00,
+  0x07, 0xC0, 0x00, 0x78, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0x00,
+  0x07, 0xB8, 0x00, 0xFF, 0x80, 0x3C, 0xFF, 0x7F, 0x0F, 0xFF, 0xC0, 0x7F,
+  0xF0, 0x00, 0x40, 0x00, 0x0E, 0x03, 0x80, 0x70, 0x1C, 0x03, 0xC1, 0xE0,
+  0x0F, 0x1E, 0x00, 0x3D, 0xE0, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x0E,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70,
+  0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00,
+  0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80,
+  0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01,
+  0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00,
+  0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00,
+  0x0F, 0x00, 0x01, 0xE0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00,
+  0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00,
+  0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0,
+  0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xE7, 0x80, 0x1E,
+  0x78, 0x01, 0xE3, 0xC0, 0x3C, 0x3F, 0xBF, 0x81, 0xFF, 0xF0, 0x07, 0xFE,
+  0x00, 0x06, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0x0C, 0x00, 0x30,
+  0xC0, 0x03, 0x0C, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E,
+  0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07,
+  0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00,
+  0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00,
+  0x07, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0E, 0x78,
+  0x01, 0xE7, 0x80, 0x1E, 0x3C, 0x03, 0xC3, 0xFB, 0xF8, 0x1F, 0xFF, 0x00,
+  0x7F, 0xE0, 0x00, 0x60, 0x00, 0x00, 0x07, 0x00, 0x00, 0x78, 0x00, 0x07,
+  0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x1E, 0xE0, 0x01,
+  0xE7, 0x80, 0x0E, 0x1C, 0x00, 0xF0, 0xF0, 0x07, 0x03, 0x80, 0x78, 0x1E,
+  0x03, 0x80, 0x70, 0x3C, 0x03, 0xC1, 0xE0, 0x1E, 0x0E, 0x00, 0x70, 0xF0,
+  0x03, 0xC7, 0x00, 0x0E, 0x78, 0x00, 0x7B, 0x80, 0x01, 0xFC, 0x00, 0x0F,
+  0xC0, 0x00, 0x3E, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00,
+  0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00,
+  0x1C, 0x07, 0x03, 0x80, 0xE0, 0x78, 0x3C, 0x07, 0x8F, 0x00, 0x7B, 0xC0,
+  0x07, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xF7, 0xFF, 0xFE, 0x00, 0x07, 0x80, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x3C,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0x83, 0x80,
+  0x07, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x6E, 0x00, 0x01,
+  0xDC, 0x00, 0x03, 0xBC, 0x00, 0x07, 0x38, 0x00, 0x1C, 0x70, 0x00, 0x38,
+  0xF0, 0x00, 0x70, 0xE0, 0x01, 0xC1, 0xC0, 0x03, 0x83, 0xC0, 0x07, 0x07,
+  0x80, 0x1E, 0x07, 0x00, 0x38, 0x0F, 0x00, 0x70, 0x1E, 0x01, 0xE0, 0x1C,
+  0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x38, 0x00, 0xF0,
+  0x70, 0x01, 0xE1, 0xE0, 0x01, 0xC3, 0x80, 0x03, 0xC7, 0x00, 0x07, 0x9E,
+  0x00, 0x0F, 0x3C, 0x00, 0x0E, 0x70, 0x00, 0x1F, 0xE0, 0x00, 0x3C, 0x03,
+  0x83, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x0F,
+  0xF7, 0xF0, 0x0F, 0x00, 0xF8, 0x1E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x3C,
+  0x00, 0x1E, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x0F, 0x70, 0x00, 0x0F, 0x70,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0,
+  0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x70,
+  0x00, 0x0F, 0x78, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0x78, 0x00, 0x1E, 0x3C,
+  0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x07,
+  0xF7, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x08, 0x00, 0x0E,
+  0x0E, 0x00, 0xE0, 0xE0, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+  0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07,
+  0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00,
+  0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00,
+  0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0E, 0x78, 0x01, 0xE7,
+  0x80, 0x1E, 0x3C, 0x03, 0xC3, 0xFB, 0xF8, 0x1F, 0xFF, 0x00, 0x7F, 0xE0,
+  0x00, 0x60, 0x00,
+};
 
 const GFXglyph SourceSansLabel22pt7bGlyphs[] PROGMEM = {
   {     0,   1,   1,  28,    0,    0 },   // 0x20 ' '
@@ -263,11 +411,50 @@ const GFXglyph SourceSansLabel22pt7bGlyphs[] PROGMEM = {
   {  2007,   1,   1,  28,    0,    0 },   // 0x7B '{'
   {  2008,   1,   1,  28,    0,    0 },   // 0x7C '|'
   {  2009,   1,   1,  28,    0,    0 },   // 0x7D '}'
-  {  2010,   1,   1,  28,    0,    0 } }; // 0x7E '~'
+  {  2010,   1,   1,  28,    0,    0 },   // 0x7E '~'
+  {  2011,  23,  39,  23,    0,  -38 },   // U+00C1 'Á'
+  {  2124,  21,  41,  25,    2,  -39 },   // U+010C 'Č'
+  {  2232,  20,  40,  27,    4,  -39 },   // U+010E 'Ď'
+  {  2332,  17,  39,  23,    4,  -38 },   // U+00C9 'É'
+  {  2415,  17,  39,  23,    4,  -38 },   // U+011A 'Ě'
+  {  2498,   9,  39,  11,    2,  -38 },   // U+00CD 'Í'
+  {  2542,  20,  40,  28,    4,  -39 },   // U+0147 'Ň'
+  {  2642,  24,  41,  29,    2,  -39 },   // U+00D3 'Ó'
+  {  2765,  19,  39,  25,    4,  -38 },   // U+0158 'Ř'
+  {  2858,  19,  41,  23,    2,  -39 },   // U+0160 'Š'
+  {  2956,  21,  39,  23,    1,  -38 },   // U+0164 'Ť'
+  {  3059,  20,  40,  28,    4,  -38 },   // U+00DA 'Ú'
+  {  3159,  20,  39,  28,    4,  -37 },   // U+016E 'Ů'
+  {  3257,  21,  39,  21,    0,  -38 },   // U+00DD 'Ý'
+  {  3360,  19,  39,  23,    2,  -38 },   // U+017D 'Ž'
+  {  3453,  23,  34,  23,    0,  -33 },   // U+00C4 'Ä'
+  {  3551,  24,  36,  29,    2,  -34 },   // U+00D6 'Ö'
+  {  3659,  20,  35,  28,    4,  -33 } }; // U+00DC 'Ü'
+
+const GFXcmap SourceSansLabel22pt7bCmap[] PROGMEM = {
+  { 0x00C1,  95 },  // U+00C1 'Á'
+  { 0x00C4, 110 },  // U+00C4 'Ä'
+  { 0x00C9,  98 },  // U+00C9 'É'
+  { 0x00CD, 100 },  // U+00CD 'Í'
+  { 0x00D3, 102 },  // U+00D3 'Ó'
+  { 0x00D6, 111 },  // U+00D6 'Ö'
+  { 0x00DA, 106 },  // U+00DA 'Ú'
+  { 0x00DC, 112 },  // U+00DC 'Ü'
+  { 0x00DD, 108 },  // U+00DD 'Ý'
+  { 0x010C,  96 },  // U+010C 'Č'
+  { 0x010E,  97 },  // U+010E 'Ď'
+  { 0x011A,  99 },  // U+011A 'Ě'
+  { 0x0147, 101 },  // U+0147 'Ň'
+  { 0x0158, 103 },  // U+0158 'Ř'
+  { 0x0160, 104 },  // U+0160 'Š'
+  { 0x0164, 105 },  // U+0164 'Ť'
+  { 0x016E, 107 },  // U+016E 'Ů'
+  { 0x017D, 109 },  // U+017D 'Ž'
+};
 
 const GFXfont SourceSansLabel22pt7b PROGMEM = {
   (uint8_t  *)SourceSansLabel22pt7bBitmaps,
   (GFXglyph *)SourceSansLabel22pt7bGlyphs,
-  0x20, 0x7E, 57 };
+  0x20, 0x7E, 57, GFXFONT_ENC_BITMAP, SourceSansLabel22pt7bCmap, 18 };
 
-// Approx. 2683 bytes
+// Approx. 4624 bytes
@@ -5,6 +5,7 @@
 #ifndef GFXFONT_H
 #define GFXFONT_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 /* Allow font headers to use PROGMEM; define as empty when not provided by Arduino. */
@@ -21,12 +22,106 @@ typedef struct {
   int8_t   yOffset;
 } GFXglyph;
 
+/* Codepoints outside first..last (tools/gfxfont_add_glyphs.py), sorted by codepoint: each names a
+ * glyph of the font's glyph table, one appended after the first..last run or an existing one
+ * (U+00B0 on the degree sign stored at '*'). first..last stays a direct index; only codepoints
+ * outside it are looked up, by binary search. */
+typedef struct {
+  uint16_t codepoint;
+  uint16_t glyph;
+} GFXcmap;
+
 typedef struct {
   const uint8_t  *bitmap;
   const GFXglyph  *glyph;
   uint8_t   first;
   uint8_t   last;
   uint16_t  yAdvance;  /* line height; uint16_t for large fonts (e.g. 120pt = 284) */
+  uint8_t   encoding;  /* GFXFONT_ENC_*; stock Adafruit headers omit it (0), fonts/ spells it out */
+  const GFXcmap *cmap; /* omitted (none) in stock Adafruit headers */
+  uint16_t  cmap_count;
 } GFXfont;
 
+/* GFXFONT_ENC_BITMAP: Adafruit row-major 1bpp, MSB = left.
+ * GFXFONT_ENC_RLE_COL (fonts/<Font>_rle.h, tools/gfxfont_to_rle_header.py): per glyph column,
+ * one run-count byte then (skip, ink) byte pairs top to bottom; bitmapOffset indexes this stream. */
+#define GFXFONT_ENC_BITMAP   0u
+#define GFXFONT_ENC_RLE_COL  1u
+
+/* Pre-transposed companion (fonts/<Font>_4g.h, tools/gfxfont_to_4g_header.py): per glyph column,
+ * bytes_per_col bytes of 1-bit coverage (1 = ink, top row = MSB) in the 4G RAM planes' column order.
+ * Metrics come from the base GFXglyph; bytes_per_col 0 = glyph not baked, use base font. */
+typedef struct {
+  uint16_t offset;
+  uint8_t  bytes_per_col;
+} GFXglyph4g;
+
+typedef struct {
+  const uint8_t    *bitmap;
+  const GFXglyph4g *glyph;
+  const GFXfont    *base;
+  uint8_t   first;
+  uint8_t   last;
+} GFXfont4g;
+
+#ifdef __cplusplus
+/* Codepoint of the UTF-8 sequence at s, its length in *len. A malformed or cut-off sequence
+ * decodes as U+FFFD over the bytes read so far (never past a NUL); no font maps U+FFFD. */
+constexpr uint32_t gfx_utf8_decode(const char *s, unsigned int *len) {
+  const unsigned int c0 = (unsigned char)s[0];
+  const unsigned int n = (c0 < 0x80u) ? 1u : (c0 < 0xC2u) ? 0u : (c0 < 0xE0u) ? 2u : (c0 < 0xF0u) ? 3u
+                       : (c0 < 0xF5u) ? 4u : 0u;
+  if (n <= 1u) {
+    *len = 1u;
+    return n ? c0 : 0xFFFDu;
+  }
+  uint32_t cp = c0 & (0x7Fu >> n);
+  for (unsigned int i = 1; i < n; i++) {
+    const unsigned int c = (unsigned char)s[i];
+    if ((c & 0xC0u) != 0x80u) {
+      *len = i;
+      return 0xFFFDu;
+    }
+    cp = (cp << 6) | (c & 0x3Fu);
+  }
+  *len = n;
+  return cp;
+}
+
+/* Compile-time advances (fonts/<Font>_metrics.h, tools/gfxfont_to_metrics_header.py): xAdvance of
+ * every glyph as a constexpr table (first..last, then the glyphs appended for the cmap), plus the
+ * '0'..'9' run of the same table for numeric strings and a constexpr copy of the font's cmap.
+ * Plain const data, read directly (not through pgm_read_*) so widths of literals fold at compile time. */
+struct GFXmetrics {
+  const uint8_t *advance;
+  const uint8_t *digit;
+  uint8_t first;
+  uint8_t last;
+  const GFXcmap *cmap;
+  uint16_t cmap_count;
+};
+
+constexpr unsigned int gfxmetrics_advance(const GFXmetrics &m, uint32_t cp) {
+  if (cp >= m.first && cp <= m.last) return m.advance[cp - m.first];
+  unsigned int lo = 0u, hi = m.cmap_count;
+  while (lo < hi) {
+    const unsigned int mid = (lo + hi) / 2u;
+    if (m.cmap[mid].codepoint < cp) lo = mid + 1u;
+    else hi = mid;
+  }
+  return (lo < m.cmap_count && m.cmap[lo].codepoint == cp) ? m.advance[m.cmap[lo].glyph] : 0u;
+}
+
+/* Total xAdvance of a UTF-8 string; a constant for literals. */
+constexpr unsigned int gfxmetrics_width(const GFXmetrics &m, const char *s) {
+  unsigned int w = 0u;
+  while (*s) {
+    unsigned int n = 1u;
+    w += gfxmetrics_advance(m, gfx_utf8_decode(s, &n));
+    s += n;
+  }
+  return w;
+}
+#endif
+
 #endif /* GFXFONT_H */
@@ -0,0 +1,126 @@
+/**
+ * Host test: the banded renderer against the full-frame one. Builds the conditions screen (in
+ * several states) and the history, forecast and diagnostics pages, rasterizes each band by band
+ * with band_render_4g(), joins the bands into both RAM planes and compares them byte for byte
+ * with the frames of a 480-column build (one band = the full frame buffer).
+ *
+ * Build and run from tools/ once per band width; the 480 build writes the reference frames:
+ *   for n in 480 32 96 160; do g++ -O2 -I.. '-Dpgm_read_ptr(a)=(*(const void*const*)(a))' \
+ *       -DEPD_UI_BAND_COLS=${n}u -o band_compare_$n band_compare.cpp && ./band_compare_$n || break; done
+ * Exits with 1 at the first frame whose planes differ, naming the plane, column and row.
+ */
+#include "../epd_ui.cpp"
+
+void EPD_Dis_Part(unsigned int, unsigned int, const unsigned char *, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Begin(unsigned int, unsigned int, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Data(const unsigned char *, unsigned int) {}
+void EPD_HW_Init_4G(void) {}
+void EPD_HW_Init_Fast(void) {}
+void EPD_Part_Update(void) {}
+void EPD_Update_4G(void) {}
+void EPD_Update_Fast(void) {}
+void EPD_Write_4G_Band(unsigned int, unsigned int, const unsigned char *, const unsigned char *) {}
+void EPD_Write_Fast_Band(unsigned int, unsigned int, const unsigned char *) {}
+
+#define FRAME_BYTES  (2u * EPD_ARRAY)  /* RAM 0x24 plane, then RAM 0x26 plane */
+#define FRAME_COUNT  6u
+
+static const char *const frame_names[FRAME_COUNT] = {
+  "conditions", "conditions, no data", "conditions, other icons", "history", "forecast", "diagnostics"
+};
+
+static void build_frame(epd_ui_ctx_t *ctx, unsigned int f) {
+  static const epd_ui_forecast_day_t forecast[3] = { { "18.2.", 3, -2, 4 }, { "19.2.", 61, 1, 17 }, { "20.2.", 95, -14, 0 } };
+  static const epd_ui_forecast_day_t other[3] = { { "1.12.", 71, -9, -3 }, { "2.12.", 45, 0, 2 }, { "31.12.", 82, 9, 12 } };
+  static epd_ui_history_t history;
+  switch (f) {
+    case 0:
+      epd_ui_build_demo_4g(ctx, 215, 45, -37, 81, 61, "10:05", "12:34", forecast, false);
+      break;
+    case 1:
+      epd_ui_build_demo_4g(ctx, 215, 45, 9990, -1, -1, "---", "", NULL, true);
+      break;
+    case 2:
+      epd_ui_build_demo_4g(ctx, -50, 100, 352, 7, 95, "23:59", "0:00", other, false);
+      break;
+    case 3:
+      /* A day and a half of 5 min samples: the chart shows the last 24 h of a sine and a spike. */
+      for (uint32_t i = 0; i < 432u; i++)
+        epd_ui_history_add(&history, 1000u + i * 300u, (int16_t)(200 + (int)((i * 7u) % 60u) - 30 + (i == 300u ? 45 : 0)),
+                           40 + (int)((i * 3u) % 20u));
+      epd_ui_build_history_page(ctx, 215, 45, &history, 1000u + 431u * 300u);
+      break;
+    case 4:
+      epd_ui_build_forecast_page(ctx, forecast, "10:05");
+      break;
+    default: {
+      epd_ui_diag_t diag;
+      memset(&diag, 0, sizeof(diag));
+      diag.wake_cause = "touch";
+      diag.wakes = 1234u;
+      diag.last_wake_ms = 5321u;
+      diag.zigbee_ok = true;
+      diag.last_update = "10:05";
+      diag.last_refresh = EPD_UI_REFRESH_FAST;
+      diag.partials = 3u;
+      diag.cache_used_kb = 48u;
+      diag.cache_total_kb = 1408u;
+      epd_ui_build_diagnostics_page(ctx, &diag);
+      break;
+    }
+  }
+}
+
+/* ctx's frame rasterized band by band into both planes of frame. */
+static void render_frame(epd_ui_ctx_t *ctx, unsigned char *frame) {
+  for (unsigned int bx = 0; bx < EPD_WIDTH; bx += EPD_UI_BAND_COLS) {
+    band_render_4g(ctx, &ctx->frame_dl, bx, NULL);
+    const epd_fb_4g_t fb = band_fb(ctx);
+    for (unsigned int k = 0; k < epd_fb_4g_t::kPlanes; k++)
+      memcpy(frame + k * EPD_ARRAY + bx * EPD_4G_BYTES_PER_COL, fb.plane_bits(k),
+             EPD_UI_BAND_COLS * EPD_4G_BYTES_PER_COL);
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *path = (argc > 1) ? argv[1] : "band_compare.ref";
+  static unsigned char band[EPD_UI_BAND_BUFFER_SIZE];
+  static unsigned char frames[FRAME_COUNT][FRAME_BYTES], ref[FRAME_COUNT][FRAME_BYTES];
+  static epd_ui_ctx_t ctx;
+  epd_ui_ctx_init(&ctx, band);
+  for (unsigned int f = 0; f < FRAME_COUNT; f++) {
+    build_frame(&ctx, f);
+    render_frame(&ctx, frames[f]);
+  }
+
+  if (EPD_UI_BAND_COLS == EPD_WIDTH) {
+    FILE *o = fopen(path, "wb");
+    if (!o || fwrite(frames, sizeof(frames), 1, o) != 1) {
+      perror(path);
+      return 1;
+    }
+    fclose(o);
+    printf("480 columns: %u reference frames -> %s\n", FRAME_COUNT, path);
+    return 0;
+  }
+
+  FILE *in = fopen(path, "rb");
+  if (!in || fread(ref, sizeof(ref), 1, in) != 1) {
+    fprintf(stderr, "%s: run the 480-column build first\n", path);
+    return 1;
+  }
+  fclose(in);
+  for (unsigned int f = 0; f < FRAME_COUNT; f++) {
+    if (memcmp(frames[f], ref[f], FRAME_BYTES) == 0) {
+      printf("%3u columns: %-24s identical\n", (unsigned int)EPD_UI_BAND_COLS, frame_names[f]);
+      continue;
+    }
+    unsigned int i = 0;
+    while (frames[f][i] == ref[f][i]) i++;
+    const unsigned int k = i / EPD_ARRAY, col = (i % EPD_ARRAY) / EPD_4G_BYTES_PER_COL;
+    printf("%3u columns: %-24s differs: plane %u, column %u, rows %u..%u\n", (unsigned int)EPD_UI_BAND_COLS,
+           frame_names[f], k, col, (i % EPD_4G_BYTES_PER_COL) * 8u, (i % EPD_4G_BYTES_PER_COL) * 8u + 7u);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+"""
+Add codepoints outside first..last to an Adafruit GFX font header, through the sparse cmap of
+fonts/gfxfont.h (GFXcmap: codepoint -> glyph, sorted, binary-searched by epd_ui.cpp). Glyphs are
+appended after the first..last run; first..last itself is unchanged, so ASCII stays a direct index.
+  --alias U+00B0=*      map a codepoint onto an existing glyph (the degree sign stored at '*')
+  --compose "áčÜ..."    build precomposed Latin letters from the font's own base letter plus an
+                        acute, caron, ring or diaeresis drawn at the font's stem width (i/j lose
+                        their dot first; the caron of ď and ť is a tick beside the ascender)
+  --ttf F --size PX --chars "ß..."   render glyphs from a TrueType font at PX pixels (Pillow)
+  --preview out.png     render the added glyphs next to their base letters
+The header is rewritten in the layout of gfxfont_to_rle_header.py's output; rerun
+gfxfont_to_metrics_header.py (and gfxfont_to_rle_header.py for fonts used as _rle.h) afterwards.
+Usage: python gfxfont_add_glyphs.py <fonts/Font.h> [options]
+"""
+import argparse
+import math
+import re
+import sys
+import unicodedata
+
+from gfxfont_to_4g_header import parse_gfxfont
+
+# Combining marks --compose can draw.
+MARKS = {"́": "acute", "̌": "caron", "̊": "ring", "̈": "diaeresis"}
+
+
+def parse_header(text):
+    """Return (name, bitmap, glyphs, first, last, y_advance, encoding, cmap) of a GFX header."""
+    name, bitmap, glyphs, first = parse_gfxfont(text)
+    f = re.search(r"const\s+GFXfont\s+\w+\s+PROGMEM\s*=\s*\{.*?0x[0-9A-Fa-f]+\s*,\s*(0x[0-9A-Fa-f]+)\s*,\s*(\d+)"
+                  r"\s*(?:,\s*(\w+))?", text, re.S)
+    last, y_advance = int(f.group(1), 16), int(f.group(2))
+    encoding = f.group(3) or "GFXFONT_ENC_BITMAP"
+    if encoding != "GFXFONT_ENC_BITMAP":
+        raise ValueError("add glyphs to the bitmap font, then re-encode it")
+    cmap = {}
+    c = re.search(r"const\s+GFXcmap\s+\w+Cmap\[\]\s*PROGMEM\s*=\s*\{(.*?)\}\s*;", text, re.S)
+    if c:
+        for cp, g in re.findall(r"\{\s*(0x[0-9A-Fa-f]+),\s*(\d+)\s*\}", c.group(1)):
+            cmap[int(cp, 16)] = int(g)
+    return name, bitmap, glyphs, first, last, y_advance, encoding, cmap
+
+
+def glyph_ink(bitmap, glyph):
+    """Ink pixels of a glyph as a set of (x, y) relative to pen position and baseline."""
+    offset, w, h, _, x_off, y_off = glyph
+    ink = set()
+    for gy in range(h):
+        for gx in range(w):
+            bit = gx + w * gy
+            if bitmap[offset + (bit >> 3)] & (0x80 >> (bit & 7)):
+                ink.add((x_off + gx, y_off + gy))
+    return ink
+
+
+def ink_to_glyph(ink, x_adv):
+    """(row-major 1bpp bytes, w, h, x_off, y_off) of an ink set; a 1x1 blank glyph if empty."""
+    if not ink:
+        return bytes(1), 1, 1, x_adv, 0, 0
+    x0, x1 = min(x for x, _ in ink), max(x for x, _ in ink)
+    y0, y1 = min(y for _, y in ink), max(y for _, y in ink)
+    w, h = x1 - x0 + 1, y1 - y0 + 1
+    out = bytearray((w * h + 7) // 8)
+    for x, y in ink:
+        bit = (x - x0) + w * (y - y0)
+        out[bit >> 3] |= 0x80 >> (bit & 7)
+    return bytes(out), w, h, x_adv, x0, y0
+
+
+def stroke(ink, p0, p1, width):
+    """Add a round-ended segment p0-p1 of the given width (pixel centers within width / 2)."""
+    r = width / 2.0
+    xs = range(math.floor(min(p0[0], p1[0]) - r), math.ceil(max(p0[0], p1[0]) + r) + 1)
+    ys = range(math.floor(min(p0[1], p1[1]) - r), math.ceil(max(p0[1], p1[1]) + r) + 1)
+    dx, dy = p1[0] - p0[0], p1[1] - p0[1]
+    n = dx * dx + dy * dy
+    for y in ys:
+        for x in xs:
+            t = 0.0 if n == 0 else max(0.0, min(1.0, ((x - p0[0]) * dx + (y - p0[1]) * dy) / n))
+            if math.hypot(x - p0[0] - t * dx, y - p0[1] - t * dy) <= r:
+                ink.add((x, y))
+
+
+class Composer:
+    def __init__(self, bitmap, glyphs, first, last):
+        self.bitmap, self.glyphs, self.first, self.last = bitmap, glyphs, first, last
+        xh = self.base_ink("x")
+        self.x_height = (-min(y for _, y in xh)) if xh else 0
+        stem = self.base_ink("l") or self.base_ink("I")
+        if not self.x_height:
+            cap = self.base_ink("H") or stem
+            self.x_height = round(0.7 * -min(y for _, y in cap)) if cap else 0
+        if not self.x_height or not stem:
+            raise ValueError("font has no letters to take its proportions from")
+        mid = (min(y for _, y in stem) + max(y for _, y in stem)) // 2
+        self.stem = max(1, sum(1 for _, y in stem if y == mid))
+
+    def base_ink(self, ch):
+        c = ord(ch)
+        if not self.first <= c <= self.last:
+            return set()
+        ink = glyph_ink(self.bitmap, self.glyphs[c - self.first])
+        return ink if len(ink) > 1 else set()  # 1x1 placeholder = not in the font
+
+    def compose(self, ch):
+        parts = unicodedata.normalize("NFD", ch)
+        if len(parts) != 2 or parts[1] not in MARKS:
+            raise ValueError("U+%04X is not a base letter plus one of the marks drawn here" % ord(ch))
+        base, mark = parts[0], MARKS[parts[1]]
+        ink = set(self.base_ink(base))
+        if not ink:
+            raise ValueError("U+%04X: the font has no '%s'" % (ord(ch), base))
+        x_adv = self.glyphs[ord(base) - self.first][3]
+        xh, t = self.x_height, self.stem
+        gap = max(1, round(xh * 0.12))
+        if base in "ij":  # dotless first: drop the ink above the x-height
+            ink = {(x, y) for x, y in ink if y >= -xh}
+        top = min(y for _, y in ink)
+        x0, x1 = min(x for x, _ in ink), max(x for x, _ in ink)
+        cx = (x0 + x1) / 2.0
+        bottom = top - gap - t / 2.0  # center line of the mark's lowest stroke
+        m = set()
+        if mark == "caron" and base in "dt":  # tick beside the ascender
+            tx = x1 + gap + t / 2.0
+            stroke(m, (tx + t / 2.0, top), (tx, top + max(2, round(xh * 0.35))), t)
+            x_adv += gap + t
+        elif mark == "acute":
+            aw, ah = max(2, round(xh * 0.3)), max(2, round(xh * 0.3))
+            stroke(m, (cx - aw / 2.0 + aw * 0.2, bottom), (cx + aw / 2.0 + aw * 0.2, bottom - ah), t)
+        elif mark == "caron":
+            cw, ch_ = max(3, round(xh * 0.55)), max(2, round(xh * 0.28))
+            stroke(m, (cx - cw / 2.0, bottom - ch_), (cx, bottom), t)
+            stroke(m, (cx, bottom), (cx + cw / 2.0, bottom - ch_), t)
+        elif mark == "ring":
+            d = max(4, round(xh * 0.42))
+            rc = (cx, bottom - d / 2.0 + t / 2.0)
+            ring_w = max(1, round(t * 0.8))
+            for y in range(math.floor(rc[1] - d / 2.0) - 1, math.ceil(rc[1] + d / 2.0) + 2):
+                for x in range(math.floor(rc[0] - d / 2.0) - 1, math.ceil(rc[0] + d / 2.0) + 2):
+                    if d / 2.0 - ring_w <= math.hypot(x - rc[0], y - rc[1]) <= d / 2.0:
+                        m.add((x, y))
+        else:  # diaeresis
+            sp = max(t + 2, round(xh * 0.42))
+            for dx in (-sp / 2.0, sp / 2.0):
+                for y in range(t):
+                    for x in range(t):
+                        m.add((round(cx + dx - t / 2.0) + x, round(bottom + t / 2.0) - t + y))
+        return ink | m, x_adv
+
+
+def render_ttf(path, size, ch):
+    from PIL import Image, ImageDraw, ImageFont
+    font = ImageFont.truetype(path, size)
+    img = Image.new("L", (size * 3, size * 3), 0)
+    origin = (size, 2 * size)
+    ImageDraw.Draw(img).text(origin, ch, fill=255, font=font, anchor="ls")
+    ink = {(x - origin[0], y - origin[1]) for y in range(img.height) for x in range(img.width)
+           if img.getpixel((x, y)) >= 128}
+    return ink, round(font.getlength(ch))
+
+
+def char_comment(cp):
+    return "U+%04X '%s'" % (cp, chr(cp)) if cp > 0x7E else "0x%02X '%s'" % (cp, chr(cp))
+
+
+def write_header(path, name, bitmap, glyphs, first, last, y_advance, cmap):
+    codes = {i: first + i for i in range(last - first + 1)}
+    codes.update({g: cp for cp, g in cmap.items() if g not in codes})
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("/* %s; codepoints past 0x%02X through %sCmap, added by tools/gfxfont_add_glyphs.py. */\n\n"
+                % (name, last, name))
+        f.write("const uint8_t %sBitmaps[] PROGMEM = {\n" % name)
+        for i in range(0, len(bitmap), 12):
+            f.write("  " + ", ".join("0x%02X" % b for b in bitmap[i:i + 12]) + ",\n")
+        f.write("};\n\n")
+        f.write("const GFXglyph %sGlyphs[] PROGMEM = {\n" % name)
+        for n, (off, w, h, x_adv, x_off, y_off) in enumerate(glyphs):
+            end = " }; //" if n == len(glyphs) - 1 else ",   //"
+            f.write("  { %5u, %3u, %3u, %3u, %4d, %4d }%s %s\n"
+                    % (off, w, h, x_adv, x_off, y_off, end, char_comment(codes[n])))
+        f.write("\n")
+        f.write("const GFXcmap %sCmap[] PROGMEM = {\n" % name)
+        for cp in sorted(cmap):
+            f.write("  { 0x%04X, %3u },  // %s\n" % (cp, cmap[cp], char_comment(cp)))
+        f.write("};\n\n")
+        f.write("const GFXfont %s PROGMEM = {\n" % name)
+        f.write("  (uint8_t  *)%sBitmaps,\n  (GFXglyph *)%sGlyphs,\n" % (name, name))
+        f.write("  0x%02X, 0x%02X, %u, GFXFONT_ENC_BITMAP, %sCmap, %u };\n\n"
+                % (first, last, y_advance, name, len(cmap)))
+        f.write("// Approx. %u bytes\n" % (len(bitmap) + 7 * len(glyphs) + 4 * len(cmap) + 14))
+
+
+def preview(out_png, bitmap, glyphs, pairs):
+    from PIL import Image
+    inks = [(glyph_ink(bitmap, glyphs[b]) if b is not None else set(), glyph_ink(bitmap, glyphs[g]))
+            for b, g in pairs]
+    allpts = [p for a, b in inks for p in a | b] or [(0, 0)]
+    y0, y1 = min(y for _, y in allpts), max(y for _, y in allpts)
+    cell = max(x for x, _ in allpts) - min(0, min(x for x, _ in allpts)) + 4
+    scale = 4
+    img = Image.new("L", (len(inks) * 2 * cell * scale, (y1 - y0 + 3) * scale), 255)
+    for i, pair in enumerate(inks):
+        for k, ink in enumerate(pair):
+            for x, y in ink:
+                for sy in range(scale):
+                    for sx in range(scale):
+                        img.putpixel((((2 * i + k) * cell + x + 1) * scale + sx, (y - y0 + 1) * scale + sy), 0)
+    img.save(out_png)
+    print("  -> %s" % out_png)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("header")
+    ap.add_argument("--alias", action="append", default=[], help="U+XXXX=c")
+    ap.add_argument("--compose", default="")
+    ap.add_argument("--ttf")
+    ap.add_argument("--size", type=int)
+    ap.add_argument("--chars", default="")
+    ap.add_argument("--preview")
+    args = ap.parse_args()
+
+    with open(args.header, "r", encoding="utf-8") as f:
+        name, bitmap, glyphs, first, last, y_advance, _, cmap = parse_header(f.read())
+    bitmap, glyphs = bytearray(bitmap), list(glyphs)
+    if len(glyphs) < last - first + 1:
+        raise ValueError("%u glyphs for 0x%02X..0x%02X" % (len(glyphs), first, last))
+    added = []
+
+    def add(cp, ink, x_adv, base):
+        if first <= cp <= last or cp in cmap:
+            raise ValueError("%s is already in the font" % char_comment(cp))
+        data, w, h, x_adv, x_off, y_off = ink_to_glyph(ink, x_adv)
+        glyphs.append((len(bitmap), w, h, x_adv, x_off, y_off))
+        bitmap.extend(data)
+        cmap[cp] = len(glyphs) - 1
+        added.append((base, len(glyphs) - 1))
+
+    for a in args.alias:
+        cp_s, ch = a.split("=", 1)
+        cp = int(cp_s[2:], 16) if cp_s.upper().startswith("U+") else ord(cp_s)
+        if first <= cp <= last or cp in cmap:
+            raise ValueError("%s is already in the font" % char_comment(cp))
+        cmap[cp] = ord(ch) - first
+        added.append((None, ord(ch) - first))
+    if args.compose:
+        comp = Composer(bytes(bitmap), glyphs, first, last)
+        for ch in args.compose:
+            ink, x_adv = comp.compose(ch)
+            add(ord(ch), ink, x_adv, ord(unicodedata.normalize("NFD", ch)[0]) - first)
+    if args.chars:
+        if not args.ttf or not args.size:
+            raise ValueError("--chars needs --ttf and --size")
+        for ch in args.chars:
+            ink, x_adv = render_ttf(args.ttf, args.size, ch)
+            add(ord(ch), ink, x_adv, None)
+    if len(bitmap) > 0xFFFF or len(glyphs) > 0xFFFF:
+        raise ValueError("font exceeds 16-bit offsets")
+
+    write_header(args.header, name, bitmap, glyphs, first, last, y_advance, cmap)
+    print("Wrote %s (%s, %u cmap entries, %u glyphs)" % (args.header, name, len(cmap), len(glyphs)))
+    if args.preview:
+        preview(args.preview, bytes(bitmap), glyphs, added)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Convert glyphs of an Adafruit GFX font header to a pre-transposed 4-gray companion header.
+Each glyph column is stored as a 1-bit coverage mask (1 = ink, MSB first) in the column-major
+order of the 4G buffer's RAM planes, so draw_gfxfont_string_4g() in epd_ui.cpp can merge whole
+bytes into both planes instead of pixels. Columns run top glyph row first.
+Usage: python gfxfont_to_4g_header.py <fonts/Font.h> [--chars "-.0123456789"] [output.h]
+Output: fonts/<Font>_4g.h with <FontName>4gBitmaps[], <FontName>4gGlyphs[] and <FontName>4g.
+"""
+import os
+import re
+import sys
+
+DEFAULT_CHARS = "-.0123456789"
+
+
+def parse_gfxfont(text):
+    """Return (font_name, bitmap bytes, glyph tuples, first) from an Adafruit GFX header."""
+    m = re.search(r"const\s+uint8_t\s+(\w+)Bitmaps\[\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\}\s*;", text, re.S)
+    if not m:
+        raise ValueError("no Bitmaps[] array found")
+    bitmap = bytes(int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", m.group(2)))
+    g = re.search(r"const\s+GFXglyph\s+\w+Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\}\s*;", text, re.S)
+    if not g:
+        raise ValueError("no Glyphs[] array found")
+    glyphs = [tuple(int(v) for v in t) for t in
+              re.findall(r"\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", g.group(1))]
+    f = re.search(r"const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{.*?(0x[0-9A-Fa-f]+)\s*,\s*(0x[0-9A-Fa-f]+)\s*,",
+                  text, re.S)
+    if not f:
+        raise ValueError("no GFXfont struct found")
+    return f.group(1), bitmap, glyphs, int(f.group(2), 16)
+
+
+def glyph_to_4g_columns(bitmap, offset, w, h):
+    """Transpose one row-major 1bpp glyph to column-major 1bpp coverage, top row first."""
+    bpc = (h + 7) // 8
+    out = bytearray(w * bpc)
+    for gx in range(w):
+        for gy in range(h):
+            bit = gx + w * gy
+            if bitmap[offset + (bit >> 3)] & (0x80 >> (bit & 7)):
+                out[gx * bpc + gy // 8] |= 0x80 >> (gy % 8)
+    return bytes(out), bpc
+
+
+def font_to_4g(src_path, chars=DEFAULT_CHARS, out_path=None):
+    with open(src_path, "r", encoding="utf-8") as f:
+        name, bitmap, glyphs, first = parse_gfxfont(f.read())
+    codes = sorted(set(ord(c) for c in chars))
+    lo, hi = codes[0], codes[-1]
+    data = bytearray()
+    entries = []
+    for c in range(lo, hi + 1):
+        offset, w, h = glyphs[c - first][0:3]
+        if c not in codes or w <= 1 or h <= 1:
+            entries.append((0, 0, c))   # bytes_per_col 0: drawn via the GFXfont path
+            continue
+        cols, bpc = glyph_to_4g_columns(bitmap, offset, w, h)
+        entries.append((len(data), bpc, c))
+        data += cols
+    if len(data) > 0xFFFF:
+        raise ValueError("companion bitmap exceeds 16-bit offsets")
+
+    base = os.path.splitext(os.path.basename(src_path))[0]
+    if out_path is None:
+        out_path = os.path.join(os.path.dirname(os.path.abspath(src_path)), base + "_4g.h")
+    guard = re.sub(r"\W", "_", base.upper()) + "_4G_H"
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/* %s glyphs pre-transposed to column-major 1-bit masks (RAM plane order). */\n" % name)
+        f.write("/* Generated by tools/gfxfont_to_4g_header.py from %s; include after the base font. */\n"
+                % os.path.basename(src_path))
+        f.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        f.write('#include "gfxfont.h"\n\n')
+        f.write("const uint8_t %s4gBitmaps[] PROGMEM = {\n" % name)
+        for i in range(0, len(data), 16):
+            f.write("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write("const GFXglyph4g %s4gGlyphs[] PROGMEM = {\n" % name)
+        for off, bpc, c in entries:
+            f.write("  { %5u, %3u },   // 0x%02X '%s'\n" % (off, bpc, c, chr(c)))
+        f.write("};\n\n")
+        f.write("const GFXfont4g %s4g PROGMEM = {\n" % name)
+        f.write("  %s4gBitmaps,\n  %s4gGlyphs,\n  &%s,\n  0x%02X, 0x%02X };\n\n" % (name, name, name, lo, hi))
+        f.write("// Approx. %u bytes\n\n#endif /* %s */\n" % (len(data) + 3 * len(entries) + 12, guard))
+    print("Wrote %s (%s, %u glyphs, %u bytes)" % (out_path, name, sum(1 for e in entries if e[1]), len(data)))
+    return True
+
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+    chars = DEFAULT_CHARS
+    if "--chars" in args:
+        i = args.index("--chars")
+        chars = args[i + 1]
+        del args[i:i + 2]
+    if not args:
+        print("Usage: python gfxfont_to_4g_header.py <fonts/Font.h> [--chars \"-.0123456789\"] [output.h]",
+              file=sys.stderr)
+        sys.exit(1)
+    ok = font_to_4g(args[0], chars, args[1] if len(args) > 1 else None)
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""
+Extract the glyph advances of an Adafruit GFX font header into a constexpr metrics header.
+The xAdvance of every glyph (first..last, then any appended for the font's cmap) becomes a
+constexpr table, so epd_ui.cpp can fold the width of string literals to constants
+(static_assert-able) and measure numeric strings from the digit run without walking the PROGMEM
+glyph table. Regenerate whenever the base font changes.
+Usage: python gfxfont_to_metrics_header.py <fonts/Font.h> [output.h]
+Output: fonts/<Font>_metrics.h with <FontName>Advance[], <FontName>MetricsCmap[] (if the font has a
+cmap) and <FontName>Metrics.
+"""
+import os
+import re
+import sys
+
+
+def parse_gfxfont_advances(text):
+    """Return (font_name, first, last, [xAdvance, ...], [(codepoint, glyph), ...]) from an Adafruit GFX header."""
+    g = re.search(r"const\s+GFXglyph\s+\w+Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\}\s*;", text, re.S)
+    if not g:
+        raise ValueError("no Glyphs[] array found")
+    glyphs = [tuple(int(v) for v in t) for t in
+              re.findall(r"\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", g.group(1))]
+    f = re.search(r"const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{.*?(0x[0-9A-Fa-f]+)\s*,\s*(0x[0-9A-Fa-f]+)\s*,",
+                  text, re.S)
+    if not f:
+        raise ValueError("no GFXfont struct found")
+    first, last = int(f.group(2), 16), int(f.group(3), 16)
+    cmap = []
+    c = re.search(r"const\s+GFXcmap\s+\w+Cmap\[\]\s*PROGMEM\s*=\s*\{(.*?)\}\s*;", text, re.S)
+    if c:
+        cmap = [(int(cp, 16), int(gi)) for cp, gi in re.findall(r"\{\s*(0x[0-9A-Fa-f]+),\s*(\d+)\s*\}", c.group(1))]
+    if len(glyphs) < last - first + 1 or any(gi >= len(glyphs) for _, gi in cmap):
+        raise ValueError("%u glyphs for 0x%02X..0x%02X" % (len(glyphs), first, last))
+    return f.group(1), first, last, [g[3] for g in glyphs], cmap
+
+
+def font_to_metrics(src_path, out_path=None):
+    with open(src_path, "r", encoding="utf-8") as f:
+        name, first, last, advances, cmap = parse_gfxfont_advances(f.read())
+    if first > ord("0") or last < ord("9"):
+        raise ValueError("font has no digits")
+
+    base = os.path.splitext(os.path.basename(src_path))[0]
+    if base.endswith("_rle"):
+        base = base[:-4]
+    if out_path is None:
+        out_path = os.path.join(os.path.dirname(os.path.abspath(src_path)), base + "_metrics.h")
+    guard = re.sub(r"\W", "_", base.upper()) + "_METRICS_H"
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/* %s glyph advances as constexpr tables (compile-time text widths). */\n" % name)
+        f.write("/* Generated by tools/gfxfont_to_metrics_header.py from %s. */\n" % os.path.basename(src_path))
+        f.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        f.write('#include "gfxfont.h"\n\n')
+        f.write("constexpr uint8_t %sAdvance[] = {\n" % name)
+        for i in range(0, len(advances), 16):
+            f.write("  " + ", ".join("%3u" % a for a in advances[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        if cmap:
+            f.write("constexpr GFXcmap %sMetricsCmap[] = {\n" % name)
+            for cp, gi in cmap:
+                f.write("  { 0x%04X, %3u },\n" % (cp, gi))
+            f.write("};\n\n")
+        f.write("constexpr GFXmetrics %sMetrics = {\n" % name)
+        f.write("  %sAdvance,\n  %sAdvance + (0x30 - 0x%02X),\n  0x%02X, 0x%02X" % (name, name, first, first, last))
+        f.write(",\n  %sMetricsCmap, %u };\n\n" % (name, len(cmap)) if cmap else ", nullptr, 0 };\n\n")
+        f.write("#endif /* %s */\n" % guard)
+    print("Wrote %s (%s, %u advances)" % (out_path, name, len(advances)))
+    return True
+
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+    if not args:
+        print("Usage: python gfxfont_to_metrics_header.py <fonts/Font.h> [output.h]", file=sys.stderr)
+        sys.exit(1)
+    ok = font_to_metrics(args[0], args[1] if len(args) > 1 else None)
+    sys.exit(0 if ok else 1)
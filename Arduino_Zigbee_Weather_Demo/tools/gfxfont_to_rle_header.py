@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""
+Re-encode an Adafruit GFX font header as column run-lengths (GFXFONT_ENC_RLE_COL in fonts/gfxfont.h).
+Each glyph column is one run-count byte followed by (skip, ink) byte pairs, top to bottom, so
+draw_gfxfont_string_4g() in epd_ui.cpp fills one vertical span per run instead of testing every bit.
+The output keeps the font's symbol names, metrics and cmap (codepoints past last, see
+gfxfont_add_glyphs.py): include it instead of the source header.
+Usage: python gfxfont_to_rle_header.py <fonts/Font.h> [output.h]
+Output: fonts/<Font>_rle.h with <FontName>Bitmaps[] (RLE stream), <FontName>Glyphs[], <FontName>Cmap[]
+(if the font has one) and <FontName>.
+"""
+import os
+import re
+import sys
+
+from gfxfont_to_4g_header import parse_gfxfont
+
+
+def glyph_to_rle_columns(bitmap, offset, w, h):
+    """Encode one row-major 1bpp glyph as per-column vertical runs."""
+    out = bytearray()
+    for gx in range(w):
+        runs = []
+        gy = 0
+        while gy < h:
+            start = gy
+            while gy < h and not bit_at(bitmap, offset, w, gx, gy):
+                gy += 1
+            if gy >= h:
+                break
+            skip = gy - start
+            start = gy
+            while gy < h and bit_at(bitmap, offset, w, gx, gy):
+                gy += 1
+            runs.append((skip, gy - start))
+        out.append(len(runs))
+        for skip, ink in runs:
+            out += bytes((skip, ink))
+    return bytes(out)
+
+
+def bit_at(bitmap, offset, w, gx, gy):
+    bit = gx + w * gy
+    return bitmap[offset + (bit >> 3)] & (0x80 >> (bit & 7))
+
+
+def font_to_rle(src_path, out_path=None):
+    with open(src_path, "r", encoding="utf-8") as f:
+        text = f.read()
+    name, bitmap, glyphs, first = parse_gfxfont(text)
+    f_m = re.search(r"const\s+GFXfont\s+\w+\s+PROGMEM\s*=\s*\{.*?0x[0-9A-Fa-f]+\s*,\s*(0x[0-9A-Fa-f]+)\s*,\s*(\d+)",
+                    text, re.S)
+    last, y_advance = int(f_m.group(1), 16), int(f_m.group(2))
+    cmap = []
+    c_m = re.search(r"const\s+GFXcmap\s+\w+Cmap\[\]\s*PROGMEM\s*=\s*\{(.*?)\}\s*;", text, re.S)
+    if c_m:
+        cmap = [(int(cp, 16), int(gi)) for cp, gi in re.findall(r"\{\s*(0x[0-9A-Fa-f]+),\s*(\d+)\s*\}", c_m.group(1))]
+    codes = [first + i for i in range(last - first + 1)] + [0] * (len(glyphs) - (last - first + 1))
+    for cp, gi in cmap:
+        if gi > last - first:
+            codes[gi] = cp
+    data = bytearray()
+    entries = []
+    for i, (offset, w, h, x_adv, x_off, y_off) in enumerate(glyphs):
+        if h > 255:
+            raise ValueError("glyph U+%04X taller than 255 rows" % codes[i])
+        entries.append((len(data), w, h, x_adv, x_off, y_off, codes[i]))
+        data += glyph_to_rle_columns(bitmap, offset, w, h)
+    if len(data) > 0xFFFF:
+        raise ValueError("RLE stream exceeds 16-bit offsets")
+
+    base = os.path.splitext(os.path.basename(src_path))[0]
+    if out_path is None:
+        out_path = os.path.join(os.path.dirname(os.path.abspath(src_path)), base + "_rle.h")
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/* %s as column run-lengths (GFXFONT_ENC_RLE_COL). */\n" % name)
+        f.write("/* Generated by tools/gfxfont_to_rle_header.py from %s; use instead of it. */\n\n"
+                % os.path.basename(src_path))
+        f.write("const uint8_t %sBitmaps[] PROGMEM = {\n" % name)
+        for i in range(0, len(data), 12):
+            f.write("  " + ", ".join("0x%02X" % b for b in data[i:i + 12]) + ",\n")
+        f.write("};\n\n")
+        f.write("const GFXglyph %sGlyphs[] PROGMEM = {\n" % name)
+        for n, (off, w, h, x_adv, x_off, y_off, c) in enumerate(entries):
+            end = " }; //" if n == len(entries) - 1 else ",   //"
+            f.write("  { %5u, %3u, %3u, %3u, %4d, %4d }%s %s '%s'\n"
+                    % (off, w, h, x_adv, x_off, y_off, end, ("U+%04X" if c > 0x7E else "0x%02X") % c, chr(c)))
+        f.write("\n")
+        if cmap:
+            f.write("const GFXcmap %sCmap[] PROGMEM = {\n" % name)
+            for cp, gi in cmap:
+                f.write("  { 0x%04X, %3u },  // U+%04X '%s'\n" % (cp, gi, cp, chr(cp)))
+            f.write("};\n\n")
+        f.write("const GFXfont %s PROGMEM = {\n" % name)
+        f.write("  (uint8_t  *)%sBitmaps,\n  (GFXglyph *)%sGlyphs,\n" % (name, name))
+        f.write("  0x%02X, 0x%02X, %u, GFXFONT_ENC_RLE_COL" % (first, last, y_advance))
+        f.write(", %sCmap, %u };\n\n" % (name, len(cmap)) if cmap else ", NULL, 0 };\n\n")
+        f.write("// Approx. %u bytes\n" % (len(data) + 7 * len(entries) + 4 * len(cmap) + 8))
+    print("Wrote %s (%s, %u -> %u bitmap bytes)" % (out_path, name, len(bitmap), len(data)))
+    return True
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Usage: python gfxfont_to_rle_header.py <fonts/Font.h> [output.h]", file=sys.stderr)
+        sys.exit(1)
+    ok = font_to_rle(sys.argv[1], sys.argv[2] if len(sys.argv) > 2 else None)
+    sys.exit(0 if ok else 1)
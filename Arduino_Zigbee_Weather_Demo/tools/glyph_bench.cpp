@@ -0,0 +1,99 @@
+/**
+ * Host benchmark: the IN/OUT readings drawn through the pre-transposed glyph companions
+ * (fonts/<Font>_4g.h, the path epd_ui.cpp takes) vs the same fonts without them: the column
+ * run-lengths of fonts/<Font>_rle.h, and the plain Adafruit GFX bitmaps of fonts/<Font>.h decoded
+ * bit by bit. Per string: render time into the 4G band buffer per path, and a check that all three
+ * paths leave the same pixels.
+ *
+ * Build and run from tools/ (epd_ui.cpp is compiled in, the panel driver is stubbed out):
+ *   g++ -O2 -I.. '-Dpgm_read_ptr(a)=(*(const void*const*)(a))' -DEPD_UI_BAND_COLS=480u \
+ *       -o glyph_bench glyph_bench.cpp && ./glyph_bench
+ */
+#include "../epd_ui.cpp"
+#include <chrono>
+
+/* The plain GFX bitmaps under the names epd_ui.cpp gives their RLE versions. */
+namespace plain {
+#include "../fonts/InterBold72.h"
+#include "../fonts/InterBold48.h"
+}
+
+void EPD_Dis_Part(unsigned int, unsigned int, const unsigned char *, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Begin(unsigned int, unsigned int, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Data(const unsigned char *, unsigned int) {}
+void EPD_HW_Init_4G(void) {}
+void EPD_HW_Init_Fast(void) {}
+void EPD_Part_Update(void) {}
+void EPD_Update_4G(void) {}
+void EPD_Update_Fast(void) {}
+void EPD_Write_4G_Band(unsigned int, unsigned int, const unsigned char *, const unsigned char *) {}
+void EPD_Write_Fast_Band(unsigned int, unsigned int, const unsigned char *) {}
+
+static_assert(EPD_UI_BAND_COLS == EPD_WIDTH, "build with -DEPD_UI_BAND_COLS=480u: strings are drawn unclipped");
+
+#define BENCH_ROUNDS  5000u
+#define BENCH_X       ((int)EPD_UI_MARGIN + 40)
+
+typedef enum {
+  BENCH_COMPANION,  /* digits from the _4g companion, the rest from the RLE font */
+  BENCH_RLE,        /* RLE font only: a copy of it has no companion */
+  BENCH_GFX,        /* plain Adafruit bitmap */
+  BENCH_PATHS
+} bench_path_t;
+
+typedef struct {
+  const char *label;
+  const char *str;
+  const GFXfont *font;        /* as epd_ui.cpp draws it (RLE, with companion) */
+  const GFXfont *gfx;         /* plain bitmap of the same font */
+  int baseline;
+  unsigned int gray;
+} bench_string_t;
+
+/* The readings of the demo frame at their rows (baselines as in layout_temp_humidity_4g()). */
+static const bench_string_t strings[] = {
+  { "IN temp",      "21.5", &InterTempSemiBold72pt7b, &plain::InterTempSemiBold72pt7b, (int)EPD_UI_IN_TEMP_Y + 103, 3u },
+  { "IN humidity",  "45",   &InterTempSemiBold48pt7b, &plain::InterTempSemiBold48pt7b, (int)EPD_UI_IN_HUMID_Y + 68, 2u },
+  { "OUT temp",     "-3.7", &InterTempSemiBold72pt7b, &plain::InterTempSemiBold72pt7b, (int)EPD_UI_OUT_TEMP_Y + 103, 3u },
+  { "OUT humidity", "81",   &InterTempSemiBold48pt7b, &plain::InterTempSemiBold48pt7b, (int)EPD_UI_OUT_HUMID_Y + 68, 2u },
+};
+#define BENCH_STRINGS  (sizeof(strings) / sizeof(strings[0]))
+
+int main(void) {
+  static unsigned char band[EPD_UI_BAND_BUFFER_SIZE], first[EPD_UI_BAND_BUFFER_SIZE];
+  static epd_ui_ctx_t ctx;
+  epd_ui_ctx_init(&ctx, band);
+  double us[BENCH_STRINGS][BENCH_PATHS] = {};
+  bool same[BENCH_STRINGS] = {};
+
+  printf("%-13s %-5s %13s %9s %9s %8s  %s\n", "string", "", "companion us", "rle us", "gfx us", "vs gfx", "pixels");
+  for (unsigned int s = 0; s < BENCH_STRINGS; s++) {
+    const bench_string_t *b = &strings[s];
+    GFXfont rle_only;  /* same glyphs at another address: gfxfont_4g_for() finds no companion */
+    memcpy(&rle_only, b->font, sizeof(rle_only));
+    const GFXfont *fonts[BENCH_PATHS] = { b->font, &rle_only, b->gfx };
+    same[s] = true;
+    for (unsigned int p = 0; p < BENCH_PATHS; p++) {
+      memset(band, 0, sizeof(band));
+      draw_gfxfont_string_4g(&ctx, BENCH_X, b->baseline, b->str, fonts[p], b->gray);
+      if (p == 0u) memcpy(first, band, sizeof(first));
+      else same[s] = same[s] && memcmp(first, band, sizeof(first)) == 0;
+      auto t0 = std::chrono::steady_clock::now();
+      for (unsigned int n = 0; n < BENCH_ROUNDS; n++)
+        draw_gfxfont_string_4g(&ctx, BENCH_X, b->baseline, b->str, fonts[p], b->gray);
+      auto t1 = std::chrono::steady_clock::now();
+      us[s][p] = std::chrono::duration<double, std::micro>(t1 - t0).count() / BENCH_ROUNDS;
+    }
+    printf("%-13s %-5s %13.2f %9.2f %9.2f %7.1fx  %s\n", b->label, b->str, us[s][BENCH_COMPANION], us[s][BENCH_RLE],
+           us[s][BENCH_GFX], us[s][BENCH_GFX] / us[s][BENCH_COMPANION], same[s] ? "identical" : "DIFFER");
+  }
+
+  double total[BENCH_PATHS] = {};
+  for (unsigned int s = 0; s < BENCH_STRINGS; s++)
+    for (unsigned int p = 0; p < BENCH_PATHS; p++) total[p] += us[s][p];
+  printf("%-19s %13.2f %9.2f %9.2f %7.1fx\n", "all four", total[BENCH_COMPANION], total[BENCH_RLE], total[BENCH_GFX],
+         total[BENCH_GFX] / total[BENCH_COMPANION]);
+  for (unsigned int s = 0; s < BENCH_STRINGS; s++)
+    if (!same[s]) return 1;
+  return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * Host test: where the history charts put the samples. The time axis runs from 24 h before the
+ * newest sample (left edge) to the newest sample (right edge, "latest"), also while the history,
+ * and the uptime its timestamps count, is shorter than that. Renders the history page for a few
+ * histories and checks the first and last chart column with ink in each of the two charts.
+ *
+ * Build and run from tools/ (epd_ui.cpp is compiled in, the panel driver is stubbed out):
+ *   g++ -O2 -I.. '-Dpgm_read_ptr(a)=(*(const void*const*)(a))' -DEPD_UI_BAND_COLS=480u \
+ *       -o history_check history_check.cpp && ./history_check
+ * Exits with 1 if a chart starts or ends more than a column away from where it should.
+ */
+#include "../epd_ui.cpp"
+
+void EPD_Dis_Part(unsigned int, unsigned int, const unsigned char *, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Begin(unsigned int, unsigned int, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Data(const unsigned char *, unsigned int) {}
+void EPD_HW_Init_4G(void) {}
+void EPD_HW_Init_Fast(void) {}
+void EPD_Part_Update(void) {}
+void EPD_Update_4G(void) {}
+void EPD_Update_Fast(void) {}
+void EPD_Write_4G_Band(unsigned int, unsigned int, const unsigned char *, const unsigned char *) {}
+void EPD_Write_Fast_Band(unsigned int, unsigned int, const unsigned char *) {}
+
+static_assert(EPD_UI_BAND_COLS == EPD_WIDTH, "build with -DEPD_UI_BAND_COLS=480u: the page is one band");
+
+typedef struct {
+  const char *name;
+  uint32_t first_t;  /* uptime of the first sample */
+  uint32_t count;    /* samples, 300 s apart */
+} history_case_t;
+
+static const history_case_t cases[] = {
+  { "first 6 h after power on", 20u, 73u },
+  { "first 23 h after power on", 20u, 277u },
+  { "36 h, 24 h shown", 1000u, 433u },
+  { "6 h, after a day of uptime", 90000u, 73u },
+};
+#define CASE_COUNT  (sizeof(cases) / sizeof(cases[0]))
+
+/* First and last column of the plot at y with ink (line or area); false if there is none. */
+static bool chart_columns(const epd_ui_ctx_t *ctx, unsigned int y, unsigned int *x0, unsigned int *x1) {
+  const epd_fb_4g_t fb = band_fb(ctx);
+  const unsigned int py = y + EPD_UI_CHART_CAPTION_H;
+  bool any = false;
+  for (unsigned int x = EPD_UI_MARGIN; x < EPD_UI_MARGIN + EPD_UI_CHART_W; x++)
+    for (unsigned int yy = py; yy < py + EPD_UI_CHART_H; yy++)
+      if (fb.get(x, yy)) {
+        if (!any) *x0 = x;
+        *x1 = x;
+        any = true;
+        break;
+      }
+  return any;
+}
+
+int main(void) {
+  static unsigned char band[EPD_UI_BAND_BUFFER_SIZE];
+  static epd_ui_ctx_t ctx;
+  static epd_ui_history_t history;
+  epd_ui_ctx_init(&ctx, band);
+  int failed = 0;
+
+  for (unsigned int c = 0; c < CASE_COUNT; c++) {
+    const history_case_t *hc = &cases[c];
+    memset(&history, 0, sizeof(history));
+    for (uint32_t i = 0; i < hc->count; i++)
+      epd_ui_history_add(&history, hc->first_t + i * 300u, (int16_t)(200 + (int)((i * 7u) % 60u) - 30),
+                         40 + (int)((i * 3u) % 20u));
+    const epd_ui_sample_t *newest = epd_ui_history_newest(&history);
+    const uint32_t now = newest->t;
+    epd_ui_build_history_page(&ctx, newest->temp_dc, newest->humidity, &history, now);
+    band_render_4g(&ctx, &ctx.frame_dl, 0u, NULL);
+
+    /* Age of the oldest sample still within the span: samples are now - k * 300 s. */
+    const uint32_t k = (hc->count - 1u < EPD_UI_HISTORY_SPAN_S / 300u) ? hc->count - 1u : EPD_UI_HISTORY_SPAN_S / 300u;
+    const uint32_t oldest = k * 300u;
+    const unsigned int want0 = EPD_UI_MARGIN + (EPD_UI_CHART_W - 1u) -
+                               (unsigned int)((uint64_t)oldest * (EPD_UI_CHART_W - 1u) / EPD_UI_HISTORY_SPAN_S);
+    const unsigned int want1 = EPD_UI_MARGIN + EPD_UI_CHART_W - 1u;
+    for (unsigned int series = 0; series < 2u; series++) {
+      unsigned int x0 = 0, x1 = 0;
+      const bool any = chart_columns(&ctx, EPD_UI_HISTORY_CHART_Y + series * EPD_UI_CHART_PANEL_H, &x0, &x1);
+      const bool ok = any && x0 + 1u >= want0 && x0 <= want0 + 1u && x1 + 1u >= want1 && x1 <= want1;
+      printf("%-28s %-11s columns %3u..%3u, want %3u..%3u  %s\n", hc->name, series ? "humidity" : "temperature",
+             x0, x1, want0, want1, ok ? "ok" : "WRONG");
+      if (!ok) failed = 1;
+    }
+  }
+  return failed;
+}
@@ -0,0 +1,122 @@
+/**
+ * Host benchmark: weather icons from the bitmap atlas (composed recipe / baked 70 px image) vs
+ * the vector icons (weather_icon_vectors.h), per icon kind: flash bytes and render time into the
+ * 4G band buffer at the OUT size (106 px) and the forecast card size (70 px).
+ *
+ * Build and run from tools/ (epd_ui.cpp is compiled in, the panel driver is stubbed out):
+ *   g++ -O2 -I.. '-Dpgm_read_ptr(a)=(*(const void*const*)(a))' -DEPD_UI_BAND_COLS=480u \
+ *       -o icon_bench icon_bench.cpp && ./icon_bench
+ * Flash of a bitmap icon counts the compressed layers of its recipe (shared between recipes on
+ * the device) plus its baked 70 px image; a vector icon is its byte stream.
+ */
+#include "../epd_ui.cpp"
+#include <chrono>
+
+void EPD_Dis_Part(unsigned int, unsigned int, const unsigned char *, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Begin(unsigned int, unsigned int, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Data(const unsigned char *, unsigned int) {}
+void EPD_HW_Init_4G(void) {}
+void EPD_HW_Init_Fast(void) {}
+void EPD_Part_Update(void) {}
+void EPD_Update_4G(void) {}
+void EPD_Update_Fast(void) {}
+void EPD_Write_4G_Band(unsigned int, unsigned int, const unsigned char *, const unsigned char *) {}
+void EPD_Write_Fast_Band(unsigned int, unsigned int, const unsigned char *) {}
+
+static_assert(EPD_UI_BAND_COLS == EPD_WIDTH, "build with -DEPD_UI_BAND_COLS=480u: icons are drawn unclipped");
+
+#define BENCH_ROUNDS  2000u
+#define BENCH_X       16u
+#define BENCH_Y       300u
+
+static const char *const kind_names[EPD_UI_ICON_COUNT] = {
+  "clear", "partly_cloudy", "cloudy", "fog", "rain", "snow", "thunderstorm"
+};
+
+/* Compressed size of atlas image i: up to the next image's stream. */
+static unsigned int atlas_image_bytes(unsigned int i) {
+  const unsigned int count = sizeof(weather_icon_images) / sizeof(weather_icon_images[0]);
+  const unsigned int end = (i + 1u < count) ? weather_icon_images[i + 1u].offset : (unsigned int)sizeof(weather_icon_atlas);
+  return end - weather_icon_images[i].offset;
+}
+
+static unsigned int recipe_bytes(const weather_icon_recipe_t *r) {
+  unsigned int n = 0;
+  for (unsigned int i = 0; i < r->count; i++) n += atlas_image_bytes(weather_icon_steps[r->first + i].layer);
+  return n;
+}
+
+static unsigned int vector_bytes(const uint8_t *p) {
+  const uint8_t *start = p;
+  for (;;) {
+    const uint8_t op = *p++;
+    if (op == WEATHER_VEC_END) break;
+    if (op == WEATHER_VEC_CIRCLE) p += 3;
+    else if (op == WEATHER_VEC_BAR) p += 5;
+    else if ((op & 0xC0u) == WEATHER_VEC_POLY) p += 2u * (op & WEATHER_VEC_POLY_MAX);
+  }
+  return (unsigned int)(p - start);
+}
+
+typedef enum { BENCH_RECIPE, BENCH_SCALED, BENCH_VECTOR_106, BENCH_VECTOR_70, BENCH_PATHS } bench_path_t;
+
+/* One draw of kind k along path; false if the kind has no such bitmap. */
+static bool bench_draw(epd_ui_ctx_t *ctx, bench_path_t path, unsigned int k) {
+  const weather_icon_desc_t *d = weather_icon_desc_by_wmo(weather_icon_kind_wmo[k]);
+  switch (path) {
+    case BENCH_RECIPE: {
+      const weather_icon_recipe_t *r = weather_icon_recipe(d->recipe);
+      if (!r) return false;
+      blit_4g_icon_to_4g(ctx, icon_compose(ctx, r), BENCH_X + r->x, BENCH_Y + r->y, r->w, r->h);
+      return true;
+    }
+    case BENCH_SCALED: {
+      const weather_icon_image_t *img = weather_icon_image(d->scaled);
+      if (!img) return false;
+      blit_atlas_4g(ctx, img, BENCH_X, BENCH_Y);
+      return true;
+    }
+    case BENCH_VECTOR_106:
+      vector_icon_draw_4g(ctx, (epd_ui_weather_icon_t)k, BENCH_X, BENCH_Y, EPD_UI_OUT_ICON_W);
+      return true;
+    default:
+      vector_icon_draw_4g(ctx, (epd_ui_weather_icon_t)k, BENCH_X, BENCH_Y, EPD_UI_FORECAST_ICON_W);
+      return true;
+  }
+}
+
+int main(void) {
+  double us[BENCH_PATHS][EPD_UI_ICON_COUNT] = {};
+  bool has[BENCH_PATHS][EPD_UI_ICON_COUNT] = {};
+  static unsigned char band[EPD_UI_BAND_BUFFER_SIZE];
+  static epd_ui_ctx_t ctx;
+  epd_ui_ctx_init(&ctx, band);
+  /* Kinds in turn each round, so icon_compose() never reuses its last result. */
+  for (unsigned int p = 0; p < BENCH_PATHS; p++) {
+    for (unsigned int n = 0; n < BENCH_ROUNDS; n++) {
+      for (unsigned int k = 0; k < EPD_UI_ICON_COUNT; k++) {
+        auto t0 = std::chrono::steady_clock::now();
+        has[p][k] = bench_draw(&ctx, (bench_path_t)p, k);
+        auto t1 = std::chrono::steady_clock::now();
+        us[p][k] += std::chrono::duration<double, std::micro>(t1 - t0).count();
+      }
+    }
+  }
+
+  printf("%-14s %8s %8s | %9s %9s | %9s %9s\n", "kind", "bmp B", "vec B", "recipe us", "vec106 us",
+         "baked us", "vec70 us");
+  unsigned int vec_total = 0;
+  for (unsigned int k = 0; k < EPD_UI_ICON_COUNT; k++) {
+    const weather_icon_desc_t *d = weather_icon_desc_by_wmo(weather_icon_kind_wmo[k]);
+    const weather_icon_recipe_t *r = weather_icon_recipe(d->recipe);
+    const unsigned int bmp = (r ? recipe_bytes(r) : 0u) + ((d->scaled != WEATHER_ICON_NONE) ? atlas_image_bytes(d->scaled) : 0u);
+    const unsigned int vec = vector_bytes(weather_icon_vectors[k]);
+    vec_total += vec;
+    printf("%-14s %8u %8u | %9.2f %9.2f | %9.2f %9.2f\n", kind_names[k], bmp, vec,
+           has[BENCH_RECIPE][k] ? us[BENCH_RECIPE][k] / BENCH_ROUNDS : 0.0, us[BENCH_VECTOR_106][k] / BENCH_ROUNDS,
+           has[BENCH_SCALED][k] ? us[BENCH_SCALED][k] / BENCH_ROUNDS : 0.0, us[BENCH_VECTOR_70][k] / BENCH_ROUNDS);
+  }
+  printf("flash: atlas %u B (all %u WMO recipes and baked images), vector icons %u B\n",
+         (unsigned int)sizeof(weather_icon_atlas), (unsigned int)WEATHER_ICON_WMO_CODES, vec_total);
+  return 0;
+}
@@ -1,10 +1,12 @@
 #!/usr/bin/env python3
 """
-Convert weather icon PNGs to 1-bit C headers for E-ink (4-gray panel).
-Output format: row-major, 8 pixels per byte, MSB = left. 1 = black (drawn), 0 = white.
-Matches blit_1bit_to_4g() in epd_ui.cpp. White background on E-ink.
+Convert weather icon PNGs into the icon atlas for E-ink (4-gray panel): weather_icons/weather_icon_atlas.h.
+The PNGs are cut into layers (sun, cloud, rain drop, snowflake, bolt, fog bands, ...), each a 4G
+column-major 2bpp image trimmed to its ink; every WMO code maps to a recipe that places layers in
+the 106x106 icon frame, composed at draw time by epd_ui.cpp. Each source PNG also gets a 4G
+variant prescaled to the forecast box. All images are PackBits-compressed into one blob, plus the
+layer step, recipe and WMO code -> descriptor tables. Matches weather_icons_4g.h. White background on E-ink.
 """
-import re
 import sys
 from pathlib import Path
 from typing import Tuple
@@ -19,11 +21,12 @@ except ImportError:
 ICON_FRAME_W = 106
 ICON_FRAME_H = 106
 
-# Threshold: pixel luminance below this -> black (1). Above -> white (0). White background.
+# Threshold of the black-only layers (sun, fog bands): luminance below this -> black, else white.
 THRESHOLD = 192
 
-# WMO codes that use 4G icons (only 0 and 45 stay 1-bit: SUN, FOG).
-WMO_4G_IDS = (2, 3, 51, 61, 71, 95)
+# Box size of the prescaled 4G variant of every icon (forecast cards); must match
+# WEATHER_ICON_SCALED_SIZE in weather_icons_4g.h.
+SCALED_SIZE = 70
 
 # -----------------------------------------------------------------------------
 # 4G icon color reference (gray = R=G=B, luminance = R).
@@ -62,113 +65,294 @@ def _bytes_per_col_4g(h: int) -> int:
     return ((h - 1) // 8) * 2 + ((h - 1) % 8) // 4 + 1
 
 
-def png_to_4g(path: Path) -> Tuple[bytes, int, int]:
-    """Load PNG at actual size, convert to 4G column-major 2bpp. Returns (data, w, h)."""
+def png_levels(path: Path, mono: bool = False):
+    """Load PNG at actual size as rows of 4G levels; mono: black (3) / white (0) only, cut at THRESHOLD."""
     img = Image.open(path).convert("RGBA")
     w, h = img.size
+    rows = []
+    for y in range(h):
+        row = []
+        for x in range(w):
+            r, g, b, a = img.getpixel((x, y))
+            lum = (r * 299 + g * 587 + b * 114) // 1000
+            if mono:
+                row.append(3 if a >= 128 and lum < THRESHOLD else 0)
+            else:
+                row.append(lum_to_4g(lum, a))
+        rows.append(row)
+    return rows
+
+
+def levels_to_4g(rows) -> bytes:
+    """Rows of 4G levels -> column-major 2bpp, 4 px per byte, top pixel in the MSBs."""
+    h, w = len(rows), len(rows[0])
     bpc = _bytes_per_col_4g(h)
     out = bytearray(w * bpc)
     for x in range(w):
         for y in range(h):
-            r, g, b, a = img.getpixel((x, y))
-            lum = (r * 299 + g * 587 + b * 114) // 1000
-            val = lum_to_4g(lum, a)
             col_byte = (y // 8) * 2 + (y % 8) // 4
             nibble_shift = (y % 4) * 2
-            byte_ix = x * bpc + col_byte
-            out[byte_ix] &= ~(3 << (6 - nibble_shift))
-            out[byte_ix] |= (val << (6 - nibble_shift))
-    return (bytes(out), w, h)
+            out[x * bpc + col_byte] |= rows[y][x] << (6 - nibble_shift)
+    return bytes(out)
 
 
-def png_to_1bit(path: Path) -> Tuple[bytes, int, int]:
-    """Load PNG at actual size, convert to 1-bit row-major (8 px/byte, MSB left). Returns (data, w, h)."""
+def png_to_4g_scaled(path: Path, box: int) -> Tuple[bytes, int, int]:
+    """Load PNG, fit it into a box x box square (aspect kept, same size as blit_4g_icon_to_4g_fit)
+    with area averaging of the 4G levels, convert to 4G column-major 2bpp. Returns (data, w, h).
+    Averaging levels rather than luminance keeps strokes thinner than a destination pixel as gray
+    instead of dropping them, without haloing every edge in light gray."""
     img = Image.open(path).convert("RGBA")
     w, h = img.size
-    row_stride = (w + 7) // 8
-    out = bytearray(row_stride * h)
-    for y in range(h):
-        for x in range(w):
+    levels = Image.new("F", (w, h))
+    for x in range(w):
+        for y in range(h):
             r, g, b, a = img.getpixel((x, y))
-            if a < 128:
-                bit = 0
-            else:
-                lum = (r * 299 + g * 587 + b * 114) // 1000
-                bit = 1 if lum < THRESHOLD else 0
-            byte_ix = y * row_stride + (x // 8)
-            bit_ix = 7 - (x % 8)
-            if bit:
-                out[byte_ix] |= 1 << bit_ix
-    return (bytes(out), w, h)
-
-
-def emit_header(array_name: str, data: bytes, w: int, h: int, out_path: Path, comment: str = "") -> None:
-    """Write a single C header with per-icon W and H (no PROGMEM; ESP32)."""
-    if not comment:
-        comment = f"1-bit {w}x{h} E-ink icon, row-major, 8 px/byte. White background."
+            lum = (r * 299 + g * 587 + b * 114) // 1000
+            levels.putpixel((x, y), float(lum_to_4g(lum, a)))
+    m = max(w, h)
+    dw, dh = w * box // m, h * box // m
+    small = levels.resize((dw, dh), Image.BOX)
+    bpc = _bytes_per_col_4g(dh)
+    out = bytearray(dw * bpc)
+    for x in range(dw):
+        for y in range(dh):
+            val = min(3, int(small.getpixel((x, y)) + 0.5))
+            col_byte = (y // 8) * 2 + (y % 8) // 4
+            nibble_shift = (y % 4) * 2
+            out[x * bpc + col_byte] |= (val << (6 - nibble_shift))
+    return (bytes(out), dw, dh)
+
+
+def packbits(data: bytes) -> bytes:
+    """PackBits: control byte n < 128 -> n + 1 literal bytes follow; n >= 128 -> next byte
+    repeated n - 126 times (2..129). Matches atlas_stream_* in epd_ui.cpp."""
+    out = bytearray()
+    i, n = 0, len(data)
+    while i < n:
+        j = i
+        while j < n and data[j] == data[i] and j - i < 129:
+            j += 1
+        if j - i >= 2:
+            out += bytes([126 + (j - i), data[i]])
+            i = j
+            continue
+        lit = bytearray()
+        while i < n and len(lit) < 128 and not (i + 1 < n and data[i + 1] == data[i]):
+            lit.append(data[i])
+            i += 1
+        out += bytes([len(lit) - 1]) + lit
+    return bytes(out)
+
+
+# Layers: name -> (PNG, crop (x0, y0, x1, y1) inclusive or None, levels kept or None, mono).
+# Each layer is trimmed to its ink; its home is where it sits in its PNG centered in the frame.
+LAYERS = (
+    ("sun",         "weather_0.png",  None,               None,   True),
+    ("sun_behind",  "weather_2.png",  None,               (2, 3), False),
+    ("cloud_light", "weather_2.png",  None,               (1,),   False),
+    ("overcast",    "weather_3.png",  None,               None,   False),
+    ("fog",         "weather_45.png", None,               None,   True),
+    ("cloud",       "weather_51.png", (0, 0, 105, 63),    None,   False),
+    ("drizzle",     "weather_51.png", (15, 64, 31, 94),   None,   False),
+    ("rain",        "weather_61.png", (31, 78, 45, 103),  None,   False),
+    ("flake",       "weather_71.png", (10, 64, 32, 89),   None,   False),
+    ("bolt",        "weather_95.png", (0, 62, 101, 105),  None,   False),
+)
+
+# Layer ops; must match WEATHER_ICON_OP_* in weather_icons_4g.h.
+OP_OVER = "WEATHER_ICON_OP_OVER"  # non-white layer pixels replace the icon's
+OP_INK = "WEATHER_ICON_OP_INK"    # non-white layer pixels are set black (heavy variants)
+
+# Recipes: name -> (steps, PNG of the prescaled forecast variant or None, WMO codes).
+# Step: (layer, dx, dy[, op]) = layer moved by (dx, dy) from its home. Drawn in order.
+DRIZZLE_ROW = (("drizzle", 0, 0), ("drizzle", 28, 1), ("drizzle", 56, 0))
+RAIN_ROW = (("rain", 0, 0), ("rain", 24, 0), ("rain", 47, 0))
+FLAKE_ROW = (("flake", 0, 0), ("flake", 33, 0), ("flake", 65, 0))
+SHOWER_SKY = (("sun_behind", 0, -13), ("cloud_light", 0, -13))
+RECIPES = (
+    ("clear",          (("sun", 0, 0),), "weather_0.png", (0,)),
+    ("mainly_clear",   (("sun", 0, 0), ("cloud_light", 0, 14)), None, (1,)),
+    ("partly_cloudy",  (("sun_behind", 0, 0), ("cloud_light", 0, 0)), "weather_2.png", (2,)),
+    ("overcast",       (("overcast", 0, 0),), "weather_3.png", None),  # every code not listed
+    ("fog",            (("fog", 0, 0),), "weather_45.png", (45,)),
+    ("rime_fog",       (("fog", 0, -12), ("flake", 32, 0)), None, (48,)),
+    ("drizzle",        (("cloud", 0, 0),) + DRIZZLE_ROW, "weather_51.png", (51, 52, 53, 54, 55, 58, 59)),
+    ("freezing_drizzle", (("cloud", 0, 0), ("drizzle", 0, 0), ("flake", 34, -1), ("drizzle", 56, 0)),
+     None, (56, 57)),
+    ("rain",           SHOWER_SKY + RAIN_ROW, "weather_61.png", (60, 61, 62, 63, 80, 81)),
+    ("heavy_rain",     (("cloud", 0, 0),) + tuple(("rain", dx - 14, dy - 10, OP_INK) for _, dx, dy in RAIN_ROW)
+     + (("rain", 58, -10, OP_INK),), None, (64, 65)),
+    ("freezing_rain",  (("cloud", 0, 0), ("rain", -14, -10), ("flake", 33, -1), ("rain", 47, -10)),
+     None, (66, 67)),
+    ("snow",           (("cloud", 0, 3),) + FLAKE_ROW, "weather_71.png", (71, 73, 75, 77)),
+    ("violent_showers", SHOWER_SKY + tuple(s + (OP_INK,) for s in RAIN_ROW), None, (82,)),
+    ("snow_showers",   SHOWER_SKY + tuple(("flake", dx, dy + 6) for _, dx, dy in FLAKE_ROW), None, (85, 86)),
+    ("thunderstorm",   (("cloud", 0, -5), ("bolt", 0, 0)), "weather_95.png", (95,)),
+    ("thunder_hail",   (("cloud", 0, -5), ("bolt", 0, 0), ("drizzle", -8, -4), ("drizzle", 66, -4)),
+     None, (96, 99)),
+)
+
+# epd_ui_weather_icon_t kinds (epd_ui.h), in enum order, with the WMO code that stands for each.
+ICON_KINDS = (("EPD_UI_ICON_CLEAR", 0), ("EPD_UI_ICON_PARTLY_CLOUDY", 2), ("EPD_UI_ICON_CLOUDY", 3),
+              ("EPD_UI_ICON_FOG", 45), ("EPD_UI_ICON_RAIN", 61), ("EPD_UI_ICON_SNOW", 71),
+              ("EPD_UI_ICON_THUNDERSTORM", 95))
+
+
+def wmo_kind(code: int) -> str:
+    """Icon kind of a WMO code (vector fallback and legacy API); unlisted codes are cloudy."""
+    if code in (0, 1): return "EPD_UI_ICON_CLEAR"
+    if code == 2: return "EPD_UI_ICON_PARTLY_CLOUDY"
+    if code in (45, 48): return "EPD_UI_ICON_FOG"
+    if 51 <= code <= 67 or 80 <= code <= 82: return "EPD_UI_ICON_RAIN"
+    if 71 <= code <= 77 or 85 <= code <= 86: return "EPD_UI_ICON_SNOW"
+    if 95 <= code <= 99: return "EPD_UI_ICON_THUNDERSTORM"
+    return "EPD_UI_ICON_CLOUDY"
+
+
+def cut_layer(icons_dir: Path, png: str, crop, keep, mono):
+    """Levels of one layer trimmed to its ink, and its home (x, y) in the frame."""
+    rows = png_levels(icons_dir / png, mono)
+    h, w = len(rows), len(rows[0])
+    x0, y0, x1, y1 = crop if crop else (0, 0, w - 1, h - 1)
+    cut = [[(v if keep is None or v in keep else 0) for v in row[x0:x1 + 1]] for row in rows[y0:y1 + 1]]
+    ys = [y for y, row in enumerate(cut) if any(row)]
+    xs = [x for x in range(len(cut[0])) if any(row[x] for row in cut)]
+    cut = [row[xs[0]:xs[-1] + 1] for row in cut[ys[0]:ys[-1] + 1]]
+    return cut, ((ICON_FRAME_W - w) // 2 + x0 + xs[0], (ICON_FRAME_H - h) // 2 + y0 + ys[0])
+
+
+def compose(layers, steps):
+    """Frame-sized levels of a recipe, as icon_compose in epd_ui.cpp draws it."""
+    frame = [[0] * ICON_FRAME_W for _ in range(ICON_FRAME_H)]
+    for layer, x, y, op in steps:
+        for ly, row in enumerate(layers[layer][0]):
+            for lx, v in enumerate(row):
+                if v:
+                    frame[y + ly][x + lx] = 3 if op == OP_INK else v
+    return frame
+
+
+def emit_atlas(images, layers, recipes, out_path: Path) -> None:
+    """Write the atlas header: image table, layer steps, recipes, WMO table, kind table and the
+    compressed blob. images: list of (label, data, w, h); layers: name -> image index;
+    recipes: list of (name, steps [(layer, x, y, op)], box (x, y, w, h), scaled image index or None, codes)."""
+    blob = bytearray()
+    rows = []
+    for label, data, w, h in images:
+        rows.append("  { %5u, %3u, %3u },  // %s" % (len(blob), w, h, label))
+        blob += packbits(data)
+    if len(blob) > 0xFFFF:
+        raise ValueError("atlas exceeds 16-bit offsets")
     lines = [
-        f"/* {comment} */",
-        f"#ifndef WEATHER_ICON_{array_name.upper()}_H",
-        f"#define WEATHER_ICON_{array_name.upper()}_H",
+        "/* Weather icon atlas: every layer and prescaled icon PackBits-compressed into one blob",
+        " * (weather_icon_atlas), the image table into it, the layer recipes and the WMO code -> icon",
+        " * descriptor table.",
+        " * Generated by tools/png_to_epd_header.py from weather_icons/weather_<id>.png; do not edit. */",
+        "#ifndef WEATHER_ICON_ATLAS_H",
+        "#define WEATHER_ICON_ATLAS_H",
+        "",
+        "constexpr weather_icon_image_t weather_icon_images[] = {",
+    ] + rows + [
+        "};",
         "",
-        f"#define WEATHER_ICON_{array_name.upper()}_W {w}",
-        f"#define WEATHER_ICON_{array_name.upper()}_H {h}",
+        "/* layer (image index), x, y (in the frame), op; runs of weather_icon_recipes[].first */",
+        "constexpr weather_icon_step_t weather_icon_steps[] = {",
+    ]
+    first = []
+    n = 0
+    for name, steps, _, _, _ in recipes:
+        first.append(n)
+        for layer, x, y, op in steps:
+            lines.append("  { %2u, %3u, %3u, %s },  // %s: %s" % (layers[layer], x, y, op, name, layer))
+            n += 1
+    if n > 0xFF:
+        raise ValueError("too many layer steps")
+    lines += [
+        "};",
         "",
-        f"const unsigned char {array_name}[{len(data)}] = {{",
+        "/* first step, step count, box (x, y, w, h) in the frame */",
+        "constexpr weather_icon_recipe_t weather_icon_recipes[] = {",
     ]
-    for i in range(0, len(data), 16):
-        chunk = data[i : i + 16]
-        hex_str = ", ".join(f"0x{b:02X}" for b in chunk)
-        lines.append(f"  {hex_str},")
-    lines.append("};")
-    lines.append("")
-    lines.append("#endif")
+    for (name, steps, (bx, by, bw, bh), _, _), f in zip(recipes, first):
+        lines.append("  { %3u, %u, %3u, %3u, %3u, %3u },  // %s" % (f, len(steps), bx, by, bw, bh, name))
+    lines += [
+        "};",
+        "",
+        "/* recipe, scaled (WEATHER_ICON_SCALED_SIZE), kind; indexed by WMO code 0..99 */",
+        "constexpr weather_icon_desc_t weather_icon_wmo_table[WEATHER_ICON_WMO_CODES] = {",
+    ]
+    default = next(i for i, r in enumerate(recipes) if r[4] is None)
+    by_code = {code: i for i, r in enumerate(recipes) for code in (r[4] or ())}
+    for code in range(100):
+        i = by_code.get(code, default)
+        scaled = "%3u" % recipes[i][3] if recipes[i][3] is not None else "WEATHER_ICON_NONE"
+        lines.append("  { %2u, %17s, %s },  // %u %s" % (i, scaled, wmo_kind(code), code, recipes[i][0]))
+    lines += [
+        "};",
+        "",
+        "/* WMO code drawn for each epd_ui_weather_icon_t (legacy icon API) */",
+        "constexpr uint8_t weather_icon_kind_wmo[EPD_UI_ICON_COUNT] = { %s };"
+        % ", ".join(str(code) for _, code in ICON_KINDS),
+        "",
+        "const uint8_t weather_icon_atlas[%u] = {" % len(blob),
+    ]
+    for i in range(0, len(blob), 16):
+        lines.append("  " + ", ".join(f"0x{b:02X}" for b in blob[i:i + 16]) + ",")
+    lines += ["};", "", "#endif /* WEATHER_ICON_ATLAS_H */"]
     out_path.write_text("\n".join(lines) + "\n", encoding="utf-8")
-
-
-def emit_4g_header(array_name: str, data: bytes, w: int, h: int, out_path: Path) -> None:
-    """Write 4G (2bpp) column-major icon header with actual W and H."""
-    comment = f"4-gray {w}x{h} E-ink icon, column-major, 2bpp. White background."
-    emit_header(array_name, data, w, h, out_path, comment)
+    raw = sum(len(im[1]) for im in images)
+    print(f"  -> {out_path.name} ({len(images)} images, {len(recipes)} recipes, {raw} -> {len(blob)} bytes)")
 
 
 def main():
     script_dir = Path(__file__).resolve().parent
     project_dir = script_dir.parent
     icons_dir = project_dir / "weather_icons"
-    out_dir = project_dir / "weather_icons"  # Headers in weather_icons/
 
     if not icons_dir.is_dir():
         print(f"No directory: {icons_dir}", file=sys.stderr)
         sys.exit(1)
 
-    pattern = re.compile(r"^weather_(\d+)\.png$")
-    count = 0
-    for png in sorted(icons_dir.iterdir(), key=lambda p: (len(p.name), p.name)):
-        if not png.is_file() or png.suffix.lower() != ".png":
-            continue
-        m = pattern.match(png.name)
-        if not m:
-            continue
-        wid = m.group(1)
-        wid_int = int(wid)
-        array_name = f"weather_{wid}"
-        # 1-bit for all (actual PNG size)
-        data, w1, h1 = png_to_1bit(png)
-        out_path = out_dir / f"weather_icon_{wid}.h"
-        emit_header(array_name, data, w1, h1, out_path)
-        print(f"  {png.name} -> {out_path.name} ({w1}x{h1}, {len(data)} bytes 1-bit)")
-        count += 1
-        # 4G for icons that need grayscale
-        if wid_int in WMO_4G_IDS:
-            data_4g, w4, h4 = png_to_4g(png)
-            name_4g = f"weather_{wid}_4g"
-            path_4g = out_dir / f"weather_icon_{wid}_4g.h"
-            emit_4g_header(name_4g, data_4g, w4, h4, path_4g)
-            print(f"  {png.name} -> {path_4g.name} ({w4}x{h4}, {len(data_4g)} bytes 4G)")
-            count += 1
-
-    print(f"Generated {count} header(s) in {out_dir.relative_to(project_dir)}")
+    images = []
+    layers = {}
+    for name, png, crop, keep, mono in LAYERS:
+        levels, home = cut_layer(icons_dir, png, crop, keep, mono)
+        layers[name] = (levels, home, len(images), mono)
+        images.append((f"{name} layer ({png})", levels_to_4g(levels), len(levels[0]), len(levels)))
+    print(f"  {len(layers)} layers")
+
+    recipes = []
+    for name, steps, scaled_png, codes in RECIPES:
+        placed = []
+        for step in steps:
+            layer, dx, dy = step[:3]
+            op = step[3] if len(step) > 3 else OP_OVER
+            levels, (hx, hy), _, _ = layers[layer]
+            x, y = hx + dx, hy + dy
+            if x < 0 or y < 0 or x + len(levels[0]) > ICON_FRAME_W or y + len(levels) > ICON_FRAME_H:
+                raise ValueError(f"recipe {name}: {layer} at ({x}, {y}) leaves the frame")
+            placed.append((layer, x, y, op))
+        bx0 = min(x for _, x, _, _ in placed)
+        by0 = min(y for _, _, y, _ in placed)
+        bx1 = max(x + len(layers[l][0][0]) for l, x, _, _ in placed)
+        by1 = max(y + len(layers[l][0]) for l, _, y, _ in placed)
+        scaled = None
+        if scaled_png:
+            # Prescaled 4G variant of the source PNG for the forecast boxes
+            data, w, h = png_to_4g_scaled(icons_dir / scaled_png, SCALED_SIZE)
+            scaled = len(images)
+            images.append((f"{scaled_png} 4G {SCALED_SIZE} px", data, w, h))
+            # Recipes standing for a PNG must draw it: report the pixels that differ
+            src = png_levels(icons_dir / scaled_png, all(layers[l][3] for l, _, _, _ in placed))
+            ox, oy = (ICON_FRAME_W - len(src[0])) // 2, (ICON_FRAME_H - len(src)) // 2
+            frame = compose(layers, placed)
+            diff = sum(1 for y in range(ICON_FRAME_H) for x in range(ICON_FRAME_W)
+                       if frame[y][x] != (src[y - oy][x - ox] if 0 <= y - oy < len(src) and 0 <= x - ox < len(src[0]) else 0))
+            print(f"  {name}: {len(placed)} layers, {diff} px differ from {scaled_png}")
+        recipes.append((name, placed, (bx0, by0, bx1 - bx0, by1 - by0), scaled, codes))
+    layer_index = {k: v[2] for k, v in layers.items()}
+
+    emit_atlas(images, layer_index, recipes, icons_dir / "weather_icon_atlas.h")
     return 0
 
 
@@ -0,0 +1,93 @@
+/**
+ * Host benchmark: what storing the 4G frame in panel RAM polarity saves per wake. Before it, the
+ * finished 96000-byte frame was inverted in place (EPD_UI_4G_INVERT) and the vendor's
+ * EPD_WhiteScreen_ALL_4G() (since removed) inverted every byte again on its way to RAM 0x24/0x26.
+ * Times both removed passes over the demo
+ * frame against the write loop that is left, and checks that the two inversions cancel out (the
+ * panel gets the same bytes either way).
+ *
+ * Build and run from tools/ (epd_ui.cpp is compiled in, the panel driver is stubbed out); no
+ * auto-vectorization, as the ESP32-C5 has none:
+ *   g++ -O2 -fno-tree-vectorize -I.. '-Dpgm_read_ptr(a)=(*(const void*const*)(a))' \
+ *       -DEPD_UI_BAND_COLS=480u -o polarity_bench polarity_bench.cpp && ./polarity_bench
+ */
+#include "../epd_ui.cpp"
+#include <chrono>
+
+void EPD_Dis_Part(unsigned int, unsigned int, const unsigned char *, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Begin(unsigned int, unsigned int, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Data(const unsigned char *, unsigned int) {}
+void EPD_HW_Init_4G(void) {}
+void EPD_HW_Init_Fast(void) {}
+void EPD_Part_Update(void) {}
+void EPD_Update_4G(void) {}
+void EPD_Update_Fast(void) {}
+void EPD_Write_4G_Band(unsigned int, unsigned int, const unsigned char *, const unsigned char *) {}
+void EPD_Write_Fast_Band(unsigned int, unsigned int, const unsigned char *) {}
+
+static_assert(EPD_UI_BAND_COLS == EPD_WIDTH, "build with -DEPD_UI_BAND_COLS=480u: the frame is one buffer");
+
+#define BENCH_ROUNDS  500u
+#define FRAME_BYTES   EPD_UI_BAND_BUFFER_SIZE
+
+/* Stands in for EPD_W21_WriteDATA(): the byte has to be produced, the SPI transfer is left out. */
+static volatile unsigned char spi_sink;
+static uint32_t spi_sum;
+
+static void write_frame(const unsigned char *f) {
+  for (unsigned int i = 0; i < FRAME_BYTES; i++) {
+    spi_sink = f[i];
+    spi_sum += f[i];
+  }
+}
+
+static void write_frame_inverted(const unsigned char *f) {
+  for (unsigned int i = 0; i < FRAME_BYTES; i++) {
+    const unsigned char b = (unsigned char)~f[i];
+    spi_sink = b;
+    spi_sum += b;
+  }
+}
+
+static void invert_frame(unsigned char *f) {
+  for (unsigned int i = 0; i < FRAME_BYTES; i++) f[i] = (unsigned char)~f[i];
+}
+
+template <typename F> static double time_us(F f) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (unsigned int n = 0; n < BENCH_ROUNDS; n++) f();
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / BENCH_ROUNDS;
+}
+
+int main(void) {
+  static unsigned char band[EPD_UI_BAND_BUFFER_SIZE], frame[FRAME_BYTES];
+  static epd_ui_ctx_t ctx;
+  const epd_ui_forecast_day_t forecast[3] = { { "18.2.", 3, -2, 4 }, { "19.2.", 61, 1, 7 }, { "20.2.", 71, -4, 0 } };
+  epd_ui_ctx_init(&ctx, band);
+  memcpy(frame, epd_ui_build_demo_4g(&ctx, 215, 45, -37, 81, 61, "10:05", "12:34", forecast, false), FRAME_BYTES);
+
+  /* Same bytes reach the panel: invert, then invert on write == write. */
+  spi_sum = 0;
+  write_frame(frame);
+  const uint32_t direct = spi_sum;
+  invert_frame(frame);
+  spi_sum = 0;
+  write_frame_inverted(frame);
+  const bool same = (spi_sum == direct);
+  invert_frame(frame);
+
+  /* Even rounds pair each invert with the next, so the frame ends as it started. */
+  const double us_invert = time_us([&] { invert_frame(frame); });
+  const double us_write_not = time_us([&] { write_frame_inverted(frame); });
+  const double us_write = time_us([&] { write_frame(frame); });
+  const double saved = us_invert + (us_write_not - us_write);
+
+  printf("per frame (%u bytes, both RAM planes), host us:\n", (unsigned int)FRAME_BYTES);
+  printf("  %-36s %8.1f\n", "frame invert pass (removed)", us_invert);
+  printf("  %-36s %8.1f\n", "driver write loop with ~ (before)", us_write_not);
+  printf("  %-36s %8.1f\n", "driver write loop (now)", us_write);
+  printf("  %-36s %8.1f\n", "saved per full refresh", saved);
+  printf("panel bytes with and without the two inversions: %s\n", same ? "identical" : "DIFFER");
+  return same ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+/**
+ * Host tool: the demo frame as a full 4-gray refresh and as a fast 1-bit refresh (grays as 4x4
+ * ordered dither, see ink_1bit() in epd_ui.cpp). Prints the refresh time the planner assumes for
+ * each mode, the time the host takes to render and convert the frame, and how far the dithered
+ * frame's local gray level strays from the 4G one; writes both frames as PGM images to compare.
+ *
+ * Build and run from tools/ (epd_ui.cpp is compiled in, the panel driver is stubbed out):
+ *   g++ -O2 -I.. '-Dpgm_read_ptr(a)=(*(const void*const*)(a))' -o refresh_mode_compare \
+ *       refresh_mode_compare.cpp && ./refresh_mode_compare [out_prefix]
+ */
+#define EPD_UI_BAND_COLS 480u
+#include "../epd_ui.cpp"
+#include <chrono>
+
+void EPD_Dis_Part(unsigned int, unsigned int, const unsigned char *, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Begin(unsigned int, unsigned int, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Data(const unsigned char *, unsigned int) {}
+void EPD_HW_Init_4G(void) {}
+void EPD_HW_Init_Fast(void) {}
+void EPD_Part_Update(void) {}
+void EPD_Update_4G(void) {}
+void EPD_Update_Fast(void) {}
+void EPD_Write_4G_Band(unsigned int, unsigned int, const unsigned char *, const unsigned char *) {}
+void EPD_Write_Fast_Band(unsigned int, unsigned int, const unsigned char *) {}
+
+/* Screen pixel (x, y) as 0 = white .. 255 = black. */
+static unsigned int level_4g(const unsigned char *f, unsigned int x, unsigned int y) {
+  const unsigned int i = epd_fb_plane_t::byte_index(x, y), s = 7u - y % 8u;
+  return (((f[i] >> s) & 1u) | (((f[EPD_ARRAY + i] >> s) & 1u) << 1)) * 85u;
+}
+static unsigned int level_1bit(const unsigned char *f, unsigned int x, unsigned int y) {
+  return ((f[epd_fb_plane_t::byte_index(x, y)] >> (7u - y % 8u)) & 1u) ? 0u : 255u;
+}
+
+static void write_pgm(const char *path, const unsigned char *f, unsigned int (*level)(const unsigned char *,
+                      unsigned int, unsigned int)) {
+  FILE *o = fopen(path, "wb");
+  if (!o) {
+    perror(path);
+    return;
+  }
+  fprintf(o, "P5\n%u %u\n255\n", (unsigned int)EPD_WIDTH, (unsigned int)EPD_HEIGHT);
+  for (unsigned int y = 0; y < EPD_HEIGHT; y++)
+    for (unsigned int x = 0; x < EPD_WIDTH; x++) fputc(255 - (int)level(f, x, y), o);
+  fclose(o);
+  printf("  -> %s\n", path);
+}
+
+int main(int argc, char **argv) {
+  const char *prefix = (argc > 1) ? argv[1] : "refresh";
+  static unsigned char band[EPD_UI_BAND_BUFFER_SIZE], frame_4g[EPD_UI_BAND_BUFFER_SIZE];
+  static epd_ui_ctx_t ctx;
+  const epd_ui_forecast_day_t forecast[3] = { { "18.2.", 3, -2, 4 }, { "19.2.", 61, 1, 7 }, { "20.2.", 71, -4, 0 } };
+  const int runs = 50;
+
+  using clock = std::chrono::steady_clock;
+  epd_ui_ctx_init(&ctx, band);
+  auto t0 = clock::now();
+  for (int i = 0; i < runs; i++) {
+    epd_ui_build_demo_4g(&ctx, 215, 45, -37, 81, 61, "10:05", "12:34", forecast, false);
+    band_render_4g(&ctx, &ctx.frame_dl, 0u, NULL);
+  }
+  auto t1 = clock::now();
+  memcpy(frame_4g, band, sizeof(frame_4g));
+  for (int i = 0; i < runs; i++) {
+    epd_ui_build_demo_4g(&ctx, 215, 45, -37, 81, 61, "10:05", "12:34", forecast, false);
+    band_to_1bit(&ctx);
+  }
+  auto t2 = clock::now();
+  const double us_4g = std::chrono::duration<double, std::micro>(t1 - t0).count() / runs;
+  const double us_1bit = std::chrono::duration<double, std::micro>(t2 - t1).count() / runs;
+
+  printf("%-6s %12s %14s\n", "mode", "refresh (s)", "host render us");
+  printf("%-6s %12.2f %14.0f\n", "full", EPD_UI_FULL_REFRESH_COST_US / 1e6, us_4g);
+  printf("%-6s %12.2f %14.0f\n", "fast", EPD_UI_FAST_REFRESH_COST_US / 1e6, us_1bit);
+
+  /* Fidelity: mean gray of each 4x4 cell (one dither period) in both frames. */
+  unsigned long cells = 0, gray_cells = 0, err_sum = 0, err_max = 0;
+  unsigned long hist[4] = { 0, 0, 0, 0 };
+  for (unsigned int y = 0; y < EPD_HEIGHT; y += 4u) {
+    for (unsigned int x = 0; x < EPD_WIDTH; x += 4u) {
+      unsigned long a = 0, b = 0;
+      bool gray = false;
+      for (unsigned int dy = 0; dy < 4u; dy++) {
+        for (unsigned int dx = 0; dx < 4u; dx++) {
+          const unsigned int v = level_4g(frame_4g, x + dx, y + dy);
+          hist[v / 85u]++;
+          gray |= (v == 85u || v == 170u);
+          a += v;
+          b += level_1bit(band, x + dx, y + dy);
+        }
+      }
+      const unsigned long e = (a > b ? a - b : b - a) / 16u;
+      cells++;
+      err_sum += e;
+      if (e > err_max) err_max = e;
+      if (gray) gray_cells++;
+    }
+  }
+  printf("pixels: white %lu, light gray %lu, dark gray %lu, black %lu\n", hist[0], hist[1], hist[2], hist[3]);
+  printf("4x4 cell gray error (0..255): mean %.2f over all %lu cells, %.2f over the %lu with gray, max %lu\n",
+         (double)err_sum / cells, cells, gray_cells ? (double)err_sum / gray_cells : 0.0, gray_cells, err_max);
+
+  char path[256];
+  snprintf(path, sizeof(path), "%s_4g.pgm", prefix);
+  write_pgm(path, frame_4g, level_4g);
+  snprintf(path, sizeof(path), "%s_fast.pgm", prefix);
+  write_pgm(path, band, level_1bit);
+  return 0;
+}
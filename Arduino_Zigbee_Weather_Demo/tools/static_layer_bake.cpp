@@ -0,0 +1,106 @@
+/**
+ * Host tool: bake the static layer of the screen (layout_static_4g() in epd_ui.cpp: IN/OUT labels,
+ * separator, forecast card outlines and divider lines) into epd_ui_static_layer.h. The layer is
+ * rendered by epd_ui.cpp itself and stored in the 4G band buffer's native format: per column one
+ * PackBits stream per plane, plane 0 first; identical columns share their streams.
+ *
+ * Build and run from tools/ (epd_ui.cpp is compiled in, the panel driver is stubbed out):
+ *   g++ -O2 -I.. '-Dpgm_read_ptr(a)=(*(const void*const*)(a))' -o static_layer_bake \
+ *       static_layer_bake.cpp && ./static_layer_bake
+ * Rerun whenever the static items, their fonts or the layout values they use change.
+ */
+#define EPD_UI_STATIC_LAYER 0
+#define EPD_UI_BAND_COLS    480u
+#include "../epd_ui.cpp"
+#include <map>
+#include <vector>
+
+void EPD_Dis_Part(unsigned int, unsigned int, const unsigned char *, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Begin(unsigned int, unsigned int, unsigned int, unsigned int) {}
+void EPD_Dis_Part_Data(const unsigned char *, unsigned int) {}
+void EPD_HW_Init_4G(void) {}
+void EPD_HW_Init_Fast(void) {}
+void EPD_Part_Update(void) {}
+void EPD_Update_4G(void) {}
+void EPD_Update_Fast(void) {}
+void EPD_Write_4G_Band(unsigned int, unsigned int, const unsigned char *, const unsigned char *) {}
+void EPD_Write_Fast_Band(unsigned int, unsigned int, const unsigned char *) {}
+
+/* Same encoding as packbits() in png_to_epd_header.py. */
+static std::vector<uint8_t> packbits(const std::vector<uint8_t> &data) {
+  std::vector<uint8_t> out;
+  size_t i = 0;
+  const size_t n = data.size();
+  while (i < n) {
+    size_t j = i;
+    while (j < n && data[j] == data[i] && j - i < 129u) j++;
+    if (j - i >= 2u) {
+      out.push_back((uint8_t)(126u + (j - i)));
+      out.push_back(data[i]);
+      i = j;
+      continue;
+    }
+    std::vector<uint8_t> lit;
+    while (i < n && lit.size() < 128u && !(i + 1u < n && data[i + 1u] == data[i])) lit.push_back(data[i++]);
+    out.push_back((uint8_t)(lit.size() - 1u));
+    out.insert(out.end(), lit.begin(), lit.end());
+  }
+  return out;
+}
+
+int main(int argc, char **argv) {
+  const char *path = (argc > 1) ? argv[1] : "../epd_ui_static_layer.h";
+  static unsigned char band[EPD_UI_BAND_BUFFER_SIZE];
+  static epd_ui_ctx_t ctx;
+  epd_ui_ctx_init(&ctx, band);
+  layout_static_4g(&ctx.frame_dl);
+  band_render_4g(&ctx, &ctx.frame_dl, 0u, NULL);
+  const epd_fb_4g_t fb = band_fb(&ctx);
+
+  std::vector<uint8_t> blob;
+  std::map<std::vector<uint8_t>, unsigned int> seen;
+  unsigned int cols[EPD_WIDTH];
+  for (unsigned int x = 0; x < EPD_WIDTH; x++) {
+    std::vector<uint8_t> packed;
+    for (unsigned int k = 0; k < epd_fb_4g_t::kPlanes; k++) {
+      const uint8_t *p = fb.plane_bits(k) + epd_fb_plane_t::byte_index(x, 0u);
+      const std::vector<uint8_t> plane = packbits(std::vector<uint8_t>(p, p + EPD_4G_BYTES_PER_COL));
+      packed.insert(packed.end(), plane.begin(), plane.end());
+    }
+    auto it = seen.find(packed);
+    if (it == seen.end()) {
+      it = seen.emplace(packed, (unsigned int)blob.size()).first;
+      blob.insert(blob.end(), packed.begin(), packed.end());
+    }
+    cols[x] = it->second;
+  }
+  if (blob.size() > 0xFFFFu) {
+    fprintf(stderr, "static layer too large for 16-bit offsets (%zu bytes)\n", blob.size());
+    return 1;
+  }
+
+  FILE *f = fopen(path, "w");
+  if (!f) {
+    perror(path);
+    return 1;
+  }
+  fprintf(f, "/* Static layer of the screen (labels, separator, forecast card outlines and divider lines) in\n"
+             " * the 4G band buffer's format: per column a PackBits stream of its %u bytes in plane 0, then one\n"
+             " * for plane 1, at epd_ui_static_layer + epd_ui_static_layer_cols[x] (identical columns share\n"
+             " * them). Drawn under every band by band_render_4g() in epd_ui.cpp.\n"
+             " * Generated by tools/static_layer_bake.cpp; do not edit. */\n",
+          EPD_4G_BYTES_PER_COL);
+  fprintf(f, "#ifndef EPD_UI_STATIC_LAYER_H\n#define EPD_UI_STATIC_LAYER_H\n\n");
+  fprintf(f, "#define EPD_UI_STATIC_LAYER_KEY  0x%08lXul  /* static_layer_key() it was baked with */\n\n",
+          (unsigned long)static_layer_key());
+  fprintf(f, "constexpr uint16_t epd_ui_static_layer_cols[%u] = {\n", (unsigned int)EPD_WIDTH);
+  for (unsigned int x = 0; x < EPD_WIDTH; x++)
+    fprintf(f, "%s%5u,%s", (x % 12u == 0u) ? "  " : " ", cols[x], (x % 12u == 11u || x + 1u == EPD_WIDTH) ? "\n" : "");
+  fprintf(f, "};\n\nconstexpr uint8_t epd_ui_static_layer[%zu] = {\n", blob.size());
+  for (size_t i = 0; i < blob.size(); i++)
+    fprintf(f, "%s0x%02X,%s", (i % 16u == 0u) ? "  " : " ", blob[i], (i % 16u == 15u || i + 1u == blob.size()) ? "\n" : "");
+  fprintf(f, "};\n\n#endif /* EPD_UI_STATIC_LAYER_H */\n");
+  fclose(f);
+  printf("  -> %s (%zu bytes, %zu distinct columns)\n", path, blob.size(), seen.size());
+  return 0;
+}
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""
+Emit the vector weather icons (one per epd_ui_weather_icon_t kind) as weather_icons/weather_icon_vectors.h.
+Icons are drawn on a 256 x 256 design grid that maps onto the icon square at any size; each is a
+byte stream of paths (a gray level, then circles, round-capped bars and polygons filled with it)
+rasterized column by column by vector_icon_draw() in epd_ui.cpp. Command bytes match
+WEATHER_VEC_* in weather_icons_4g.h.
+Usage: python vector_icons_to_header.py [--preview out.png]
+  --preview: also render every icon at 106 and 70 px (same sampling as epd_ui.cpp) into a PNG.
+"""
+import math
+import sys
+from pathlib import Path
+
+VEC_END = 0x00
+VEC_GRAY = 0x10     # | gray 0..3 (0 = white)
+VEC_CIRCLE = 0x20   # cx, cy, r
+VEC_BAR = 0x21      # x0, y0, x1, y1, r: segment with round caps
+VEC_POLY = 0x40     # | n (3..63), then n (x, y) pairs, even-odd fill
+
+# Sub-pixel bits of the rasterizer (WEATHER_VEC_FRAC_BITS in weather_icons_4g.h).
+FRAC_BITS = 4
+
+
+def u8(v):
+    v = int(round(v))
+    if not 0 <= v <= 255:
+        raise ValueError("coordinate %d outside the design grid" % v)
+    return v
+
+
+def circle(cx, cy, r):
+    return [VEC_CIRCLE, u8(cx), u8(cy), u8(r)]
+
+
+def bar(x0, y0, x1, y1, r):
+    return [VEC_BAR, u8(x0), u8(y0), u8(x1), u8(y1), u8(r)]
+
+
+def poly(*pts):
+    out = [VEC_POLY | len(pts)]
+    for x, y in pts:
+        out += [u8(x), u8(y)]
+    return out
+
+
+def path(gray, *shapes):
+    out = [VEC_GRAY | gray]
+    for s in shapes:
+        out += s
+    return out
+
+
+def cloud(cx, cy, s, grow=0):
+    """Cloud of three puffs on a round-capped base, centered at (cx, cy), s = scale (1 = 168 wide)."""
+    return [
+        bar(cx - 60 * s, cy + 20 * s, cx + 60 * s, cy + 20 * s, 24 * s + grow),
+        circle(cx - 34 * s, cy + 4 * s, 30 * s + grow),
+        circle(cx + 4 * s, cy - 16 * s, 40 * s + grow),
+        circle(cx + 44 * s, cy + 6 * s, 28 * s + grow),
+    ]
+
+
+def sun(cx, cy, r, ray0, ray1, ray_w):
+    rays = [bar(cx + ray0 * math.cos(a), cy + ray0 * math.sin(a), cx + ray1 * math.cos(a), cy + ray1 * math.sin(a), ray_w)
+            for a in (i * math.pi / 4 for i in range(8))]
+    return [circle(cx, cy, r)] + rays
+
+
+def drop(x, y, s):
+    """Rain drop with its tip at (x, y)."""
+    return [poly((x, y), (x - 9 * s, y + 20 * s), (x + 9 * s, y + 20 * s)), circle(x, y + 22 * s, 10 * s)]
+
+
+def flake(x, y, r):
+    return [bar(x + r * math.cos(a), y + r * math.sin(a), x - r * math.cos(a), y - r * math.sin(a), 3)
+            for a in (math.pi / 2, math.pi / 6, -math.pi / 6)]
+
+
+def bolt(x, y):
+    return [poly((x + 10, y), (x + 40, y), (x + 26, y + 28), (x + 44, y + 28), (x + 4, y + 84),
+                 (x + 14, y + 42), (x - 4, y + 42))]
+
+
+# epd_ui_weather_icon_t kinds in enum order (epd_ui.h).
+ICONS = (
+    ("clear", path(3, *sun(128, 128, 50, 72, 112, 7))),
+    ("partly_cloudy", path(3, *sun(92, 88, 34, 50, 76, 6))
+     + path(0, *cloud(148, 148, 0.9, 8)) + path(1, *cloud(148, 148, 0.9))),
+    ("cloudy", path(3, *cloud(160, 100, 0.7)) + path(0, *cloud(112, 150, 0.95, 8))
+     + path(1, *cloud(112, 150, 0.95))),
+    ("fog", path(3, bar(40, 64, 200, 64, 8), bar(64, 100, 224, 100, 8), bar(24, 136, 160, 136, 8),
+                 bar(190, 136, 232, 136, 8), bar(48, 172, 208, 172, 8), bar(80, 208, 176, 208, 8))),
+    ("rain", path(3, *cloud(128, 96, 1.0)) + path(2, *(drop(76, 160, 1.4) + drop(128, 172, 1.4) + drop(180, 160, 1.4)))),
+    ("snow", path(3, *cloud(128, 96, 1.0)) + path(2, *(flake(76, 190, 20) + flake(128, 200, 20) + flake(180, 190, 20)))),
+    ("thunderstorm", path(3, *cloud(128, 92, 1.0)) + path(2, *bolt(112, 156))),
+)
+
+
+def emit(out_path: Path):
+    lines = [
+        "/* Vector weather icons: per epd_ui_weather_icon_t kind, paths on a 256 x 256 design grid",
+        " * (WEATHER_VEC_* streams, rasterized at any size by vector_icon_draw() in epd_ui.cpp).",
+        " * Generated by tools/vector_icons_to_header.py; do not edit. */",
+        "#ifndef WEATHER_ICON_VECTORS_H",
+        "#define WEATHER_ICON_VECTORS_H",
+        "",
+    ]
+    total = 0
+    for name, data in ICONS:
+        data = data + [VEC_END]
+        total += len(data)
+        lines.append("constexpr uint8_t weather_vec_%s[] = {" % name)
+        for i in range(0, len(data), 16):
+            lines.append("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        lines += ["};", ""]
+    lines.append("constexpr const uint8_t *weather_icon_vectors[EPD_UI_ICON_COUNT] = {")
+    lines += ["  weather_vec_%s," % name for name, _ in ICONS]
+    lines += ["};", "", "#endif /* WEATHER_ICON_VECTORS_H */"]
+    out_path.write_text("\n".join(lines) + "\n", encoding="utf-8")
+    print(f"  -> {out_path.name} ({len(ICONS)} icons, {total} bytes)")
+
+
+def tdiv(a, b):
+    """Integer division truncating toward zero, like C."""
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def rasterize(data, size):
+    """Rows of 4G levels of one icon at size x size px, sampled like vector_icon_draw()."""
+    one = 1 << FRAC_BITS
+    half = one // 2
+    px = [[0] * size for _ in range(size)]
+
+    def fx(v):
+        return (v * size) >> (8 - FRAC_BITS)
+
+    def spans_fill(c0, c1, spans_at):
+        for c in range(max(c0, 0), min(c1, size)):
+            for ya, yb in spans_at(c * one + half):
+                for r in range(max((ya + half - 1) >> FRAC_BITS, 0), min((yb + half - 1) >> FRAC_BITS, size)):
+                    px[r][c] = gray
+
+    def fill_circle(cx, cy, rr):
+        def at(x):
+            d = x - cx
+            if abs(d) >= rr:
+                return []
+            h = math.isqrt(rr * rr - d * d)
+            return [(cy - h, cy + h)]
+        spans_fill((cx - rr + half - 1) >> FRAC_BITS, (cx + rr + half - 1) >> FRAC_BITS, at)
+
+    def fill_poly(pts):
+        def at(x):
+            ys = []
+            for i in range(len(pts)):
+                (xa, ya), (xb, yb) = pts[i], pts[(i + 1) % len(pts)]
+                if min(xa, xb) <= x < max(xa, xb):
+                    ys.append(ya + int((x - xa) * (yb - ya) / (xb - xa)))
+            ys.sort()
+            return list(zip(ys[0::2], ys[1::2]))
+        xs = [p[0] for p in pts]
+        spans_fill((min(xs) + half - 1) >> FRAC_BITS, (max(xs) + half - 1) >> FRAC_BITS, at)
+
+    gray = 0
+    i = 0
+    while data[i] != VEC_END:
+        c = data[i]
+        if c & 0xF0 == VEC_GRAY:
+            gray = c & 3
+            i += 1
+        elif c == VEC_CIRCLE:
+            fill_circle(fx(data[i + 1]), fx(data[i + 2]), fx(data[i + 3]))
+            i += 4
+        elif c == VEC_BAR:
+            x0, y0, x1, y1, r = data[i + 1:i + 6]
+            dx, dy = x1 - x0, y1 - y0
+            n = math.isqrt(dx * dx + dy * dy)
+            nx, ny = (tdiv(-dy * r * 16, n), tdiv(dx * r * 16, n)) if n else (0, 0)
+            nx, ny = (nx * size) >> (12 - FRAC_BITS), (ny * size) >> (12 - FRAC_BITS)
+            a, b = (fx(x0), fx(y0)), (fx(x1), fx(y1))
+            if n:
+                fill_poly([(a[0] + nx, a[1] + ny), (b[0] + nx, b[1] + ny), (b[0] - nx, b[1] - ny), (a[0] - nx, a[1] - ny)])
+            fill_circle(a[0], a[1], fx(r))
+            fill_circle(b[0], b[1], fx(r))
+            i += 6
+        else:
+            n = c & 0x3F
+            fill_poly([(fx(data[i + 1 + 2 * k]), fx(data[i + 2 + 2 * k])) for k in range(n)])
+            i += 1 + 2 * n
+    return px
+
+
+def preview(out_png: Path):
+    from PIL import Image
+    shades = (255, 200, 120, 30)
+    img = Image.new("L", (len(ICONS) * 110, 110 + 74), 255)
+    for k, (_, data) in enumerate(ICONS):
+        for size, oy in ((106, 0), (70, 110)):
+            px = rasterize(data + [VEC_END], size)
+            for y in range(size):
+                for x in range(size):
+                    img.putpixel((k * 110 + x, oy + y), shades[px[y][x]])
+    img.save(out_png)
+    print(f"  -> {out_png}")
+
+
+def main():
+    project_dir = Path(__file__).resolve().parent.parent
+    emit(project_dir / "weather_icons" / "weather_icon_vectors.h")
+    if len(sys.argv) > 2 and sys.argv[1] == "--preview":
+        preview(Path(sys.argv[2]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,872 @@
+/* Weather icon atlas: every layer and prescaled icon PackBits-compressed into one blob
+ * (weather_icon_atlas), the image table into it, the layer recipes and the WMO code -> icon
+ * descriptor table.
+ * Generated by tools/png_to_epd_header.py from weather_icons/weather_<id>.png; do not edit. */
+#ifndef WEATHER_ICON_ATLAS_H
+#define WEATHER_ICON_ATLAS_H
+
+constexpr weather_icon_image_t weather_icon_images[] = {
+  {     0, 106, 106 },  // sun layer (weather_0.png)
+  {   965,  58,  58 },  // sun_behind layer (weather_2.png)
+  {  1373,  88,  53 },  // cloud_light layer (weather_2.png)
+  {  1939, 106,  58 },  // overcast layer (weather_3.png)
+  {  2746, 106,  57 },  // fog layer (weather_45.png)
+  {  4261, 106,  64 },  // cloud layer (weather_51.png)
+  {  4807,  17,  25 },  // drizzle layer (weather_51.png)
+  {  4907,  15,  20 },  // rain layer (weather_61.png)
+  {  4978,  23,  22 },  // flake layer (weather_71.png)
+  {  5106,  43,  40 },  // bolt layer (weather_95.png)
+  {  5375,  70,  70 },  // weather_0.png 4G 70 px
+  {  6010,  70,  51 },  // weather_2.png 4G 70 px
+  {  6621,  70,  38 },  // weather_3.png 4G 70 px
+  {  7127,  70,  37 },  // weather_45.png 4G 70 px
+  {  7861,  70,  62 },  // weather_51.png 4G 70 px
+  {  8539,  70,  68 },  // weather_61.png 4G 70 px
+  {  9295,  70,  59 },  // weather_71.png 4G 70 px
+  {  9963,  67,  70 },  // weather_95.png 4G 70 px
+};
+
+/* layer (image index), x, y (in the frame), op; runs of weather_icon_recipes[].first */
+constexpr weather_icon_step_t weather_icon_steps[] = {
+  {  0,   0,   0, WEATHER_ICON_OP_OVER },  // clear: sun
+  {  0,   0,   0, WEATHER_ICON_OP_OVER },  // mainly_clear: sun
+  {  2,  18,  53, WEATHER_ICON_OP_OVER },  // mainly_clear: cloud_light
+  {  1,   0,  14, WEATHER_ICON_OP_OVER },  // partly_cloudy: sun_behind
+  {  2,  18,  39, WEATHER_ICON_OP_OVER },  // partly_cloudy: cloud_light
+  {  3,   0,  24, WEATHER_ICON_OP_OVER },  // overcast: overcast
+  {  4,   0,  24, WEATHER_ICON_OP_OVER },  // fog: fog
+  {  4,   0,  12, WEATHER_ICON_OP_OVER },  // rime_fog: fog
+  {  8,  42,  76, WEATHER_ICON_OP_OVER },  // rime_fog: flake
+  {  5,   0,   5, WEATHER_ICON_OP_OVER },  // drizzle: cloud
+  {  6,  15,  75, WEATHER_ICON_OP_OVER },  // drizzle: drizzle
+  {  6,  43,  76, WEATHER_ICON_OP_OVER },  // drizzle: drizzle
+  {  6,  71,  75, WEATHER_ICON_OP_OVER },  // drizzle: drizzle
+  {  5,   0,   5, WEATHER_ICON_OP_OVER },  // freezing_drizzle: cloud
+  {  6,  15,  75, WEATHER_ICON_OP_OVER },  // freezing_drizzle: drizzle
+  {  8,  44,  75, WEATHER_ICON_OP_OVER },  // freezing_drizzle: flake
+  {  6,  71,  75, WEATHER_ICON_OP_OVER },  // freezing_drizzle: drizzle
+  {  1,   0,   1, WEATHER_ICON_OP_OVER },  // rain: sun_behind
+  {  2,  18,  26, WEATHER_ICON_OP_OVER },  // rain: cloud_light
+  {  7,  31,  85, WEATHER_ICON_OP_OVER },  // rain: rain
+  {  7,  55,  85, WEATHER_ICON_OP_OVER },  // rain: rain
+  {  7,  78,  85, WEATHER_ICON_OP_OVER },  // rain: rain
+  {  5,   0,   5, WEATHER_ICON_OP_OVER },  // heavy_rain: cloud
+  {  7,  17,  75, WEATHER_ICON_OP_INK },  // heavy_rain: rain
+  {  7,  41,  75, WEATHER_ICON_OP_INK },  // heavy_rain: rain
+  {  7,  64,  75, WEATHER_ICON_OP_INK },  // heavy_rain: rain
+  {  7,  89,  75, WEATHER_ICON_OP_INK },  // heavy_rain: rain
+  {  5,   0,   5, WEATHER_ICON_OP_OVER },  // freezing_rain: cloud
+  {  7,  17,  75, WEATHER_ICON_OP_OVER },  // freezing_rain: rain
+  {  8,  43,  75, WEATHER_ICON_OP_OVER },  // freezing_rain: flake
+  {  7,  78,  75, WEATHER_ICON_OP_OVER },  // freezing_rain: rain
+  {  5,   0,   8, WEATHER_ICON_OP_OVER },  // snow: cloud
+  {  8,  10,  76, WEATHER_ICON_OP_OVER },  // snow: flake
+  {  8,  43,  76, WEATHER_ICON_OP_OVER },  // snow: flake
+  {  8,  75,  76, WEATHER_ICON_OP_OVER },  // snow: flake
+  {  1,   0,   1, WEATHER_ICON_OP_OVER },  // violent_showers: sun_behind
+  {  2,  18,  26, WEATHER_ICON_OP_OVER },  // violent_showers: cloud_light
+  {  7,  31,  85, WEATHER_ICON_OP_INK },  // violent_showers: rain
+  {  7,  55,  85, WEATHER_ICON_OP_INK },  // violent_showers: rain
+  {  7,  78,  85, WEATHER_ICON_OP_INK },  // violent_showers: rain
+  {  1,   0,   1, WEATHER_ICON_OP_OVER },  // snow_showers: sun_behind
+  {  2,  18,  26, WEATHER_ICON_OP_OVER },  // snow_showers: cloud_light
+  {  8,  10,  82, WEATHER_ICON_OP_OVER },  // snow_showers: flake
+  {  8,  43,  82, WEATHER_ICON_OP_OVER },  // snow_showers: flake
+  {  8,  75,  82, WEATHER_ICON_OP_OVER },  // snow_showers: flake
+  {  5,   0,   0, WEATHER_ICON_OP_OVER },  // thunderstorm: cloud
+  {  9,  30,  65, WEATHER_ICON_OP_OVER },  // thunderstorm: bolt
+  {  5,   0,   0, WEATHER_ICON_OP_OVER },  // thunder_hail: cloud
+  {  9,  30,  65, WEATHER_ICON_OP_OVER },  // thunder_hail: bolt
+  {  6,   7,  71, WEATHER_ICON_OP_OVER },  // thunder_hail: drizzle
+  {  6,  81,  71, WEATHER_ICON_OP_OVER },  // thunder_hail: drizzle
+};
+
+/* first step, step count, box (x, y, w, h) in the frame */
+constexpr weather_icon_recipe_t weather_icon_recipes[] = {
+  {   0, 1,   0,   0, 106, 106 },  // clear
+  {   1, 2,   0,   0, 106, 106 },  // mainly_clear
+  {   3, 2,   0,  14, 106,  78 },  // partly_cloudy
+  {   5, 1,   0,  24, 106,  58 },  // overcast
+  {   6, 1,   0,  24, 106,  57 },  // fog
+  {   7, 2,   0,  12, 106,  86 },  // rime_fog
+  {   9, 4,   0,   5, 106,  96 },  // drizzle
+  {  13, 4,   0,   5, 106,  95 },  // freezing_drizzle
+  {  17, 5,   0,   1, 106, 104 },  // rain
+  {  22, 5,   0,   5, 106,  90 },  // heavy_rain
+  {  27, 4,   0,   5, 106,  92 },  // freezing_rain
+  {  31, 4,   0,   8, 106,  90 },  // snow
+  {  35, 5,   0,   1, 106, 104 },  // violent_showers
+  {  40, 5,   0,   1, 106, 103 },  // snow_showers
+  {  45, 2,   0,   0, 106, 105 },  // thunderstorm
+  {  47, 4,   0,   0, 106, 105 },  // thunder_hail
+};
+
+/* recipe, scaled (WEATHER_ICON_SCALED_SIZE), kind; indexed by WMO code 0..99 */
+constexpr weather_icon_desc_t weather_icon_wmo_table[WEATHER_ICON_WMO_CODES] = {
+  {  0,                10, EPD_UI_ICON_CLEAR },  // 0 clear
+  {  1, WEATHER_ICON_NONE, EPD_UI_ICON_CLEAR },  // 1 mainly_clear
+  {  2,                11, EPD_UI_ICON_PARTLY_CLOUDY },  // 2 partly_cloudy
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 3 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 4 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 5 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 6 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 7 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 8 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 9 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 10 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 11 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 12 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 13 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 14 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 15 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 16 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 17 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 18 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 19 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 20 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 21 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 22 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 23 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 24 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 25 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 26 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 27 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 28 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 29 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 30 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 31 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 32 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 33 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 34 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 35 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 36 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 37 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 38 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 39 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 40 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 41 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 42 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 43 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 44 overcast
+  {  4,                13, EPD_UI_ICON_FOG },  // 45 fog
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 46 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 47 overcast
+  {  5, WEATHER_ICON_NONE, EPD_UI_ICON_FOG },  // 48 rime_fog
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 49 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 50 overcast
+  {  6,                14, EPD_UI_ICON_RAIN },  // 51 drizzle
+  {  6,                14, EPD_UI_ICON_RAIN },  // 52 drizzle
+  {  6,                14, EPD_UI_ICON_RAIN },  // 53 drizzle
+  {  6,                14, EPD_UI_ICON_RAIN },  // 54 drizzle
+  {  6,                14, EPD_UI_ICON_RAIN },  // 55 drizzle
+  {  7, WEATHER_ICON_NONE, EPD_UI_ICON_RAIN },  // 56 freezing_drizzle
+  {  7, WEATHER_ICON_NONE, EPD_UI_ICON_RAIN },  // 57 freezing_drizzle
+  {  6,                14, EPD_UI_ICON_RAIN },  // 58 drizzle
+  {  6,                14, EPD_UI_ICON_RAIN },  // 59 drizzle
+  {  8,                15, EPD_UI_ICON_RAIN },  // 60 rain
+  {  8,                15, EPD_UI_ICON_RAIN },  // 61 rain
+  {  8,                15, EPD_UI_ICON_RAIN },  // 62 rain
+  {  8,                15, EPD_UI_ICON_RAIN },  // 63 rain
+  {  9, WEATHER_ICON_NONE, EPD_UI_ICON_RAIN },  // 64 heavy_rain
+  {  9, WEATHER_ICON_NONE, EPD_UI_ICON_RAIN },  // 65 heavy_rain
+  { 10, WEATHER_ICON_NONE, EPD_UI_ICON_RAIN },  // 66 freezing_rain
+  { 10, WEATHER_ICON_NONE, EPD_UI_ICON_RAIN },  // 67 freezing_rain
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 68 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 69 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 70 overcast
+  { 11,                16, EPD_UI_ICON_SNOW },  // 71 snow
+  {  3,                12, EPD_UI_ICON_SNOW },  // 72 overcast
+  { 11,                16, EPD_UI_ICON_SNOW },  // 73 snow
+  {  3,                12, EPD_UI_ICON_SNOW },  // 74 overcast
+  { 11,                16, EPD_UI_ICON_SNOW },  // 75 snow
+  {  3,                12, EPD_UI_ICON_SNOW },  // 76 overcast
+  { 11,                16, EPD_UI_ICON_SNOW },  // 77 snow
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 78 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 79 overcast
+  {  8,                15, EPD_UI_ICON_RAIN },  // 80 rain
+  {  8,                15, EPD_UI_ICON_RAIN },  // 81 rain
+  { 12, WEATHER_ICON_NONE, EPD_UI_ICON_RAIN },  // 82 violent_showers
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 83 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 84 overcast
+  { 13, WEATHER_ICON_NONE, EPD_UI_ICON_SNOW },  // 85 snow_showers
+  { 13, WEATHER_ICON_NONE, EPD_UI_ICON_SNOW },  // 86 snow_showers
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 87 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 88 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 89 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 90 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 91 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 92 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 93 overcast
+  {  3,                12, EPD_UI_ICON_CLOUDY },  // 94 overcast
+  { 14,                17, EPD_UI_ICON_THUNDERSTORM },  // 95 thunderstorm
+  { 15, WEATHER_ICON_NONE, EPD_UI_ICON_THUNDERSTORM },  // 96 thunder_hail
+  {  3,                12, EPD_UI_ICON_THUNDERSTORM },  // 97 overcast
+  {  3,                12, EPD_UI_ICON_THUNDERSTORM },  // 98 overcast
+  { 15, WEATHER_ICON_NONE, EPD_UI_ICON_THUNDERSTORM },  // 99 thunder_hail
+};
+
+/* WMO code drawn for each epd_ui_weather_icon_t (legacy icon API) */
+constexpr uint8_t weather_icon_kind_wmo[EPD_UI_ICON_COUNT] = { 0, 2, 3, 45, 61, 71, 95 };
+
+const uint8_t weather_icon_atlas[10520] = {
+  0x8B, 0x00, 0x00, 0xF0, 0x97, 0x00, 0x01, 0x03, 0xFC, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00,
+  0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01,
+  0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F,
+  0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF,
+  0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x8F, 0x00, 0x00, 0xFC, 0x85, 0x00,
+  0x01, 0x0F, 0xFF, 0x85, 0x00, 0x01, 0x03, 0xF0, 0x85, 0x00, 0x01, 0x03, 0xFF, 0x85, 0x00, 0x01,
+  0x0F, 0xFF, 0x85, 0x00, 0x01, 0x0F, 0xFC, 0x85, 0x00, 0x02, 0x03, 0xFF, 0xC0, 0x84, 0x00, 0x01,
+  0x0F, 0xFF, 0x85, 0x00, 0x01, 0x3F, 0xFC, 0x85, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0x84, 0x00, 0x01,
+  0x0F, 0xFF, 0x85, 0x00, 0x01, 0xFF, 0xFC, 0x86, 0x00, 0x01, 0xFF, 0xFC, 0x84, 0x00, 0x01, 0x0F,
+  0xFF, 0x84, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0x86, 0x00, 0x01, 0x3F, 0xFF, 0x84, 0x00, 0x01, 0x0F,
+  0xFF, 0x84, 0x00, 0x02, 0x0F, 0xFF, 0xC0, 0x86, 0x00, 0x02, 0x0F, 0xFF, 0xC0, 0x83, 0x00, 0x01,
+  0x03, 0xFC, 0x84, 0x00, 0x01, 0x3F, 0xFF, 0x87, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0x83, 0x00, 0x01,
+  0x03, 0xFC, 0x84, 0x00, 0x01, 0xFF, 0xFC, 0x88, 0x00, 0x01, 0xFF, 0xFC, 0x8A, 0x00, 0x02, 0x03,
+  0xFF, 0xF0, 0x88, 0x00, 0x01, 0x3F, 0xFF, 0x8A, 0x00, 0x02, 0x0F, 0xFF, 0xC0, 0x88, 0x00, 0x02,
+  0x0F, 0xFF, 0xC0, 0x89, 0x00, 0x01, 0x3F, 0xFF, 0x89, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0x89, 0x00,
+  0x01, 0xFF, 0xFC, 0x8A, 0x00, 0x01, 0xFF, 0xFC, 0x88, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0x8A, 0x00,
+  0x01, 0x3F, 0xFF, 0x88, 0x00, 0x02, 0x0F, 0xFF, 0xC0, 0x8A, 0x00, 0x02, 0x0F, 0xFF, 0xC0, 0x87,
+  0x00, 0x01, 0x3F, 0xFF, 0x8B, 0x00, 0x02, 0x03, 0xFF, 0xC0, 0x87, 0x00, 0x01, 0x3F, 0xFC, 0x8C,
+  0x00, 0x00, 0xFF, 0x88, 0x00, 0x01, 0x0F, 0xF0, 0x8C, 0x00, 0x00, 0x3C, 0x81, 0x00, 0x00, 0x03,
+  0x80, 0xFF, 0x00, 0xFC, 0x81, 0x00, 0x01, 0x03, 0xC0, 0x90, 0x00, 0x82, 0xFF, 0x00, 0xF0, 0x93,
+  0x00, 0x00, 0x0F, 0x83, 0xFF, 0x93, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0xC0, 0x91, 0x00, 0x00,
+  0x03, 0x84, 0xFF, 0x00, 0xFC, 0x91, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x91, 0x00, 0x00, 0x3F, 0x85,
+  0xFF, 0x00, 0xC0, 0x90, 0x00, 0x86, 0xFF, 0x00, 0xF0, 0x90, 0x00, 0x86, 0xFF, 0x00, 0xF0, 0x8F,
+  0x00, 0x00, 0x03, 0x86, 0xFF, 0x00, 0xFC, 0x8F, 0x00, 0x00, 0x0F, 0x87, 0xFF, 0x8F, 0x00, 0x00,
+  0x0F, 0x87, 0xFF, 0x8F, 0x00, 0x00, 0x3F, 0x87, 0xFF, 0x00, 0xC0, 0x8E, 0x00, 0x00, 0x3F, 0x87,
+  0xFF, 0x00, 0xC0, 0x8E, 0x00, 0x00, 0x3F, 0x87, 0xFF, 0x00, 0xC0, 0x8E, 0x00, 0x88, 0xFF, 0x00,
+  0xF0, 0x8E, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x8E, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x86, 0x00, 0x00,
+  0x0F, 0x82, 0xFF, 0x00, 0xC0, 0x80, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x3F, 0x82,
+  0xFF, 0x01, 0x00, 0x3F, 0x82, 0xFF, 0x00, 0xFC, 0x80, 0x00, 0x88, 0xFF, 0x02, 0xF0, 0x00, 0x03,
+  0x83, 0xFF, 0x00, 0xC0, 0x83, 0xFF, 0x00, 0xFC, 0x80, 0x00, 0x88, 0xFF, 0x02, 0xF0, 0x00, 0x03,
+  0x83, 0xFF, 0x00, 0xF0, 0x83, 0xFF, 0x00, 0xFC, 0x80, 0x00, 0x88, 0xFF, 0x02, 0xF0, 0x00, 0x03,
+  0x83, 0xFF, 0x01, 0xF0, 0x3F, 0x82, 0xFF, 0x00, 0xFC, 0x80, 0x00, 0x88, 0xFF, 0x02, 0xF0, 0x00,
+  0x03, 0x83, 0xFF, 0x01, 0xC0, 0x0F, 0x82, 0xFF, 0x00, 0xC0, 0x80, 0x00, 0x88, 0xFF, 0x00, 0xF0,
+  0x80, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x87, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x8E, 0x00, 0x88, 0xFF,
+  0x00, 0xF0, 0x8E, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x8E, 0x00, 0x00, 0x3F, 0x87, 0xFF, 0x00, 0xC0,
+  0x8E, 0x00, 0x00, 0x3F, 0x87, 0xFF, 0x00, 0xC0, 0x8E, 0x00, 0x00, 0x3F, 0x87, 0xFF, 0x00, 0xC0,
+  0x8E, 0x00, 0x00, 0x0F, 0x87, 0xFF, 0x8F, 0x00, 0x00, 0x0F, 0x87, 0xFF, 0x8F, 0x00, 0x00, 0x03,
+  0x86, 0xFF, 0x00, 0xFC, 0x90, 0x00, 0x86, 0xFF, 0x00, 0xF0, 0x90, 0x00, 0x86, 0xFF, 0x00, 0xF0,
+  0x90, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x00, 0xC0, 0x90, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x91, 0x00,
+  0x00, 0x03, 0x84, 0xFF, 0x00, 0xFC, 0x92, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0xC0, 0x92, 0x00,
+  0x00, 0x0F, 0x83, 0xFF, 0x94, 0x00, 0x82, 0xFF, 0x00, 0xF0, 0x90, 0x00, 0x00, 0x3C, 0x81, 0x00,
+  0x00, 0x03, 0x80, 0xFF, 0x00, 0xFC, 0x81, 0x00, 0x01, 0x03, 0xC0, 0x8C, 0x00, 0x00, 0xFF, 0x88,
+  0x00, 0x01, 0x0F, 0xF0, 0x8B, 0x00, 0x02, 0x03, 0xFF, 0xC0, 0x87, 0x00, 0x01, 0x3F, 0xFC, 0x8B,
+  0x00, 0x02, 0x0F, 0xFF, 0xC0, 0x87, 0x00, 0x01, 0x3F, 0xFF, 0x8B, 0x00, 0x01, 0x3F, 0xFF, 0x88,
+  0x00, 0x02, 0x0F, 0xFF, 0xC0, 0x8A, 0x00, 0x01, 0xFF, 0xFC, 0x88, 0x00, 0x02, 0x03, 0xFF, 0xF0,
+  0x89, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0x89, 0x00, 0x01, 0xFF, 0xFC, 0x89, 0x00, 0x02, 0x0F, 0xFF,
+  0xC0, 0x89, 0x00, 0x01, 0x3F, 0xFF, 0x89, 0x00, 0x01, 0x3F, 0xFF, 0x8A, 0x00, 0x02, 0x0F, 0xFF,
+  0xC0, 0x88, 0x00, 0x01, 0xFF, 0xFC, 0x8A, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0x87, 0x00, 0x02, 0x03,
+  0xFF, 0xF0, 0x83, 0x00, 0x01, 0x03, 0xFC, 0x84, 0x00, 0x01, 0xFF, 0xFC, 0x87, 0x00, 0x02, 0x0F,
+  0xFF, 0xC0, 0x83, 0x00, 0x01, 0x03, 0xFC, 0x84, 0x00, 0x01, 0x3F, 0xFF, 0x87, 0x00, 0x01, 0x3F,
+  0xFF, 0x84, 0x00, 0x01, 0x0F, 0xFF, 0x84, 0x00, 0x02, 0x0F, 0xFF, 0xC0, 0x86, 0x00, 0x01, 0xFF,
+  0xFC, 0x84, 0x00, 0x01, 0x0F, 0xFF, 0x84, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0x85, 0x00, 0x02, 0x03,
+  0xFF, 0xF0, 0x84, 0x00, 0x01, 0x0F, 0xFF, 0x85, 0x00, 0x01, 0xFF, 0xFC, 0x85, 0x00, 0x02, 0x03,
+  0xFF, 0xC0, 0x84, 0x00, 0x01, 0x0F, 0xFF, 0x85, 0x00, 0x01, 0x3F, 0xFC, 0x85, 0x00, 0x01, 0x03,
+  0xFF, 0x85, 0x00, 0x01, 0x0F, 0xFF, 0x85, 0x00, 0x01, 0x0F, 0xFC, 0x86, 0x00, 0x00, 0xFC, 0x85,
+  0x00, 0x01, 0x0F, 0xFF, 0x85, 0x00, 0x01, 0x03, 0xF0, 0x8E, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00,
+  0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01,
+  0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F,
+  0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF,
+  0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x0F, 0xFF, 0x97, 0x00, 0x01, 0x03, 0xFC, 0x98,
+  0x00, 0x00, 0xF0, 0x8B, 0x00, 0x86, 0x00, 0x00, 0xFC, 0x8C, 0x00, 0x00, 0xFF, 0x8C, 0x00, 0x00,
+  0xFF, 0x8C, 0x00, 0x00, 0xFF, 0x8C, 0x00, 0x00, 0xFF, 0x8C, 0x00, 0x00, 0xFF, 0x8C, 0x00, 0x00,
+  0xFF, 0x8C, 0x00, 0x00, 0xFF, 0x8C, 0x00, 0x00, 0xFF, 0x86, 0x00, 0x00, 0x0F, 0x83, 0x00, 0x00,
+  0xFF, 0x83, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x01, 0x3F, 0xC0, 0x82, 0x00, 0x00, 0xFF, 0x82, 0x00,
+  0x01, 0x0F, 0xF0, 0x80, 0x00, 0x01, 0x3F, 0xF0, 0x82, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x01, 0x3F,
+  0xF0, 0x80, 0x00, 0x01, 0x0F, 0xFC, 0x82, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x01, 0xFF, 0xF0, 0x80,
+  0x00, 0x01, 0x03, 0xFF, 0x82, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x02, 0x03, 0xFF, 0xC0, 0x81, 0x00,
+  0x01, 0xFF, 0xC0, 0x81, 0x00, 0x00, 0x3C, 0x81, 0x00, 0x01, 0x0F, 0xFF, 0x82, 0x00, 0x01, 0x3F,
+  0xF0, 0x85, 0x00, 0x01, 0x3F, 0xFC, 0x82, 0x00, 0x01, 0x0F, 0xFC, 0x85, 0x00, 0x01, 0xFF, 0xF0,
+  0x82, 0x00, 0x01, 0x03, 0xFF, 0x84, 0x00, 0x02, 0x03, 0xFF, 0xC0, 0x83, 0x00, 0x01, 0xFF, 0xC0,
+  0x83, 0x00, 0x01, 0x03, 0xFF, 0x84, 0x00, 0x01, 0x3F, 0xC0, 0x83, 0x00, 0x01, 0x0F, 0xFC, 0x84,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x05, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xC0, 0x86, 0x00, 0x00, 0x03,
+  0x81, 0xFF, 0x89, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x00, 0xF0, 0x88, 0x00, 0x82, 0xFF, 0x00, 0xFC,
+  0x87, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x87, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x00, 0xC0, 0x86, 0x00,
+  0x00, 0x0F, 0x83, 0xFF, 0x00, 0xF0, 0x86, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0xF0, 0x86, 0x00,
+  0x00, 0x3F, 0x83, 0xFF, 0x00, 0xFC, 0x86, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0xFC, 0x86, 0x00,
+  0x84, 0xFF, 0x00, 0xFC, 0x86, 0x00, 0x84, 0xFF, 0x00, 0xFC, 0x81, 0x00, 0x81, 0xFF, 0x01, 0xFC,
+  0x00, 0x84, 0xFF, 0x00, 0xEA, 0x81, 0x00, 0x81, 0xFF, 0x01, 0xFC, 0x00, 0x83, 0xFF, 0x00, 0x80,
+  0x82, 0x00, 0x81, 0xFF, 0x01, 0xFC, 0x00, 0x82, 0xFF, 0x00, 0xE0, 0x88, 0x00, 0x82, 0xFF, 0x89,
+  0x00, 0x81, 0xFF, 0x00, 0xF8, 0x89, 0x00, 0x81, 0xFF, 0x00, 0xC0, 0x89, 0x00, 0x00, 0x3F, 0x80,
+  0xFF, 0x8A, 0x00, 0x02, 0x3F, 0xFF, 0xFC, 0x8A, 0x00, 0x02, 0x0F, 0xFF, 0xF0, 0x8A, 0x00, 0x02,
+  0x0F, 0xFF, 0xE0, 0x8A, 0x00, 0x02, 0x03, 0xFF, 0x80, 0x8B, 0x00, 0x00, 0xFF, 0x8C, 0x00, 0x00,
+  0x3E, 0x99, 0x00, 0x00, 0x0F, 0x8C, 0x00, 0x01, 0x3F, 0xC0, 0x8B, 0x00, 0x01, 0xFF, 0xC0, 0x8A,
+  0x00, 0x01, 0x03, 0xFF, 0x8B, 0x00, 0x01, 0x0F, 0xFC, 0x8B, 0x00, 0x01, 0x3F, 0xF0, 0x8B, 0x00,
+  0x01, 0xFF, 0xC0, 0x8A, 0x00, 0x01, 0x03, 0xFF, 0x8B, 0x00, 0x01, 0x0F, 0xFC, 0x8B, 0x00, 0x01,
+  0x3F, 0xF0, 0x8B, 0x00, 0x01, 0x3F, 0xC0, 0x8B, 0x00, 0x00, 0x0F, 0x8A, 0x00, 0x86, 0x00, 0x02,
+  0x01, 0x55, 0x50, 0x89, 0x00, 0x81, 0x55, 0x00, 0x40, 0x87, 0x00, 0x00, 0x05, 0x81, 0x55, 0x00,
+  0x54, 0x87, 0x00, 0x00, 0x15, 0x82, 0x55, 0x87, 0x00, 0x83, 0x55, 0x00, 0x40, 0x85, 0x00, 0x00,
+  0x01, 0x83, 0x55, 0x00, 0x50, 0x85, 0x00, 0x00, 0x01, 0x83, 0x55, 0x00, 0x54, 0x85, 0x00, 0x00,
+  0x05, 0x83, 0x55, 0x00, 0x54, 0x85, 0x00, 0x00, 0x15, 0x84, 0x55, 0x85, 0x00, 0x00, 0x15, 0x84,
+  0x55, 0x85, 0x00, 0x00, 0x15, 0x84, 0x55, 0x00, 0x40, 0x84, 0x00, 0x85, 0x55, 0x00, 0x40, 0x84,
+  0x00, 0x85, 0x55, 0x00, 0x40, 0x84, 0x00, 0x85, 0x55, 0x00, 0x40, 0x83, 0x00, 0x00, 0x01, 0x85,
+  0x55, 0x00, 0x40, 0x82, 0x00, 0x87, 0x55, 0x00, 0x40, 0x81, 0x00, 0x00, 0x15, 0x87, 0x55, 0x00,
+  0x40, 0x80, 0x00, 0x00, 0x01, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00, 0x05, 0x88, 0x55, 0x00,
+  0x40, 0x80, 0x00, 0x89, 0x55, 0x02, 0x40, 0x00, 0x01, 0x89, 0x55, 0x02, 0x40, 0x00, 0x05, 0x89,
+  0x55, 0x02, 0x40, 0x00, 0x15, 0x89, 0x55, 0x02, 0x40, 0x00, 0x15, 0x89, 0x55, 0x01, 0x40, 0x00,
+  0x8A, 0x55, 0x01, 0x40, 0x01, 0x8A, 0x55, 0x01, 0x40, 0x01, 0x8A, 0x55, 0x01, 0x40, 0x05, 0x8A,
+  0x55, 0x01, 0x40, 0x15, 0x8A, 0x55, 0x01, 0x40, 0x15, 0x8A, 0x55, 0x01, 0x40, 0x15, 0x8A, 0x55,
+  0x00, 0x40, 0x8B, 0x55, 0x00, 0x40, 0x8B, 0x55, 0x00, 0x40, 0x8B, 0x55, 0x00, 0x40, 0x8B, 0x55,
+  0x00, 0x40, 0x8B, 0x55, 0x00, 0x40, 0x8B, 0x55, 0x00, 0x40, 0x8B, 0x55, 0x00, 0x40, 0x8B, 0x55,
+  0x00, 0x40, 0x8B, 0x55, 0x01, 0x40, 0x15, 0x8A, 0x55, 0x01, 0x40, 0x15, 0x8A, 0x55, 0x01, 0x40,
+  0x15, 0x8A, 0x55, 0x01, 0x40, 0x05, 0x8A, 0x55, 0x01, 0x40, 0x05, 0x8A, 0x55, 0x01, 0x40, 0x01,
+  0x8A, 0x55, 0x01, 0x40, 0x01, 0x8A, 0x55, 0x01, 0x40, 0x00, 0x8A, 0x55, 0x01, 0x40, 0x00, 0x8A,
+  0x55, 0x02, 0x40, 0x00, 0x15, 0x89, 0x55, 0x02, 0x40, 0x00, 0x05, 0x89, 0x55, 0x02, 0x40, 0x00,
+  0x01, 0x89, 0x55, 0x00, 0x40, 0x80, 0x00, 0x89, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00, 0x05, 0x88,
+  0x55, 0x00, 0x40, 0x80, 0x00, 0x00, 0x01, 0x88, 0x55, 0x00, 0x40, 0x81, 0x00, 0x00, 0x15, 0x87,
+  0x55, 0x00, 0x40, 0x81, 0x00, 0x00, 0x15, 0x87, 0x55, 0x00, 0x40, 0x81, 0x00, 0x88, 0x55, 0x00,
+  0x40, 0x81, 0x00, 0x88, 0x55, 0x00, 0x40, 0x81, 0x00, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00,
+  0x01, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00, 0x01, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00,
+  0x01, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00, 0x01, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00,
+  0x01, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00, 0x01, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00,
+  0x01, 0x88, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00, 0x01, 0x88, 0x55, 0x00, 0x40, 0x81, 0x00, 0x88,
+  0x55, 0x00, 0x40, 0x81, 0x00, 0x88, 0x55, 0x00, 0x40, 0x81, 0x00, 0x00, 0x15, 0x87, 0x55, 0x00,
+  0x40, 0x81, 0x00, 0x00, 0x15, 0x87, 0x55, 0x00, 0x40, 0x81, 0x00, 0x00, 0x05, 0x87, 0x55, 0x00,
+  0x40, 0x81, 0x00, 0x00, 0x01, 0x87, 0x55, 0x00, 0x40, 0x81, 0x00, 0x00, 0x01, 0x87, 0x55, 0x00,
+  0x40, 0x82, 0x00, 0x00, 0x15, 0x86, 0x55, 0x00, 0x40, 0x82, 0x00, 0x00, 0x05, 0x86, 0x55, 0x00,
+  0x40, 0x83, 0x00, 0x86, 0x55, 0x00, 0x40, 0x83, 0x00, 0x02, 0x05, 0x55, 0x54, 0x83, 0x55, 0x00,
+  0x40, 0x86, 0x00, 0x00, 0x15, 0x82, 0x55, 0x00, 0x40, 0x86, 0x00, 0x00, 0x15, 0x82, 0x55, 0x00,
+  0x40, 0x86, 0x00, 0x00, 0x15, 0x82, 0x55, 0x00, 0x40, 0x86, 0x00, 0x00, 0x05, 0x82, 0x55, 0x87,
+  0x00, 0x00, 0x05, 0x81, 0x55, 0x00, 0x54, 0x87, 0x00, 0x00, 0x01, 0x81, 0x55, 0x00, 0x54, 0x88,
+  0x00, 0x81, 0x55, 0x00, 0x50, 0x88, 0x00, 0x00, 0x15, 0x80, 0x55, 0x89, 0x00, 0x02, 0x01, 0x55,
+  0x50, 0x80, 0x00, 0x87, 0x00, 0x00, 0x01, 0x80, 0x55, 0x8A, 0x00, 0x00, 0x15, 0x80, 0x55, 0x00,
+  0x50, 0x88, 0x00, 0x00, 0x01, 0x82, 0x55, 0x88, 0x00, 0x00, 0x05, 0x82, 0x55, 0x00, 0x40, 0x87,
+  0x00, 0x00, 0x15, 0x82, 0x55, 0x00, 0x50, 0x87, 0x00, 0x83, 0x55, 0x00, 0x54, 0x86, 0x00, 0x00,
+  0x01, 0x84, 0x55, 0x86, 0x00, 0x00, 0x01, 0x84, 0x55, 0x00, 0x40, 0x85, 0x00, 0x00, 0x05, 0x84,
+  0x55, 0x00, 0x40, 0x85, 0x00, 0x00, 0x05, 0x84, 0x55, 0x00, 0x40, 0x85, 0x00, 0x00, 0x05, 0x84,
+  0x55, 0x00, 0x50, 0x85, 0x00, 0x00, 0x15, 0x84, 0x55, 0x00, 0x50, 0x85, 0x00, 0x00, 0x15, 0x84,
+  0x55, 0x00, 0x50, 0x85, 0x00, 0x00, 0x15, 0x84, 0x55, 0x00, 0x50, 0x83, 0x00, 0x00, 0x05, 0x86,
+  0x55, 0x00, 0x50, 0x82, 0x00, 0x00, 0x01, 0x87, 0x55, 0x00, 0x50, 0x82, 0x00, 0x00, 0x15, 0x87,
+  0x55, 0x00, 0x50, 0x81, 0x00, 0x00, 0x01, 0x88, 0x55, 0x00, 0x50, 0x81, 0x00, 0x00, 0x05, 0x88,
+  0x55, 0x00, 0x50, 0x81, 0x00, 0x89, 0x55, 0x00, 0x50, 0x80, 0x00, 0x00, 0x01, 0x89, 0x55, 0x00,
+  0x50, 0x80, 0x00, 0x00, 0x01, 0x89, 0x55, 0x00, 0x50, 0x80, 0x00, 0x00, 0x05, 0x89, 0x55, 0x00,
+  0x50, 0x80, 0x00, 0x00, 0x15, 0x89, 0x55, 0x00, 0x50, 0x80, 0x00, 0x8A, 0x55, 0x00, 0x50, 0x80,
+  0x00, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x01, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x01, 0x8A, 0x55, 0x02,
+  0x50, 0x00, 0x01, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x05, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x05, 0x8A,
+  0x55, 0x02, 0x50, 0x00, 0x05, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x05, 0x8A, 0x55, 0x02, 0x50, 0x00,
+  0x15, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x15, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x15, 0x8A, 0x55, 0x02,
+  0x50, 0x00, 0x15, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x15, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x05, 0x8A,
+  0x55, 0x02, 0x50, 0x00, 0x05, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x05, 0x8A, 0x55, 0x02, 0x50, 0x00,
+  0x05, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x01, 0x8A, 0x55, 0x02, 0x50, 0x00, 0x01, 0x8A, 0x55, 0x00,
+  0x50, 0x80, 0x00, 0x8A, 0x55, 0x00, 0x50, 0x80, 0x00, 0x8A, 0x55, 0x00, 0x50, 0x80, 0x00, 0x00,
+  0x15, 0x89, 0x55, 0x00, 0x50, 0x80, 0x00, 0x00, 0x25, 0x89, 0x55, 0x00, 0x50, 0x80, 0x00, 0x00,
+  0xF9, 0x89, 0x55, 0x03, 0x50, 0x00, 0x0F, 0xFE, 0x89, 0x55, 0x04, 0x50, 0x00, 0x3F, 0xFF, 0x95,
+  0x88, 0x55, 0x01, 0x50, 0x00, 0x80, 0xFF, 0x00, 0xE5, 0x88, 0x55, 0x01, 0x50, 0x03, 0x80, 0xFF,
+  0x00, 0xFD, 0x88, 0x55, 0x01, 0x50, 0x03, 0x81, 0xFF, 0x00, 0x95, 0x87, 0x55, 0x01, 0x50, 0x0F,
+  0x81, 0xFF, 0x00, 0xF9, 0x87, 0x55, 0x01, 0x50, 0x0F, 0x81, 0xFF, 0x00, 0xF9, 0x87, 0x55, 0x01,
+  0x50, 0x3F, 0x81, 0xFF, 0x00, 0xF5, 0x87, 0x55, 0x01, 0x50, 0x3F, 0x81, 0xFF, 0x00, 0xE5, 0x87,
+  0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0xD5, 0x87, 0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0xD5, 0x87,
+  0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0xD5, 0x87, 0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0x95, 0x87,
+  0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0x95, 0x87, 0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0x95, 0x87,
+  0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0x95, 0x87, 0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0xD5, 0x87,
+  0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0xD5, 0x87, 0x55, 0x00, 0x50, 0x82, 0xFF, 0x00, 0xE5, 0x87,
+  0x55, 0x01, 0x50, 0x3F, 0x81, 0xFF, 0x00, 0xE5, 0x87, 0x55, 0x01, 0x50, 0x3F, 0x81, 0xFF, 0x00,
+  0xF5, 0x87, 0x55, 0x01, 0x50, 0x0F, 0x81, 0xFF, 0x00, 0xF9, 0x87, 0x55, 0x01, 0x50, 0x0F, 0x81,
+  0xFF, 0x00, 0xFE, 0x87, 0x55, 0x01, 0x50, 0x03, 0x82, 0xFF, 0x87, 0x55, 0x01, 0x50, 0x03, 0x82,
+  0xFF, 0x00, 0xD5, 0x86, 0x55, 0x01, 0x50, 0x00, 0x82, 0xFF, 0x00, 0xF9, 0x86, 0x55, 0x02, 0x50,
+  0x00, 0x3F, 0x81, 0xFF, 0x00, 0xFE, 0x86, 0x55, 0x02, 0x50, 0x00, 0x0F, 0x82, 0xFF, 0x00, 0xE5,
+  0x85, 0x55, 0x02, 0x50, 0x00, 0x03, 0x83, 0xFF, 0x02, 0xA5, 0x6A, 0xF5, 0x82, 0x55, 0x00, 0x50,
+  0x80, 0x00, 0x00, 0x3F, 0x84, 0xFF, 0x00, 0xF5, 0x82, 0x55, 0x00, 0x50, 0x80, 0x00, 0x00, 0x0F,
+  0x84, 0xFF, 0x00, 0xF9, 0x82, 0x55, 0x00, 0x50, 0x80, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0x00, 0xF9,
+  0x82, 0x55, 0x00, 0x40, 0x80, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0x00, 0xFD, 0x82, 0x55, 0x00, 0x40,
+  0x80, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x82, 0x55, 0x81, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x00, 0x95,
+  0x81, 0x55, 0x81, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x00, 0xE5, 0x80, 0x55, 0x00, 0x54, 0x81, 0x00,
+  0x00, 0x3F, 0x85, 0xFF, 0x00, 0xFD, 0x80, 0x55, 0x00, 0x40, 0x81, 0x00, 0x00, 0x3F, 0x86, 0xFF,
+  0x01, 0x15, 0x54, 0x82, 0x00, 0x00, 0x3F, 0x86, 0xFF, 0x84, 0x00, 0x00, 0x3F, 0x86, 0xFF, 0x84,
+  0x00, 0x00, 0x3F, 0x86, 0xFF, 0x84, 0x00, 0x00, 0x0F, 0x86, 0xFF, 0x84, 0x00, 0x00, 0x0F, 0x86,
+  0xFF, 0x84, 0x00, 0x00, 0x03, 0x86, 0xFF, 0x84, 0x00, 0x00, 0x03, 0x86, 0xFF, 0x85, 0x00, 0x86,
+  0xFF, 0x85, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x85, 0x00, 0x00, 0x03, 0x85, 0xFF, 0x86, 0x00, 0x85,
+  0xFF, 0x86, 0x00, 0x02, 0x03, 0xFF, 0xC3, 0x82, 0xFF, 0x88, 0x00, 0x00, 0x03, 0x81, 0xFF, 0x00,
+  0xFC, 0x88, 0x00, 0x00, 0x03, 0x81, 0xFF, 0x00, 0xFC, 0x89, 0x00, 0x81, 0xFF, 0x00, 0xFC, 0x89,
+  0x00, 0x81, 0xFF, 0x00, 0xF0, 0x89, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0xC0, 0x89, 0x00, 0x00,
+  0x0F, 0x80, 0xFF, 0x8B, 0x00, 0x01, 0xFF, 0xF0, 0x83, 0x00, 0x84, 0x00, 0x01, 0x03, 0xF0, 0x80,
+  0x00, 0x00, 0xFC, 0x88, 0x00, 0x04, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x00, 0x3F, 0x83,
+  0x00, 0x04, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x01, 0xFF, 0xC0, 0x82, 0x00, 0x04, 0x0F,
+  0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x01, 0xFF, 0xF0, 0x82, 0x00, 0x04, 0x0F, 0xFC, 0x00, 0x03,
+  0xFF, 0x82, 0x00, 0x01, 0xFF, 0xF0, 0x82, 0x00, 0x04, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00,
+  0x01, 0xFF, 0xF0, 0x82, 0x00, 0x04, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x0A, 0xFF, 0xF0,
+  0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x3F,
+  0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
+  0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
+  0x00, 0x03, 0xFF, 0x82, 0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
+  0xFF, 0x82, 0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82,
+  0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x0A,
+  0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x0A, 0xFF, 0xF0,
+  0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x06, 0x3C, 0x00, 0xFF, 0xF0,
+  0x00, 0x3F, 0xF0, 0x82, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0x00, 0xFF, 0xF0, 0x00,
+  0x3F, 0xF0, 0x82, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F,
+  0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82,
+  0x00, 0x0A, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A,
+  0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0x00, 0x03,
+  0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x52, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0,
+  0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00,
+  0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F,
+  0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0,
+  0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
+  0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x82, 0x00, 0x0A, 0x0F, 0xFC,
+  0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x82, 0x00, 0x0A, 0x0F, 0xFC, 0x00, 0x03,
+  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x82, 0x00, 0x0A, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x82, 0x00, 0x0A, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x82, 0x00, 0x0A, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF,
+  0xF0, 0x82, 0x00, 0x0A, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x82,
+  0x00, 0x0A, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x82, 0x00, 0x0A,
+  0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x82, 0x00, 0x7F, 0x0F, 0xFC,
+  0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
+  0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
+  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03,
+  0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x7F, 0xC0,
+  0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF,
+  0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0,
+  0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00,
+  0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F,
+  0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0,
+  0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
+  0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
+  0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0x7F,
+  0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
+  0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
+  0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
+  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03,
+  0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0x34, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF,
+  0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0,
+  0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F,
+  0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
+  0x0F, 0xFC, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
+  0x82, 0x00, 0x0A, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00,
+  0x0A, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00, 0x0A, 0x03,
+  0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0xC0, 0xFF, 0xF0,
+  0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F,
+  0xF0, 0x00, 0x0F, 0xFC, 0x80, 0x00, 0x54, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F,
+  0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0,
+  0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
+  0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
+  0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
+  0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x80, 0x00, 0x0C, 0xC0,
+  0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03,
+  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0x00, 0x03, 0xFF,
+  0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF,
+  0xF0, 0x00, 0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00,
+  0x3F, 0xF0, 0x82, 0x00, 0x0A, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0,
+  0x82, 0x00, 0x06, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x0B, 0x3F, 0xF0, 0x00,
+  0x03, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x81, 0x00, 0x0B, 0x3F, 0xF0, 0x00, 0x0F,
+  0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x81, 0x00, 0x0B, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
+  0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x81, 0x00, 0x0B, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
+  0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x81, 0x00, 0x0B, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
+  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x81, 0x00, 0x0B, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
+  0x00, 0x03, 0xFF, 0xC0, 0x81, 0x00, 0x0B, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0, 0x81, 0x00, 0x0B, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03,
+  0xFF, 0xC0, 0x81, 0x00, 0x04, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x80, 0x00, 0x04, 0xFC, 0x00, 0x03,
+  0xFF, 0xC0, 0x81, 0x00, 0x04, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00, 0x02, 0x03, 0xFF, 0xC0,
+  0x81, 0x00, 0x04, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x82, 0x00, 0x02, 0x03, 0xFF, 0xC0, 0x81, 0x00,
+  0x04, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x83, 0x00, 0x01, 0xFF, 0xC0, 0x81, 0x00, 0x04, 0x3F, 0xF0,
+  0x00, 0x0F, 0xFC, 0x83, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x04, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x83,
+  0x00, 0x00, 0x3C, 0x82, 0x00, 0x04, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x88, 0x00, 0x04, 0x0F, 0xC0,
+  0x00, 0x03, 0xF0, 0x85, 0x00, 0x88, 0x00, 0x02, 0x0F, 0xFF, 0xFC, 0x8A, 0x00, 0x00, 0x03, 0x81,
+  0xFF, 0x00, 0xF0, 0x89, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0x89, 0x00, 0x83, 0xFF, 0x00, 0xC0, 0x87,
+  0x00, 0x00, 0x0F, 0x83, 0xFF, 0x00, 0xF0, 0x87, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0xFC, 0x87,
+  0x00, 0x00, 0x3F, 0x84, 0xFF, 0x87, 0x00, 0x85, 0xFF, 0x00, 0xC0, 0x85, 0x00, 0x00, 0x03, 0x85,
+  0xFF, 0x00, 0xC0, 0x85, 0x00, 0x00, 0x03, 0x85, 0xFF, 0x00, 0xF0, 0x85, 0x00, 0x00, 0x0F, 0x85,
+  0xFF, 0x00, 0xF0, 0x85, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x00, 0xFC, 0x85, 0x00, 0x00, 0x3F, 0x85,
+  0xFF, 0x00, 0xFC, 0x85, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x00, 0xFC, 0x85, 0x00, 0x00, 0x3F, 0x86,
+  0xFF, 0x85, 0x00, 0x00, 0x3F, 0x86, 0xFF, 0x85, 0x00, 0x00, 0x3F, 0x86, 0xFF, 0x83, 0x00, 0x00,
+  0x3F, 0x88, 0xFF, 0x82, 0x00, 0x00, 0x3F, 0x89, 0xFF, 0x81, 0x00, 0x00, 0x03, 0x8A, 0xFF, 0x81,
+  0x00, 0x00, 0x3F, 0x8A, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x8B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x8B,
+  0xFF, 0x80, 0x00, 0x00, 0x3F, 0x8B, 0xFF, 0x80, 0x00, 0x8C, 0xFF, 0x01, 0x00, 0x03, 0x8C, 0xFF,
+  0x01, 0x00, 0x0F, 0x8C, 0xFF, 0x01, 0x00, 0x3F, 0x8C, 0xFF, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x00,
+  0x8D, 0xFF, 0x00, 0x03, 0x8D, 0xFF, 0x00, 0x03, 0x8D, 0xFF, 0x00, 0x0F, 0x8D, 0xFF, 0x00, 0x0F,
+  0x8D, 0xFF, 0x00, 0x3F, 0x8D, 0xFF, 0x00, 0x3F, 0x8D, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xCC, 0xFF,
+  0x00, 0x3F, 0x8D, 0xFF, 0x00, 0x3F, 0x8D, 0xFF, 0x00, 0x3F, 0x8D, 0xFF, 0x00, 0x0F, 0x8D, 0xFF,
+  0x00, 0x0F, 0x8D, 0xFF, 0x00, 0x0F, 0x8D, 0xFF, 0x00, 0x03, 0x8D, 0xFF, 0x00, 0x00, 0x8D, 0xFF,
+  0x00, 0x00, 0x8D, 0xFF, 0x01, 0x00, 0x3F, 0x8C, 0xFF, 0x01, 0x00, 0x0F, 0x8C, 0xFF, 0x01, 0x00,
+  0x03, 0x8C, 0xFF, 0x80, 0x00, 0x8C, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x8B, 0xFF, 0x80, 0x00, 0x00,
+  0x0F, 0x8B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x8B, 0xFF, 0x81, 0x00, 0x00, 0x3F, 0x8A, 0xFF, 0x81,
+  0x00, 0x00, 0x03, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x03, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x03, 0x8A,
+  0xFF, 0x81, 0x00, 0x00, 0x03, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x0F, 0x8A, 0xFF, 0x81, 0x00, 0x00,
+  0x0F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x0F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x3F, 0x8A, 0xFF, 0x81,
+  0x00, 0x00, 0x3F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x3F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x3F, 0x8A,
+  0xFF, 0x81, 0x00, 0x00, 0x3F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x3F, 0x8A, 0xFF, 0x81, 0x00, 0x00,
+  0x3F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x3F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x0F, 0x8A, 0xFF, 0x81,
+  0x00, 0x00, 0x0F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x0F, 0x8A, 0xFF, 0x81, 0x00, 0x00, 0x03, 0x8A,
+  0xFF, 0x81, 0x00, 0x00, 0x03, 0x8A, 0xFF, 0x82, 0x00, 0x8A, 0xFF, 0x82, 0x00, 0x00, 0x3F, 0x89,
+  0xFF, 0x82, 0x00, 0x00, 0x3F, 0x89, 0xFF, 0x82, 0x00, 0x00, 0x0F, 0x89, 0xFF, 0x82, 0x00, 0x00,
+  0x03, 0x89, 0xFF, 0x83, 0x00, 0x89, 0xFF, 0x83, 0x00, 0x00, 0x0F, 0x88, 0xFF, 0x84, 0x00, 0x88,
+  0xFF, 0x84, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x00, 0xC3, 0x84, 0xFF, 0x87, 0x00, 0x00, 0x03, 0x84,
+  0xFF, 0x87, 0x00, 0x00, 0x03, 0x84, 0xFF, 0x87, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x00, 0xFC, 0x88,
+  0x00, 0x83, 0xFF, 0x00, 0xFC, 0x88, 0x00, 0x83, 0xFF, 0x00, 0xF0, 0x88, 0x00, 0x00, 0x3F, 0x82,
+  0xFF, 0x00, 0xF0, 0x88, 0x00, 0x00, 0x0F, 0x82, 0xFF, 0x00, 0xC0, 0x88, 0x00, 0x00, 0x03, 0x82,
+  0xFF, 0x8A, 0x00, 0x81, 0xFF, 0x00, 0xFC, 0x8A, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0xC0, 0x8A,
+  0x00, 0x02, 0x03, 0xFF, 0xFC, 0x80, 0x00, 0x81, 0x00, 0x01, 0x2A, 0xAA, 0x82, 0x00, 0x00, 0x02,
+  0x80, 0xAA, 0x00, 0xA0, 0x81, 0x00, 0x00, 0x0A, 0x80, 0xAA, 0x00, 0xA8, 0x81, 0x00, 0x00, 0x2A,
+  0x80, 0xAA, 0x00, 0xA8, 0x81, 0x00, 0x82, 0xAA, 0x80, 0x00, 0x00, 0x02, 0x82, 0xAA, 0x02, 0x80,
+  0x00, 0x02, 0x82, 0xAA, 0x02, 0x80, 0x00, 0x0A, 0x82, 0xAA, 0x02, 0x80, 0x00, 0x2A, 0x82, 0xAA,
+  0x01, 0x80, 0x00, 0x83, 0xAA, 0x01, 0x80, 0x00, 0x83, 0xAA, 0x01, 0x80, 0x02, 0x83, 0xAA, 0x01,
+  0x80, 0x0A, 0x83, 0xAA, 0x01, 0x00, 0x0A, 0x83, 0xAA, 0x01, 0x00, 0x2A, 0x82, 0xAA, 0x01, 0xA8,
+  0x00, 0x83, 0xAA, 0x02, 0xA0, 0x00, 0x2A, 0x82, 0xAA, 0x80, 0x00, 0x81, 0x00, 0x00, 0xA0, 0x81,
+  0x00, 0x02, 0x2A, 0xAA, 0x80, 0x80, 0x00, 0x80, 0xAA, 0x02, 0xA0, 0x00, 0x02, 0x80, 0xAA, 0x02,
+  0xA8, 0x00, 0x0A, 0x80, 0xAA, 0x02, 0xA8, 0x00, 0x2A, 0x81, 0xAA, 0x00, 0x00, 0x82, 0xAA, 0x00,
+  0x00, 0x82, 0xAA, 0x00, 0x02, 0x82, 0xAA, 0x00, 0x0A, 0x82, 0xAA, 0x00, 0x0A, 0x82, 0xAA, 0x00,
+  0x2A, 0x81, 0xAA, 0x00, 0xA8, 0x82, 0xAA, 0x00, 0xA0, 0x82, 0xAA, 0x01, 0x80, 0x2A, 0x81, 0xAA,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0xA0, 0x82, 0x00, 0x01, 0x02, 0xAA, 0x82, 0x00, 0x01, 0x0A, 0xAA,
+  0x82, 0x00, 0x02, 0x0A, 0xAA, 0x80, 0x81, 0x00, 0x0C, 0x0A, 0xAA, 0x80, 0x2A, 0x80, 0x00, 0x02,
+  0xAA, 0x82, 0xAA, 0xA0, 0x00, 0x02, 0x81, 0xAA, 0x02, 0xA0, 0x00, 0x02, 0x81, 0xAA, 0x01, 0xA0,
+  0x02, 0x82, 0xAA, 0x01, 0x80, 0x2A, 0x82, 0xAA, 0x01, 0x00, 0x2A, 0x81, 0xAA, 0x01, 0xA8, 0x00,
+  0x82, 0xAA, 0x02, 0x80, 0x00, 0x2A, 0x81, 0xAA, 0x02, 0xA8, 0x00, 0x2A, 0x82, 0xAA, 0x01, 0x00,
+  0x02, 0x82, 0xAA, 0x02, 0x80, 0x00, 0x02, 0x81, 0xAA, 0x02, 0xA0, 0x00, 0x02, 0x81, 0xAA, 0x11,
+  0xA0, 0x00, 0x02, 0xAA, 0x82, 0xAA, 0xA0, 0x00, 0x0A, 0xAA, 0x80, 0xAA, 0x80, 0x00, 0x0A, 0xAA,
+  0x80, 0x02, 0x80, 0x00, 0x01, 0x0A, 0xAA, 0x82, 0x00, 0x01, 0x02, 0xA8, 0x83, 0x00, 0x00, 0xA0,
+  0x81, 0x00, 0x82, 0x00, 0x01, 0x02, 0x80, 0x86, 0x00, 0x01, 0xAA, 0x80, 0x85, 0x00, 0x02, 0x2A,
+  0xAA, 0x80, 0x84, 0x00, 0x00, 0x0A, 0x80, 0xAA, 0x00, 0x80, 0x83, 0x00, 0x00, 0x02, 0x81, 0xAA,
+  0x00, 0x80, 0x81, 0x00, 0x01, 0xAA, 0x00, 0x82, 0xAA, 0x00, 0x80, 0x80, 0x00, 0x02, 0x2A, 0xA0,
+  0x2A, 0x82, 0xAA, 0x04, 0x80, 0x00, 0x2A, 0xAA, 0x80, 0x83, 0xAA, 0x01, 0x80, 0x0A, 0x80, 0xAA,
+  0x00, 0x00, 0x83, 0xAA, 0x00, 0x8A, 0x80, 0xAA, 0x01, 0xA0, 0x00, 0x86, 0xAA, 0x01, 0x80, 0x00,
+  0x86, 0xAA, 0x80, 0x00, 0x85, 0xAA, 0x00, 0xA0, 0x80, 0x00, 0x85, 0xAA, 0x00, 0x80, 0x80, 0x00,
+  0x85, 0xAA, 0x81, 0x00, 0x80, 0xAA, 0x00, 0xA8, 0x81, 0xAA, 0x00, 0xA0, 0x81, 0x00, 0x80, 0xAA,
+  0x00, 0x00, 0x81, 0xAA, 0x00, 0x80, 0x81, 0x00, 0x02, 0xAA, 0x80, 0x00, 0x81, 0xAA, 0x82, 0x00,
+  0x00, 0xA0, 0x80, 0x00, 0x80, 0xAA, 0x00, 0xA0, 0x85, 0x00, 0x80, 0xAA, 0x00, 0x80, 0x85, 0x00,
+  0x80, 0xAA, 0x86, 0x00, 0x01, 0xAA, 0xA0, 0x86, 0x00, 0x01, 0xAA, 0x80, 0x86, 0x00, 0x00, 0xAA,
+  0x87, 0x00, 0x00, 0xA0, 0x87, 0x00, 0x00, 0x80, 0x9B, 0x00, 0x00, 0x20, 0x86, 0x00, 0x01, 0x0A,
+  0xA0, 0x85, 0x00, 0x02, 0x02, 0xAA, 0xA0, 0x85, 0x00, 0x80, 0xAA, 0x03, 0xA0, 0x00, 0x02, 0xA0,
+  0x81, 0x00, 0x00, 0x2A, 0x80, 0xAA, 0x03, 0xA0, 0x02, 0xAA, 0x80, 0x81, 0x00, 0x81, 0xAA, 0x02,
+  0xA0, 0xAA, 0xA8, 0x82, 0x00, 0x83, 0xAA, 0x00, 0xA0, 0x82, 0x00, 0x83, 0xAA, 0x00, 0x80, 0x82,
+  0x00, 0x82, 0xAA, 0x00, 0xA8, 0x83, 0x00, 0x82, 0xAA, 0x00, 0xA0, 0x83, 0x00, 0x01, 0xAA, 0xA0,
+  0x80, 0xAA, 0x00, 0x80, 0x83, 0x00, 0x03, 0xA8, 0x00, 0xAA, 0xA8, 0x86, 0x00, 0x01, 0xAA, 0xA0,
+  0x86, 0x00, 0x01, 0xAA, 0x80, 0x86, 0x00, 0x00, 0xA8, 0x87, 0x00, 0x00, 0xA0, 0x85, 0x00, 0x86,
+  0x00, 0x00, 0x0F, 0x8F, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01,
+  0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F,
+  0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0,
+  0x88, 0x00, 0x01, 0x0F, 0x80, 0x82, 0x00, 0x01, 0x3F, 0xC0, 0x82, 0x00, 0x00, 0x2F, 0x83, 0x00,
+  0x01, 0x0F, 0xF0, 0x82, 0x00, 0x01, 0x3F, 0xC0, 0x82, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x01, 0x0B,
+  0xF8, 0x82, 0x00, 0x01, 0x3F, 0xC0, 0x81, 0x00, 0x01, 0x02, 0xFE, 0x83, 0x00, 0x01, 0x03, 0xFF,
+  0x82, 0x00, 0x01, 0x3F, 0xC0, 0x81, 0x00, 0x01, 0x0F, 0xFC, 0x84, 0x00, 0x01, 0xBF, 0x80, 0x81,
+  0x00, 0x01, 0x2F, 0x80, 0x81, 0x00, 0x01, 0x2F, 0xE0, 0x84, 0x00, 0x01, 0x3F, 0xF0, 0x86, 0x00,
+  0x01, 0xFF, 0xC0, 0x84, 0x00, 0x01, 0x0B, 0xF8, 0x85, 0x00, 0x01, 0x02, 0xFE, 0x85, 0x00, 0x01,
+  0x03, 0xFF, 0x85, 0x00, 0x01, 0x0F, 0xFC, 0x86, 0x00, 0x01, 0xBF, 0x80, 0x84, 0x00, 0x01, 0x2F,
+  0xE0, 0x86, 0x00, 0x01, 0x3F, 0xF0, 0x84, 0x00, 0x01, 0xFF, 0xC0, 0x86, 0x00, 0x01, 0x0B, 0xF0,
+  0x80, 0x00, 0x00, 0x0A, 0x81, 0x00, 0x00, 0xFE, 0x87, 0x00, 0x05, 0x03, 0xC0, 0x00, 0x0B, 0xFF,
+  0xFE, 0x80, 0x00, 0x00, 0x3C, 0x8A, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x00, 0xE0, 0x8B, 0x00, 0x00,
+  0x0B, 0x81, 0xFF, 0x00, 0xFE, 0x8B, 0x00, 0x00, 0x2F, 0x82, 0xFF, 0x00, 0x80, 0x8A, 0x00, 0x00,
+  0xBF, 0x82, 0xFF, 0x00, 0xE0, 0x89, 0x00, 0x00, 0x02, 0x83, 0xFF, 0x00, 0xF8, 0x89, 0x00, 0x00,
+  0x03, 0x83, 0xFF, 0x00, 0xFC, 0x89, 0x00, 0x00, 0x0B, 0x83, 0xFF, 0x00, 0xFE, 0x89, 0x00, 0x00,
+  0x0F, 0x84, 0xFF, 0x89, 0x00, 0x00, 0x2F, 0x84, 0xFF, 0x00, 0x80, 0x88, 0x00, 0x00, 0x3F, 0x84,
+  0xFF, 0x00, 0xC0, 0x88, 0x00, 0x00, 0x3F, 0x84, 0xFF, 0x00, 0xC0, 0x83, 0x00, 0x00, 0x3F, 0x80,
+  0xFF, 0x02, 0xF8, 0x00, 0x3F, 0x84, 0xFF, 0x01, 0xC0, 0x02, 0x81, 0xFF, 0x00, 0xC0, 0x81, 0xFF,
+  0x02, 0xFC, 0x00, 0xBF, 0x84, 0xFF, 0x01, 0xE0, 0x03, 0x81, 0xFF, 0x00, 0xF0, 0x81, 0xFF, 0x02,
+  0xFC, 0x00, 0xBF, 0x84, 0xFF, 0x01, 0xE0, 0x03, 0x81, 0xFF, 0x01, 0xF0, 0x3F, 0x80, 0xFF, 0x02,
+  0xF8, 0x00, 0x3F, 0x84, 0xFF, 0x01, 0xC0, 0x02, 0x81, 0xFF, 0x00, 0xC0, 0x83, 0x00, 0x00, 0x3F,
+  0x84, 0xFF, 0x00, 0xC0, 0x88, 0x00, 0x00, 0x3F, 0x84, 0xFF, 0x00, 0xC0, 0x88, 0x00, 0x00, 0x2F,
+  0x84, 0xFF, 0x00, 0x80, 0x88, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0x89, 0x00, 0x00, 0x0B, 0x83, 0xFF,
+  0x00, 0xFE, 0x89, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x00, 0xFC, 0x89, 0x00, 0x00, 0x02, 0x83, 0xFF,
+  0x00, 0xF8, 0x8A, 0x00, 0x00, 0xBF, 0x82, 0xFF, 0x00, 0xE0, 0x8A, 0x00, 0x00, 0x2F, 0x82, 0xFF,
+  0x00, 0x80, 0x8A, 0x00, 0x00, 0x0B, 0x81, 0xFF, 0x00, 0xFE, 0x8C, 0x00, 0x00, 0xBF, 0x80, 0xFF,
+  0x00, 0xE0, 0x89, 0x00, 0x05, 0x03, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x3C, 0x87,
+  0x00, 0x01, 0x0B, 0xF0, 0x80, 0x00, 0x00, 0x0A, 0x81, 0x00, 0x00, 0xFE, 0x87, 0x00, 0x01, 0x3F,
+  0xF0, 0x84, 0x00, 0x01, 0xFF, 0xC0, 0x86, 0x00, 0x01, 0xBF, 0x80, 0x84, 0x00, 0x01, 0x2F, 0xE0,
+  0x85, 0x00, 0x01, 0x03, 0xFF, 0x85, 0x00, 0x01, 0x0F, 0xFC, 0x85, 0x00, 0x01, 0x0B, 0xF8, 0x85,
+  0x00, 0x01, 0x02, 0xFE, 0x85, 0x00, 0x01, 0x3F, 0xF0, 0x86, 0x00, 0x01, 0xFF, 0xC0, 0x84, 0x00,
+  0x01, 0xBF, 0x80, 0x81, 0x00, 0x01, 0x2F, 0x80, 0x81, 0x00, 0x01, 0x2F, 0xE0, 0x83, 0x00, 0x01,
+  0x03, 0xFF, 0x82, 0x00, 0x01, 0x3F, 0xC0, 0x81, 0x00, 0x01, 0x0F, 0xFC, 0x83, 0x00, 0x01, 0x0B,
+  0xF8, 0x82, 0x00, 0x01, 0x3F, 0xC0, 0x81, 0x00, 0x01, 0x02, 0xFE, 0x83, 0x00, 0x01, 0x0F, 0xF0,
+  0x82, 0x00, 0x01, 0x3F, 0xC0, 0x82, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x01, 0x0F, 0x80, 0x82, 0x00,
+  0x01, 0x3F, 0xC0, 0x82, 0x00, 0x00, 0x2F, 0x89, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F,
+  0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0,
+  0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x01, 0x3F, 0xC0, 0x8E,
+  0x00, 0x01, 0x3F, 0xC0, 0x8E, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x83, 0x00, 0x00, 0x3D, 0x8A, 0x00,
+  0x00, 0x3E, 0x8A, 0x00, 0x00, 0x3E, 0x8A, 0x00, 0x00, 0x3E, 0x8A, 0x00, 0x00, 0x3E, 0x8A, 0x00,
+  0x00, 0x3E, 0x86, 0x00, 0x01, 0x0B, 0x40, 0x80, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x01, 0x02, 0xA0,
+  0x82, 0x00, 0x01, 0x0F, 0xC0, 0x80, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x01, 0x0B, 0xF0, 0x82, 0x00,
+  0x01, 0x07, 0xF4, 0x80, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x01, 0x1F, 0xE0, 0x83, 0x00, 0x00, 0xFC,
+  0x80, 0x00, 0x00, 0x2C, 0x80, 0x00, 0x01, 0x3F, 0x80, 0x83, 0x00, 0x01, 0x7F, 0x40, 0x81, 0x00,
+  0x01, 0x01, 0xFE, 0x84, 0x00, 0x01, 0x0F, 0xC0, 0x81, 0x00, 0x01, 0x03, 0xF8, 0x84, 0x00, 0x01,
+  0x07, 0xF0, 0x81, 0x00, 0x04, 0x0B, 0xE0, 0x15, 0x55, 0x50, 0x82, 0x00, 0x05, 0xC0, 0x03, 0xFF,
+  0xC0, 0x03, 0x00, 0x80, 0x55, 0x00, 0x54, 0x83, 0x00, 0x04, 0x2F, 0xFF, 0xF9, 0x00, 0x01, 0x81,
+  0x55, 0x83, 0x00, 0x81, 0xFF, 0x01, 0x00, 0x05, 0x81, 0x55, 0x00, 0x40, 0x81, 0x00, 0x00, 0x03,
+  0x81, 0xFF, 0x01, 0xD0, 0x05, 0x81, 0x55, 0x00, 0x50, 0x81, 0x00, 0x00, 0x0B, 0x81, 0xFF, 0x01,
+  0xF0, 0x15, 0x81, 0x55, 0x00, 0x54, 0x81, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x01, 0xF8, 0x15, 0x81,
+  0x55, 0x00, 0x54, 0x81, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x00, 0xFC, 0x82, 0x55, 0x00, 0x54, 0x81,
+  0x00, 0x00, 0x3F, 0x81, 0xFF, 0x00, 0xFC, 0x82, 0x55, 0x00, 0x54, 0x80, 0xFF, 0x01, 0xF0, 0x3F,
+  0x81, 0xFF, 0x00, 0xFA, 0x82, 0x55, 0x00, 0x54, 0x80, 0xFF, 0x01, 0xF0, 0x3F, 0x80, 0xFF, 0x00,
+  0xE9, 0x83, 0x55, 0x00, 0x54, 0x81, 0x00, 0x02, 0x3F, 0xFF, 0xFE, 0x84, 0x55, 0x00, 0x54, 0x81,
+  0x00, 0x02, 0x3F, 0xFF, 0xF9, 0x84, 0x55, 0x00, 0x54, 0x81, 0x00, 0x02, 0x0F, 0xFF, 0xD5, 0x84,
+  0x55, 0x00, 0x54, 0x81, 0x00, 0x01, 0x0B, 0xFF, 0x85, 0x55, 0x00, 0x54, 0x81, 0x00, 0x01, 0x0B,
+  0xFE, 0x85, 0x55, 0x00, 0x54, 0x81, 0x00, 0x01, 0x02, 0xF9, 0x85, 0x55, 0x00, 0x54, 0x82, 0x00,
+  0x00, 0xB5, 0x85, 0x55, 0x00, 0x54, 0x81, 0x00, 0x01, 0x80, 0x15, 0x85, 0x55, 0x00, 0x54, 0x80,
+  0x00, 0x02, 0x03, 0xF0, 0x15, 0x85, 0x55, 0x00, 0x54, 0x80, 0x00, 0x02, 0x0B, 0xE0, 0x15, 0x85,
+  0x55, 0x00, 0x54, 0x80, 0x00, 0x01, 0x3F, 0x80, 0x86, 0x55, 0x00, 0x54, 0x80, 0x00, 0x01, 0xBE,
+  0x00, 0x86, 0x55, 0x04, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x86, 0x55, 0x04, 0x54, 0x00, 0x0F, 0xC0,
+  0x00, 0x86, 0x55, 0x04, 0x54, 0x00, 0x0B, 0x40, 0x00, 0x86, 0x55, 0x00, 0x54, 0x82, 0x00, 0x00,
+  0x15, 0x85, 0x55, 0x00, 0x54, 0x82, 0x00, 0x00, 0x15, 0x85, 0x55, 0x00, 0x54, 0x82, 0x00, 0x00,
+  0x15, 0x85, 0x55, 0x00, 0x54, 0x82, 0x00, 0x00, 0x05, 0x85, 0x55, 0x00, 0x54, 0x82, 0x00, 0x00,
+  0x05, 0x85, 0x55, 0x00, 0x54, 0x82, 0x00, 0x00, 0x01, 0x85, 0x55, 0x00, 0x54, 0x82, 0x00, 0x00,
+  0x01, 0x85, 0x55, 0x00, 0x54, 0x83, 0x00, 0x85, 0x55, 0x00, 0x54, 0x83, 0x00, 0x00, 0x15, 0x84,
+  0x55, 0x00, 0x54, 0x83, 0x00, 0x00, 0x01, 0x84, 0x55, 0x00, 0x54, 0x84, 0x00, 0x00, 0x15, 0x83,
+  0x55, 0x00, 0x54, 0x84, 0x00, 0x84, 0x55, 0x00, 0x54, 0x84, 0x00, 0x84, 0x55, 0x00, 0x54, 0x84,
+  0x00, 0x84, 0x55, 0x00, 0x54, 0x83, 0x00, 0x00, 0x01, 0x84, 0x55, 0x00, 0x54, 0x83, 0x00, 0x00,
+  0x01, 0x84, 0x55, 0x00, 0x54, 0x83, 0x00, 0x00, 0x01, 0x84, 0x55, 0x00, 0x54, 0x83, 0x00, 0x00,
+  0x01, 0x84, 0x55, 0x00, 0x54, 0x83, 0x00, 0x00, 0x01, 0x84, 0x55, 0x00, 0x54, 0x84, 0x00, 0x84,
+  0x55, 0x00, 0x54, 0x84, 0x00, 0x00, 0x15, 0x83, 0x55, 0x00, 0x54, 0x84, 0x00, 0x00, 0x15, 0x83,
+  0x55, 0x00, 0x54, 0x84, 0x00, 0x00, 0x05, 0x83, 0x55, 0x00, 0x54, 0x84, 0x00, 0x00, 0x05, 0x83,
+  0x55, 0x00, 0x54, 0x85, 0x00, 0x83, 0x55, 0x00, 0x54, 0x85, 0x00, 0x00, 0x05, 0x82, 0x55, 0x00,
+  0x54, 0x87, 0x00, 0x00, 0x05, 0x80, 0x55, 0x00, 0x54, 0x87, 0x00, 0x00, 0x05, 0x80, 0x55, 0x00,
+  0x54, 0x87, 0x00, 0x00, 0x05, 0x80, 0x55, 0x00, 0x54, 0x87, 0x00, 0x00, 0x01, 0x80, 0x55, 0x00,
+  0x50, 0x88, 0x00, 0x80, 0x55, 0x00, 0x40, 0x88, 0x00, 0x02, 0x15, 0x55, 0x00, 0x84, 0x00, 0x80,
+  0x55, 0x00, 0x40, 0x84, 0x00, 0x00, 0x01, 0x80, 0x55, 0x00, 0x50, 0x84, 0x00, 0x00, 0x05, 0x80,
+  0x55, 0x00, 0x54, 0x84, 0x00, 0x00, 0x15, 0x81, 0x55, 0x84, 0x00, 0x82, 0x55, 0x00, 0x40, 0x82,
+  0x00, 0x00, 0x01, 0x82, 0x55, 0x00, 0x50, 0x82, 0x00, 0x00, 0x01, 0x82, 0x55, 0x00, 0x50, 0x82,
+  0x00, 0x00, 0x01, 0x82, 0x55, 0x00, 0x50, 0x82, 0x00, 0x00, 0x01, 0x82, 0x55, 0x00, 0x50, 0x81,
+  0x00, 0x00, 0x05, 0x83, 0x55, 0x00, 0x50, 0x80, 0x00, 0x00, 0x01, 0x84, 0x55, 0x00, 0x50, 0x80,
+  0x00, 0x00, 0x05, 0x84, 0x55, 0x00, 0x50, 0x80, 0x00, 0x85, 0x55, 0x02, 0x50, 0x00, 0x01, 0x85,
+  0x55, 0x02, 0x50, 0x00, 0x01, 0x85, 0x55, 0x02, 0x50, 0x00, 0x05, 0x85, 0x55, 0x02, 0x50, 0x00,
+  0x15, 0x85, 0x55, 0x01, 0x50, 0x00, 0x86, 0x55, 0x01, 0x50, 0x00, 0x86, 0x55, 0x01, 0x50, 0x00,
+  0x86, 0x55, 0x01, 0x50, 0x00, 0x86, 0x55, 0x01, 0x50, 0x00, 0x86, 0x55, 0x01, 0x50, 0x01, 0x86,
+  0x55, 0x01, 0x50, 0x01, 0x86, 0x55, 0x01, 0x50, 0x01, 0x86, 0x55, 0x01, 0x50, 0x00, 0x86, 0x55,
+  0x01, 0x50, 0x00, 0x86, 0x55, 0x01, 0x50, 0x00, 0x86, 0x55, 0x01, 0x50, 0x00, 0x86, 0x55, 0x02,
+  0x50, 0x00, 0x15, 0x85, 0x55, 0x02, 0x50, 0x00, 0x15, 0x85, 0x55, 0x02, 0x50, 0x00, 0x09, 0x85,
+  0x55, 0x02, 0x50, 0x00, 0xBE, 0x85, 0x55, 0x03, 0x50, 0x03, 0xFF, 0x95, 0x84, 0x55, 0x03, 0x50,
+  0x0B, 0xFF, 0xE5, 0x84, 0x55, 0x03, 0x50, 0x2F, 0xFF, 0xFE, 0x84, 0x55, 0x01, 0x50, 0x3F, 0x80,
+  0xFF, 0x00, 0x95, 0x83, 0x55, 0x01, 0x50, 0xBF, 0x80, 0xFF, 0x84, 0x55, 0x00, 0x50, 0x80, 0xFF,
+  0x00, 0xFD, 0x84, 0x55, 0x00, 0x50, 0x80, 0xFF, 0x00, 0xFD, 0x84, 0x55, 0x00, 0x50, 0x80, 0xFF,
+  0x00, 0xFD, 0x84, 0x55, 0x00, 0x50, 0x80, 0xFF, 0x00, 0xFD, 0x84, 0x55, 0x00, 0x50, 0x80, 0xFF,
+  0x00, 0xFD, 0x84, 0x55, 0x00, 0x50, 0x80, 0xFF, 0x00, 0xFD, 0x84, 0x55, 0x00, 0x50, 0x80, 0xFF,
+  0x00, 0xFE, 0x84, 0x55, 0x01, 0x50, 0xBF, 0x80, 0xFF, 0x84, 0x55, 0x01, 0x50, 0x3F, 0x80, 0xFF,
+  0x00, 0x95, 0x83, 0x55, 0x01, 0x50, 0x2F, 0x80, 0xFF, 0x00, 0xD5, 0x83, 0x55, 0x01, 0x50, 0x0F,
+  0x80, 0xFF, 0x00, 0xF5, 0x83, 0x55, 0x01, 0x50, 0x07, 0x80, 0xFF, 0x00, 0xFE, 0x83, 0x55, 0x01,
+  0x50, 0x00, 0x81, 0xFF, 0x00, 0xD5, 0x82, 0x55, 0x02, 0x50, 0x00, 0x6F, 0x80, 0xFF, 0x02, 0xFE,
+  0xAF, 0xD5, 0x80, 0x55, 0x02, 0x50, 0x00, 0x0B, 0x82, 0xFF, 0x00, 0xE5, 0x80, 0x55, 0x02, 0x50,
+  0x00, 0x0B, 0x82, 0xFF, 0x00, 0xE5, 0x80, 0x55, 0x02, 0x50, 0x00, 0x0F, 0x82, 0xFF, 0x00, 0xF5,
+  0x80, 0x55, 0x02, 0x40, 0x00, 0x0F, 0x82, 0xFF, 0x00, 0xFD, 0x80, 0x55, 0x02, 0x40, 0x00, 0x0F,
+  0x83, 0xFF, 0x01, 0x55, 0x54, 0x80, 0x00, 0x00, 0x0F, 0x83, 0xFF, 0x01, 0xC5, 0x40, 0x80, 0x00,
+  0x00, 0x0F, 0x83, 0xFF, 0x00, 0xC0, 0x81, 0x00, 0x00, 0x0B, 0x83, 0xFF, 0x00, 0xC0, 0x81, 0x00,
+  0x00, 0x0B, 0x83, 0xFF, 0x00, 0xC0, 0x81, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x00, 0xC0, 0x82, 0x00,
+  0x83, 0xFF, 0x00, 0xC0, 0x82, 0x00, 0x00, 0x6F, 0x82, 0xFF, 0x00, 0xC0, 0x82, 0x00, 0x00, 0x0B,
+  0x82, 0xFF, 0x00, 0xC0, 0x83, 0x00, 0x01, 0x6A, 0x4F, 0x80, 0xFF, 0x00, 0x80, 0x84, 0x00, 0x00,
+  0x0F, 0x80, 0xFF, 0x85, 0x00, 0x02, 0x0B, 0xFF, 0xFE, 0x85, 0x00, 0x02, 0x03, 0xFF, 0xFC, 0x85,
+  0x00, 0x02, 0x01, 0xBF, 0xE0, 0x81, 0x00, 0x82, 0x00, 0x03, 0x3E, 0x00, 0x3F, 0x40, 0x80, 0x00,
+  0x00, 0xBC, 0x81, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x00, 0xFE, 0x81, 0x00, 0x03,
+  0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0x80, 0x80,
+  0x00, 0x07, 0xFF, 0x00, 0x28, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x07, 0xFF, 0x00, 0xBF,
+  0x00, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0x80, 0xFF, 0x00, 0xBF, 0x80,
+  0x80, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0x80, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x07, 0xFF, 0x00,
+  0xBF, 0x80, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0x00, 0xBF,
+  0x80, 0x80, 0x00, 0x0D, 0xFF, 0x00, 0xBF, 0x80, 0x19, 0x00, 0xBF, 0x80, 0x0B, 0x80, 0xFF, 0x00,
+  0xBF, 0x80, 0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x07,
+  0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0xC0, 0xFF,
+  0x00, 0xBF, 0x80, 0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00,
+  0x2C, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x2E, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xFF,
+  0x00, 0xBF, 0x80, 0x3F, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0xBF,
+  0x80, 0x3F, 0xC0, 0xFF, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x81, 0x00,
+  0x06, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x81, 0x00, 0x06, 0x3F, 0xC0, 0xBF, 0x80, 0x3F,
+  0xC0, 0xFF, 0x81, 0x00, 0x06, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x81, 0x00, 0x06, 0x3F,
+  0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x81, 0x00, 0x7F, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF,
+  0x00, 0x0C, 0x00, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0xBF,
+  0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF,
+  0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F,
+  0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F,
+  0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF,
+  0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF,
+  0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF,
+  0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0x53, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80,
+  0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80,
+  0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0,
+  0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0,
+  0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x7F, 0x80, 0x3F, 0xC0, 0xFF, 0x00,
+  0xBF, 0x80, 0x3F, 0xC0, 0x0C, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00,
+  0x07, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00, 0x07, 0x3F, 0xC0, 0xFF, 0x00,
+  0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00, 0x07, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x80,
+  0x00, 0x07, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00, 0x37, 0x3F, 0xC0, 0xFF,
+  0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x3F, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x7F,
+  0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF,
+  0x80, 0x3F, 0x80, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x2E, 0x00, 0xBF, 0x80, 0x3F,
+  0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80,
+  0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x07, 0xBF, 0x80,
+  0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x80, 0x80, 0x00, 0x0D, 0xBF, 0x80, 0x3F, 0xC0, 0xBC, 0x00, 0xBF,
+  0x80, 0x19, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0x00, 0xBF, 0x80,
+  0x3F, 0xC0, 0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00, 0x07,
+  0xBF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0xC0, 0xBF,
+  0x80, 0x3F, 0xC0, 0x80, 0x00, 0x07, 0xBF, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x80, 0x00,
+  0x07, 0xBF, 0x80, 0x3F, 0xC0, 0x0A, 0x00, 0x3F, 0xC0, 0x80, 0x00, 0x03, 0xBF, 0x80, 0x3F, 0xC0,
+  0x80, 0x00, 0x01, 0x3F, 0xC0, 0x80, 0x00, 0x03, 0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00, 0x01, 0x2F,
+  0xC0, 0x80, 0x00, 0x03, 0xBF, 0x80, 0x3F, 0xC0, 0x80, 0x00, 0x01, 0x0B, 0x80, 0x80, 0x00, 0x02,
+  0x7F, 0x00, 0x2F, 0x83, 0x00, 0x84, 0x00, 0x02, 0x1A, 0xFF, 0xE8, 0x8B, 0x00, 0x81, 0xFF, 0x00,
+  0x80, 0x89, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0xE0, 0x89, 0x00, 0x00, 0x2F, 0x81, 0xFF, 0x00,
+  0xF8, 0x89, 0x00, 0x00, 0x2F, 0x81, 0xFF, 0x00, 0xFE, 0x89, 0x00, 0x83, 0xFF, 0x88, 0x00, 0x00,
+  0x01, 0x83, 0xFF, 0x00, 0x80, 0x87, 0x00, 0x00, 0x02, 0x83, 0xFF, 0x00, 0xC0, 0x87, 0x00, 0x00,
+  0x03, 0x83, 0xFF, 0x00, 0xC0, 0x87, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x00, 0xF0, 0x87, 0x00, 0x00,
+  0x03, 0x83, 0xFF, 0x00, 0xF0, 0x80, 0x00, 0x01, 0x1A, 0xA9, 0x82, 0x00, 0x00, 0x0F, 0x84, 0xFF,
+  0x00, 0xF0, 0x80, 0x00, 0x80, 0xAA, 0x00, 0x80, 0x80, 0x00, 0x00, 0x0B, 0x85, 0xFF, 0x02, 0xF0,
+  0x00, 0x02, 0x80, 0xAA, 0x00, 0x90, 0x80, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x02, 0xF0, 0x00, 0x0A,
+  0x80, 0xAA, 0x02, 0xA0, 0x00, 0x07, 0x86, 0xFF, 0x02, 0xF0, 0x00, 0x1A, 0x80, 0xAA, 0x02, 0xA0,
+  0x00, 0x0F, 0x86, 0xFF, 0x02, 0xF0, 0x00, 0x2A, 0x80, 0xAA, 0x02, 0xA0, 0x00, 0x7F, 0x86, 0xFF,
+  0x01, 0xF0, 0x00, 0x81, 0xAA, 0x01, 0xA0, 0x00, 0x87, 0xFF, 0x01, 0xF0, 0x01, 0x81, 0xAA, 0x01,
+  0xA0, 0x07, 0x87, 0xFF, 0x01, 0xF0, 0x02, 0x81, 0xAA, 0x01, 0x90, 0x0B, 0x87, 0xFF, 0x01, 0xF0,
+  0x06, 0x81, 0xAA, 0x01, 0x80, 0x0F, 0x87, 0xFF, 0x01, 0xF0, 0x0A, 0x80, 0xAA, 0x02, 0xA9, 0x00,
+  0x3F, 0x87, 0xFF, 0x00, 0xF0, 0x83, 0x00, 0x00, 0x7F, 0x87, 0xFF, 0x00, 0xF0, 0x83, 0x00, 0x00,
+  0xBF, 0x87, 0xFF, 0x00, 0xF0, 0x83, 0x00, 0x00, 0xBF, 0x87, 0xFF, 0x00, 0xF0, 0x83, 0x00, 0x88,
+  0xFF, 0x00, 0xF0, 0x83, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x83, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x83,
+  0x00, 0x88, 0xFF, 0x00, 0xF0, 0x80, 0x00, 0x02, 0x05, 0x54, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x80,
+  0x00, 0x02, 0x2A, 0xA9, 0x00, 0x88, 0xFF, 0x02, 0xF0, 0x00, 0x01, 0x80, 0xAA, 0x00, 0x80, 0x88,
+  0xFF, 0x02, 0xF0, 0x00, 0x02, 0x80, 0xAA, 0x01, 0x90, 0xBF, 0x87, 0xFF, 0x02, 0xF0, 0x00, 0x0A,
+  0x80, 0xAA, 0x01, 0xA0, 0xBF, 0x87, 0xFF, 0x02, 0xF0, 0x00, 0x1A, 0x80, 0xAA, 0x01, 0xA0, 0x7F,
+  0x87, 0xFF, 0x02, 0xF0, 0x00, 0x6A, 0x80, 0xAA, 0x01, 0xA0, 0x3F, 0x87, 0xFF, 0x01, 0xF0, 0x01,
+  0x81, 0xAA, 0x01, 0xA0, 0x0F, 0x87, 0xFF, 0x01, 0xF0, 0x02, 0x81, 0xAA, 0x01, 0x90, 0x0B, 0x87,
+  0xFF, 0x01, 0xF0, 0x06, 0x81, 0xAA, 0x01, 0x90, 0x03, 0x87, 0xFF, 0x01, 0xF0, 0x06, 0x81, 0xAA,
+  0x80, 0x00, 0x00, 0xBF, 0x86, 0xFF, 0x04, 0xF0, 0x05, 0x55, 0x6A, 0x54, 0x80, 0x00, 0x00, 0x3F,
+  0x86, 0xFF, 0x00, 0xF0, 0x84, 0x00, 0x00, 0x0B, 0x86, 0xFF, 0x00, 0xF0, 0x84, 0x00, 0x00, 0x03,
+  0x86, 0xFF, 0x00, 0xF0, 0x85, 0x00, 0x00, 0x6F, 0x85, 0xFF, 0x00, 0xF0, 0x85, 0x00, 0x00, 0x0F,
+  0x85, 0xFF, 0x00, 0xF0, 0x85, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x00, 0xF0, 0x85, 0x00, 0x00, 0x3F,
+  0x85, 0xFF, 0x00, 0xF0, 0x85, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x00, 0xF0, 0x80, 0x00, 0x01, 0x1A,
+  0xA9, 0x81, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x00, 0xF0, 0x80, 0x00, 0x80, 0xAA, 0x00, 0x80, 0x80,
+  0x00, 0x00, 0xBF, 0x85, 0xFF, 0x02, 0xF0, 0x00, 0x02, 0x80, 0xAA, 0x00, 0x90, 0x80, 0x00, 0x00,
+  0xBF, 0x85, 0xFF, 0x02, 0xF0, 0x00, 0x0A, 0x80, 0xAA, 0x00, 0xA0, 0x80, 0x00, 0x00, 0xBF, 0x85,
+  0xFF, 0x02, 0xF0, 0x00, 0x1A, 0x80, 0xAA, 0x00, 0xA0, 0x80, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x02,
+  0xF0, 0x00, 0x2A, 0x80, 0xAA, 0x00, 0xA0, 0x80, 0x00, 0x00, 0x7F, 0x85, 0xFF, 0x01, 0xF0, 0x00,
+  0x81, 0xAA, 0x00, 0xA0, 0x80, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x01, 0xF0, 0x01, 0x81, 0xAA, 0x00,
+  0xA0, 0x80, 0x00, 0x00, 0x2F, 0x85, 0xFF, 0x01, 0xF0, 0x02, 0x81, 0xAA, 0x00, 0x90, 0x80, 0x00,
+  0x00, 0x0F, 0x85, 0xFF, 0x01, 0xF0, 0x06, 0x81, 0xAA, 0x00, 0x80, 0x80, 0x00, 0x00, 0x07, 0x85,
+  0xFF, 0x01, 0xF0, 0x0A, 0x80, 0xAA, 0x00, 0xA9, 0x81, 0x00, 0x00, 0x03, 0x85, 0xFF, 0x03, 0xF0,
+  0x00, 0x01, 0xAA, 0x83, 0x00, 0x00, 0xBF, 0x84, 0xFF, 0x00, 0xF0, 0x86, 0x00, 0x00, 0x3F, 0x84,
+  0xFF, 0x00, 0xF0, 0x86, 0x00, 0x00, 0x06, 0x84, 0xFF, 0x00, 0xF0, 0x87, 0x00, 0x02, 0x3F, 0xFF,
+  0x2F, 0x81, 0xFF, 0x00, 0xF0, 0x89, 0x00, 0x00, 0x2F, 0x81, 0xFF, 0x00, 0xF0, 0x89, 0x00, 0x00,
+  0x2F, 0x81, 0xFF, 0x00, 0xC0, 0x89, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x00, 0x80, 0x89, 0x00, 0x00,
+  0x03, 0x81, 0xFF, 0x00, 0x80, 0x89, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x00, 0xFE, 0x8B, 0x00, 0x02,
+  0x3F, 0xFF, 0xF8, 0x8B, 0x00, 0x02, 0x1B, 0xFF, 0x80, 0x84, 0x00, 0x83, 0x00, 0x00, 0x3D, 0x8E,
+  0x00, 0x00, 0x3E, 0x8E, 0x00, 0x00, 0x3E, 0x8E, 0x00, 0x00, 0x3E, 0x8E, 0x00, 0x00, 0x3E, 0x8E,
+  0x00, 0x00, 0x3E, 0x8A, 0x00, 0x01, 0x0B, 0x40, 0x80, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x01, 0x02,
+  0xE0, 0x86, 0x00, 0x01, 0x0F, 0xC0, 0x80, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x01, 0x0B, 0xF0, 0x86,
+  0x00, 0x01, 0x07, 0xF4, 0x80, 0x00, 0x00, 0x3D, 0x80, 0x00, 0x01, 0x1F, 0x80, 0x87, 0x00, 0x00,
+  0xFC, 0x80, 0x00, 0x00, 0x2C, 0x80, 0x00, 0x00, 0x3F, 0x88, 0x00, 0x01, 0x7F, 0x40, 0x81, 0x00,
+  0x01, 0x01, 0xF8, 0x88, 0x00, 0x01, 0x0F, 0xC0, 0x81, 0x00, 0x01, 0x03, 0xF0, 0x88, 0x00, 0x01,
+  0x07, 0xF0, 0x81, 0x00, 0x04, 0x0B, 0xD0, 0x15, 0x55, 0x50, 0x86, 0x00, 0x05, 0xC0, 0x03, 0xFF,
+  0xC0, 0x03, 0x00, 0x80, 0x55, 0x00, 0x54, 0x87, 0x00, 0x04, 0x2F, 0xFF, 0xF9, 0x00, 0x01, 0x81,
+  0x55, 0x87, 0x00, 0x81, 0xFF, 0x01, 0x00, 0x05, 0x81, 0x55, 0x00, 0x40, 0x85, 0x00, 0x00, 0x03,
+  0x81, 0xFF, 0x01, 0xD0, 0x15, 0x81, 0x55, 0x00, 0x50, 0x85, 0x00, 0x00, 0x0B, 0x81, 0xFF, 0x01,
+  0xF0, 0x15, 0x81, 0x55, 0x00, 0x54, 0x85, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x01, 0xF8, 0x15, 0x81,
+  0x55, 0x00, 0x54, 0x85, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x00, 0xFC, 0x82, 0x55, 0x00, 0x54, 0x85,
+  0x00, 0x00, 0x3F, 0x81, 0xFF, 0x00, 0xFC, 0x82, 0x55, 0x00, 0x54, 0x80, 0x00, 0x01, 0x01, 0x00,
+  0x80, 0xFF, 0x01, 0xF0, 0x3F, 0x81, 0xFF, 0x00, 0xFA, 0x82, 0x55, 0x00, 0x54, 0x80, 0x00, 0x01,
+  0x2A, 0xA0, 0x80, 0xFF, 0x01, 0xF0, 0x3F, 0x80, 0xFF, 0x00, 0xE9, 0x83, 0x55, 0x04, 0x54, 0x00,
+  0x01, 0xAA, 0xA9, 0x81, 0x00, 0x02, 0x3F, 0xFF, 0xFE, 0x84, 0x55, 0x04, 0x54, 0x00, 0x02, 0xAA,
+  0xA9, 0x81, 0x00, 0x02, 0x3F, 0xFF, 0xF9, 0x84, 0x55, 0x02, 0x54, 0x00, 0x1A, 0x80, 0xAA, 0x81,
+  0x00, 0x02, 0x0F, 0xFF, 0xD5, 0x84, 0x55, 0x02, 0x54, 0x00, 0x1A, 0x80, 0xAA, 0x81, 0x00, 0x01,
+  0x0B, 0xFF, 0x85, 0x55, 0x02, 0x54, 0x00, 0x6A, 0x80, 0xAA, 0x81, 0x00, 0x01, 0x0B, 0xFE, 0x85,
+  0x55, 0x01, 0x54, 0x00, 0x81, 0xAA, 0x81, 0x00, 0x01, 0x02, 0xF9, 0x85, 0x55, 0x01, 0x54, 0x02,
+  0x80, 0xAA, 0x00, 0xA9, 0x82, 0x00, 0x00, 0xB5, 0x85, 0x55, 0x01, 0x54, 0x02, 0x80, 0xAA, 0x00,
+  0xA0, 0x81, 0x00, 0x01, 0x80, 0x15, 0x85, 0x55, 0x01, 0x54, 0x01, 0x80, 0x55, 0x00, 0x50, 0x80,
+  0x00, 0x02, 0x03, 0xF0, 0x15, 0x85, 0x55, 0x00, 0x54, 0x84, 0x00, 0x02, 0x0B, 0xE0, 0x15, 0x85,
+  0x55, 0x00, 0x54, 0x84, 0x00, 0x01, 0x3F, 0x80, 0x86, 0x55, 0x00, 0x54, 0x84, 0x00, 0x01, 0xBE,
+  0x00, 0x86, 0x55, 0x00, 0x54, 0x83, 0x00, 0x02, 0x07, 0xF4, 0x00, 0x86, 0x55, 0x00, 0x54, 0x83,
+  0x00, 0x02, 0x0F, 0xC0, 0x00, 0x86, 0x55, 0x00, 0x54, 0x80, 0x00, 0x05, 0x2A, 0x90, 0x00, 0x0B,
+  0x40, 0x00, 0x86, 0x55, 0x04, 0x54, 0x00, 0x01, 0xAA, 0xA9, 0x82, 0x00, 0x00, 0x15, 0x85, 0x55,
+  0x04, 0x54, 0x00, 0x02, 0xAA, 0xA9, 0x82, 0x00, 0x00, 0x15, 0x85, 0x55, 0x02, 0x54, 0x00, 0x0A,
+  0x80, 0xAA, 0x82, 0x00, 0x00, 0x15, 0x85, 0x55, 0x02, 0x54, 0x00, 0x1A, 0x80, 0xAA, 0x82, 0x00,
+  0x00, 0x05, 0x85, 0x55, 0x02, 0x54, 0x00, 0x6A, 0x80, 0xAA, 0x82, 0x00, 0x00, 0x05, 0x85, 0x55,
+  0x01, 0x54, 0x00, 0x81, 0xAA, 0x82, 0x00, 0x00, 0x05, 0x85, 0x55, 0x01, 0x54, 0x02, 0x80, 0xAA,
+  0x00, 0xA9, 0x82, 0x00, 0x00, 0x01, 0x85, 0x55, 0x01, 0x54, 0x02, 0x80, 0xAA, 0x00, 0xA8, 0x83,
+  0x00, 0x85, 0x55, 0x01, 0x54, 0x01, 0x80, 0x55, 0x00, 0x50, 0x83, 0x00, 0x00, 0x15, 0x84, 0x55,
+  0x00, 0x54, 0x87, 0x00, 0x00, 0x01, 0x84, 0x55, 0x00, 0x54, 0x88, 0x00, 0x00, 0x15, 0x83, 0x55,
+  0x00, 0x54, 0x88, 0x00, 0x84, 0x55, 0x00, 0x54, 0x88, 0x00, 0x84, 0x55, 0x00, 0x54, 0x87, 0x00,
+  0x00, 0x01, 0x84, 0x55, 0x00, 0x54, 0x80, 0x00, 0x01, 0x15, 0x50, 0x83, 0x00, 0x00, 0x01, 0x84,
+  0x55, 0x00, 0x54, 0x80, 0x00, 0x01, 0xAA, 0xA0, 0x83, 0x00, 0x00, 0x01, 0x84, 0x55, 0x04, 0x54,
+  0x00, 0x02, 0xAA, 0xA9, 0x83, 0x00, 0x00, 0x01, 0x84, 0x55, 0x02, 0x54, 0x00, 0x02, 0x80, 0xAA,
+  0x83, 0x00, 0x00, 0x01, 0x84, 0x55, 0x02, 0x54, 0x00, 0x1A, 0x80, 0xAA, 0x83, 0x00, 0x00, 0x01,
+  0x84, 0x55, 0x02, 0x54, 0x00, 0x2A, 0x80, 0xAA, 0x84, 0x00, 0x84, 0x55, 0x02, 0x54, 0x00, 0x6A,
+  0x80, 0xAA, 0x84, 0x00, 0x00, 0x15, 0x83, 0x55, 0x01, 0x54, 0x01, 0x80, 0xAA, 0x00, 0xA9, 0x84,
+  0x00, 0x00, 0x15, 0x83, 0x55, 0x01, 0x54, 0x02, 0x80, 0xAA, 0x00, 0xA9, 0x84, 0x00, 0x00, 0x15,
+  0x83, 0x55, 0x01, 0x54, 0x02, 0x80, 0xAA, 0x00, 0xA0, 0x84, 0x00, 0x00, 0x05, 0x83, 0x55, 0x03,
+  0x54, 0x00, 0x01, 0x55, 0x86, 0x00, 0x83, 0x55, 0x00, 0x54, 0x89, 0x00, 0x00, 0x15, 0x82, 0x55,
+  0x00, 0x54, 0x8B, 0x00, 0x00, 0x05, 0x80, 0x55, 0x00, 0x54, 0x8B, 0x00, 0x00, 0x05, 0x80, 0x55,
+  0x00, 0x54, 0x8B, 0x00, 0x00, 0x05, 0x80, 0x55, 0x00, 0x54, 0x8B, 0x00, 0x00, 0x01, 0x80, 0x55,
+  0x00, 0x50, 0x8C, 0x00, 0x80, 0x55, 0x00, 0x40, 0x8C, 0x00, 0x01, 0x15, 0x55, 0x83, 0x00, 0x84,
+  0x00, 0x02, 0x1A, 0xFF, 0xE9, 0x8A, 0x00, 0x81, 0xFF, 0x00, 0xC0, 0x88, 0x00, 0x00, 0x02, 0x81,
+  0xFF, 0x00, 0xE0, 0x88, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x00, 0xFC, 0x88, 0x00, 0x00, 0x2F, 0x81,
+  0xFF, 0x00, 0xFE, 0x88, 0x00, 0x83, 0xFF, 0x00, 0x80, 0x86, 0x00, 0x00, 0x01, 0x83, 0xFF, 0x02,
+  0x80, 0x00, 0x04, 0x84, 0x00, 0x00, 0x02, 0x83, 0xFF, 0x03, 0xC0, 0x00, 0x2A, 0x40, 0x83, 0x00,
+  0x00, 0x02, 0x83, 0xFF, 0x03, 0xE0, 0x00, 0x6A, 0x80, 0x83, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x04,
+  0xF0, 0x00, 0x6A, 0x80, 0xA4, 0x82, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x04, 0xF0, 0x00, 0x2A, 0x9A,
+  0xA8, 0x81, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0x04, 0xF0, 0x00, 0x2A, 0xAA, 0xA8, 0x80, 0x00, 0x00,
+  0x0A, 0x85, 0xFF, 0x01, 0xF0, 0x1A, 0x80, 0xAA, 0x00, 0xA4, 0x80, 0x00, 0x00, 0xBF, 0x85, 0xFF,
+  0x01, 0xF0, 0x2A, 0x80, 0xAA, 0x02, 0x80, 0x00, 0x07, 0x86, 0xFF, 0x01, 0xF0, 0x6A, 0x80, 0xAA,
+  0x02, 0x40, 0x00, 0x0F, 0x86, 0xFF, 0x01, 0xF0, 0x2A, 0x80, 0xAA, 0x02, 0xA0, 0x00, 0x7F, 0x86,
+  0xFF, 0x05, 0xF0, 0x05, 0x6A, 0xAA, 0xA8, 0x00, 0x87, 0xFF, 0x05, 0xF0, 0x00, 0x2A, 0xAA, 0xA8,
+  0x07, 0x87, 0xFF, 0x05, 0xF0, 0x00, 0x6A, 0x86, 0xA8, 0x0B, 0x87, 0xFF, 0x05, 0xF0, 0x00, 0x6A,
+  0x80, 0x20, 0x0F, 0x87, 0xFF, 0x05, 0xF0, 0x00, 0x6A, 0x40, 0x00, 0x3F, 0x87, 0xFF, 0x02, 0xF0,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x7F, 0x87, 0xFF, 0x00, 0xF0, 0x82, 0x00, 0x00, 0xBF, 0x87, 0xFF,
+  0x00, 0xF0, 0x82, 0x00, 0x00, 0xBF, 0x87, 0xFF, 0x00, 0xF0, 0x82, 0x00, 0x88, 0xFF, 0x00, 0xF0,
+  0x82, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x82, 0x00, 0x88, 0xFF, 0x00, 0xF0, 0x82, 0x00, 0x88, 0xFF,
+  0x02, 0xF0, 0x00, 0x15, 0x80, 0x00, 0x88, 0xFF, 0x04, 0xF0, 0x00, 0x6A, 0x40, 0x00, 0x88, 0xFF,
+  0x04, 0xF0, 0x00, 0x6A, 0x80, 0x50, 0x88, 0xFF, 0x05, 0xF0, 0x00, 0x6A, 0x82, 0xA8, 0xBF, 0x87,
+  0xFF, 0x05, 0xF0, 0x00, 0x2A, 0x9A, 0xA8, 0xBF, 0x87, 0xFF, 0x05, 0xF0, 0x00, 0x2A, 0xAA, 0xA8,
+  0x7F, 0x87, 0xFF, 0x01, 0xF0, 0x1A, 0x80, 0xAA, 0x01, 0x94, 0x2F, 0x87, 0xFF, 0x01, 0xF0, 0x6A,
+  0x80, 0xAA, 0x01, 0x40, 0x0F, 0x87, 0xFF, 0x01, 0xF0, 0x2A, 0x80, 0xAA, 0x01, 0x80, 0x0B, 0x87,
+  0xFF, 0x05, 0xF0, 0x05, 0x6A, 0xAA, 0xA8, 0x03, 0x87, 0xFF, 0x06, 0xF0, 0x00, 0x2A, 0xAA, 0xA8,
+  0x00, 0xBF, 0x86, 0xFF, 0x06, 0xF0, 0x00, 0x6A, 0x86, 0xA8, 0x00, 0x3F, 0x86, 0xFF, 0x06, 0xF0,
+  0x00, 0x6A, 0x80, 0xA4, 0x00, 0x0B, 0x86, 0xFF, 0x03, 0xF0, 0x00, 0x6A, 0x40, 0x80, 0x00, 0x00,
+  0x03, 0x86, 0xFF, 0x02, 0xF0, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x6F, 0x85, 0xFF, 0x00, 0xF0, 0x84,
+  0x00, 0x00, 0x0F, 0x85, 0xFF, 0x00, 0xF0, 0x84, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x00, 0xF0, 0x84,
+  0x00, 0x00, 0x3F, 0x85, 0xFF, 0x00, 0xF0, 0x84, 0x00, 0x00, 0x3F, 0x85, 0xFF, 0x00, 0xF0, 0x84,
+  0x00, 0x00, 0xBF, 0x85, 0xFF, 0x00, 0xF0, 0x84, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x02, 0xF0, 0x00,
+  0x05, 0x82, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x03, 0xF0, 0x00, 0x2A, 0x40, 0x81, 0x00, 0x00, 0xBF,
+  0x85, 0xFF, 0x03, 0xF0, 0x00, 0x6A, 0x80, 0x81, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x04, 0xF0, 0x00,
+  0x6A, 0x80, 0xA4, 0x80, 0x00, 0x00, 0x7F, 0x85, 0xFF, 0x04, 0xF0, 0x00, 0x2A, 0x9A, 0xA8, 0x80,
+  0x00, 0x00, 0x3F, 0x85, 0xFF, 0x04, 0xF0, 0x00, 0x2A, 0xAA, 0xA8, 0x80, 0x00, 0x00, 0x2F, 0x85,
+  0xFF, 0x01, 0xF0, 0x1A, 0x80, 0xAA, 0x00, 0xA4, 0x80, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x01, 0xF0,
+  0x2A, 0x80, 0xAA, 0x00, 0x80, 0x80, 0x00, 0x00, 0x07, 0x85, 0xFF, 0x01, 0xF0, 0x6A, 0x80, 0xAA,
+  0x00, 0x40, 0x80, 0x00, 0x00, 0x03, 0x85, 0xFF, 0x01, 0xF0, 0x2A, 0x80, 0xAA, 0x00, 0xA0, 0x81,
+  0x00, 0x00, 0xBF, 0x84, 0xFF, 0x04, 0xF0, 0x05, 0x6A, 0xAA, 0xA8, 0x81, 0x00, 0x00, 0x0F, 0x84,
+  0xFF, 0x04, 0xF0, 0x00, 0x2A, 0xAA, 0xA8, 0x81, 0x00, 0x00, 0x06, 0x84, 0xFF, 0x04, 0xF0, 0x00,
+  0x6A, 0x85, 0xA8, 0x82, 0x00, 0x02, 0x3F, 0xFF, 0x2F, 0x81, 0xFF, 0x03, 0xF0, 0x00, 0x6A, 0x40,
+  0x85, 0x00, 0x00, 0x2F, 0x81, 0xFF, 0x03, 0xF0, 0x00, 0x6A, 0x40, 0x85, 0x00, 0x00, 0x0F, 0x81,
+  0xFF, 0x02, 0xC0, 0x00, 0x08, 0x86, 0x00, 0x00, 0x0B, 0x81, 0xFF, 0x00, 0x80, 0x88, 0x00, 0x00,
+  0x03, 0x81, 0xFF, 0x00, 0x80, 0x88, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x00, 0xFE, 0x8A, 0x00, 0x02,
+  0x3F, 0xFF, 0xFC, 0x8A, 0x00, 0x02, 0x0B, 0xFF, 0xE0, 0x83, 0x00, 0x84, 0x00, 0x02, 0x6B, 0xFF,
+  0xA4, 0x8C, 0x00, 0x00, 0x03, 0x80, 0xFF, 0x00, 0xFC, 0x8C, 0x00, 0x00, 0x0B, 0x81, 0xFF, 0x00,
+  0x80, 0x8B, 0x00, 0x00, 0x3F, 0x81, 0xFF, 0x00, 0xE0, 0x8B, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00,
+  0xF0, 0x8B, 0x00, 0x82, 0xFF, 0x00, 0xFC, 0x8A, 0x00, 0x00, 0x03, 0x82, 0xFF, 0x00, 0xFE, 0x8A,
+  0x00, 0x00, 0x0B, 0x82, 0xFF, 0x00, 0xFE, 0x8A, 0x00, 0x00, 0x0B, 0x83, 0xFF, 0x8A, 0x00, 0x00,
+  0x0B, 0x83, 0xFF, 0x89, 0x00, 0x01, 0x02, 0xAB, 0x83, 0xFF, 0x89, 0x00, 0x85, 0xFF, 0x88, 0x00,
+  0x00, 0x6F, 0x85, 0xFF, 0x87, 0x00, 0x00, 0x03, 0x86, 0xFF, 0x87, 0x00, 0x00, 0x0B, 0x86, 0xFF,
+  0x87, 0x00, 0x00, 0xBF, 0x86, 0xFF, 0x87, 0x00, 0x87, 0xFF, 0x86, 0x00, 0x00, 0x03, 0x87, 0xFF,
+  0x86, 0x00, 0x00, 0x0B, 0x87, 0xFF, 0x81, 0x00, 0x01, 0x01, 0x40, 0x81, 0x00, 0x00, 0x0F, 0x87,
+  0xFF, 0x81, 0x00, 0x01, 0x1A, 0x80, 0x81, 0x00, 0x00, 0x3F, 0x87, 0xFF, 0x80, 0x00, 0x02, 0x16,
+  0xAA, 0x80, 0x81, 0x00, 0x00, 0xBF, 0x87, 0xFF, 0x01, 0x00, 0x01, 0x80, 0xAA, 0x04, 0x80, 0x00,
+  0x02, 0x90, 0xBF, 0x87, 0xFF, 0x01, 0x01, 0x6A, 0x80, 0xAA, 0x04, 0x80, 0x05, 0x6A, 0x00, 0xBF,
+  0x87, 0xFF, 0x00, 0x02, 0x81, 0xAA, 0x03, 0x95, 0xAA, 0xA4, 0x00, 0x88, 0xFF, 0x00, 0x02, 0x83,
+  0xAA, 0x01, 0x80, 0x00, 0x88, 0xFF, 0x00, 0x02, 0x82, 0xAA, 0x00, 0xA9, 0x80, 0x00, 0x88, 0xFF,
+  0x00, 0x02, 0x82, 0xAA, 0x00, 0xA0, 0x80, 0x00, 0x88, 0xFF, 0x02, 0x02, 0xAA, 0xA6, 0x80, 0xAA,
+  0x00, 0x50, 0x80, 0x00, 0x88, 0xFF, 0x04, 0x02, 0xAA, 0x02, 0xAA, 0xA9, 0x81, 0x00, 0x88, 0xFF,
+  0x04, 0x02, 0x50, 0x02, 0xAA, 0xA4, 0x81, 0x00, 0x88, 0xFF, 0x80, 0x00, 0x02, 0x02, 0xAA, 0x80,
+  0x81, 0x00, 0x00, 0xBF, 0x87, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xA9, 0x82, 0x00, 0x00, 0xBF, 0x87,
+  0xFF, 0x80, 0x00, 0x01, 0x02, 0xA0, 0x82, 0x00, 0x00, 0x3F, 0x87, 0xFF, 0x80, 0x00, 0x01, 0x02,
+  0x50, 0x82, 0x00, 0x00, 0x3F, 0x87, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x0B, 0x87,
+  0xFF, 0x86, 0x00, 0x00, 0x0B, 0x87, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x02, 0x87,
+  0xFF, 0x02, 0x00, 0x01, 0x6A, 0x84, 0x00, 0x00, 0xBF, 0x86, 0xFF, 0x04, 0x00, 0x1A, 0xAA, 0x00,
+  0x0A, 0x82, 0x00, 0x00, 0x2F, 0x86, 0xFF, 0x00, 0x02, 0x80, 0xAA, 0x01, 0x16, 0xA5, 0x82, 0x00,
+  0x00, 0x0B, 0x86, 0xFF, 0x00, 0x02, 0x81, 0xAA, 0x00, 0x90, 0x83, 0x00, 0x00, 0xBF, 0x85, 0xFF,
+  0x00, 0x02, 0x81, 0xAA, 0x00, 0x40, 0x83, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x00, 0x02, 0x80, 0xAA,
+  0x00, 0xA8, 0x84, 0x00, 0x00, 0x2F, 0x85, 0xFF, 0x03, 0x02, 0x94, 0xAA, 0x90, 0x84, 0x00, 0x00,
+  0x7F, 0x85, 0xFF, 0x80, 0x00, 0x00, 0xAA, 0x85, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x80, 0x00, 0x00,
+  0xA0, 0x85, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x85, 0x00, 0x00, 0xBF, 0x85,
+  0xFF, 0x88, 0x00, 0x86, 0xFF, 0x88, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x88, 0x00, 0x00, 0xBF, 0x85,
+  0xFF, 0x88, 0x00, 0x00, 0xBF, 0x85, 0xFF, 0x88, 0x00, 0x00, 0x7F, 0x85, 0xFF, 0x88, 0x00, 0x00,
+  0x3F, 0x85, 0xFF, 0x88, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x88, 0x00, 0x00, 0x0B, 0x85, 0xFF, 0x88,
+  0x00, 0x00, 0x02, 0x85, 0xFF, 0x89, 0x00, 0x00, 0xBF, 0x84, 0xFF, 0x89, 0x00, 0x00, 0x2B, 0x84,
+  0xFF, 0x8A, 0x00, 0x84, 0xFF, 0x8A, 0x00, 0x02, 0x06, 0xA0, 0x7F, 0x81, 0xFF, 0x8C, 0x00, 0x00,
+  0x3F, 0x81, 0xFF, 0x8C, 0x00, 0x00, 0x2F, 0x80, 0xFF, 0x00, 0xFE, 0x8C, 0x00, 0x00, 0x0F, 0x80,
+  0xFF, 0x00, 0xFC, 0x8C, 0x00, 0x00, 0x07, 0x80, 0xFF, 0x00, 0xF8, 0x8D, 0x00, 0x80, 0xFF, 0x00,
+  0xE0, 0x8D, 0x00, 0x01, 0x6B, 0xFE, 0x87, 0x00,
+};
+
+#endif /* WEATHER_ICON_ATLAS_H */
@@ -0,0 +1,67 @@
+/* Vector weather icons: per epd_ui_weather_icon_t kind, paths on a 256 x 256 design grid
+ * (WEATHER_VEC_* streams, rasterized at any size by vector_icon_draw() in epd_ui.cpp).
+ * Generated by tools/vector_icons_to_header.py; do not edit. */
+#ifndef WEATHER_ICON_VECTORS_H
+#define WEATHER_ICON_VECTORS_H
+
+constexpr uint8_t weather_vec_clear[] = {
+  0x13, 0x20, 0x80, 0x80, 0x32, 0x21, 0xC8, 0x80, 0xF0, 0x80, 0x07, 0x21, 0xB3, 0xB3, 0xCF, 0xCF,
+  0x07, 0x21, 0x80, 0xC8, 0x80, 0xF0, 0x07, 0x21, 0x4D, 0xB3, 0x31, 0xCF, 0x07, 0x21, 0x38, 0x80,
+  0x10, 0x80, 0x07, 0x21, 0x4D, 0x4D, 0x31, 0x31, 0x07, 0x21, 0x80, 0x38, 0x80, 0x10, 0x07, 0x21,
+  0xB3, 0x4D, 0xCF, 0x31, 0x07, 0x00,
+};
+
+constexpr uint8_t weather_vec_partly_cloudy[] = {
+  0x13, 0x20, 0x5C, 0x58, 0x22, 0x21, 0x8E, 0x58, 0xA8, 0x58, 0x06, 0x21, 0x7F, 0x7B, 0x92, 0x8E,
+  0x06, 0x21, 0x5C, 0x8A, 0x5C, 0xA4, 0x06, 0x21, 0x39, 0x7B, 0x26, 0x8E, 0x06, 0x21, 0x2A, 0x58,
+  0x10, 0x58, 0x06, 0x21, 0x39, 0x35, 0x26, 0x22, 0x06, 0x21, 0x5C, 0x26, 0x5C, 0x0C, 0x06, 0x21,
+  0x7F, 0x35, 0x92, 0x22, 0x06, 0x10, 0x21, 0x5E, 0xA6, 0xCA, 0xA6, 0x1E, 0x20, 0x75, 0x98, 0x23,
+  0x20, 0x98, 0x86, 0x2C, 0x20, 0xBC, 0x99, 0x21, 0x11, 0x21, 0x5E, 0xA6, 0xCA, 0xA6, 0x16, 0x20,
+  0x75, 0x98, 0x1B, 0x20, 0x98, 0x86, 0x24, 0x20, 0xBC, 0x99, 0x19, 0x00,
+};
+
+constexpr uint8_t weather_vec_cloudy[] = {
+  0x13, 0x21, 0x76, 0x72, 0xCA, 0x72, 0x11, 0x20, 0x88, 0x67, 0x15, 0x20, 0xA3, 0x59, 0x1C, 0x20,
+  0xBF, 0x68, 0x14, 0x10, 0x21, 0x37, 0xA9, 0xA9, 0xA9, 0x1F, 0x20, 0x50, 0x9A, 0x24, 0x20, 0x74,
+  0x87, 0x2E, 0x20, 0x9A, 0x9C, 0x23, 0x11, 0x21, 0x37, 0xA9, 0xA9, 0xA9, 0x17, 0x20, 0x50, 0x9A,
+  0x1C, 0x20, 0x74, 0x87, 0x26, 0x20, 0x9A, 0x9C, 0x1B, 0x00,
+};
+
+constexpr uint8_t weather_vec_fog[] = {
+  0x13, 0x21, 0x28, 0x40, 0xC8, 0x40, 0x08, 0x21, 0x40, 0x64, 0xE0, 0x64, 0x08, 0x21, 0x18, 0x88,
+  0xA0, 0x88, 0x08, 0x21, 0xBE, 0x88, 0xE8, 0x88, 0x08, 0x21, 0x30, 0xAC, 0xD0, 0xAC, 0x08, 0x21,
+  0x50, 0xD0, 0xB0, 0xD0, 0x08, 0x00,
+};
+
+constexpr uint8_t weather_vec_rain[] = {
+  0x13, 0x21, 0x44, 0x74, 0xBC, 0x74, 0x18, 0x20, 0x5E, 0x64, 0x1E, 0x20, 0x84, 0x50, 0x28, 0x20,
+  0xAC, 0x66, 0x1C, 0x12, 0x43, 0x4C, 0xA0, 0x3F, 0xBC, 0x59, 0xBC, 0x20, 0x4C, 0xBF, 0x0E, 0x43,
+  0x80, 0xAC, 0x73, 0xC8, 0x8D, 0xC8, 0x20, 0x80, 0xCB, 0x0E, 0x43, 0xB4, 0xA0, 0xA7, 0xBC, 0xC1,
+  0xBC, 0x20, 0xB4, 0xBF, 0x0E, 0x00,
+};
+
+constexpr uint8_t weather_vec_snow[] = {
+  0x13, 0x21, 0x44, 0x74, 0xBC, 0x74, 0x18, 0x20, 0x5E, 0x64, 0x1E, 0x20, 0x84, 0x50, 0x28, 0x20,
+  0xAC, 0x66, 0x1C, 0x12, 0x21, 0x4C, 0xD2, 0x4C, 0xAA, 0x03, 0x21, 0x5D, 0xC8, 0x3B, 0xB4, 0x03,
+  0x21, 0x5D, 0xB4, 0x3B, 0xC8, 0x03, 0x21, 0x80, 0xDC, 0x80, 0xB4, 0x03, 0x21, 0x91, 0xD2, 0x6F,
+  0xBE, 0x03, 0x21, 0x91, 0xBE, 0x6F, 0xD2, 0x03, 0x21, 0xB4, 0xD2, 0xB4, 0xAA, 0x03, 0x21, 0xC5,
+  0xC8, 0xA3, 0xB4, 0x03, 0x21, 0xC5, 0xB4, 0xA3, 0xC8, 0x03, 0x00,
+};
+
+constexpr uint8_t weather_vec_thunderstorm[] = {
+  0x13, 0x21, 0x44, 0x70, 0xBC, 0x70, 0x18, 0x20, 0x5E, 0x60, 0x1E, 0x20, 0x84, 0x4C, 0x28, 0x20,
+  0xAC, 0x62, 0x1C, 0x12, 0x47, 0x7A, 0x9C, 0x98, 0x9C, 0x8A, 0xB8, 0x9C, 0xB8, 0x74, 0xF0, 0x7E,
+  0xC6, 0x6C, 0xC6, 0x00,
+};
+
+constexpr const uint8_t *weather_icon_vectors[EPD_UI_ICON_COUNT] = {
+  weather_vec_clear,
+  weather_vec_partly_cloudy,
+  weather_vec_cloudy,
+  weather_vec_fog,
+  weather_vec_rain,
+  weather_vec_snow,
+  weather_vec_thunderstorm,
+};
+
+#endif /* WEATHER_ICON_VECTORS_H */
@@ -1,113 +1,97 @@
 /**
- * Weather icons for E-ink. Each icon has its own W/H (from PNG); icons are centered in frame.
- * Frame size is 106x106. Use blit_1bit_to_4g / blit_4g_icon_to_4g with icon dimensions.
+ * Weather icons for E-ink, 106x106 frame. The icon PNGs are cut into layers (sun, cloud, drops,
+ * snowflake, bolt, fog bands, ...) that live PackBits-compressed in one atlas
+ * (weather_icon_atlas.h, generated by tools/png_to_epd_header.py); each WMO code picks a recipe
+ * of layers placed in the frame, which epd_ui.cpp composes at draw time (icon_compose).
  */
 #ifndef WEATHER_ICONS_4G_H
 #define WEATHER_ICONS_4G_H
 
 #include <stdint.h>
+#include "../epd_ui.h"  /* epd_ui_weather_icon_t */
 
-/* Frame size: icon is centered in this region on the E-ink. */
+/* Frame size: recipes place their layers in this region on the E-ink. */
 #define WEATHER_ICON_FRAME_W  106
 #define WEATHER_ICON_FRAME_H  106
-/* Max buffer size for 1-bit frame (used for centering smaller 1-bit icons). */
-#define WEATHER_ICON_BYTES    (((WEATHER_ICON_FRAME_W + 7) / 8) * WEATHER_ICON_FRAME_H)
-
-/* Icons: 0 and 45 are 1-bit only (SUN, FOG); all others use 4G. */
-#include "weather_icon_0.h"   /* 1-bit */
-#include "weather_icon_45.h"  /* 1-bit */
-#include "weather_icon_2_4g.h"
-#include "weather_icon_3_4g.h"
-#include "weather_icon_51_4g.h"
-#include "weather_icon_61_4g.h"
-#include "weather_icon_71_4g.h"
-#include "weather_icon_95_4g.h"
-
-/** True for WMO codes that have a 4G icon (only 0 and 45 use 1-bit). */
-inline int weather_icon_use_4g(int wmo_code) {
-  return (wmo_code == 2 || wmo_code == 3 || wmo_code == 51 || wmo_code == 61 || wmo_code == 71 || wmo_code == 95);
-}
+/* Max size of one decompressed 4G icon column (bytes) and of a whole 4G icon. */
+#define WEATHER_ICON_4G_COL_BYTES  ((WEATHER_ICON_FRAME_H + 3) / 4)
+#define WEATHER_ICON_4G_BYTES      (WEATHER_ICON_FRAME_W * WEATHER_ICON_4G_COL_BYTES)
 
-/** Return 4G icon width for given WMO (actual PNG width). */
-inline unsigned int weather_icon_4g_width_by_wmo(int wmo_code) {
-  switch (wmo_code) {
-    case 2:   return WEATHER_ICON_WEATHER_2_4G_W;
-    case 3:   return WEATHER_ICON_WEATHER_3_4G_W;
-    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58: case 59:
-    case 80: case 81: case 82: return WEATHER_ICON_WEATHER_51_4G_W;
-    case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: return WEATHER_ICON_WEATHER_61_4G_W;
-    case 71: case 73: case 75: case 77: case 85: case 86: return WEATHER_ICON_WEATHER_71_4G_W;
-    case 95: case 96: case 99: return WEATHER_ICON_WEATHER_95_4G_W;
-    default:  return WEATHER_ICON_FRAME_W;
-  }
-}
+/* Box size of the prescaled 4G variants: every icon fitted into this square with area
+ * averaging, for a straight copy into the forecast cards. */
+#define WEATHER_ICON_SCALED_SIZE  70
 
-/** Return 4G icon height for given WMO (actual PNG height). */
-inline unsigned int weather_icon_4g_height_by_wmo(int wmo_code) {
-  switch (wmo_code) {
-    case 2:   return WEATHER_ICON_WEATHER_2_4G_H;
-    case 3:   return WEATHER_ICON_WEATHER_3_4G_H;
-    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58: case 59:
-    case 80: case 81: case 82: return WEATHER_ICON_WEATHER_51_4G_H;
-    case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: return WEATHER_ICON_WEATHER_61_4G_H;
-    case 71: case 73: case 75: case 77: case 85: case 86: return WEATHER_ICON_WEATHER_71_4G_H;
-    case 95: case 96: case 99: return WEATHER_ICON_WEATHER_95_4G_H;
-    default:  return WEATHER_ICON_FRAME_H;
-  }
-}
+#define WEATHER_ICON_WMO_CODES    100u
+#define WEATHER_ICON_NONE         0xFFu
 
-/** Return 1-bit icon width for given WMO (only 0 and 45 have 1-bit; others use 4G). */
-inline unsigned int weather_icon_1bit_width_by_wmo(int wmo_code) {
-  switch (wmo_code) {
-    case 0: case 1: return WEATHER_ICON_WEATHER_0_W;
-    case 45: case 48: return WEATHER_ICON_WEATHER_45_W;
-    default: return WEATHER_ICON_FRAME_W;
-  }
-}
+/* Layer ops: how a layer's non-white pixels go onto the icon being composed. */
+#define WEATHER_ICON_OP_OVER  0u  /* replace the icon's pixels */
+#define WEATHER_ICON_OP_INK   1u  /* set them black (heavy rain) */
+
+/** One image in weather_icon_atlas (4G column-major 2bpp, 4 px per byte, top pixel in the MSBs):
+ *  offset of its PackBits stream and size. */
+typedef struct {
+  uint16_t offset;
+  uint8_t  w;
+  uint8_t  h;
+} weather_icon_image_t;
+
+/** One layer of a recipe: layer image (index into weather_icon_images), its top-left in the frame, op. */
+typedef struct {
+  uint8_t layer;
+  uint8_t x;
+  uint8_t y;
+  uint8_t op;
+} weather_icon_step_t;
+
+/** Steps first..first+count-1 of weather_icon_steps, drawn in order; (x, y, w, h) is the box in
+ *  the frame they cover, the size of the composed image. */
+typedef struct {
+  uint8_t first;
+  uint8_t count;
+  uint8_t x, y, w, h;
+} weather_icon_recipe_t;
+
+/** What a WMO code draws: recipe (index into weather_icon_recipes), prescaled image (index into
+ *  weather_icon_images, WEATHER_ICON_NONE if there is none) and the icon kind for the legacy API. */
+typedef struct {
+  uint8_t recipe;
+  uint8_t scaled;
+  uint8_t kind;  /* epd_ui_weather_icon_t */
+} weather_icon_desc_t;
 
-/** Return 1-bit icon height for given WMO (only 0 and 45 have 1-bit; others use 4G). */
-inline unsigned int weather_icon_1bit_height_by_wmo(int wmo_code) {
-  switch (wmo_code) {
-    case 0: case 1: return WEATHER_ICON_WEATHER_0_H;
-    case 45: case 48: return WEATHER_ICON_WEATHER_45_H;
-    default: return WEATHER_ICON_FRAME_H;
-  }
+#include "weather_icon_atlas.h"
+
+/* Vector icons (weather_icon_vectors.h, generated by tools/vector_icons_to_header.py): one byte
+ * stream per epd_ui_weather_icon_t kind on a 256 x 256 design grid, drawn at any size by
+ * vector_icon_draw() in epd_ui.cpp. Coordinates are design units, scaled to size / 256 px. */
+#define WEATHER_VEC_DESIGN   256u
+#define WEATHER_VEC_END      0x00u  /* end of the icon */
+#define WEATHER_VEC_GRAY     0x10u  /* | gray 0..3: fill level of the shapes that follow (0 = white) */
+#define WEATHER_VEC_CIRCLE   0x20u  /* cx, cy, r */
+#define WEATHER_VEC_BAR      0x21u  /* x0, y0, x1, y1, r: segment r thick on each side, round caps */
+#define WEATHER_VEC_POLY     0x40u  /* | n (3..63), then n (x, y) pairs: polygon, even-odd fill */
+#define WEATHER_VEC_POLY_MAX 63u
+/* Sub-pixel bits of the rasterizer: shapes are placed in 1/16 px and pixels are filled whose
+ * centers fall inside. */
+#define WEATHER_VEC_FRAC_BITS 4
+
+#include "weather_icon_vectors.h"
+
+/** Descriptor for a WMO code; codes outside 0..99 have no recipe and draw the cloudy vector icon. */
+inline const weather_icon_desc_t *weather_icon_desc_by_wmo(int wmo_code) {
+  static constexpr weather_icon_desc_t unknown = { WEATHER_ICON_NONE, WEATHER_ICON_NONE, EPD_UI_ICON_CLOUDY };
+  return (wmo_code >= 0 && wmo_code < (int)WEATHER_ICON_WMO_CODES) ? &weather_icon_wmo_table[wmo_code] : &unknown;
 }
 
-/**
- * Return 4-gray (2bpp) column-major icon for given WMO, or nullptr if 1-bit only.
- * PROGMEM; use blit_4g_icon_to_4g() which reads via pgm_read_byte on AVR.
- */
-inline const unsigned char* weather_icon_4g_by_wmo(int wmo_code) {
-  switch (wmo_code) {
-    case 2:   return weather_2_4g;
-    case 3:   return weather_3_4g;
-    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58: case 59:
-    case 80: case 81: case 82:  return weather_51_4g;
-    case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: return weather_61_4g;
-    case 71:
-    case 73:
-    case 75:
-    case 77:
-    case 85:
-    case 86:  return weather_71_4g;
-    case 95:
-    case 96:
-    case 99:  return weather_95_4g;
-    default:  return nullptr;
-  }
+/** Image at index i of the atlas, or nullptr for WEATHER_ICON_NONE. */
+inline const weather_icon_image_t *weather_icon_image(uint8_t i) {
+  return (i == WEATHER_ICON_NONE) ? nullptr : &weather_icon_images[i];
 }
 
-/**
- * Return 1-bit bitmap for given WMO code, or nullptr if unknown.
- * Data is PROGMEM; use memcpy_P to copy to RAM if needed, or pass to blit that reads PROGMEM.
- */
-inline const unsigned char* weather_icon_bitmap_by_wmo(int wmo_code) {
-  switch (wmo_code) {
-    case 0: case 1:   return weather_0;
-    case 45: case 48: return weather_45;
-    default:          return nullptr;
-  }
+/** Recipe at index i, or nullptr for WEATHER_ICON_NONE. */
+inline const weather_icon_recipe_t *weather_icon_recipe(uint8_t i) {
+  return (i == WEATHER_ICON_NONE) ? nullptr : &weather_icon_recipes[i];
 }
 
 #endif /* WEATHER_ICONS_4G_H */